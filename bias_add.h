@@ -0,0 +1,75 @@
+#ifndef BIAS_ADD_H
+#define BIAS_ADD_H
+
+#include <algorithm>
+#include <cmath>
+#include "uTensor/core/tensor.hpp"
+#include "uTensor/core/context.hpp"
+#include "uTensor/util/quantization_utils.hpp"
+
+/**
+ * @brief Quantized C = A + bias, with bias broadcast over the rows of A
+ * @details A is [m, n] (or any shape whose size is a multiple of n), bias
+ * is [n], C has the shape of A. Both inputs are brought to float, added and
+ * quantized into a range wide enough for any sum, [-(|A| + |bias|),
+ * |A| + |bias|]. The requantization that follows narrows it again.
+ */
+template<class T1, class T2, class TOut>
+void QuantizedBiasAdd(S_TENSOR A, S_TENSOR bias, S_TENSOR C,
+                      S_TENSOR mina, S_TENSOR maxa, S_TENSOR minb, S_TENSOR maxb,
+                      S_TENSOR outmin, S_TENSOR outmax){
+	const float min_a = *(mina->read<float>(0, 0));
+	const float max_a = *(maxa->read<float>(0, 0));
+	const float min_b = *(minb->read<float>(0, 0));
+	const float max_b = *(maxb->read<float>(0, 0));
+
+	const uint32_t n = bias->getSize();
+	const uint32_t size = A->getSize();
+	if(n == 0 || size % n != 0){
+		ERR_EXIT("bias of %lu elements on a tensor of %lu", (unsigned long) n, (unsigned long) size);
+	}
+	if(C->getSize() == 0) C->resize(A->getShape());
+
+	const float range = std::max(std::abs(min_a), std::abs(max_a)) +
+	                    std::max(std::abs(min_b), std::abs(max_b));
+	const float min_c = -range;
+	const float max_c = range;
+
+	const T1* a = A->read<T1>(0, 0);
+	const T2* b = bias->read<T2>(0, 0);
+	TOut* c = C->write<TOut>(0, 0);
+
+	for(uint32_t i = 0; i < size; i += n){
+		for(uint32_t j = 0; j < n; j++){
+			const float v = QuantizedToFloat<T1>(a[i + j], min_a, max_a) +
+			                QuantizedToFloat<T2>(b[j], min_b, max_b);
+			c[i + j] = (TOut) FloatToQuantizedUnclamped<TOut>(v, min_c, max_c);
+		}
+	}
+
+	*(outmin->write<float>(0, 0)) = min_c;
+	*(outmax->write<float>(0, 0)) = max_c;
+}
+
+/**
+ * @brief Drop-in replacement for QuantizedAddOp where the second operand is
+ * a bias, so one graph can run a batch of rows
+ *
+ * Inputs: A, min_a, max_a, bias, min_b, max_b
+ * Outputs: C, min_c, max_c
+ */
+template<class T1, class T2, class TOut>
+class QntBiasAddOp : public Operator {
+	public:
+		QntBiasAddOp() {
+			n_inputs = 6;
+			n_outputs = 3;
+		}
+		virtual void compute() override {
+			QuantizedBiasAdd<T1, T2, TOut>(inputs[0], inputs[3], outputs[0],
+				inputs[1], inputs[2], inputs[4], inputs[5],
+				outputs[1], outputs[2]);
+		}
+};
+
+#endif
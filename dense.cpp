@@ -0,0 +1,105 @@
+#include "dense.h"
+#include <algorithm>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DENSE_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define DENSE_X86_SIMD 0
+#endif
+
+// b + w_min * sum(x) + w_scale * acc, the affine part of the weights
+static inline void finish(float* yr, const float* b, int n, float offset, float scale, bool relu){
+    for(int j = 0; j < n; j++){
+        float v = b[j] + offset + scale * yr[j];
+        yr[j] = relu ? std::max(v, 0.0f) : v;
+    }
+}
+
+template<typename W>
+static void dense_ref(const float* x, int rows, int k, const W* w, float w_min, float w_scale,
+                      const float* b, int n, bool relu, float* y){
+    for(int r = 0; r < rows; r++){
+        const float* xr = x + r * k;
+        float* yr = y + r * n;
+        std::fill(yr, yr + n, 0.0f);
+        float sum = 0;
+        for(int i = 0; i < k; i++){
+            const float xv = xr[i];
+            if(xv == 0.0f) continue;
+            sum += xv;
+            const W* wr = w + i * n;
+            for(int j = 0; j < n; j++) yr[j] += xv * wr[j];
+        }
+        finish(yr, b, n, w_min * sum, w_scale, relu);
+    }
+}
+
+#if DENSE_X86_SIMD
+__attribute__((target("avx2,fma")))
+static inline __m256 load8(const float* w){
+    return _mm256_loadu_ps(w);
+}
+
+__attribute__((target("avx2,fma")))
+static inline __m256 load8(const uint8_t* w){
+    return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) w)));
+}
+
+template<typename W>
+__attribute__((target("avx2,fma")))
+static void dense_avx2(const float* x, int rows, int k, const W* w, float w_min, float w_scale,
+                       const float* b, int n, bool relu, float* y){
+    const int n8 = n & ~7;
+    for(int r = 0; r < rows; r++){
+        const float* xr = x + r * k;
+        float* yr = y + r * n;
+        std::fill(yr, yr + n, 0.0f);
+        float sum = 0;
+        for(int i = 0; i < k; i++){
+            const float xv = xr[i];
+            if(xv == 0.0f) continue;
+            sum += xv;
+            const W* wr = w + i * n;
+            const __m256 xb = _mm256_set1_ps(xv);
+            int j = 0;
+            for(; j < n8; j += 8){
+                __m256 acc = _mm256_loadu_ps(yr + j);
+                acc = _mm256_fmadd_ps(xb, load8(wr + j), acc);
+                _mm256_storeu_ps(yr + j, acc);
+            }
+            for(; j < n; j++) yr[j] += xv * wr[j];
+        }
+        finish(yr, b, n, w_min * sum, w_scale, relu);
+    }
+}
+#endif
+
+bool dense_cpu_has_simd(void){
+#if DENSE_X86_SIMD
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+    return false;
+#endif
+}
+
+#if DENSE_X86_SIMD
+static const bool use_simd = dense_cpu_has_simd();
+#endif
+
+void dense_f32(const float* x, int rows, int k, const float* w,
+               const float* b, int n, bool relu, float* y){
+#if DENSE_X86_SIMD
+    if(use_simd) return dense_avx2(x, rows, k, w, 0.0f, 1.0f, b, n, relu, y);
+#endif
+    dense_ref(x, rows, k, w, 0.0f, 1.0f, b, n, relu, y);
+}
+
+void dense_u8(const float* x, int rows, int k, const uint8_t* w, float w_min, float w_scale,
+              const float* b, int n, bool relu, float* y){
+#if DENSE_X86_SIMD
+    if(use_simd) return dense_avx2(x, rows, k, w, w_min, w_scale, b, n, relu, y);
+#endif
+    dense_ref(x, rows, k, w, w_min, w_scale, b, n, relu, y);
+}
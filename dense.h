@@ -0,0 +1,29 @@
+#ifndef DENSE_H
+#define DENSE_H
+
+#include <stdint.h>
+
+/*
+ * Dense layer kernels shared by the float backend and the plan runner:
+ *
+ *   y[r][:] = b + x[r][:] * W, optionally followed by ReLU
+ *
+ * W is k x n row-major, as the generated constants are laid out. Eight-bit
+ * weights stand for w_min + q * w_scale; they are not expanded, the affine
+ * part is applied once per output instead. Zero inputs are skipped, most
+ * canvas pixels and many activations after ReLU are blank.
+ *
+ * On x86 the kernels use AVX2/FMA when the CPU supports them, picked at
+ * runtime; everywhere else a portable loop is used.
+ */
+
+void dense_f32(const float* x, int rows, int k, const float* w,
+               const float* b, int n, bool relu, float* y);
+
+void dense_u8(const float* x, int rows, int k, const uint8_t* w, float w_min, float w_scale,
+              const float* b, int n, bool relu, float* y);
+
+// Whether this CPU runs the SIMD kernels
+bool dense_cpu_has_simd(void);
+
+#endif
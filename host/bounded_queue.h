@@ -0,0 +1,54 @@
+#ifndef HOST_BOUNDED_QUEUE_H
+#define HOST_BOUNDED_QUEUE_H
+
+#include <stddef.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+/**
+ * @brief Blocking FIFO with a fixed capacity, used between pipeline stages
+ * @details push() blocks while the queue is full and pop() while it is
+ * empty, so a slow stage throttles the ones before it. close() wakes every
+ * waiter; pop() then drains what is left and returns false once empty.
+ */
+template<typename T>
+class BoundedQueue {
+	private:
+		std::deque<T> items;
+		size_t capacity;
+		bool closed;
+		std::mutex lock;
+		std::condition_variable not_empty;
+		std::condition_variable not_full;
+
+	public:
+		explicit BoundedQueue(size_t _capacity) : capacity(_capacity), closed(false) {}
+
+		void push(T item){
+			std::unique_lock<std::mutex> guard(lock);
+			not_full.wait(guard, [this]{ return items.size() < capacity || closed; });
+			if(closed) return;
+			items.push_back(item);
+			not_empty.notify_one();
+		}
+
+		bool pop(T& item){
+			std::unique_lock<std::mutex> guard(lock);
+			not_empty.wait(guard, [this]{ return !items.empty() || closed; });
+			if(items.empty()) return false;
+			item = items.front();
+			items.pop_front();
+			not_full.notify_one();
+			return true;
+		}
+
+		void close(void){
+			std::lock_guard<std::mutex> guard(lock);
+			closed = true;
+			not_empty.notify_all();
+			not_full.notify_all();
+		}
+};
+
+#endif
@@ -0,0 +1,203 @@
+#!/usr/bin/python
+# -*- coding: utf8 -*-
+"""
+Decode the latency histogram frames the firmware sends over serial
+(format in latency.h) into per stage tables.
+
+  latency_decode.py capture.bin            # a saved serial capture
+  latency_decode.py --port /dev/ttyACM0    # live, needs pyserial
+  latency_decode.py capture.bin --total    # one table over all frames
+
+Percentiles are estimated from the log2 buckets: the upper edge of the
+bucket the percentile falls in, capped by the stage maximum. Anything that
+is not a valid frame (the demo's own printf output) is skipped, or echoed
+with --text.
+"""
+from __future__ import print_function
+import argparse
+import struct
+import sys
+
+STAGES = ["touch", "raster", "segment", "build", "eval", "lcd"]
+SYNC = b"\xa5\x5a"
+VERSION = 1
+MAX_PAYLOAD = 512 - 6   # LATENCY_FRAME_MAX less sync, length and crc
+
+
+def crc16_ccitt(data):
+  crc = 0xFFFF
+  for byte in bytearray(data):
+    crc ^= byte << 8
+    for _ in range(8):
+      crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+      crc &= 0xFFFF
+  return crc
+
+
+def read_varint(data, pos):
+  value, shift = 0, 0
+  while True:
+    byte = data[pos]
+    pos += 1
+    value |= (byte & 0x7F) << shift
+    if not byte & 0x80:
+      return value, pos
+    shift += 7
+
+
+def parse_payload(payload):
+  """Return a frame dict, or None for a version this decoder does not know."""
+  data = bytearray(payload)
+  version, pos = read_varint(data, 0)
+  if version != VERSION:
+    return None
+  seq, pos = read_varint(data, pos)
+  period_ms, pos = read_varint(data, pos)
+  n_stages, pos = read_varint(data, pos)
+  n_buckets, pos = read_varint(data, pos)
+  stages = []
+  for s in range(n_stages):
+    count, pos = read_varint(data, pos)
+    sum_us, pos = read_varint(data, pos)
+    max_us, pos = read_varint(data, pos)
+    buckets = []
+    for _ in range(n_buckets):
+      b, pos = read_varint(data, pos)
+      buckets.append(b)
+    name = STAGES[s] if s < len(STAGES) else "stage%d" % s
+    stages.append({"name": name, "count": count, "sum_us": sum_us,
+                   "max_us": max_us, "buckets": buckets})
+  return {"seq": seq, "period_ms": period_ms, "stages": stages}
+
+
+def frames(read, echo=None):
+  """Yield every valid frame from read(), resynchronising on errors."""
+  buf = b""
+  while True:
+    chunk = read()
+    if not chunk:
+      return
+    buf += chunk
+    while True:
+      start = buf.find(SYNC)
+      if start < 0:
+        keep = 1 if buf.endswith(SYNC[:1]) else 0
+        if echo and len(buf) > keep:
+          echo(buf[:len(buf) - keep])
+        buf = buf[len(buf) - keep:]
+        break
+      if echo and start > 0:
+        echo(buf[:start])
+      buf = buf[start:]
+      if len(buf) < 4:
+        break
+      length = struct.unpack("<H", buf[2:4])[0]
+      if length <= MAX_PAYLOAD and len(buf) < 4 + length + 2:
+        break
+      payload = buf[4:4 + length]
+      crc = struct.unpack("<H", buf[4 + length:6 + length])[0] if length <= MAX_PAYLOAD else None
+      frame = None
+      if crc is not None and crc == crc16_ccitt(payload):
+        try:
+          frame = parse_payload(payload)
+        except IndexError:
+          frame = None
+      if frame is None:
+        # not a frame after all, skip the sync byte and look again
+        if echo:
+          echo(buf[:1])
+        buf = buf[1:]
+        continue
+      buf = buf[6 + length:]
+      yield frame
+
+
+def bucket_upper_us(b, n_buckets):
+  return float("inf") if b == n_buckets - 1 else float(2 ** (b + 1) - 1)
+
+
+def percentile(stage, p):
+  total = sum(stage["buckets"])
+  if total == 0:
+    return 0.0
+  rank = p * total
+  seen = 0
+  for b, c in enumerate(stage["buckets"]):
+    seen += c
+    if seen >= rank:
+      return min(bucket_upper_us(b, len(stage["buckets"])), stage["max_us"])
+  return float(stage["max_us"])
+
+
+def merge(total, frame):
+  if total is None:
+    return {"seq": frame["seq"], "period_ms": frame["period_ms"],
+            "stages": [dict(s, buckets=list(s["buckets"])) for s in frame["stages"]]}
+  total["period_ms"] += frame["period_ms"]
+  for t, s in zip(total["stages"], frame["stages"]):
+    t["count"] += s["count"]
+    t["sum_us"] += s["sum_us"]
+    t["max_us"] = max(t["max_us"], s["max_us"])
+    t["buckets"] = [a + b for a, b in zip(t["buckets"], s["buckets"])]
+  return total
+
+
+def report(frame, csv, label):
+  if csv:
+    for s in frame["stages"]:
+      mean = float(s["sum_us"]) / s["count"] if s["count"] else 0.0
+      print("%s,%s,%d,%.1f,%.0f,%.0f,%.0f,%d" % (
+          label, s["name"], s["count"], mean, percentile(s, 0.5),
+          percentile(s, 0.9), percentile(s, 0.99), s["max_us"]))
+    return
+  print("frame %s, %d ms" % (label, frame["period_ms"]))
+  print("%-10s %8s %10s %10s %10s %10s %10s" % (
+      "stage", "count", "mean_us", "p50_us", "p90_us", "p99_us", "max_us"))
+  for s in frame["stages"]:
+    mean = float(s["sum_us"]) / s["count"] if s["count"] else 0.0
+    print("%-10s %8d %10.1f %10.0f %10.0f %10.0f %10d" % (
+        s["name"], s["count"], mean, percentile(s, 0.5),
+        percentile(s, 0.9), percentile(s, 0.99), s["max_us"]))
+  print()
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+  parser.add_argument("capture", nargs="?", help="saved serial output, - for stdin")
+  parser.add_argument("--port", help="read live from this serial port")
+  parser.add_argument("--baud", type=int, default=115200)
+  parser.add_argument("--total", action="store_true", help="one table over all frames")
+  parser.add_argument("--csv", action="store_true")
+  parser.add_argument("--text", action="store_true", help="echo non-frame output to stderr")
+  args = parser.parse_args()
+
+  if args.port:
+    import serial
+    port = serial.Serial(args.port, args.baud, timeout=None)
+    read = lambda: port.read(port.in_waiting or 1)
+  else:
+    if args.capture and args.capture != "-":
+      stream = open(args.capture, "rb")
+    else:
+      stream = getattr(sys.stdin, "buffer", sys.stdin)
+    read = lambda: stream.read(4096)
+
+  echo = None
+  if args.text:
+    echo = lambda b: sys.stderr.write(b.decode("ascii", "replace"))
+
+  if args.csv:
+    print("frame,stage,count,mean_us,p50_us,p90_us,p99_us,max_us")
+  total = None
+  for frame in frames(read, echo):
+    if args.total:
+      total = merge(total, frame)
+    else:
+      report(frame, args.csv, str(frame["seq"]))
+      sys.stdout.flush()
+  if args.total and total is not None:
+    report(total, args.csv, "total")
+
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,319 @@
+/*
+ * Compile the deep_mlp model into an execution plan (see plan.h).
+ *
+ *   plan_compile <out.plan> [--header out.hpp] [--quantize-above BYTES]
+ *
+ * The graph is read from the constants utensor-cli generated in
+ * models/deep_mlp_weight.hpp, so the plan is rebuilt whenever the model is
+ * regenerated. Compilation folds what get_deep_mlp_ctx() redoes on every
+ * inference:
+ *
+ *   - reshapes only change the shape and disappear
+ *   - the min/max of eight-bit weights become each layer's w_min/w_scale
+ *   - float weights larger than --quantize-above bytes are quantized here
+ *     instead of at every eval, smaller ones keep the float kernel
+ *   - bias add and ReLU are fused into the dense op
+ *   - every intermediate tensor gets a fixed arena offset; tensors whose
+ *     lifetimes do not overlap share space
+ *
+ * --header also writes the blob as a C array, for builds that keep the
+ * plan in flash.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+#include "plan.h"
+#include "models/deep_mlp_weight.hpp"
+
+typedef struct {
+    const char* name;
+    uint32_t size;          // floats per image
+    int first;              // op writing it, -1 for the input
+    int last;               // last op reading it
+    uint32_t offset;
+} tensor_desc_t;
+
+typedef struct {
+    const char* name;
+    uint8_t opcode;
+    uint8_t kernel;
+    bool relu;
+    int in;
+    int out;
+    uint32_t k;
+    uint32_t n;
+    const uint8_t* wq;      // eight-bit weights, or
+    const float* wf;        // float weights
+    float w_min;
+    float w_max;
+    const float* bias;
+    std::vector<uint8_t> folded;
+} op_desc_t;
+
+static std::vector<tensor_desc_t> tensors;
+static std::vector<op_desc_t> ops;
+
+static int add_tensor(const char* name, uint32_t size){
+    tensor_desc_t t = { name, size, -1, -1, PLAN_EXTERNAL };
+    tensors.push_back(t);
+    return tensors.size() - 1;
+}
+
+static int add_dense(const char* name, int in, uint32_t n, const uint8_t* wq, const float* wf,
+                     float w_min, float w_max, const float* bias, bool relu, const char* out_name){
+    int out = add_tensor(out_name, n);
+    op_desc_t op;
+    op.name = name;
+    op.opcode = PLAN_OP_DENSE;
+    op.kernel = PLAN_KERNEL_NONE;
+    op.relu = relu;
+    op.in = in;
+    op.out = out;
+    op.k = tensors[in].size;
+    op.n = n;
+    op.wq = wq;
+    op.wf = wf;
+    op.w_min = w_min;
+    op.w_max = w_max;
+    op.bias = bias;
+    ops.push_back(op);
+    return out;
+}
+
+static int add_argmax(const char* name, int in, const char* out_name){
+    int out = add_tensor(out_name, 1);
+    op_desc_t op;
+    op.name = name;
+    op.opcode = PLAN_OP_ARGMAX;
+    op.kernel = PLAN_KERNEL_NONE;
+    op.relu = false;
+    op.in = in;
+    op.out = out;
+    op.k = tensors[in].size;
+    op.n = 1;
+    op.wq = nullptr;
+    op.wf = nullptr;
+    op.w_min = 0;
+    op.w_max = 0;
+    op.bias = nullptr;
+    ops.push_back(op);
+    return out;
+}
+
+// The dense layers of deep_mlp.cpp, with the reshapes dropped
+static void describe_deep_mlp(int& input, int& output){
+    input = add_tensor("x:0", 784);
+    int h = add_dense("relu", input, 128, inline_Variable_quantized_const_0, nullptr,
+                      inline_Variable_quantized_min_0[0], inline_Variable_quantized_max_0[0],
+                      inline_Variable_1_0, true, "relu:0");
+    h = add_dense("relu_1", h, 64, inline_Variable_2_quantized_const_0, nullptr,
+                  inline_Variable_2_quantized_min_0[0], inline_Variable_2_quantized_max_0[0],
+                  inline_Variable_3_0, true, "relu_1:0");
+    h = add_dense("logits", h, 10, nullptr, inline_Variable_4_0, 0, 0,
+                  inline_Variable_5_0, false, "logits:0");
+    output = add_argmax("y_pred", h, "y_pred:0");
+}
+
+/*
+ * Kernel selection and constant folding. Float weights above the threshold
+ * are quantized with their own range, the way QuantizeV2Op quantizes them
+ * at runtime, to save flash. Only the weights are eight-bit: plan_run()
+ * keeps activations in float, so the plan follows the float backend, not
+ * the eight-bit graph, and its predictions can differ from the graph's.
+ */
+static void select_kernels(size_t quantize_above){
+    for(op_desc_t& op : ops){
+        if(op.opcode != PLAN_OP_DENSE) continue;
+        const size_t count = (size_t) op.k * op.n;
+        if(op.wq){
+            op.kernel = PLAN_KERNEL_DENSE_U8;
+        } else if(count * sizeof(float) > quantize_above){
+            float lo = std::min(0.0f, *std::min_element(op.wf, op.wf + count));
+            float hi = std::max(0.0f, *std::max_element(op.wf, op.wf + count));
+            if(hi == lo) hi = lo + 1.0f;
+            op.folded.resize(count);
+            for(size_t i = 0; i < count; i++){
+                op.folded[i] = (uint8_t) lrintf((op.wf[i] - lo) * 255.0f / (hi - lo));
+            }
+            op.wq = op.folded.data();
+            op.w_min = lo;
+            op.w_max = hi;
+            op.kernel = PLAN_KERNEL_DENSE_U8;
+        } else {
+            op.kernel = PLAN_KERNEL_DENSE_F32;
+        }
+    }
+}
+
+/*
+ * Arena assignment. A tensor lives from the op that writes it to the last
+ * op that reads it; the plan output lives to the end. Tensors are placed
+ * largest first at the lowest offset that does not collide with a tensor
+ * of overlapping lifetime.
+ */
+static uint32_t assign_offsets(int input, int output){
+    for(size_t i = 0; i < ops.size(); i++){
+        tensors[ops[i].out].first = i;
+        tensors[ops[i].out].last = std::max(tensors[ops[i].out].last, (int) i);
+        tensors[ops[i].in].last = std::max(tensors[ops[i].in].last, (int) i);
+    }
+    tensors[output].last = ops.size();
+
+    std::vector<int> order;
+    for(size_t i = 0; i < tensors.size(); i++){
+        if((int) i != input) order.push_back(i);
+    }
+    std::stable_sort(order.begin(), order.end(),
+        [](int a, int b){ return tensors[a].size > tensors[b].size; });
+
+    std::vector<int> placed;
+    uint32_t arena = 0;
+    for(int t : order){
+        tensor_desc_t& a = tensors[t];
+        // placed tensors that are alive at the same time, by offset
+        std::vector<int> busy;
+        for(int p : placed){
+            const tensor_desc_t& b = tensors[p];
+            if(a.first <= b.last && b.first <= a.last) busy.push_back(p);
+        }
+        std::sort(busy.begin(), busy.end(),
+            [](int x, int y){ return tensors[x].offset < tensors[y].offset; });
+        uint32_t offset = 0;
+        for(int p : busy){
+            if(offset + a.size <= tensors[p].offset) break;
+            offset = std::max(offset, tensors[p].offset + tensors[p].size);
+        }
+        a.offset = offset;
+        arena = std::max(arena, offset + a.size);
+        placed.push_back(t);
+    }
+    return arena;
+}
+
+static uint32_t append(std::vector<uint8_t>& pool, const void* data, size_t bytes){
+    uint32_t offset = pool.size();
+    pool.insert(pool.end(), (const uint8_t*) data, (const uint8_t*) data + bytes);
+    pool.resize((pool.size() + 3) & ~3u, 0);
+    return offset;
+}
+
+static std::vector<uint8_t> serialize(int input, int output, uint32_t arena){
+    std::vector<uint8_t> pool;
+    std::vector<plan_op_t> out_ops;
+    for(const op_desc_t& op : ops){
+        plan_op_t p;
+        memset(&p, 0, sizeof(p));
+        p.opcode = op.opcode;
+        p.kernel = op.kernel;
+        p.flags = op.relu ? PLAN_FLAG_RELU : 0;
+        p.in = op.in;
+        p.out = op.out;
+        p.k = op.k;
+        p.n = op.n;
+        if(op.opcode == PLAN_OP_DENSE){
+            if(op.kernel == PLAN_KERNEL_DENSE_U8){
+                p.weights = append(pool, op.wq, (size_t) op.k * op.n);
+                p.w_min = op.w_min;
+                p.w_scale = (op.w_max - op.w_min) / 255.0f;
+            } else {
+                p.weights = append(pool, op.wf, (size_t) op.k * op.n * sizeof(float));
+                p.w_scale = 1.0f;
+            }
+            p.bias = append(pool, op.bias, op.n * sizeof(float));
+        }
+        out_ops.push_back(p);
+    }
+
+    plan_header_t h;
+    memset(&h, 0, sizeof(h));
+    h.magic = PLAN_MAGIC;
+    h.version = PLAN_VERSION;
+    h.n_tensors = tensors.size();
+    h.n_ops = out_ops.size();
+    h.input = input;
+    h.output = output;
+    h.arena_floats = arena;
+    h.const_bytes = pool.size();
+    h.total_bytes = sizeof(h) + tensors.size() * sizeof(plan_tensor_t)
+                  + out_ops.size() * sizeof(plan_op_t) + pool.size();
+
+    std::vector<uint8_t> blob;
+    append(blob, &h, sizeof(h));
+    for(const tensor_desc_t& t : tensors){
+        plan_tensor_t p = { t.offset, t.size };
+        append(blob, &p, sizeof(p));
+    }
+    append(blob, out_ops.data(), out_ops.size() * sizeof(plan_op_t));
+    blob.insert(blob.end(), pool.begin(), pool.end());
+    return blob;
+}
+
+static bool write_header(const char* path, const std::vector<uint8_t>& blob){
+    FILE* f = fopen(path, "w");
+    if(!f) return false;
+    std::vector<uint32_t> words((blob.size() + 3) / 4, 0);
+    memcpy(words.data(), blob.data(), blob.size());
+    fprintf(f, "// Generated by host/plan_compile.cpp from deep_mlp_weight.hpp, do not edit\n\n");
+    fprintf(f, "#ifndef ___MODELS_DEEP_MLP_PLAN_H\n#define ___MODELS_DEEP_MLP_PLAN_H\n\n");
+    fprintf(f, "#include <stdint.h>\n\n");
+    fprintf(f, "// uint32_t words keep the blob aligned for plan_load()\n");
+    fprintf(f, "const uint32_t deep_mlp_plan_bytes = %lu;\n", (unsigned long) blob.size());
+    fprintf(f, "const uint32_t deep_mlp_plan [ %lu ] = {", (unsigned long) words.size());
+    for(size_t i = 0; i < words.size(); i++){
+        fprintf(f, "%s0x%08x,", i % 8 ? " " : "\n    ", words[i]);
+    }
+    fprintf(f, "\n};\n\n#endif // ___MODELS_DEEP_MLP_PLAN_H\n");
+    return fclose(f) == 0;
+}
+
+static const char* kernel_names[] = { "-", "dense_f32", "dense_u8" };
+
+int main(int argc, char** argv){
+    const char* path = nullptr;
+    const char* header = nullptr;
+    size_t quantize_above = 16384;
+    for(int i = 1; i < argc; i++){
+        if(!strcmp(argv[i], "--header") && i + 1 < argc) header = argv[++i];
+        else if(!strcmp(argv[i], "--quantize-above") && i + 1 < argc) quantize_above = atol(argv[++i]);
+        else path = argv[i];
+    }
+    if(!path){
+        fprintf(stderr, "usage: %s <out.plan> [--header out.hpp] [--quantize-above BYTES]\n", argv[0]);
+        return 2;
+    }
+
+    int input, output;
+    describe_deep_mlp(input, output);
+    select_kernels(quantize_above);
+    uint32_t arena = assign_offsets(input, output);
+    std::vector<uint8_t> blob = serialize(input, output, arena);
+
+    plan_t plan;
+    if(!plan_load(plan, blob.data(), blob.size())){
+        fprintf(stderr, "internal error: the compiled plan does not load\n");
+        return 1;
+    }
+
+    FILE* f = fopen(path, "wb");
+    if(!f || fwrite(blob.data(), 1, blob.size(), f) != blob.size() || fclose(f) != 0){
+        fprintf(stderr, "cannot write %s\n", path);
+        return 1;
+    }
+    if(header && !write_header(header, blob)){
+        fprintf(stderr, "cannot write %s\n", header);
+        return 1;
+    }
+
+    printf("%-8s %-10s %-10s %s\n", "op", "kernel", "in", "out");
+    for(const op_desc_t& op : ops){
+        printf("%-8s %-10s %-10s %s @%u\n", op.name, kernel_names[op.kernel],
+               tensors[op.in].name, tensors[op.out].name, tensors[op.out].offset);
+    }
+    printf("%lu bytes, %lu bytes of constants, arena %u floats per image\n",
+           (unsigned long) blob.size(), (unsigned long) plan.header->const_bytes, arena);
+    return 0;
+}
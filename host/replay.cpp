@@ -0,0 +1,296 @@
+/*
+ * Replay recorded touch traces through the demo pipeline on the host and
+ * report per stage and touch-to-prediction latency distributions.
+ *
+ *   replay <trace> [--repeat N] [--csv] [--backend quant|float|auto] [--check]
+ *          [--plan FILE] [--memtrace]
+ *
+ * Touch samples go through the same TouchRing and touch_sample_into() the
+ * board uses, the ring is drained every 5 ms of trace time like the main
+ * loop does, and the stages after a button press (draining the ring,
+ * segmentation, one batched classification of every digit) are the ones
+ * main.cpp runs. The LCD is stubbed out. Touch-to-prediction is measured
+ * from the moment the last touch sample before the button press is queued.
+ *
+ * --backend picks the eight-bit graph the firmware runs (quant, the
+ * default) or the float32 kernels (float); auto takes float when the CPU
+ * has AVX2/FMA. For the float backend "build" is the one-off weight
+ * preparation. --check also runs the other backend on every image and
+ * counts disagreeing predictions.
+ *
+ * --plan runs an execution plan written by host/plan_compile instead; its
+ * "build" is loading the file, once.
+ *
+ * --memtrace prints the heap accounting of the last eight-bit graph that
+ * ran; build with -DMBED_CONF_APP_MEMTRACE=1 for it to record anything.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "trace.h"
+#include "image.h"
+#include "pipeline.h"
+#include "touch_source.h"
+#include "models/deep_mlp_float.hpp"
+#include "plan.h"
+#include "memtrace.h"
+
+typedef std::chrono::steady_clock clk;
+
+static double us_since(clk::time_point t0){
+    return std::chrono::duration<double, std::micro>(clk::now() - t0).count();
+}
+
+enum { RASTER, SEGMENT, BUILD, EVAL, READ, LCD, E2E, NUM_STAGES };
+static const char* stage_names[NUM_STAGES] = {
+    "raster", "segment", "build", "eval", "read", "lcd", "touch_to_pred"
+};
+static std::vector<double> stage_us[NUM_STAGES];
+
+static touch_sample_t stub_sample;
+static bool stub_down = false;
+
+static bool stub_read(touch_sample_t& s){
+    if(!stub_down) return false;
+    s.x = stub_sample.x;
+    s.y = stub_sample.y;
+    return true;
+}
+
+enum backend_t { QUANT, FLOAT, PLAN };
+
+static DeepMlpFloat* float_model = nullptr;
+
+// One graph per digit like main.cpp, each stage summed over the digits
+static void classify_quant(float* batch, int n, char* digits, bool timed){
+    Context ctx;
+    clk::time_point t0 = clk::now();
+    pipeline_build(ctx, batch, n);
+    if(timed) stage_us[BUILD].push_back(us_since(t0));
+
+    t0 = clk::now();
+    ctx.eval();
+    if(timed) stage_us[EVAL].push_back(us_since(t0));
+
+    t0 = clk::now();
+    pipeline_read(ctx, digits, n);
+    if(timed) stage_us[READ].push_back(us_since(t0));
+}
+
+// Created up front for the float backend, on first use by --check
+static void classify_float(float* batch, int n, char* digits, bool timed){
+    if(!float_model) float_model = new DeepMlpFloat();
+
+    clk::time_point t0 = clk::now();
+    float logits[PIPELINE_MAX_DIGITS * DeepMlpFloat::OUTPUT];
+    float_model->eval(batch, n, logits);
+    if(timed) stage_us[EVAL].push_back(us_since(t0));
+
+    t0 = clk::now();
+    for(int i = 0; i < n; i++){
+        const float* l = logits + i * DeepMlpFloat::OUTPUT;
+        digits[i] = '0' + (std::max_element(l, l + DeepMlpFloat::OUTPUT) - l);
+    }
+    digits[n] = '\0';
+    if(timed) stage_us[READ].push_back(us_since(t0));
+}
+
+static std::vector<uint32_t> plan_blob;
+static plan_t plan;
+static std::vector<float> plan_arena;
+
+static bool load_plan(const char* path){
+    FILE* f = fopen(path, "rb");
+    if(!f){
+        fprintf(stderr, "cannot open %s\n", path);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    rewind(f);
+    plan_blob.resize((size + 3) / 4);
+    bool ok = fread(plan_blob.data(), 1, size, f) == (size_t) size && plan_load(plan, plan_blob.data(), size);
+    fclose(f);
+    if(!ok){
+        fprintf(stderr, "%s is not a plan for this build\n", path);
+        return false;
+    }
+    plan_arena.resize(plan_arena_floats(plan, PIPELINE_MAX_DIGITS));
+    return true;
+}
+
+static void classify_plan(float* batch, int n, char* digits, bool timed){
+    clk::time_point t0 = clk::now();
+    pipeline_run_plan(plan, batch, n, plan_arena.data(), digits);
+    if(timed) stage_us[EVAL].push_back(us_since(t0));
+}
+
+static double percentile(const std::vector<double>& sorted, double p){
+    if(sorted.empty()) return 0;
+    size_t idx = (size_t)(p * (sorted.size() - 1) + 0.5);
+    return sorted[idx];
+}
+
+static void report(bool csv){
+    if(csv){
+        printf("stage,count,mean_us,p50_us,p90_us,p99_us,max_us\n");
+    } else {
+        printf("%-14s %6s %10s %10s %10s %10s %10s\n",
+               "stage", "count", "mean_us", "p50_us", "p90_us", "p99_us", "max_us");
+    }
+    for(int i = 0; i < NUM_STAGES; i++){
+        std::vector<double> v = stage_us[i];
+        std::sort(v.begin(), v.end());
+        double sum = 0;
+        for(double d : v) sum += d;
+        double mean = v.empty() ? 0 : sum / v.size();
+        double max = v.empty() ? 0 : v.back();
+        printf(csv ? "%s,%u,%.1f,%.1f,%.1f,%.1f,%.1f\n"
+                   : "%-14s %6u %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+               stage_names[i], (unsigned) v.size(), mean, percentile(v, 0.5),
+               percentile(v, 0.9), percentile(v, 0.99), max);
+    }
+}
+
+static void clear(Image<float>& img){
+    for(int y = 0; y < img.get_yDim(); y++) img.fill_span(y, 0, img.get_xDim() - 1, 0);
+}
+
+int main(int argc, char** argv){
+    const char* path = nullptr;
+    int repeat = 1;
+    bool csv = false;
+    bool check = false;
+    const char* backend_arg = "quant";
+    const char* plan_path = nullptr;
+    bool memtrace = false;
+    for(int i = 1; i < argc; i++){
+        if(!strcmp(argv[i], "--repeat") && i + 1 < argc) repeat = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "--backend") && i + 1 < argc) backend_arg = argv[++i];
+        else if(!strcmp(argv[i], "--csv")) csv = true;
+        else if(!strcmp(argv[i], "--plan") && i + 1 < argc) plan_path = argv[++i];
+        else if(!strcmp(argv[i], "--check")) check = true;
+        else if(!strcmp(argv[i], "--memtrace")) memtrace = true;
+        else path = argv[i];
+    }
+    if(!path){
+        fprintf(stderr, "usage: %s <trace> [--repeat N] [--csv] [--backend quant|float|auto] [--check] [--plan FILE] [--memtrace]\n", argv[0]);
+        return 2;
+    }
+
+    backend_t backend;
+    if(!strcmp(backend_arg, "float")) backend = FLOAT;
+    else if(!strcmp(backend_arg, "auto")) backend = DeepMlpFloat::cpu_has_simd() ? FLOAT : QUANT;
+    else backend = QUANT;
+    if(plan_path){
+        clk::time_point t0 = clk::now();
+        if(!load_plan(plan_path)) return 1;
+        stage_us[BUILD].push_back(us_since(t0));
+        backend = PLAN;
+    }
+    if(backend == FLOAT){
+        clk::time_point t0 = clk::now();
+        float_model = new DeepMlpFloat();
+        stage_us[BUILD].push_back(us_since(t0));
+    }
+
+    std::vector<trace_event_t> events;
+    if(!trace_load(path, events)) return 1;
+    touch_source_set_stub(stub_read);
+
+    Image<float> canvas(240, 240);
+    static float digit_batch[PIPELINE_MAX_DIGITS * PIPELINE_DIGIT_SIZE];
+    TouchRing<64> ring;
+    touch_sample_t batch[16];
+    int guesses = 0, correct = 0, labelled = 0, disagree = 0;
+
+    for(int r = 0; r < repeat; r++){
+        clear(canvas);
+        stroke_state_t stroke = {false, 0, 0};
+        uint32_t last_drain = 0;
+        double raster = 0;
+        clk::time_point last_touch = clk::now();
+
+        for(const trace_event_t& e : events){
+            if(e.ev == 'D' || e.ev == 'U'){
+                stub_down = e.ev == 'D';
+                stub_sample.x = e.x;
+                stub_sample.y = e.y;
+                touch_sample_into(ring);
+                last_touch = clk::now();
+
+                if(e.t_us - last_drain >= 5000){
+                    clk::time_point t0 = clk::now();
+                    uint16_t n;
+                    while((n = ring.pop(batch, 16)) > 0) pipeline_draw(canvas, stroke, batch, n);
+                    raster += us_since(t0);
+                    last_drain = e.t_us;
+                }
+                continue;
+            }
+
+            // Button press: the main loop finishes the pending batch first
+            clk::time_point t0 = clk::now();
+            uint16_t n;
+            while((n = ring.pop(batch, 16)) > 0) pipeline_draw(canvas, stroke, batch, n);
+            raster += us_since(t0);
+            stage_us[RASTER].push_back(raster);
+            raster = 0;
+
+            t0 = clk::now();
+            int found = pipeline_segment(canvas, digit_batch, PIPELINE_MAX_DIGITS);
+            stage_us[SEGMENT].push_back(us_since(t0));
+
+            char result[PIPELINE_MAX_DIGITS + 1] = "?";
+            if(found > 0){
+                if(backend == PLAN) classify_plan(digit_batch, found, result, true);
+                else if(backend == FLOAT) classify_float(digit_batch, found, result, true);
+                else classify_quant(digit_batch, found, result, true);
+            }
+            stage_us[E2E].push_back(us_since(last_touch));
+
+            if(check && found > 0){
+                char other[PIPELINE_MAX_DIGITS + 1];
+                if(backend == QUANT) classify_float(digit_batch, found, other, false);
+                else classify_quant(digit_batch, found, other, false);
+                disagree += strcmp(other, result) != 0;
+            }
+
+            t0 = clk::now();
+            pipeline_show(result);
+            stage_us[LCD].push_back(us_since(t0));
+
+            guesses++;
+            if(e.label[0]){
+                labelled++;
+                correct += strcmp(result, e.label) == 0;
+            }
+            if(!csv && r == 0){
+                printf("t=%lu us guessed %s", (unsigned long) e.t_us, result);
+                if(e.label[0]) printf(" (drawn %s)", e.label);
+                printf("\n");
+            }
+
+            clear(canvas);
+            stroke.in_stroke = false;
+        }
+    }
+
+    report(csv);
+    if(!csv){
+        printf("backend %s\n", backend == QUANT ? "quant" : backend == PLAN ? "plan"
+                                : float_model->kernel_name());
+        printf("%d predictions, %d/%d labelled correct, %lu touch samples dropped\n",
+               guesses, correct, labelled, (unsigned long) ring.overflows());
+        if(check) printf("%d/%d predictions differ between backends\n", disagree, guesses);
+    }
+    if(memtrace){
+        if(MBED_CONF_APP_MEMTRACE) memtrace_report();
+        else fprintf(stderr, "--memtrace: built without -DMBED_CONF_APP_MEMTRACE=1, nothing recorded\n");
+    }
+    return check && disagree ? 1 : 0;
+}
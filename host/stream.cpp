@@ -0,0 +1,352 @@
+/*
+ * Classify a stream of images on the host with every stage on its own
+ * thread, so preprocessing of the next images overlaps inference.
+ *
+ *   stream <images.idx3-ubyte [labels.idx1-ubyte] | trace> [--repeat N]
+ *          [--frames N] [--backend quant|float] [--sequential]
+ *
+ *   decode     read the next image (MNIST idx3 file, or one canvas per
+ *              button press of a touch trace) into a frame
+ *   preprocess normalise it to the 28x28 model input
+ *   infer      get_deep_mlp_ctx and ctx.eval (the graph quantizes its own
+ *              input), or the float backend, into the frame's logits
+ *   argmax     pick the class from the logits, score it, recycle the frame
+ *
+ * Frames are allocated once up front and only their pointers travel through
+ * the bounded queues between stages; when every frame is in flight the
+ * decoder waits. --sequential runs the same stages one image at a time on
+ * a single thread for comparison.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "bounded_queue.h"
+#include "trace.h"
+#include "image.h"
+#include "segment.h"
+#include "pipeline.h"
+#include "models/deep_mlp_float.hpp"
+
+typedef std::chrono::steady_clock clk;
+
+static double us_since(clk::time_point t0){
+    return std::chrono::duration<double, std::micro>(clk::now() - t0).count();
+}
+
+typedef struct {
+    uint32_t seq;
+    int label;              // -1 when unknown
+    int result;
+    float* canvas;          // rows x cols as decoded
+    float input[PIPELINE_DIGIT_SIZE];
+    float logits[DeepMlpFloat::OUTPUT];
+} frame_t;
+
+enum { DECODE, PREPROCESS, INFER, ARGMAX, NUM_STAGES };
+static const char* stage_names[NUM_STAGES] = { "decode", "preprocess", "infer", "argmax" };
+static std::atomic<uint64_t> busy_ns[NUM_STAGES];
+
+static void account(int stage, clk::time_point t0){
+    busy_ns[stage] += std::chrono::duration_cast<std::chrono::nanoseconds>(clk::now() - t0).count();
+}
+
+/*
+ * Image sources
+ */
+
+class Source {
+	public:
+		int rows = 0;
+		int cols = 0;
+		virtual ~Source() {}
+		// Fill canvas (rows x cols) with the next image, false at the end
+		virtual bool next(float* canvas, int& label) = 0;
+};
+
+static uint32_t read_be32(FILE* f){
+    uint8_t b[4] = {0, 0, 0, 0};
+    if(fread(b, 1, 4, f) != 4) return 0;
+    return ((uint32_t) b[0] << 24) | ((uint32_t) b[1] << 16) | ((uint32_t) b[2] << 8) | b[3];
+}
+
+// MNIST idx3-ubyte images with an optional idx1-ubyte label file, read
+// repeat times over
+class IdxSource : public Source {
+	private:
+		FILE* images;
+		FILE* labels;
+		uint32_t count;
+		uint32_t done;
+		int repeat;
+		std::vector<uint8_t> raw;
+
+		static const long IMAGES_START = 16;
+		static const long LABELS_START = 8;
+
+	public:
+		IdxSource(FILE* _images, FILE* _labels, int _repeat)
+			: images(_images), labels(_labels), done(0), repeat(_repeat) {
+			read_be32(images);
+			count = read_be32(images);
+			rows = read_be32(images);
+			cols = read_be32(images);
+			raw.resize(rows * cols);
+			if(labels && (read_be32(labels) != 0x00000801 || read_be32(labels) != count)){
+				fprintf(stderr, "label file does not match the images, ignoring it\n");
+				fclose(labels);
+				labels = nullptr;
+			}
+		}
+		~IdxSource(){
+			fclose(images);
+			if(labels) fclose(labels);
+		}
+		bool next(float* canvas, int& label) override {
+			if(done == count && --repeat > 0){
+				fseek(images, IMAGES_START, SEEK_SET);
+				if(labels) fseek(labels, LABELS_START, SEEK_SET);
+				done = 0;
+			}
+			if(done == count || fread(raw.data(), 1, raw.size(), images) != raw.size()) return false;
+			for(size_t i = 0; i < raw.size(); i++) canvas[i] = raw[i];
+			label = -1;
+			uint8_t l;
+			if(labels && fread(&l, 1, 1, labels) == 1) label = l;
+			done++;
+			return true;
+		}
+};
+
+// One 240x240 canvas per button press of a touch trace
+class TraceSource : public Source {
+	private:
+		std::vector<trace_event_t> events;
+		size_t pos;
+		int repeat;
+
+	public:
+		TraceSource(const std::vector<trace_event_t>& _events, int _repeat)
+			: events(_events), pos(0), repeat(_repeat) {
+			rows = 240;
+			cols = 240;
+		}
+		bool next(float* canvas, int& label) override {
+			Image<float> img(canvas, cols, rows);
+			for(int y = 0; y < rows; y++) img.fill_span(y, 0, cols - 1, 0);
+			stroke_state_t stroke = {false, 0, 0};
+
+			while(repeat > 0){
+				if(pos == events.size()){
+					pos = 0;
+					repeat--;
+					continue;
+				}
+				const trace_event_t& e = events[pos++];
+				if(e.ev == 'I'){
+					label = strlen(e.label) == 1 ? e.label[0] - '0' : -1;
+					return true;
+				}
+				touch_sample_t s = { e.t_us, e.x, e.y, (uint8_t) (e.ev == 'D') };
+				pipeline_draw(img, stroke, &s, 1);
+			}
+			return false;
+		}
+};
+
+/*
+ * Stages, shared by the threaded and the sequential runs
+ */
+
+static bool use_float = false;
+static DeepMlpFloat* float_model = nullptr;
+
+static void preprocess(frame_t* f, int rows, int cols){
+    Image<float> canvas(f->canvas, cols, rows);
+    Image<float> input(f->input, 28, 28);
+    if(rows == 28 && cols == 28){
+        std::copy(f->canvas, f->canvas + PIPELINE_DIGIT_SIZE, f->input);
+        return;
+    }
+    std::vector<digit_box_t> boxes;
+    if(find_digits(canvas, boxes) == 0){
+        std::fill(f->input, f->input + PIPELINE_DIGIT_SIZE, 0.0f);
+        return;
+    }
+    digit_box_t all = boxes[0];
+    for(size_t i = 1; i < boxes.size(); i++) box_merge(all, boxes[i]);
+    normalise_digit(canvas, all, input);
+}
+
+static void infer(frame_t* f){
+    if(use_float){
+        float_model->eval(f->input, 1, f->logits);
+        return;
+    }
+    // Hold logits:0 so it outlives ctx.eval(), which releases it; the
+    // argmax stage picks the class from the copy in the frame
+    Context ctx;
+    pipeline_build(ctx, f->input, 1);
+    S_TENSOR logits = ctx.get({"logits:0"});
+    ctx.eval();
+    const float* l = logits->read<float>(0, 0);
+    std::copy(l, l + DeepMlpFloat::OUTPUT, f->logits);
+}
+
+typedef struct {
+    uint32_t images;
+    uint32_t labelled;
+    uint32_t correct;
+} score_t;
+
+static void argmax(frame_t* f, score_t& score){
+    f->result = std::max_element(f->logits, f->logits + DeepMlpFloat::OUTPUT) - f->logits;
+    score.images++;
+    if(f->label >= 0){
+        score.labelled++;
+        score.correct += f->result == f->label;
+    }
+}
+
+int main(int argc, char** argv){
+    std::vector<const char*> paths;
+    int repeat = 1;
+    int n_frames = 8;
+    bool sequential = false;
+    for(int i = 1; i < argc; i++){
+        if(!strcmp(argv[i], "--repeat") && i + 1 < argc) repeat = std::max(atoi(argv[++i]), 1);
+        else if(!strcmp(argv[i], "--frames") && i + 1 < argc) n_frames = std::max(atoi(argv[++i]), 1);
+        else if(!strcmp(argv[i], "--backend") && i + 1 < argc) use_float = !strcmp(argv[++i], "float");
+        else if(!strcmp(argv[i], "--sequential")) sequential = true;
+        else paths.push_back(argv[i]);
+    }
+    if(paths.empty()){
+        fprintf(stderr, "usage: %s <images.idx3-ubyte [labels.idx1-ubyte] | trace> [--repeat N] "
+                        "[--frames N] [--backend quant|float] [--sequential]\n", argv[0]);
+        return 2;
+    }
+
+    Source* source;
+    FILE* f = fopen(paths[0], "rb");
+    if(!f){
+        fprintf(stderr, "cannot open %s\n", paths[0]);
+        return 1;
+    }
+    uint32_t magic = read_be32(f);
+    rewind(f);
+    if(magic == 0x00000803){
+        source = new IdxSource(f, paths.size() > 1 ? fopen(paths[1], "rb") : nullptr, repeat);
+    } else {
+        fclose(f);
+        std::vector<trace_event_t> events;
+        if(!trace_load(paths[0], events)) return 1;
+        source = new TraceSource(events, repeat);
+    }
+    if(use_float) float_model = new DeepMlpFloat();
+
+    const int rows = source->rows;
+    const int cols = source->cols;
+    std::vector<frame_t> frames(n_frames);
+    std::vector<float> canvases((size_t) n_frames * rows * cols);
+    for(int i = 0; i < n_frames; i++) frames[i].canvas = &canvases[(size_t) i * rows * cols];
+
+    score_t score = {0, 0, 0};
+    clk::time_point start = clk::now();
+
+    if(sequential){
+        frame_t* fr = &frames[0];
+        for(uint32_t seq = 0; ; seq++){
+            clk::time_point t0 = clk::now();
+            bool more = source->next(fr->canvas, fr->label);
+            account(DECODE, t0);
+            if(!more) break;
+            fr->seq = seq;
+
+            t0 = clk::now();
+            preprocess(fr, rows, cols);
+            account(PREPROCESS, t0);
+
+            t0 = clk::now();
+            infer(fr);
+            account(INFER, t0);
+
+            t0 = clk::now();
+            argmax(fr, score);
+            account(ARGMAX, t0);
+        }
+    } else {
+        BoundedQueue<frame_t*> free_frames(n_frames);
+        BoundedQueue<frame_t*> decoded(n_frames);
+        BoundedQueue<frame_t*> ready(n_frames);
+        BoundedQueue<frame_t*> inferred(n_frames);
+        for(int i = 0; i < n_frames; i++) free_frames.push(&frames[i]);
+
+        std::thread decode_thread([&]{
+            frame_t* fr;
+            for(uint32_t seq = 0; free_frames.pop(fr); seq++){
+                clk::time_point t0 = clk::now();
+                bool more = source->next(fr->canvas, fr->label);
+                account(DECODE, t0);
+                if(!more) break;
+                fr->seq = seq;
+                decoded.push(fr);
+            }
+            decoded.close();
+        });
+        std::thread preprocess_thread([&]{
+            frame_t* fr;
+            while(decoded.pop(fr)){
+                clk::time_point t0 = clk::now();
+                preprocess(fr, rows, cols);
+                account(PREPROCESS, t0);
+                ready.push(fr);
+            }
+            ready.close();
+        });
+        std::thread infer_thread([&]{
+            frame_t* fr;
+            while(ready.pop(fr)){
+                clk::time_point t0 = clk::now();
+                infer(fr);
+                account(INFER, t0);
+                inferred.push(fr);
+            }
+            inferred.close();
+        });
+
+        // argmax runs on the main thread and hands frames back to decode
+        frame_t* fr;
+        while(inferred.pop(fr)){
+            clk::time_point t0 = clk::now();
+            argmax(fr, score);
+            account(ARGMAX, t0);
+            free_frames.push(fr);
+        }
+        free_frames.close();
+
+        decode_thread.join();
+        preprocess_thread.join();
+        infer_thread.join();
+    }
+
+    double wall = us_since(start);
+    printf("%s, %s backend, %d frames\n", sequential ? "sequential" : "pipelined",
+           use_float ? "float" : "quant", sequential ? 1 : n_frames);
+    printf("%-12s %12s %10s\n", "stage", "busy_us", "us/image");
+    for(int i = 0; i < NUM_STAGES; i++){
+        double us = busy_ns[i] / 1000.0;
+        printf("%-12s %12.0f %10.1f\n", stage_names[i], us, score.images ? us / score.images : 0.0);
+    }
+    printf("%u images in %.0f us, %.1f images/s", score.images, wall,
+           wall > 0 ? score.images * 1e6 / wall : 0.0);
+    if(score.labelled) printf(", %u/%u labelled correct", score.correct, score.labelled);
+    printf("\n");
+
+    delete source;
+    return 0;
+}
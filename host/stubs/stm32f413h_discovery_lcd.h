@@ -0,0 +1,35 @@
+#ifndef HOST_STM32F413H_DISCOVERY_LCD_H
+#define HOST_STM32F413H_DISCOVERY_LCD_H
+
+/*
+ * Host stand-in for the BSP LCD driver. Only what the pipeline calls is
+ * declared; every call is a no-op.
+ */
+
+#include <stdint.h>
+
+#define LCD_COLOR_BLACK         ((uint16_t)0x0000)
+#define LCD_COLOR_GREEN         ((uint16_t)0x07E0)
+#define LCD_COLOR_WHITE         ((uint16_t)0xFFFF)
+
+typedef struct {
+    const uint8_t* table;
+    uint16_t Width;
+    uint16_t Height;
+} sFONT;
+
+static sFONT Font24 = { nullptr, 17, 24 };
+
+typedef enum {
+    CENTER_MODE = 0x01,
+    RIGHT_MODE  = 0x02,
+    LEFT_MODE   = 0x03
+} Line_ModeTypdef;
+
+inline void BSP_LCD_Clear(uint16_t) {}
+inline void BSP_LCD_SetTextColor(uint16_t) {}
+inline void BSP_LCD_SetFont(sFONT*) {}
+inline void BSP_LCD_FillCircle(uint16_t, uint16_t, uint16_t) {}
+inline void BSP_LCD_DisplayStringAt(uint16_t, uint16_t, uint8_t*, Line_ModeTypdef) {}
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef HOST_TRACE_H
+#define HOST_TRACE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+/*
+ * Recorded touch traces, one event per line:
+ *
+ *   # comment
+ *   <t_us> D <x> <y>    finger down or moving, screen coordinates
+ *   <t_us> U            finger lifted
+ *   <t_us> I [digits]   button pressed: classify the canvas, optionally
+ *                       with the digits that were drawn, left to right
+ *
+ * Timestamps are microseconds from the start of the trace and must not
+ * decrease. Each D/U line is one tick of the 5 ms touch ticker.
+ */
+
+typedef struct {
+    uint32_t t_us;
+    char ev;           // 'D', 'U' or 'I'
+    uint16_t x;
+    uint16_t y;
+    char label[16];    // expected digits for 'I', empty when unknown
+} trace_event_t;
+
+inline bool trace_load(const char* path, std::vector<trace_event_t>& out){
+    FILE* f = fopen(path, "r");
+    if(!f){
+        fprintf(stderr, "cannot open trace %s\n", path);
+        return false;
+    }
+
+    char line[128];
+    int lineno = 0;
+    uint32_t last = 0;
+    while(fgets(line, sizeof(line), f)){
+        lineno++;
+        if(line[0] == '#' || line[0] == '\n' || line[0] == '\r') continue;
+
+        trace_event_t e = { 0, 0, 0, 0, "" };
+        unsigned long t;
+        unsigned x, y;
+        char label[16];
+        char ev;
+        int n = sscanf(line, "%lu %c", &t, &ev);
+        bool ok = n == 2;
+        if(ok && ev == 'D'){
+            ok = sscanf(line, "%lu %c %u %u", &t, &ev, &x, &y) == 4;
+            e.x = x;
+            e.y = y;
+        } else if(ok && ev == 'I'){
+            if(sscanf(line, "%lu %c %15[0-9]", &t, &ev, label) == 3) strcpy(e.label, label);
+        } else if(ok && ev != 'U'){
+            ok = false;
+        }
+        if(!ok || t < last){
+            fprintf(stderr, "%s:%d: bad trace line\n", path, lineno);
+            fclose(f);
+            return false;
+        }
+        e.t_us = t;
+        e.ev = ev;
+        last = t;
+        out.push_back(e);
+    }
+    fclose(f);
+    return true;
+}
+
+#endif
@@ -2,29 +2,87 @@
 #define IMAGE_H
 
 #include <vector>
+#include <algorithm>
+#include <cmath>
 #include "uTensor/core/tensor.hpp"
+#include "view_tensor.h"
 
 template<typename T, template<typename> class TENSOR=RamTensor>
 class Image {
 	private:
 		Tensor* data;
-		int xDim;
-		int yDim;
-		bool dimOverride = false;
+		// Cached: getShape() returns a copy of the shape vector
+		int xDim = 0;
+		int yDim = 0;
+
+		void sync_dims(void){
+			std::vector<uint32_t> shape = data->getShape();
+			xDim = shape[0];
+			yDim = shape.size() > 1 ? shape[1] : 1;
+		}
 
         void put_pixel(int x, int y){
             if(x >= 0 && x < get_xDim() && y >= 0 && y < get_yDim())
                 this->operator()(x, y) = 255;
         }
+
+        // Grow [lo, hi] by the span of row y inside the circle (xc, yc, r)
+        static void circle_row(int xc, int yc, float r, int y, float& lo, float& hi){
+            const float h = y - yc;
+            if(h*h > r*r) return;
+            const float half = std::sqrt(r*r - h*h);
+            lo = std::min(lo, xc - half);
+            hi = std::max(hi, xc + half);
+        }
+
+        // Shrink [lo, hi] to the x satisfying vmin <= a*x + c <= vmax
+        static void clip_linear(float a, float c, float vmin, float vmax, float& lo, float& hi){
+            if(a == 0){
+                if(c < vmin || c > vmax){
+                    lo = 1e9f;
+                    hi = -1e9f;
+                }
+                return;
+            }
+            float x0 = (vmin - c) / a;
+            float x1 = (vmax - c) / a;
+            if(a < 0) std::swap(x0, x1);
+            lo = std::max(lo, x0);
+            hi = std::min(hi, x1);
+        }
 	public:
 
 		Image(uint32_t x, uint32_t y){
 			data = new TENSOR<T>();
 			TensorShape tmp({x, y});
 			data->init(tmp);
+			sync_dims();
 		}
-		Image(Tensor* that): data(that){}
+		Image(Tensor* that): data(that){ sync_dims(); }
 		Image(): data(nullptr){}
+		/**
+		 * @brief Image over caller owned storage
+		 * @details buffer must hold x*y elements and outlive the image, it
+		 * is never freed by the image.
+		 */
+		Image(T* buffer, uint32_t x, uint32_t y): data(new BufferTensor<T>(buffer, {x, y})), xDim(x), yDim(y){}
+
+		// Owns its tensor: movable, not copyable
+		Image(const Image&) = delete;
+		Image& operator=(const Image&) = delete;
+		Image(Image&& that): data(that.data), xDim(that.xDim), yDim(that.yDim) {
+			that.data = nullptr;
+		}
+		Image& operator=(Image&& that){
+			if(this != &that){
+				delete data;
+				data = that.data;
+				xDim = that.xDim;
+				yDim = that.yDim;
+				that.data = nullptr;
+			}
+			return *this;
+		}
 		
 		T& operator[](int idx) { return *((T*)data->write<T>(idx, 0)); }
 		// T& operator[](int idx) { return *write(idx, 0); }
@@ -33,24 +91,14 @@ class Image {
 		const T& operator()(int x, int y) const{ return *data->read<T>(y*this->get_xDim() + x, 0); }
 
 		Tensor* get_data() { return data; }
+		// Number of pixels the underlying storage can hold
+		uint32_t get_capacity(void) const { return data->getSize(); }
 		void reshape(int x, int y){
 			xDim = x;
 			yDim = y;
-			dimOverride = true;
-		}
-		int get_xDim(void) const {
-			if(!dimOverride)
-				return data->getShape()[0];
-			else
-				return xDim;
-		}
-
-		int get_yDim(void) const {
-			if(!dimOverride)
-				return data->getShape()[1];
-			else 
-				return yDim;
 		}
+		int get_xDim(void) const { return xDim; }
+		int get_yDim(void) const { return yDim; }
         void drawline(int x0, int y0, int x1, int y1)
         {
             int dx, dy, p, x, y;
@@ -79,6 +127,20 @@ class Image {
                 x=x+1;
             }
         }
+        /**
+         * @brief Fill the pixels [x0, x1] of row y
+         * @details Clipped to the image, written with a single bulk fill
+         * instead of one virtual write per pixel.
+         */
+        void fill_span(int y, int x0, int x1, T value = 255){
+            if(y < 0 || y >= get_yDim()) return;
+            if(x0 < 0) x0 = 0;
+            if(x1 >= get_xDim()) x1 = get_xDim() - 1;
+            if(x1 < x0) return;
+            T* row = data->write<T>(y*get_xDim() + x0, x1 - x0 + 1);
+            std::fill(row, row + (x1 - x0 + 1), value);
+        }
+
         void draw_circle(int x0, int y0, int radius){
             int x = radius-1;
             int y = 0;
@@ -88,23 +150,10 @@ class Image {
 
             while (x >= y)
             {
-                /* Hole version
-                put_pixel(x0 + x, y0 + y);
-                put_pixel(x0 - x, y0 + y);
-                
-                put_pixel(x0 + y, y0 + x);
-                put_pixel(x0 - y, y0 + x);
-                
-                put_pixel(x0 - x, y0 - y);
-                put_pixel(x0 + x, y0 - y);
-                
-                put_pixel(x0 - y, y0 - x);
-                put_pixel(x0 + y, y0 - x);
-                */
-                drawline(x0 - x, y0 + y, x0 + x, y0 + y);
-                drawline(x0 - y, y0 + x, x0 + y, y0 + x);
-                drawline(x0 - x, y0 - y, x0 + x, y0 - y);
-                drawline(x0 - y, y0 - x, x0 + y, y0 - x);
+                fill_span(y0 + y, x0 - x, x0 + x);
+                fill_span(y0 + x, x0 - y, x0 + y);
+                fill_span(y0 - y, x0 - x, x0 + x);
+                fill_span(y0 - x, x0 - y, x0 + y);
 
                 if (err <= 0)
                 {
@@ -122,6 +171,45 @@ class Image {
 
         }
 
+        /**
+         * @brief Thick line with round caps between two points
+         * @details Every pixel within radius of the segment (xa,ya)-(xb,yb)
+         * is set. The shape is convex, so each row is one span: the union
+         * of the two end cap circles and the band along the segment.
+         */
+        void draw_capsule(int xa, int ya, int xb, int yb, int radius){
+            const float r = radius;
+            const float dx = xb - xa;
+            const float dy = yb - ya;
+            const float len2 = dx*dx + dy*dy;
+            const float rlen = r * std::sqrt(len2);
+
+            int yMin = std::max(std::min(ya, yb) - radius, 0);
+            int yMax = std::min(std::max(ya, yb) + radius, get_yDim() - 1);
+
+            for(int y = yMin; y <= yMax; y++){
+                float lo = 1e9f;
+                float hi = -1e9f;
+                circle_row(xa, ya, r, y, lo, hi);
+                circle_row(xb, yb, r, y, lo, hi);
+
+                if(len2 > 0){
+                    // 0 <= (P-A).d <= |d|^2 and |(P-A)x d| <= r|d|, linear in x
+                    const float wy = y - ya;
+                    float bLo = -1e9f;
+                    float bHi = 1e9f;
+                    clip_linear(dx, wy*dy - xa*dx, 0, len2, bLo, bHi);
+                    clip_linear(dy, -wy*dx - xa*dy, -rlen, rlen, bLo, bHi);
+                    if(bLo <= bHi){
+                        lo = std::min(lo, bLo);
+                        hi = std::max(hi, bHi);
+                    }
+                }
+
+                if(lo <= hi) fill_span(y, (int) std::ceil(lo), (int) std::floor(hi));
+            }
+        }
+
 		~Image(){
 			delete data;
 		}
@@ -172,6 +260,15 @@ void get_centroid(const Image<T>& img, int& xC, int& yC){
 	return;
 }
 
+template<typename T>
+void copy_region(const Image<T>& img, Image<T>& dst, int xMin, int yMin){
+	for(int i=0, ii=xMin; i < dst.get_xDim(); i++, ii++){
+		for(int j=0, jj=yMin; j < dst.get_yDim(); j++, jj++){
+			dst(i,j) = img(ii,jj);
+		}
+	}
+}
+
 /**
  * @brief Chop an image 
  * @details Get the minimum bounding box of an image
@@ -187,16 +284,29 @@ Image<T> chop(const Image<T>& img){
 	printf("Chopping image to bound = %d, %d, %d, %d\n", xMin, yMin, xMax, yMax);
 
 	Image<T> temp(xMax-xMin, yMax-yMin);
-
-	for(int i=0, ii=xMin; ii < xMax; i++, ii++){
-		for(int j=0, jj=yMin; jj < yMax; j++, jj++){
-			temp(i,j) = img(ii,jj);
-		}
-	}
+	copy_region(img, temp, xMin, yMin);
 
 	return temp;
 }
 
+/**
+ * @brief Chop an image into an existing one
+ * @details dst is reshaped to the bounding box, its storage must be large
+ * enough to hold it. Nothing is allocated.
+ *
+ * @return false if dst is too small
+ */
+template<typename T>
+bool chop_into(const Image<T>& img, Image<T>& dst){
+	int xMin, xMax, yMin, yMax;
+	get_bounding_box(img, xMin, yMin, xMax, yMax);
+	if((uint32_t) ((xMax-xMin) * (yMax-yMin)) > dst.get_capacity()) return false;
+
+	dst.reshape(xMax-xMin, yMax-yMin);
+	copy_region(img, dst, xMin, yMin);
+	return true;
+}
+
 /**
  * @brief Nearest interpolation
  * @details Stretch or shrink an image naively
@@ -210,6 +320,19 @@ Image<T> chop(const Image<T>& img){
 template<typename T>
 Image<T> resize(const Image<T>& img, int w2, int h2){
     Image<T> temp(w2,h2);
+    resize_into(img, temp);
+    return temp;
+}
+
+/**
+ * @brief Nearest interpolation into an existing image
+ * @details Scales img to the current dimensions of dst. Nothing is
+ * allocated.
+ */
+template<typename T>
+void resize_into(const Image<T>& img, Image<T>& dst){
+    int w2 = dst.get_xDim();
+    int h2 = dst.get_yDim();
     int x_ratio = (int)((img.get_xDim()<<16)/w2) +1;
     int y_ratio = (int)((img.get_yDim()<<16)/h2) +1;
     int x2, y2 ;
@@ -218,11 +341,9 @@ Image<T> resize(const Image<T>& img, int w2, int h2){
         for(int j = 0; j < w2; j++) {
             x2 = ((j*x_ratio)>>16) ;
             y2 = ((i*y_ratio)>>16) ;
-            temp[(i*w2) + j] = img[(y2*img.get_xDim()) + x2] ;
+            dst[(i*w2) + j] = img[(y2*img.get_xDim()) + x2] ;
         }                
     }                
-    return temp;
-
 }
 
 
@@ -237,21 +358,35 @@ Image<T> resize(const Image<T>& img, int w2, int h2){
 template<typename T>
 Image<T> pad(const Image<T>& img, int padX, int padY){
 	Image<T> temp(img.get_xDim() + 2*padX, img.get_yDim() + 2*padY);
+	pad_into(img, temp, padX, padY);
+    return temp;
+
+}
+
+/**
+ * @brief Zero pad into an existing image
+ * @details dst is reshaped to the padded size, its storage must be large
+ * enough to hold it. Nothing is allocated.
+ *
+ * @return false if dst is too small
+ */
+template<typename T>
+bool pad_into(const Image<T>& img, Image<T>& dst, int padX, int padY){
+	int w = img.get_xDim() + 2*padX;
+	int h = img.get_yDim() + 2*padY;
+	if((uint32_t) (w * h) > dst.get_capacity()) return false;
+	dst.reshape(w, h);
 
 	// Init to zero
-	for(int i = 0; i < temp.get_xDim(); i++){
-		for(int j = 0; j < temp.get_yDim(); j++){
-			temp(i,j) = 0;
-		}
+	for(int j = 0; j < h; j++){
+		dst.fill_span(j, 0, w - 1, 0);
 	}
 	for(int i = 0, ii = padX; i < img.get_xDim(); ii++, i++){
 		for(int j = 0, jj = padY; j < img.get_yDim(); jj++, j++){
-			temp(ii,jj) = img(i,j);
+			dst(ii,jj) = img(i,j);
 		}
 	}
-
-    return temp;
-
+	return true;
 }
 
 #endif
@@ -0,0 +1,82 @@
+#include "latency.h"
+#include <string.h>
+
+#ifdef __MBED__
+#include "platform/mbed_critical.h"
+#define LATENCY_LOCK()   core_util_critical_section_enter()
+#define LATENCY_UNLOCK() core_util_critical_section_exit()
+#else
+#define LATENCY_LOCK()
+#define LATENCY_UNLOCK()
+#endif
+
+static latency_hist_t hists[LATENCY_NUM_STAGES];
+static uint32_t frame_seq = 0;
+
+static inline uint8_t bucket_of(uint32_t us){
+    if(us < 2) return 0;
+    uint8_t b = 31 - __builtin_clz(us);
+    return b < LATENCY_BUCKETS ? b : LATENCY_BUCKETS - 1;
+}
+
+void latency_record(latency_stage_t stage, uint32_t us){
+    latency_hist_t& h = hists[stage];
+    uint16_t& bucket = h.buckets[bucket_of(us)];
+    if(bucket != 0xFFFF) bucket++;
+    h.count++;
+    h.sum_us += us;
+    if(us > h.max_us) h.max_us = us;
+}
+
+static uint8_t* put_varint(uint8_t* p, uint64_t v){
+    while(v >= 0x80){
+        *p++ = (uint8_t) (v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (uint8_t) v;
+    return p;
+}
+
+static uint16_t crc16_ccitt(const uint8_t* p, size_t n){
+    uint16_t crc = 0xFFFF;
+    for(size_t i = 0; i < n; i++){
+        crc ^= (uint16_t) p[i] << 8;
+        for(int b = 0; b < 8; b++){
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+size_t latency_frame(uint8_t* buf, uint32_t period_ms){
+    // The touch stage is updated from an interrupt, take a consistent copy
+    latency_hist_t snap[LATENCY_NUM_STAGES];
+    LATENCY_LOCK();
+    memcpy(snap, hists, sizeof(hists));
+    memset(hists, 0, sizeof(hists));
+    LATENCY_UNLOCK();
+
+    uint8_t* payload = buf + 4;
+    uint8_t* p = payload;
+    p = put_varint(p, LATENCY_VERSION);
+    p = put_varint(p, frame_seq++);
+    p = put_varint(p, period_ms);
+    p = put_varint(p, LATENCY_NUM_STAGES);
+    p = put_varint(p, LATENCY_BUCKETS);
+    for(int s = 0; s < LATENCY_NUM_STAGES; s++){
+        p = put_varint(p, snap[s].count);
+        p = put_varint(p, snap[s].sum_us);
+        p = put_varint(p, snap[s].max_us);
+        for(int b = 0; b < LATENCY_BUCKETS; b++) p = put_varint(p, snap[s].buckets[b]);
+    }
+
+    const uint16_t length = p - payload;
+    const uint16_t crc = crc16_ccitt(payload, length);
+    buf[0] = 0xA5;
+    buf[1] = 0x5A;
+    buf[2] = length & 0xFF;
+    buf[3] = length >> 8;
+    *p++ = crc & 0xFF;
+    *p++ = crc >> 8;
+    return p - buf;
+}
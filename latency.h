@@ -0,0 +1,81 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Always-on latency histograms for the stages of the demo.
+ *
+ * Each stage keeps a count, the sum and the maximum, and counts in
+ * log2 buckets: bucket 0 holds 0-1 us, bucket b holds [2^b, 2^(b+1)) us
+ * and the last bucket everything from 2^(LATENCY_BUCKETS-1) us up. Recording
+ * is a handful of integer operations into static storage, cheap enough for
+ * the touch ticker's interrupt.
+ *
+ * latency_emit() sends the histograms gathered since the previous frame as
+ * one binary frame and starts over; host/latency_decode.py turns the frames
+ * back into tables. The period is "latency-period-ms" in mbed_app.json, 0
+ * turns the frames off.
+ *
+ * Frame, all integers unsigned LEB128 varints unless noted:
+ *
+ *   0xA5 0x5A                  sync
+ *   length                     uint16 little-endian, bytes of the payload
+ *   payload:
+ *     version, seq, period_ms, n_stages, n_buckets
+ *     per stage: count, sum_us, max_us, n_buckets bucket counts
+ *   crc                        uint16 little-endian, CRC-16/CCITT of the payload
+ */
+
+#ifndef MBED_CONF_APP_LATENCY_PERIOD_MS
+#define MBED_CONF_APP_LATENCY_PERIOD_MS 10000
+#endif
+
+#define LATENCY_BUCKETS 20
+#define LATENCY_VERSION 1
+#define LATENCY_FRAME_MAX 512
+
+enum latency_stage_t {
+    LATENCY_TOUCH,      // one touch controller poll, in the ticker
+    LATENCY_RASTER,     // pipeline_draw() of one batch of samples
+    LATENCY_SEGMENT,    // finding the digits and resizing them to 28x28
+    LATENCY_BUILD,      // get_deep_mlp_ctx()
+    LATENCY_EVAL,       // ctx.eval(), or plan_run()
+    LATENCY_LCD,        // showing the result
+    LATENCY_NUM_STAGES
+};
+
+typedef struct {
+    uint32_t count;
+    uint32_t max_us;
+    uint64_t sum_us;
+    uint16_t buckets[LATENCY_BUCKETS];  // saturate at 65535 within a period
+} latency_hist_t;
+
+/**
+ * @brief Add one duration to a stage
+ * @details Each stage must be recorded from a single context; the touch
+ * stage is the only one recorded from an interrupt.
+ */
+void latency_record(latency_stage_t stage, uint32_t us);
+
+/**
+ * @brief Encode the histograms into buf and reset them
+ * @param buf at least LATENCY_FRAME_MAX bytes
+ * @param period_ms time covered by the frame
+ * @return frame length in bytes
+ */
+size_t latency_frame(uint8_t* buf, uint32_t period_ms);
+
+/**
+ * @brief Write a frame to a Serial-like stream with putc()
+ */
+template<typename OUT>
+void latency_emit(OUT& out, uint32_t period_ms){
+    uint8_t buf[LATENCY_FRAME_MAX];
+    size_t n = latency_frame(buf, period_ms);
+    for(size_t i = 0; i < n; i++) out.putc(buf[i]);
+}
+
+#endif
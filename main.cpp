@@ -5,6 +5,18 @@
 #include "tensor.hpp"
 #include "image.h"
 #include "models/deep_mlp.hpp"
+#include "memtrace.h"
+#include "touch_source.h"
+#include "pipeline.h"
+#include "latency.h"
+
+#ifndef MBED_CONF_APP_PLAN
+#define MBED_CONF_APP_PLAN 0
+#endif
+
+#if MBED_CONF_APP_PLAN
+#include "models/deep_mlp_plan.hpp"
+#endif
 
 Serial pc(USBTX, USBRX, 115200);
 
@@ -14,7 +26,30 @@ Serial pc(USBTX, USBRX, 115200);
 
 InterruptIn button(USER_BUTTON);
 
-TS_StateTypeDef  TS_State = {0};
+// Filled by touch_tick() in interrupt context, drained by the main loop
+TouchRing<64> touch_ring;
+Ticker touch_ticker;
+
+void touch_tick(void){
+    uint32_t t0 = touch_source_now_us();
+    touch_sample_into(touch_ring);
+    latency_record(LATENCY_TOUCH, touch_source_now_us() - t0);
+}
+
+// Send the stage histograms every latency-period-ms, and before exiting
+static uint32_t latency_last_us = 0;
+
+void latency_tick(bool force){
+    uint32_t now = touch_source_now_us();
+    uint32_t elapsed_ms = (now - latency_last_us) / 1000;
+    if(MBED_CONF_APP_LATENCY_PERIOD_MS && (force || elapsed_ms >= MBED_CONF_APP_LATENCY_PERIOD_MS)){
+        latency_emit(pc, elapsed_ms);
+        latency_last_us = now;
+    }
+}
+
+// Every digit found on the canvas, normalised to 28x28, classified as one batch
+static float digit_batch[PIPELINE_MAX_DIGITS * PIPELINE_DIGIT_SIZE];
 
 volatile bool trigger_inference = false;
 
@@ -42,10 +77,10 @@ void printImage(const Image<T>& img){
 
 int main()
 {
-    uint16_t x1, y1;
+    stroke_state_t stroke = {false, 0, 0};
     printf("uTensor deep learning character recognition demo\n");
     printf("https://github.com/uTensor/utensor-mnist-demo\n");
-    printf("Draw a number (0-9) on the touch screen, and press the button...\r\n");
+    printf("Draw one or more digits (0-9) side by side on the touch screen, and press the button...\r\n");
 
 
     Image<float>* img = new Image<float>(240, 240);
@@ -57,61 +92,81 @@ int main()
     if (BSP_TS_Init(BSP_LCD_GetXSize(), BSP_LCD_GetYSize()) == TS_ERROR) {
         printf("BSP_TS_Init error\n");
     }
+    latency_last_us = touch_source_now_us();
+    touch_ticker.attach_us(&touch_tick, 5000);
 
     /* Clear the LCD */
     BSP_LCD_Clear(LCD_COLOR_WHITE);
 
-    Context ctx;
     clear(*img);
 
+#if MBED_CONF_APP_PLAN
+    // Everything the graph would build at inference time is in the plan
+    plan_t plan;
+    if(!plan_load(plan, deep_mlp_plan, deep_mlp_plan_bytes)){
+        pc.printf("Execution plan does not load, rebuild it with host/plan_compile\n\r");
+        exit(1);
+    }
+    float* plan_arena = new float[plan_arena_floats(plan, PIPELINE_MAX_DIGITS)];
+#endif
+
+
+    touch_sample_t batch[16];
 
     while (1) {
-        BSP_TS_GetState(&TS_State);
         if(trigger_inference){
-          
-            Image<float> smallImage = resize(*img, 28, 28);
-
-            pc.printf("Done padding\n\n");
+            // Finish the samples still queued, the end of the last stroke
+            uint32_t t0 = touch_source_now_us();
+            uint16_t pending;
+            while((pending = touch_ring.pop(batch, 16)) > 0){
+                pipeline_draw(*img, stroke, batch, pending);
+            }
+            latency_record(LATENCY_RASTER, touch_source_now_us() - t0);
+            pc.printf("Touch samples dropped: %lu\n\r", (unsigned long) touch_ring.overflows());
+
+            t0 = touch_source_now_us();
+            int n = pipeline_segment(*img, digit_batch, PIPELINE_MAX_DIGITS);
+            latency_record(LATENCY_SEGMENT, touch_source_now_us() - t0);
+            pc.printf("Found %d digits\n\r", n);
             delete img;
 
-            pc.printf("Reshaping\n\r");
-            smallImage.get_data()->resize({1, 784});
-            pc.printf("Creating Graph\n\r");
-
-            get_deep_mlp_ctx(ctx, smallImage.get_data());
-            pc.printf("Evaluating\n\r");
-            ctx.eval();
-            S_TENSOR prediction = ctx.get({"y_pred:0"});
-            int result = *(prediction->read<int>(0,0));
-
-            printf("Number guessed %d\n\r", result);
-
-            BSP_LCD_Clear(LCD_COLOR_WHITE);
-            BSP_LCD_SetTextColor(LCD_COLOR_BLACK);
-            BSP_LCD_SetFont(&Font24);
+            char digits[PIPELINE_MAX_DIGITS + 1] = "?";
+#if MBED_CONF_APP_PLAN
+            if(n > 0){
+                t0 = touch_source_now_us();
+                pipeline_run_plan(plan, digit_batch, n, plan_arena, digits);
+                latency_record(LATENCY_EVAL, touch_source_now_us() - t0);
+            }
+#else
+            if(n > 0){
+                Context ctx;
+                t0 = touch_source_now_us();
+                pipeline_build(ctx, digit_batch, n);
+                latency_record(LATENCY_BUILD, touch_source_now_us() - t0);
+                t0 = touch_source_now_us();
+                ctx.eval();
+                latency_record(LATENCY_EVAL, touch_source_now_us() - t0);
+                pipeline_read(ctx, digits, n);
+                memtrace_dump(pc);
+            }
+#endif
 
-            // Create a cstring
-            uint8_t number[2];
-            number[1] = '\0';
-            //ASCII numbers are 48 + the number, a neat trick
-            number[0] = 48 + result;
-            BSP_LCD_DisplayStringAt(0, 120, number, CENTER_MODE);
+            printf("Number guessed %s\n\r", digits);
+            t0 = touch_source_now_us();
+            pipeline_show(digits);
+            latency_record(LATENCY_LCD, touch_source_now_us() - t0);
+            latency_tick(true);
             trigger_inference = false;
             exit(0);
         }
-        if(TS_State.touchDetected) {
-            /* One or dual touch have been detected          */
-
-            /* Get X and Y position of the first touch post calibrated */
-            x1 = TS_State.touchX[0];
-            y1 = TS_State.touchY[0];
-
-            img->draw_circle(x1, y1, 7); //Screen not in image x,y format. Must transpose
-
-            BSP_LCD_SetTextColor(LCD_COLOR_GREEN);
-            BSP_LCD_FillCircle(x1, y1, 5);
-
+        uint16_t n = touch_ring.pop(batch, 16);
+        if(n > 0){
+            uint32_t t0 = touch_source_now_us();
+            pipeline_draw(*img, stroke, batch, n);
+            latency_record(LATENCY_RASTER, touch_source_now_us() - t0);
+        } else {
             wait_ms(5);
         }
+        latency_tick(false);
     }
 }
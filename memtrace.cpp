@@ -0,0 +1,162 @@
+#include "memtrace.h"
+
+#if MBED_CONF_APP_MEMTRACE
+
+#include <stdio.h>
+#include <memory>
+
+#if defined(__MBED__)
+#include "mbed_stats.h"
+#elif defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+static memtrace_tensor_t tensors[MEMTRACE_MAX_TENSORS];
+static std::weak_ptr<Tensor> refs[MEMTRACE_MAX_TENSORS];
+static memtrace_step_t steps[MEMTRACE_MAX_STEPS];
+static uint16_t n_tensors = 0;
+static uint16_t n_steps = 0;
+static uint32_t current = 0;
+static uint32_t peak = 0;
+static uint16_t peak_step = 0;
+static uint32_t heap_peak = 0;
+
+static uint32_t heap_in_use(void){
+#if defined(__MBED__) && defined(MBED_HEAP_STATS_ENABLED) && MBED_HEAP_STATS_ENABLED
+    mbed_stats_heap_t stats;
+    mbed_stats_heap_get(&stats);
+    return stats.current_size;
+#elif !defined(__MBED__) && defined(__GLIBC__)
+#if __GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33)
+    return mallinfo2().uordblks;
+#else
+    return mallinfo().uordblks;
+#endif
+#else
+    return 0;
+#endif
+}
+
+static void track(Context& ctx, const char* name, const char* op, bool flash){
+    if(n_tensors >= MEMTRACE_MAX_TENSORS) return;
+    S_TENSOR t = ctx.get(name);
+    memtrace_tensor_t& rec = tensors[n_tensors];
+    rec.name = name;
+    rec.op = op;
+    rec.bytes = t->getSize_in_bytes();
+    rec.born = n_steps;
+    rec.died = MEMTRACE_ALIVE;
+    rec.flash = flash;
+    refs[n_tensors] = t;
+    n_tensors++;
+}
+
+// Walk every tensor still held, mark the ones the Context released and
+// refresh the sizes of the ones that were resized by an op.
+static uint32_t sweep(uint16_t step){
+    uint32_t live = 0;
+    for(uint16_t i = 0; i < n_tensors; i++){
+        memtrace_tensor_t& rec = tensors[i];
+        if(rec.died != MEMTRACE_ALIVE) continue;
+        S_TENSOR t = refs[i].lock();
+        if(!t){
+            rec.died = step;
+            continue;
+        }
+        rec.bytes = t->getSize_in_bytes();
+        if(!rec.flash) live += rec.bytes;
+    }
+    return live;
+}
+
+void memtrace_reset(void){
+    for(uint16_t i = 0; i < n_tensors; i++) refs[i].reset();
+    n_tensors = 0;
+    n_steps = 0;
+    current = 0;
+    peak = 0;
+    peak_step = 0;
+    heap_peak = 0;
+}
+
+static void step(const char* op){
+    current = sweep(n_steps);
+    memtrace_step_t& s = steps[n_steps];
+    s.op = op;
+    s.tracked = current;
+    s.heap = heap_in_use();
+    // Largest sample since memtrace_reset(). mbed's max_size would also
+    // catch allocations freed inside an op, but it covers everything since
+    // boot, the canvas included, and cannot be reset.
+    if(s.heap > heap_peak) heap_peak = s.heap;
+    if(current >= peak){
+        peak = current;
+        peak_step = n_steps;
+    }
+    n_steps++;
+}
+
+void memtrace_op(Context& ctx, const char* op, std::initializer_list<const char*> outputs){
+    if(n_steps >= MEMTRACE_MAX_STEPS) return;
+    for(const char* name : outputs) track(ctx, name, op, false);
+    step(op);
+}
+
+void memtrace_view(Context& ctx, const char* op, const char* name){
+    if(n_steps >= MEMTRACE_MAX_STEPS) return;
+    track(ctx, name, op, true);
+    step(op);
+}
+
+void memtrace_const(Context& ctx, const char* name){
+    track(ctx, name, "Const", true);
+}
+
+uint32_t memtrace_current(void) { return current; }
+uint32_t memtrace_peak(void) { return peak; }
+uint16_t memtrace_peak_step(void) { return peak_step; }
+uint32_t memtrace_heap_peak(void) { return heap_peak; }
+uint16_t memtrace_num_steps(void) { return n_steps; }
+uint16_t memtrace_num_tensors(void) { return n_tensors; }
+const memtrace_step_t* memtrace_get_step(uint16_t idx) { return &steps[idx]; }
+const memtrace_tensor_t* memtrace_get_tensor(uint16_t idx) { return &tensors[idx]; }
+
+void memtrace_report(void){
+    printf("memtrace: %u steps, %u tensors, peak %lu bytes at step %u (%s), heap peak %lu bytes\n",
+           n_steps, n_tensors, (unsigned long) peak, peak_step,
+           n_steps ? steps[peak_step].op : "-", (unsigned long) heap_peak);
+
+    printf("%5s %10s %10s  %s\n", "step", "tracked", "heap", "op");
+    for(uint16_t i = 0; i < n_steps; i++){
+        printf("%5u %10lu %10lu  %s\n", i, (unsigned long) steps[i].tracked,
+               (unsigned long) steps[i].heap, steps[i].op);
+    }
+
+    // Live heap tensors at the peak, largest first
+    uint16_t order[MEMTRACE_MAX_TENSORS];
+    uint16_t n = 0;
+    for(uint16_t i = 0; i < n_tensors; i++){
+        if(!tensors[i].flash && memtrace_live_at(&tensors[i], peak_step))
+            order[n++] = i;
+    }
+    for(uint16_t i = 1; i < n; i++){
+        uint16_t key = order[i];
+        int j = i - 1;
+        while(j >= 0 && tensors[order[j]].bytes < tensors[key].bytes){
+            order[j + 1] = order[j];
+            j--;
+        }
+        order[j + 1] = key;
+    }
+
+    printf("live at peak:\n%10s %5s %5s  %-24s %s\n", "bytes", "born", "died", "op", "tensor");
+    for(uint16_t i = 0; i < n; i++){
+        const memtrace_tensor_t& t = tensors[order[i]];
+        if(t.died == MEMTRACE_ALIVE)
+            printf("%10lu %5u %5s  %-24s %s\n", (unsigned long) t.bytes, t.born, "-", t.op, t.name);
+        else
+            printf("%10lu %5u %5u  %-24s %s\n", (unsigned long) t.bytes, t.born, t.died, t.op, t.name);
+    }
+}
+
+#endif // MBED_CONF_APP_MEMTRACE
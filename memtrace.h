@@ -0,0 +1,118 @@
+#ifndef MEMTRACE_H
+#define MEMTRACE_H
+
+#include <stdint.h>
+#include <initializer_list>
+#include "uTensor/core/context.hpp"
+
+/*
+ * Heap accounting for the model runtime.
+ *
+ * The generated graph calls memtrace_op() after every ctx.eval(),
+ * memtrace_view() after every op whose output aliases its input, and
+ * memtrace_const() after every constant it registers. Each call looks the
+ * named tensors up in the Context and keeps a weak reference to them, so a
+ * tensor is reported as released as soon as the Context drops it.
+ *
+ * Enable with "memtrace": 1 in mbed_app.json (or -DMBED_CONF_APP_MEMTRACE=1
+ * on the host). When disabled every entry point compiles to nothing.
+ */
+
+#ifndef MBED_CONF_APP_MEMTRACE
+#define MBED_CONF_APP_MEMTRACE 0
+#endif
+
+#ifndef MEMTRACE_MAX_TENSORS
+#define MEMTRACE_MAX_TENSORS 128
+#endif
+
+#ifndef MEMTRACE_MAX_STEPS
+#define MEMTRACE_MAX_STEPS 64
+#endif
+
+#define MEMTRACE_ALIVE 0xFFFF
+
+typedef struct {
+    const char* name;
+    const char* op;        // node that produced the tensor, "Const" for weights
+    uint32_t bytes;
+    uint16_t born;         // step the tensor was first seen
+    uint16_t died;         // step it was released, MEMTRACE_ALIVE otherwise
+    bool flash;            // no heap storage: const array or a view
+} memtrace_tensor_t;
+
+typedef struct {
+    const char* op;
+    uint32_t tracked;      // bytes held by live tensors after the step
+    uint32_t heap;         // heap in use as reported by the platform
+} memtrace_step_t;
+
+#if MBED_CONF_APP_MEMTRACE
+
+void memtrace_reset(void);
+void memtrace_op(Context& ctx, const char* op, std::initializer_list<const char*> outputs);
+void memtrace_const(Context& ctx, const char* name);
+void memtrace_view(Context& ctx, const char* op, const char* name);
+
+uint32_t memtrace_current(void);
+uint32_t memtrace_peak(void);
+uint16_t memtrace_peak_step(void);
+// Largest per-step sample of the platform heap counter since
+// memtrace_reset(), 0 where the platform has none
+uint32_t memtrace_heap_peak(void);
+uint16_t memtrace_num_steps(void);
+uint16_t memtrace_num_tensors(void);
+const memtrace_step_t* memtrace_get_step(uint16_t idx);
+const memtrace_tensor_t* memtrace_get_tensor(uint16_t idx);
+
+inline bool memtrace_live_at(const memtrace_tensor_t* t, uint16_t step) {
+    return t->born <= step && (t->died == MEMTRACE_ALIVE || t->died > step);
+}
+
+/**
+ * @brief Human readable report
+ * @details Per step heap usage followed by every heap tensor that was live
+ * at the peak, largest first.
+ */
+void memtrace_report(void);
+
+/**
+ * @brief Compact dump for a serial port
+ * @details One line per record, comma separated:
+ *   P,<peak bytes>,<peak step>,<steps>,<tensors>,<heap peak bytes>
+ *   S,<step>,<tracked bytes>,<heap bytes>,<op>
+ *   L,<bytes>,<born>,<died>,<name>     (heap tensors live at the peak)
+ *
+ * @param out anything with a printf method, e.g. the mbed Serial pc
+ */
+template<typename OUT>
+void memtrace_dump(OUT& out){
+    uint16_t peak_step = memtrace_peak_step();
+    out.printf("P,%lu,%u,%u,%u,%lu\r\n", (unsigned long) memtrace_peak(), peak_step,
+               memtrace_num_steps(), memtrace_num_tensors(), (unsigned long) memtrace_heap_peak());
+    for(uint16_t i = 0; i < memtrace_num_steps(); i++){
+        const memtrace_step_t* s = memtrace_get_step(i);
+        out.printf("S,%u,%lu,%lu,%s\r\n", i, (unsigned long) s->tracked,
+                   (unsigned long) s->heap, s->op);
+    }
+    for(uint16_t i = 0; i < memtrace_num_tensors(); i++){
+        const memtrace_tensor_t* t = memtrace_get_tensor(i);
+        if(t->flash || !memtrace_live_at(t, peak_step)) continue;
+        out.printf("L,%lu,%u,%u,%s\r\n", (unsigned long) t->bytes, t->born,
+                   t->died, t->name);
+    }
+}
+
+#else
+
+inline void memtrace_reset(void) {}
+inline void memtrace_op(Context&, const char*, std::initializer_list<const char*>) {}
+inline void memtrace_const(Context&, const char*) {}
+inline void memtrace_view(Context&, const char*, const char*) {}
+inline void memtrace_report(void) {}
+template<typename OUT>
+inline void memtrace_dump(OUT&) {}
+
+#endif // MBED_CONF_APP_MEMTRACE
+
+#endif // MEMTRACE_H
@@ -1,4 +1,6 @@
-// Auto generated by utensor-cli
+// Auto generated by utensor-cli, then edited by hand: memtrace hooks,
+// ReshapeViewOp, QntSparseMatMulOp and QntBiasAddOp. Re-apply the edits
+// listed in README.md ("Generate embedded C++ code") after regenerating.
 
 #include "deep_mlp_weight.hpp"
 #include "uTensor/core/context.hpp"
@@ -8,29 +10,37 @@
 #include "uTensor/ops/MatrixOps.hpp"
 #include "deep_mlp.hpp"
 #include "uTensor/core/tensor.hpp"
+#include "memtrace.h"
+#include "view_tensor.h"
+#include "sparse_matmul.h"
+#include "bias_add.h"
 
 
 void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
 
 { // add tensor for placeholders
     ctx.add(input_0, "x:0", 2);
+    memtrace_op(ctx, "Placeholder", { "x:0" });
 }
 {    
     ctx.add(new BinaryTensor<int>({1}, inline_MatMul_eightbit_x__port__0_reshape_dims_0), 
             "MatMul_eightbit/x__port__0/reshape_dims:0", 
             1);
+    memtrace_const(ctx, "MatMul_eightbit/x__port__0/reshape_dims:0");
 }
 {
-    ctx.add(new RamTensor<float>(), "MatMul_eightbit/x__port__0/reshape:0", 2);
-    ctx.push(new ReshapeOp(), 
+    ctx.add(new ViewTensor<float>(), "MatMul_eightbit/x__port__0/reshape:0", 2);
+    ctx.push(new ReshapeViewOp<float>(), 
              { "x:0", "MatMul_eightbit/x__port__0/reshape_dims:0" },
              { "MatMul_eightbit/x__port__0/reshape:0" });
     ctx.eval();
+    memtrace_view(ctx, "MatMul_eightbit/x__port__0/reshape", "MatMul_eightbit/x__port__0/reshape:0");
 }
 {    
     ctx.add(new BinaryTensor<int>({1}, inline_MatMul_eightbit_x__port__0_reduction_dims_0), 
             "MatMul_eightbit/x__port__0/reduction_dims:0", 
             2);
+    memtrace_const(ctx, "MatMul_eightbit/x__port__0/reduction_dims:0");
 }
 {   
     RamTensor<float>* out_tensor;
@@ -40,6 +50,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "MatMul_eightbit/x__port__0/reshape:0", "MatMul_eightbit/x__port__0/reduction_dims:0" },
              { "MatMul_eightbit/x__port__0/min:0" });
     ctx.eval();
+    memtrace_op(ctx, "MatMul_eightbit/x__port__0/min", { "MatMul_eightbit/x__port__0/min:0" });
 }
 {   
     RamTensor<float>* out_tensor;
@@ -49,6 +60,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "MatMul_eightbit/x__port__0/reshape:0", "MatMul_eightbit/x__port__0/reduction_dims:0" },
              { "MatMul_eightbit/x__port__0/max:0" });
     ctx.eval();
+    memtrace_op(ctx, "MatMul_eightbit/x__port__0/max", { "MatMul_eightbit/x__port__0/max:0" });
 }
 {
     ctx.add(new RamTensor<uint8_t>(), "MatMul_eightbit/x__port__0/quantize:0", 1);
@@ -58,30 +70,35 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              {  "x:0",  "MatMul_eightbit/x__port__0/min:0", "MatMul_eightbit/x__port__0/max:0" },
              {  "MatMul_eightbit/x__port__0/quantize:0",  "MatMul_eightbit/x__port__0/quantize:1", "MatMul_eightbit/x__port__0/quantize:2" });
     ctx.eval();
+    memtrace_op(ctx, "MatMul_eightbit/x__port__0/quantize", { "MatMul_eightbit/x__port__0/quantize:0", "MatMul_eightbit/x__port__0/quantize:1", "MatMul_eightbit/x__port__0/quantize:2" });
 }
 {    
     ctx.add(new BinaryTensor<uint8_t>({784,128}, inline_Variable_quantized_const_0), 
             "Variable_quantized_const:0", 
             1);
+    memtrace_const(ctx, "Variable_quantized_const:0");
 }
 {    
     ctx.add(new BinaryTensor<float>({1}, inline_Variable_quantized_min_0), 
             "Variable_quantized_min:0", 
             1);
+    memtrace_const(ctx, "Variable_quantized_min:0");
 }
 {    
     ctx.add(new BinaryTensor<float>({1}, inline_Variable_quantized_max_0), 
             "Variable_quantized_max:0", 
             1);
+    memtrace_const(ctx, "Variable_quantized_max:0");
 }
 {
     ctx.add(new RamTensor<int>(), "MatMul/eightbit:0", 2);
     ctx.add(new RamTensor<float>({1}), "MatMul/eightbit:1", 2);
     ctx.add(new RamTensor<float>({1}), "MatMul/eightbit:2", 2);
-    ctx.push(new QntMatMulOp<uint8_t, uint8_t, int>(), 
+    ctx.push(new QntSparseMatMulOp<uint8_t, uint8_t, int>(), 
              { "MatMul_eightbit/x__port__0/quantize:0", "MatMul_eightbit/x__port__0/quantize:1", "MatMul_eightbit/x__port__0/quantize:2", "Variable_quantized_const:0", "Variable_quantized_min:0",  "Variable_quantized_max:0" },
              { "MatMul/eightbit:0", "MatMul/eightbit:1",  "MatMul/eightbit:2" });
     ctx.eval();
+    memtrace_op(ctx, "MatMul/eightbit", { "MatMul/eightbit:0", "MatMul/eightbit:1", "MatMul/eightbit:2" });
 }
 {
     ctx.add(new RamTensor<float>({1}), "MatMul/eightbit/requant_range:0", 1);
@@ -90,6 +107,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "MatMul/eightbit:0", "MatMul/eightbit:1", "MatMul/eightbit:2" },
              { "MatMul/eightbit/requant_range:0", "MatMul/eightbit/requant_range:1" });
     ctx.eval();
+    memtrace_op(ctx, "MatMul/eightbit/requant_range", { "MatMul/eightbit/requant_range:0", "MatMul/eightbit/requant_range:1" });
 }
 {   
     ctx.add(new RamTensor<uint8_t>(), "MatMul/eightbit/requantize:0", 1);
@@ -99,28 +117,33 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "MatMul/eightbit:0", "MatMul/eightbit:1", "MatMul/eightbit:2", "MatMul/eightbit/requant_range:0", "MatMul/eightbit/requant_range:1" },
              { "MatMul/eightbit/requantize:0", "MatMul/eightbit/requantize:1", "MatMul/eightbit/requantize:2" });
     ctx.eval();
+    memtrace_op(ctx, "MatMul/eightbit/requantize", { "MatMul/eightbit/requantize:0", "MatMul/eightbit/requantize:1", "MatMul/eightbit/requantize:2" });
 }
 {    
     ctx.add(new BinaryTensor<float>({128}, inline_Variable_1_0), 
             "Variable_1:0", 
             2);
+    memtrace_const(ctx, "Variable_1:0");
 }
 {    
     ctx.add(new BinaryTensor<int>({1}, inline_zscore_eightbit_Variable_1__port__0_reshape_dims_0), 
             "zscore_eightbit/Variable_1__port__0/reshape_dims:0", 
             1);
+    memtrace_const(ctx, "zscore_eightbit/Variable_1__port__0/reshape_dims:0");
 }
 {
-    ctx.add(new RamTensor<float>(), "zscore_eightbit/Variable_1__port__0/reshape:0", 2);
-    ctx.push(new ReshapeOp(), 
+    ctx.add(new ViewTensor<float>(), "zscore_eightbit/Variable_1__port__0/reshape:0", 2);
+    ctx.push(new ReshapeViewOp<float>(), 
              { "Variable_1:0", "zscore_eightbit/Variable_1__port__0/reshape_dims:0" },
              { "zscore_eightbit/Variable_1__port__0/reshape:0" });
     ctx.eval();
+    memtrace_view(ctx, "zscore_eightbit/Variable_1__port__0/reshape", "zscore_eightbit/Variable_1__port__0/reshape:0");
 }
 {    
     ctx.add(new BinaryTensor<int>({1}, inline_zscore_eightbit_Variable_1__port__0_reduction_dims_0), 
             "zscore_eightbit/Variable_1__port__0/reduction_dims:0", 
             2);
+    memtrace_const(ctx, "zscore_eightbit/Variable_1__port__0/reduction_dims:0");
 }
 {   
     RamTensor<float>* out_tensor;
@@ -130,6 +153,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "zscore_eightbit/Variable_1__port__0/reshape:0", "zscore_eightbit/Variable_1__port__0/reduction_dims:0" },
              { "zscore_eightbit/Variable_1__port__0/min:0" });
     ctx.eval();
+    memtrace_op(ctx, "zscore_eightbit/Variable_1__port__0/min", { "zscore_eightbit/Variable_1__port__0/min:0" });
 }
 {   
     RamTensor<float>* out_tensor;
@@ -139,6 +163,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "zscore_eightbit/Variable_1__port__0/reshape:0", "zscore_eightbit/Variable_1__port__0/reduction_dims:0" },
              { "zscore_eightbit/Variable_1__port__0/max:0" });
     ctx.eval();
+    memtrace_op(ctx, "zscore_eightbit/Variable_1__port__0/max", { "zscore_eightbit/Variable_1__port__0/max:0" });
 }
 {
     ctx.add(new RamTensor<uint8_t>(), "zscore_eightbit/Variable_1__port__0/quantize:0", 1);
@@ -148,15 +173,17 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              {  "Variable_1:0",  "zscore_eightbit/Variable_1__port__0/min:0", "zscore_eightbit/Variable_1__port__0/max:0" },
              {  "zscore_eightbit/Variable_1__port__0/quantize:0",  "zscore_eightbit/Variable_1__port__0/quantize:1", "zscore_eightbit/Variable_1__port__0/quantize:2" });
     ctx.eval();
+    memtrace_op(ctx, "zscore_eightbit/Variable_1__port__0/quantize", { "zscore_eightbit/Variable_1__port__0/quantize:0", "zscore_eightbit/Variable_1__port__0/quantize:1", "zscore_eightbit/Variable_1__port__0/quantize:2" });
 }
 {
     ctx.add(new RamTensor<int>(), "zscore/eightbit:0", 2);
     ctx.add(new RamTensor<float>({1}), "zscore/eightbit:1", 2);
     ctx.add(new RamTensor<float>({1}), "zscore/eightbit:2", 2);
-    ctx.push(new QuantizedAddOp<uint8_t, uint8_t, int>(), 
+    ctx.push(new QntBiasAddOp<uint8_t, uint8_t, int>(), 
              { "MatMul/eightbit/requantize:0", "MatMul/eightbit/requantize:1", "MatMul/eightbit/requantize:2", "zscore_eightbit/Variable_1__port__0/quantize:0", "zscore_eightbit/Variable_1__port__0/quantize:1",  "zscore_eightbit/Variable_1__port__0/quantize:2" },
              { "zscore/eightbit:0", "zscore/eightbit:1",  "zscore/eightbit:2" });
     ctx.eval();
+    memtrace_op(ctx, "zscore/eightbit", { "zscore/eightbit:0", "zscore/eightbit:1", "zscore/eightbit:2" });
 }
 {
     ctx.add(new RamTensor<float>({1}), "zscore/eightbit/requant_range:0", 1);
@@ -165,6 +192,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "zscore/eightbit:0", "zscore/eightbit:1", "zscore/eightbit:2" },
              { "zscore/eightbit/requant_range:0", "zscore/eightbit/requant_range:1" });
     ctx.eval();
+    memtrace_op(ctx, "zscore/eightbit/requant_range", { "zscore/eightbit/requant_range:0", "zscore/eightbit/requant_range:1" });
 }
 {   
     ctx.add(new RamTensor<uint8_t>(), "zscore/eightbit/requantize:0", 1);
@@ -174,6 +202,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "zscore/eightbit:0", "zscore/eightbit:1", "zscore/eightbit:2", "zscore/eightbit/requant_range:0", "zscore/eightbit/requant_range:1" },
              { "zscore/eightbit/requantize:0", "zscore/eightbit/requantize:1", "zscore/eightbit/requantize:2" });
     ctx.eval();
+    memtrace_op(ctx, "zscore/eightbit/requantize", { "zscore/eightbit/requantize:0", "zscore/eightbit/requantize:1", "zscore/eightbit/requantize:2" });
 }
 {
     ctx.add(new RamTensor<uint8_t>(), "Relu/eightbit:0", 1);
@@ -183,30 +212,35 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "zscore/eightbit/requantize:0", "zscore/eightbit/requantize:1", "zscore/eightbit/requantize:2" },
              { "Relu/eightbit:0", "Relu/eightbit:1", "Relu/eightbit:2" });
     ctx.eval();
+    memtrace_op(ctx, "Relu/eightbit", { "Relu/eightbit:0", "Relu/eightbit:1", "Relu/eightbit:2" });
 }
 {    
     ctx.add(new BinaryTensor<uint8_t>({128,64}, inline_Variable_2_quantized_const_0), 
             "Variable_2_quantized_const:0", 
             1);
+    memtrace_const(ctx, "Variable_2_quantized_const:0");
 }
 {    
     ctx.add(new BinaryTensor<float>({1}, inline_Variable_2_quantized_min_0), 
             "Variable_2_quantized_min:0", 
             1);
+    memtrace_const(ctx, "Variable_2_quantized_min:0");
 }
 {    
     ctx.add(new BinaryTensor<float>({1}, inline_Variable_2_quantized_max_0), 
             "Variable_2_quantized_max:0", 
             1);
+    memtrace_const(ctx, "Variable_2_quantized_max:0");
 }
 {
     ctx.add(new RamTensor<int>(), "MatMul_1/eightbit:0", 2);
     ctx.add(new RamTensor<float>({1}), "MatMul_1/eightbit:1", 2);
     ctx.add(new RamTensor<float>({1}), "MatMul_1/eightbit:2", 2);
-    ctx.push(new QntMatMulOp<uint8_t, uint8_t, int>(), 
+    ctx.push(new QntSparseMatMulOp<uint8_t, uint8_t, int>(), 
              { "Relu/eightbit:0", "Relu/eightbit:1", "Relu/eightbit:2", "Variable_2_quantized_const:0", "Variable_2_quantized_min:0",  "Variable_2_quantized_max:0" },
              { "MatMul_1/eightbit:0", "MatMul_1/eightbit:1",  "MatMul_1/eightbit:2" });
     ctx.eval();
+    memtrace_op(ctx, "MatMul_1/eightbit", { "MatMul_1/eightbit:0", "MatMul_1/eightbit:1", "MatMul_1/eightbit:2" });
 }
 {
     ctx.add(new RamTensor<float>({1}), "MatMul_1/eightbit/requant_range:0", 1);
@@ -215,6 +249,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "MatMul_1/eightbit:0", "MatMul_1/eightbit:1", "MatMul_1/eightbit:2" },
              { "MatMul_1/eightbit/requant_range:0", "MatMul_1/eightbit/requant_range:1" });
     ctx.eval();
+    memtrace_op(ctx, "MatMul_1/eightbit/requant_range", { "MatMul_1/eightbit/requant_range:0", "MatMul_1/eightbit/requant_range:1" });
 }
 {   
     ctx.add(new RamTensor<uint8_t>(), "MatMul_1/eightbit/requantize:0", 1);
@@ -224,28 +259,33 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "MatMul_1/eightbit:0", "MatMul_1/eightbit:1", "MatMul_1/eightbit:2", "MatMul_1/eightbit/requant_range:0", "MatMul_1/eightbit/requant_range:1" },
              { "MatMul_1/eightbit/requantize:0", "MatMul_1/eightbit/requantize:1", "MatMul_1/eightbit/requantize:2" });
     ctx.eval();
+    memtrace_op(ctx, "MatMul_1/eightbit/requantize", { "MatMul_1/eightbit/requantize:0", "MatMul_1/eightbit/requantize:1", "MatMul_1/eightbit/requantize:2" });
 }
 {    
     ctx.add(new BinaryTensor<float>({64}, inline_Variable_3_0), 
             "Variable_3:0", 
             2);
+    memtrace_const(ctx, "Variable_3:0");
 }
 {    
     ctx.add(new BinaryTensor<int>({1}, inline_zscore_1_eightbit_Variable_3__port__0_reshape_dims_0), 
             "zscore_1_eightbit/Variable_3__port__0/reshape_dims:0", 
             1);
+    memtrace_const(ctx, "zscore_1_eightbit/Variable_3__port__0/reshape_dims:0");
 }
 {
-    ctx.add(new RamTensor<float>(), "zscore_1_eightbit/Variable_3__port__0/reshape:0", 2);
-    ctx.push(new ReshapeOp(), 
+    ctx.add(new ViewTensor<float>(), "zscore_1_eightbit/Variable_3__port__0/reshape:0", 2);
+    ctx.push(new ReshapeViewOp<float>(), 
              { "Variable_3:0", "zscore_1_eightbit/Variable_3__port__0/reshape_dims:0" },
              { "zscore_1_eightbit/Variable_3__port__0/reshape:0" });
     ctx.eval();
+    memtrace_view(ctx, "zscore_1_eightbit/Variable_3__port__0/reshape", "zscore_1_eightbit/Variable_3__port__0/reshape:0");
 }
 {    
     ctx.add(new BinaryTensor<int>({1}, inline_zscore_1_eightbit_Variable_3__port__0_reduction_dims_0), 
             "zscore_1_eightbit/Variable_3__port__0/reduction_dims:0", 
             2);
+    memtrace_const(ctx, "zscore_1_eightbit/Variable_3__port__0/reduction_dims:0");
 }
 {   
     RamTensor<float>* out_tensor;
@@ -255,6 +295,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "zscore_1_eightbit/Variable_3__port__0/reshape:0", "zscore_1_eightbit/Variable_3__port__0/reduction_dims:0" },
              { "zscore_1_eightbit/Variable_3__port__0/min:0" });
     ctx.eval();
+    memtrace_op(ctx, "zscore_1_eightbit/Variable_3__port__0/min", { "zscore_1_eightbit/Variable_3__port__0/min:0" });
 }
 {   
     RamTensor<float>* out_tensor;
@@ -264,6 +305,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "zscore_1_eightbit/Variable_3__port__0/reshape:0", "zscore_1_eightbit/Variable_3__port__0/reduction_dims:0" },
              { "zscore_1_eightbit/Variable_3__port__0/max:0" });
     ctx.eval();
+    memtrace_op(ctx, "zscore_1_eightbit/Variable_3__port__0/max", { "zscore_1_eightbit/Variable_3__port__0/max:0" });
 }
 {
     ctx.add(new RamTensor<uint8_t>(), "zscore_1_eightbit/Variable_3__port__0/quantize:0", 1);
@@ -273,15 +315,17 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              {  "Variable_3:0",  "zscore_1_eightbit/Variable_3__port__0/min:0", "zscore_1_eightbit/Variable_3__port__0/max:0" },
              {  "zscore_1_eightbit/Variable_3__port__0/quantize:0",  "zscore_1_eightbit/Variable_3__port__0/quantize:1", "zscore_1_eightbit/Variable_3__port__0/quantize:2" });
     ctx.eval();
+    memtrace_op(ctx, "zscore_1_eightbit/Variable_3__port__0/quantize", { "zscore_1_eightbit/Variable_3__port__0/quantize:0", "zscore_1_eightbit/Variable_3__port__0/quantize:1", "zscore_1_eightbit/Variable_3__port__0/quantize:2" });
 }
 {
     ctx.add(new RamTensor<int>(), "zscore_1/eightbit:0", 2);
     ctx.add(new RamTensor<float>({1}), "zscore_1/eightbit:1", 2);
     ctx.add(new RamTensor<float>({1}), "zscore_1/eightbit:2", 2);
-    ctx.push(new QuantizedAddOp<uint8_t, uint8_t, int>(), 
+    ctx.push(new QntBiasAddOp<uint8_t, uint8_t, int>(), 
              { "MatMul_1/eightbit/requantize:0", "MatMul_1/eightbit/requantize:1", "MatMul_1/eightbit/requantize:2", "zscore_1_eightbit/Variable_3__port__0/quantize:0", "zscore_1_eightbit/Variable_3__port__0/quantize:1",  "zscore_1_eightbit/Variable_3__port__0/quantize:2" },
              { "zscore_1/eightbit:0", "zscore_1/eightbit:1",  "zscore_1/eightbit:2" });
     ctx.eval();
+    memtrace_op(ctx, "zscore_1/eightbit", { "zscore_1/eightbit:0", "zscore_1/eightbit:1", "zscore_1/eightbit:2" });
 }
 {
     ctx.add(new RamTensor<float>({1}), "zscore_1/eightbit/requant_range:0", 1);
@@ -290,6 +334,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "zscore_1/eightbit:0", "zscore_1/eightbit:1", "zscore_1/eightbit:2" },
              { "zscore_1/eightbit/requant_range:0", "zscore_1/eightbit/requant_range:1" });
     ctx.eval();
+    memtrace_op(ctx, "zscore_1/eightbit/requant_range", { "zscore_1/eightbit/requant_range:0", "zscore_1/eightbit/requant_range:1" });
 }
 {   
     ctx.add(new RamTensor<uint8_t>(), "zscore_1/eightbit/requantize:0", 1);
@@ -299,6 +344,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "zscore_1/eightbit:0", "zscore_1/eightbit:1", "zscore_1/eightbit:2", "zscore_1/eightbit/requant_range:0", "zscore_1/eightbit/requant_range:1" },
              { "zscore_1/eightbit/requantize:0", "zscore_1/eightbit/requantize:1", "zscore_1/eightbit/requantize:2" });
     ctx.eval();
+    memtrace_op(ctx, "zscore_1/eightbit/requantize", { "zscore_1/eightbit/requantize:0", "zscore_1/eightbit/requantize:1", "zscore_1/eightbit/requantize:2" });
 }
 {
     ctx.add(new RamTensor<uint8_t>(), "Relu_1/eightbit:0", 1);
@@ -308,28 +354,33 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "zscore_1/eightbit/requantize:0", "zscore_1/eightbit/requantize:1", "zscore_1/eightbit/requantize:2" },
              { "Relu_1/eightbit:0", "Relu_1/eightbit:1", "Relu_1/eightbit:2" });
     ctx.eval();
+    memtrace_op(ctx, "Relu_1/eightbit", { "Relu_1/eightbit:0", "Relu_1/eightbit:1", "Relu_1/eightbit:2" });
 }
 {    
     ctx.add(new BinaryTensor<float>({64,10}, inline_Variable_4_0), 
             "Variable_4:0", 
             2);
+    memtrace_const(ctx, "Variable_4:0");
 }
 {    
     ctx.add(new BinaryTensor<int>({1}, inline_MatMul_2_eightbit_Variable_4__port__0_reshape_dims_0), 
             "MatMul_2_eightbit/Variable_4__port__0/reshape_dims:0", 
             1);
+    memtrace_const(ctx, "MatMul_2_eightbit/Variable_4__port__0/reshape_dims:0");
 }
 {
-    ctx.add(new RamTensor<float>(), "MatMul_2_eightbit/Variable_4__port__0/reshape:0", 2);
-    ctx.push(new ReshapeOp(), 
+    ctx.add(new ViewTensor<float>(), "MatMul_2_eightbit/Variable_4__port__0/reshape:0", 2);
+    ctx.push(new ReshapeViewOp<float>(), 
              { "Variable_4:0", "MatMul_2_eightbit/Variable_4__port__0/reshape_dims:0" },
              { "MatMul_2_eightbit/Variable_4__port__0/reshape:0" });
     ctx.eval();
+    memtrace_view(ctx, "MatMul_2_eightbit/Variable_4__port__0/reshape", "MatMul_2_eightbit/Variable_4__port__0/reshape:0");
 }
 {    
     ctx.add(new BinaryTensor<int>({1}, inline_MatMul_2_eightbit_Variable_4__port__0_reduction_dims_0), 
             "MatMul_2_eightbit/Variable_4__port__0/reduction_dims:0", 
             2);
+    memtrace_const(ctx, "MatMul_2_eightbit/Variable_4__port__0/reduction_dims:0");
 }
 {   
     RamTensor<float>* out_tensor;
@@ -339,6 +390,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "MatMul_2_eightbit/Variable_4__port__0/reshape:0", "MatMul_2_eightbit/Variable_4__port__0/reduction_dims:0" },
              { "MatMul_2_eightbit/Variable_4__port__0/min:0" });
     ctx.eval();
+    memtrace_op(ctx, "MatMul_2_eightbit/Variable_4__port__0/min", { "MatMul_2_eightbit/Variable_4__port__0/min:0" });
 }
 {   
     RamTensor<float>* out_tensor;
@@ -348,6 +400,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "MatMul_2_eightbit/Variable_4__port__0/reshape:0", "MatMul_2_eightbit/Variable_4__port__0/reduction_dims:0" },
              { "MatMul_2_eightbit/Variable_4__port__0/max:0" });
     ctx.eval();
+    memtrace_op(ctx, "MatMul_2_eightbit/Variable_4__port__0/max", { "MatMul_2_eightbit/Variable_4__port__0/max:0" });
 }
 {
     ctx.add(new RamTensor<uint8_t>(), "MatMul_2_eightbit/Variable_4__port__0/quantize:0", 1);
@@ -357,15 +410,17 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              {  "Variable_4:0",  "MatMul_2_eightbit/Variable_4__port__0/min:0", "MatMul_2_eightbit/Variable_4__port__0/max:0" },
              {  "MatMul_2_eightbit/Variable_4__port__0/quantize:0",  "MatMul_2_eightbit/Variable_4__port__0/quantize:1", "MatMul_2_eightbit/Variable_4__port__0/quantize:2" });
     ctx.eval();
+    memtrace_op(ctx, "MatMul_2_eightbit/Variable_4__port__0/quantize", { "MatMul_2_eightbit/Variable_4__port__0/quantize:0", "MatMul_2_eightbit/Variable_4__port__0/quantize:1", "MatMul_2_eightbit/Variable_4__port__0/quantize:2" });
 }
 {
     ctx.add(new RamTensor<int>(), "MatMul_2/eightbit:0", 2);
     ctx.add(new RamTensor<float>({1}), "MatMul_2/eightbit:1", 2);
     ctx.add(new RamTensor<float>({1}), "MatMul_2/eightbit:2", 2);
-    ctx.push(new QntMatMulOp<uint8_t, uint8_t, int>(), 
+    ctx.push(new QntSparseMatMulOp<uint8_t, uint8_t, int>(), 
              { "Relu_1/eightbit:0", "Relu_1/eightbit:1", "Relu_1/eightbit:2", "MatMul_2_eightbit/Variable_4__port__0/quantize:0", "MatMul_2_eightbit/Variable_4__port__0/quantize:1",  "MatMul_2_eightbit/Variable_4__port__0/quantize:2" },
              { "MatMul_2/eightbit:0", "MatMul_2/eightbit:1",  "MatMul_2/eightbit:2" });
     ctx.eval();
+    memtrace_op(ctx, "MatMul_2/eightbit", { "MatMul_2/eightbit:0", "MatMul_2/eightbit:1", "MatMul_2/eightbit:2" });
 }
 {
     ctx.add(new RamTensor<float>({1}), "MatMul_2/eightbit/requant_range:0", 1);
@@ -374,6 +429,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "MatMul_2/eightbit:0", "MatMul_2/eightbit:1", "MatMul_2/eightbit:2" },
              { "MatMul_2/eightbit/requant_range:0", "MatMul_2/eightbit/requant_range:1" });
     ctx.eval();
+    memtrace_op(ctx, "MatMul_2/eightbit/requant_range", { "MatMul_2/eightbit/requant_range:0", "MatMul_2/eightbit/requant_range:1" });
 }
 {   
     ctx.add(new RamTensor<uint8_t>(), "MatMul_2/eightbit/requantize:0", 1);
@@ -383,28 +439,33 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "MatMul_2/eightbit:0", "MatMul_2/eightbit:1", "MatMul_2/eightbit:2", "MatMul_2/eightbit/requant_range:0", "MatMul_2/eightbit/requant_range:1" },
              { "MatMul_2/eightbit/requantize:0", "MatMul_2/eightbit/requantize:1", "MatMul_2/eightbit/requantize:2" });
     ctx.eval();
+    memtrace_op(ctx, "MatMul_2/eightbit/requantize", { "MatMul_2/eightbit/requantize:0", "MatMul_2/eightbit/requantize:1", "MatMul_2/eightbit/requantize:2" });
 }
 {    
     ctx.add(new BinaryTensor<float>({10}, inline_Variable_5_0), 
             "Variable_5:0", 
             2);
+    memtrace_const(ctx, "Variable_5:0");
 }
 {    
     ctx.add(new BinaryTensor<int>({1}, inline_logits_eightbit_Variable_5__port__0_reshape_dims_0), 
             "logits_eightbit/Variable_5__port__0/reshape_dims:0", 
             1);
+    memtrace_const(ctx, "logits_eightbit/Variable_5__port__0/reshape_dims:0");
 }
 {
-    ctx.add(new RamTensor<float>(), "logits_eightbit/Variable_5__port__0/reshape:0", 2);
-    ctx.push(new ReshapeOp(), 
+    ctx.add(new ViewTensor<float>(), "logits_eightbit/Variable_5__port__0/reshape:0", 2);
+    ctx.push(new ReshapeViewOp<float>(), 
              { "Variable_5:0", "logits_eightbit/Variable_5__port__0/reshape_dims:0" },
              { "logits_eightbit/Variable_5__port__0/reshape:0" });
     ctx.eval();
+    memtrace_view(ctx, "logits_eightbit/Variable_5__port__0/reshape", "logits_eightbit/Variable_5__port__0/reshape:0");
 }
 {    
     ctx.add(new BinaryTensor<int>({1}, inline_logits_eightbit_Variable_5__port__0_reduction_dims_0), 
             "logits_eightbit/Variable_5__port__0/reduction_dims:0", 
             2);
+    memtrace_const(ctx, "logits_eightbit/Variable_5__port__0/reduction_dims:0");
 }
 {   
     RamTensor<float>* out_tensor;
@@ -414,6 +475,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "logits_eightbit/Variable_5__port__0/reshape:0", "logits_eightbit/Variable_5__port__0/reduction_dims:0" },
              { "logits_eightbit/Variable_5__port__0/min:0" });
     ctx.eval();
+    memtrace_op(ctx, "logits_eightbit/Variable_5__port__0/min", { "logits_eightbit/Variable_5__port__0/min:0" });
 }
 {   
     RamTensor<float>* out_tensor;
@@ -423,6 +485,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "logits_eightbit/Variable_5__port__0/reshape:0", "logits_eightbit/Variable_5__port__0/reduction_dims:0" },
              { "logits_eightbit/Variable_5__port__0/max:0" });
     ctx.eval();
+    memtrace_op(ctx, "logits_eightbit/Variable_5__port__0/max", { "logits_eightbit/Variable_5__port__0/max:0" });
 }
 {
     ctx.add(new RamTensor<uint8_t>(), "logits_eightbit/Variable_5__port__0/quantize:0", 1);
@@ -432,15 +495,17 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              {  "Variable_5:0",  "logits_eightbit/Variable_5__port__0/min:0", "logits_eightbit/Variable_5__port__0/max:0" },
              {  "logits_eightbit/Variable_5__port__0/quantize:0",  "logits_eightbit/Variable_5__port__0/quantize:1", "logits_eightbit/Variable_5__port__0/quantize:2" });
     ctx.eval();
+    memtrace_op(ctx, "logits_eightbit/Variable_5__port__0/quantize", { "logits_eightbit/Variable_5__port__0/quantize:0", "logits_eightbit/Variable_5__port__0/quantize:1", "logits_eightbit/Variable_5__port__0/quantize:2" });
 }
 {
     ctx.add(new RamTensor<int>(), "logits/eightbit:0", 2);
     ctx.add(new RamTensor<float>({1}), "logits/eightbit:1", 2);
     ctx.add(new RamTensor<float>({1}), "logits/eightbit:2", 2);
-    ctx.push(new QuantizedAddOp<uint8_t, uint8_t, int>(), 
+    ctx.push(new QntBiasAddOp<uint8_t, uint8_t, int>(), 
              { "MatMul_2/eightbit/requantize:0", "MatMul_2/eightbit/requantize:1", "MatMul_2/eightbit/requantize:2", "logits_eightbit/Variable_5__port__0/quantize:0", "logits_eightbit/Variable_5__port__0/quantize:1",  "logits_eightbit/Variable_5__port__0/quantize:2" },
              { "logits/eightbit:0", "logits/eightbit:1",  "logits/eightbit:2" });
     ctx.eval();
+    memtrace_op(ctx, "logits/eightbit", { "logits/eightbit:0", "logits/eightbit:1", "logits/eightbit:2" });
 }
 {
     ctx.add(new RamTensor<float>({1}), "logits/eightbit/requant_range:0", 1);
@@ -449,6 +514,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "logits/eightbit:0", "logits/eightbit:1", "logits/eightbit:2" },
              { "logits/eightbit/requant_range:0", "logits/eightbit/requant_range:1" });
     ctx.eval();
+    memtrace_op(ctx, "logits/eightbit/requant_range", { "logits/eightbit/requant_range:0", "logits/eightbit/requant_range:1" });
 }
 {   
     ctx.add(new RamTensor<uint8_t>(), "logits/eightbit/requantize:0", 1);
@@ -458,6 +524,7 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "logits/eightbit:0", "logits/eightbit:1", "logits/eightbit:2", "logits/eightbit/requant_range:0", "logits/eightbit/requant_range:1" },
              { "logits/eightbit/requantize:0", "logits/eightbit/requantize:1", "logits/eightbit/requantize:2" });
     ctx.eval();
+    memtrace_op(ctx, "logits/eightbit/requantize", { "logits/eightbit/requantize:0", "logits/eightbit/requantize:1", "logits/eightbit/requantize:2" });
 }
 {
     ctx.add(new RamTensor<float>(), "logits:0", 1);
@@ -465,11 +532,13 @@ void get_deep_mlp_ctx(Context& ctx, Tensor* input_0) {
              { "logits/eightbit/requantize:0", "logits/eightbit/requantize:1", "logits/eightbit/requantize:2" },
              { "logits:0" });
     ctx.eval();
+    memtrace_op(ctx, "logits", { "logits:0" });
 }
 {    
     ctx.add(new BinaryTensor<int>({1}, inline_y_pred_dimension_0), 
             "y_pred/dimension:0", 
             1);
+    memtrace_const(ctx, "y_pred/dimension:0");
 }
 {
     ctx.add(new RamTensor<int>(), "y_pred:0");
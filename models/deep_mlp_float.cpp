@@ -0,0 +1,39 @@
+#include "deep_mlp_float.hpp"
+#include "deep_mlp_weight.hpp"
+#include "dense.h"
+
+// min + q * (max - min) / 255, the eight-bit dequantization used by the graph
+static void dequantize(const uint8_t* q, int n, float min, float max, std::vector<float>& out){
+    const float scale = (max - min) / 255.0f;
+    out.resize(n);
+    for(int i = 0; i < n; i++) out[i] = min + q[i] * scale;
+}
+
+DeepMlpFloat::DeepMlpFloat(){
+    dequantize(inline_Variable_quantized_const_0, INPUT * HIDDEN_1,
+               inline_Variable_quantized_min_0[0], inline_Variable_quantized_max_0[0], w1);
+    b1.assign(inline_Variable_1_0, inline_Variable_1_0 + HIDDEN_1);
+    dequantize(inline_Variable_2_quantized_const_0, HIDDEN_1 * HIDDEN_2,
+               inline_Variable_2_quantized_min_0[0], inline_Variable_2_quantized_max_0[0], w2);
+    b2.assign(inline_Variable_3_0, inline_Variable_3_0 + HIDDEN_2);
+    w3.assign(inline_Variable_4_0, inline_Variable_4_0 + HIDDEN_2 * OUTPUT);
+    b3.assign(inline_Variable_5_0, inline_Variable_5_0 + OUTPUT);
+
+    simd = cpu_has_simd();
+}
+
+bool DeepMlpFloat::cpu_has_simd(void){
+    return dense_cpu_has_simd();
+}
+
+const char* DeepMlpFloat::kernel_name(void) const {
+    return simd ? "float avx2+fma" : "float reference";
+}
+
+void DeepMlpFloat::eval(const float* input, int batch, float* logits){
+    h1.resize(batch * HIDDEN_1);
+    h2.resize(batch * HIDDEN_2);
+    dense_f32(input, batch, INPUT, w1.data(), b1.data(), HIDDEN_1, true, h1.data());
+    dense_f32(h1.data(), batch, HIDDEN_1, w2.data(), b2.data(), HIDDEN_2, true, h2.data());
+    dense_f32(h2.data(), batch, HIDDEN_2, w3.data(), b3.data(), OUTPUT, false, logits);
+}
@@ -0,0 +1,47 @@
+#ifndef ___MODELS_DEEP_MLP_FLOAT_H
+#define ___MODELS_DEEP_MLP_FLOAT_H
+
+#include <stdint.h>
+#include <vector>
+
+/*
+ * float32 backend for the deep_mlp model, for hosts and gateways where the
+ * quantize/requantize bookkeeping of the eight-bit graph costs more than the
+ * math. It runs the same three dense layers on the same weights: the
+ * float constants are used as is and the eight-bit ones are dequantized
+ * once when the backend is created. Embedded builds keep using
+ * get_deep_mlp_ctx().
+ *
+ * The dense kernels are the ones in dense.h, shared with the plan runner;
+ * on x86 they use AVX2/FMA when the CPU supports them.
+ */
+
+class DeepMlpFloat {
+	public:
+		static const int INPUT = 784;
+		static const int HIDDEN_1 = 128;
+		static const int HIDDEN_2 = 64;
+		static const int OUTPUT = 10;
+
+		DeepMlpFloat();
+
+		/**
+		 * @brief Run a batch
+		 * @param input batch x 784 row-major pixels
+		 * @param logits batch x 10 output
+		 */
+		void eval(const float* input, int batch, float* logits);
+
+		// Name of the kernel set picked for this CPU
+		const char* kernel_name(void) const;
+
+		// Whether this CPU runs the SIMD kernels
+		static bool cpu_has_simd(void);
+
+	private:
+		std::vector<float> w1, b1, w2, b2, w3, b3;
+		std::vector<float> h1, h2;
+		bool simd;
+};
+
+#endif // ___MODELS_DEEP_MLP_FLOAT_H
@@ -0,0 +1,3517 @@
+// Generated by host/plan_compile.cpp from deep_mlp_weight.hpp, do not edit
+
+#ifndef ___MODELS_DEEP_MLP_PLAN_H
+#define ___MODELS_DEEP_MLP_PLAN_H
+
+#include <stdint.h>
+
+// uint32_t words keep the blob aligned for plan_load()
+const uint32_t deep_mlp_plan_bytes = 112108;
+const uint32_t deep_mlp_plan [ 28027 ] = {
+    0x4c505455, 0x00050001, 0x00000004, 0x00000004, 0x000000c0, 0x0001b528, 0x0001b5ec, 0xffffffff,
+    0x00000310, 0x00000000, 0x00000080, 0x00000080, 0x00000040, 0x00000000, 0x0000000a, 0x0000000a,
+    0x00000001, 0x00010201, 0x00010000, 0x00000310, 0x00000080, 0x00000000, 0x00018800, 0xbeee295a,
+    0x3b5210e6, 0x00010201, 0x00020001, 0x00000080, 0x00000040, 0x00018a00, 0x0001aa00, 0xbebd4df0,
+    0x3b4fb7c2, 0x00000101, 0x00030002, 0x00000040, 0x0000000a, 0x0001ab00, 0x0001b500, 0x00000000,
+    0x3f800000, 0x00000002, 0x00040003, 0x0000000a, 0x00000001, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x81ada56d, 0x6fc9a06d, 0xa85ab166, 0x7e93b363, 0x8792a4aa, 0xa8627a8f, 0xca5a949f,
+    0xa6729085, 0x7b9d99b1, 0x82906581, 0x8aac777a, 0x9c867cad, 0x9e918abb, 0x668bb9b8, 0x7bafb588,
+    0x72697e9e, 0x72748095, 0x767b996c, 0x72ad9f7c, 0xb269a4b0, 0x7f88868d, 0xa0b862a6, 0x7c679479,
+    0x868c7777, 0x9279a699, 0x85a97e90, 0x9c9a9781, 0x696c7da7, 0x58939588, 0x866d7060, 0x9781a495,
+    0x8f9572a3, 0xc8c69a75, 0xbb7eae80, 0x7f6d6da6, 0x95cd6892, 0xa7cda0b4, 0x9a8d9a82, 0x9e6fa458,
+    0xc78da8a0, 0x93bb865f, 0x7d6f918c, 0x9b86bb7c, 0x5b85849a, 0xa1628c87, 0xc8afa7c5, 0x978bae92,
+    0xbca466a5, 0xad866dc2, 0x9c96966a, 0x6c828f7c, 0xc192adae, 0xc77c7294, 0x997493ac, 0x6da68876,
+    0xa261817c, 0xb27d689e, 0x78628895, 0x7f92987c, 0x9dbe7db3, 0xaf81a0b4, 0x64ac9fb1, 0xaf9b8b7e,
+    0x7ea480be, 0x7aa678a8, 0x71b6be98, 0x57adb18e, 0x6b7e969c, 0x9a567c6d, 0x5e767c88, 0x8188b873,
+    0x64a98c5e, 0xa9866bc0, 0xa7b8a56c, 0x9f778eb7, 0xa1a49f88, 0x78837f91, 0x8d6a9198, 0xa3ba7588,
+    0x6c99a9cc, 0x71b5aba9, 0xad8c5f6c, 0x7397928a, 0xad5b689a, 0x949b9285, 0xa88a97bf, 0xa07f7569,
+    0x9382b696, 0x688484b2, 0x73a0b2a8, 0xb7b18260, 0x6e89aca0, 0x8672c278, 0xa7815fc2, 0xa097a56f,
+    0x9a9ab27d, 0x97aca07c, 0xb7c0c6c9, 0x91a28993, 0x99a6adc5, 0x66897788, 0xa7ac818b, 0xb8998d7f,
+    0x7e7fa79e, 0x9abf7e86, 0x74a5b081, 0x9aa37f6e, 0xa98a5eb7, 0xa18e88ba, 0x92978569, 0x7da57896,
+    0x6f7182bd, 0x64935ea0, 0x96c17acb, 0x63a5a87a, 0xa29269c3, 0x6f6585ba, 0xb7b78e67, 0x89845856,
+    0x777f86ad, 0x889d8bae, 0x6c70919d, 0x7ecb825e, 0x6f549db8, 0x96ba8457, 0x76c26c83, 0x6a7a946a,
+    0x8075b683, 0x77696aa4, 0xb05e9482, 0xae9ecb6c, 0x888d85b2, 0xb6a37c6c, 0x7e9f9ac0, 0x9e7fa0af,
+    0x9890b992, 0x56a6b373, 0x8db2b56a, 0x9e82c96a, 0xc079a861, 0x5e936d94, 0xa29589ad, 0xc488aa94,
+    0x6b7a7f88, 0xaa895f77, 0xa48893a2, 0x979188a1, 0x8ab8c78e, 0x6b8e81ab, 0xbb8db498, 0x7781ce97,
+    0x769f858f, 0xcf758089, 0x8ca793a1, 0x96a09b83, 0x6a848e96, 0x6881829f, 0x8a745c8f, 0x877abd8b,
+    0x9baa7f8c, 0xad8a7382, 0x75b9caab, 0x9cbfae8d, 0x637cad7d, 0xb2938097, 0x748b7b8f, 0xc97d6d64,
+    0xac709ac4, 0xc0a07a6c, 0xbeaa9faa, 0xc27e6779, 0x88a6af7f, 0x96aa7b80, 0xb0989d64, 0x90998db7,
+    0x9a69867d, 0x95ba93aa, 0x6d6e63a8, 0x9f945982, 0xba9374a1, 0x839e5c99, 0x778a8694, 0x8bc49d9b,
+    0x83bcb1a8, 0x746d66a1, 0x9686a77a, 0xa5676b7d, 0xaba7a0ab, 0xa79f85a4, 0xb2af9a62, 0x9f82678d,
+    0xb694a492, 0xb797b283, 0x9d808561, 0x8b9fae61, 0x8e9699a0, 0xac898c9d, 0xb3b088aa, 0x9485b0a9,
+    0x867da2a8, 0x90b1a680, 0xc7807ec6, 0xcd6a5a60, 0x7a8d87bc, 0x8982a692, 0xac5ebf8a, 0xc286bb98,
+    0x9d9a98ba, 0x82b07884, 0x757a7298, 0x82ac8b7a, 0x7a71c3a4, 0x7389827d, 0x707f8860, 0xae7c8cad,
+    0x9f79917a, 0xcc9376ac, 0xb3b0cd94, 0x6986c098, 0x895b6ea9, 0x9f928e56, 0xab9ec68c, 0x949eada5,
+    0xad915da7, 0x86966883, 0x709aa79f, 0x868f537f, 0x6e6c958e, 0x6893a197, 0x8e848882, 0x80958fa0,
+    0x958d809c, 0x7d885b93, 0x999f68b0, 0x70c1647c, 0xb593858f, 0x8cb48a8d, 0x8e949383, 0x97ba8687,
+    0xc283629a, 0xa0967195, 0x589e9c95, 0x9e65b78d, 0xb7798772, 0x71ab979f, 0xbea19e6a, 0x9f7e6a79,
+    0xaa8e8c79, 0xb89890b8, 0x5d77c98a, 0x7e7593af, 0x5d9f916e, 0x9c907c78, 0x7c7c94b0, 0x98888171,
+    0x99a7a4a7, 0x74788787, 0x8baa94a3, 0x96c3a27a, 0x559c63b1, 0x97cea9a7, 0x9e7d79ad, 0xa6a49688,
+    0x9eaf92a0, 0x989cb08e, 0x95a29b5c, 0xabcc97ba, 0x8f8b8695, 0x6f7ba67b, 0x548669a1, 0x6c84abad,
+    0x75b5ce90, 0x9f60748e, 0x7a6bc496, 0x9cad88ae, 0x8799b45a, 0x8fa789a4, 0xbd9ebb82, 0xbbbe7f95,
+    0x5f8a9779, 0x5aabafb1, 0xad8389a4, 0xb2925f9f, 0x9ba19c9d, 0x84825cc0, 0x7b9ca682, 0x98a46ca4,
+    0xa8987fa0, 0x999798a2, 0x5d6db36d, 0x60ab948f, 0xad8f918d, 0xb1688a9e, 0xb77cb99a, 0x957c5d63,
+    0x6271a89a, 0x81a49e66, 0xa578578f, 0x6161829a, 0x83bca8a2, 0x8fb3ad95, 0x77c3a08e, 0xaaa2575c,
+    0x838980af, 0x636e8c6a, 0x8dc28387, 0x6f6a6b7b, 0x845a81ab, 0x7d5da367, 0x848c6192, 0x888d68bf,
+    0x665aaa89, 0x89945d84, 0x8c5f9672, 0x7f8db6af, 0x9f92c070, 0xbda0bf99, 0x84a36084, 0xb8807c7c,
+    0x5db29ba1, 0x8b9d839a, 0x767baca1, 0x9f9aa5aa, 0x7dc37369, 0x817b8871, 0x6375a072, 0xa1a09b8d,
+    0x948da67e, 0x937097aa, 0x8b598786, 0x9c7e967f, 0x63c69174, 0x94649f99, 0x878d9782, 0xb997b0c4,
+    0xb7bd7973, 0x84a191b7, 0x6a7b63b5, 0xa4866c71, 0xbf58995c, 0xba6b7e98, 0x7f95bf99, 0xc09370a2,
+    0x7d7b8dc3, 0x7b8fc969, 0x7f54a6a8, 0x5e778d82, 0x789c9180, 0xad6b7d7d, 0xa3709fb5, 0x7673ab70,
+    0x6d9ab070, 0x83a1ab91, 0x5cbda8a7, 0x8d54918e, 0xa282a06a, 0x95989672, 0x818dbfb0, 0xa39d70b6,
+    0x789db58b, 0x9ea78274, 0x7da962ca, 0x998e9899, 0x9a7a92a8, 0x775d897b, 0x966ba0be, 0x818e98a9,
+    0xb87fb577, 0xb285c9a8, 0x9bb3be9c, 0x9079a17a, 0x95a99e99, 0x9ca68f99, 0x818b9f7e, 0x538593a2,
+    0x9ba98772, 0xb49cc19f, 0x827f6ba0, 0x6975c5b2, 0x786f7fa1, 0x8399b885, 0xa3bd9aa4, 0xabae968e,
+    0x6e8a7f96, 0xa2b09f99, 0x72739875, 0xbe997c76, 0x8382aa81, 0x7090808e, 0xac90c35d, 0xa1b1c894,
+    0x7ca98a90, 0xac6e6881, 0xc7897f72, 0x97bc8f99, 0x65b46aa1, 0x9d818a59, 0x88897aac, 0x80b7879c,
+    0x6f8e848c, 0x6cc0ad80, 0xaebe6982, 0x8f9185ad, 0x907073a2, 0x8ab191af, 0x63b5b2c7, 0xb692b67f,
+    0x9c9b92a5, 0xa4919d6c, 0xb3d083b8, 0x8b9a7f85, 0x67986897, 0x76848997, 0xb0bda09a, 0x9a907aa5,
+    0x5897619d, 0xb9af6691, 0xc587c28c, 0x8d90a481, 0x8c9ca0b9, 0xb09ca367, 0xb0778c54, 0x85a5bb78,
+    0xa190a191, 0xb37f6eb4, 0xbab67e8b, 0xbb867d87, 0x81b08d9a, 0x719e9480, 0x9e7a6e8f, 0x95819a91,
+    0xa7a1b06d, 0x60c3bdc2, 0x767e717c, 0x8ea77db3, 0x6a918163, 0x88826fae, 0xafa891b6, 0x89768f90,
+    0xa1919883, 0xc0b75b7f, 0x95c1a5a2, 0xbbac79a3, 0x8c93bb9f, 0x8874c1c6, 0x8caf5fa5, 0x6582a8a5,
+    0x8b67a66f, 0x609c62c7, 0x8c609a8e, 0xb397ab95, 0xa899c195, 0x83958eb7, 0x8c8d7888, 0x97967079,
+    0x859e73aa, 0x89a96b6a, 0x65637d9a, 0x747e807b, 0x96a36a9f, 0x777d898a, 0x8fa58e82, 0xb2837c89,
+    0xa48e8e6e, 0xae76a275, 0x8bb89dac, 0x769596a5, 0x65ad838c, 0xc78f8cb8, 0xb487a9aa, 0xa161a983,
+    0xa8be62bf, 0x86a38d9b, 0xa3a7a0af, 0x71a59d68, 0x6694a89b, 0xc26d92a4, 0x73948f8a, 0x8dae8f70,
+    0x77b085a6, 0x88759963, 0xb37a7e8c, 0x9d786987, 0x7fadc888, 0x77868f6c, 0x9a858cb0, 0xa1ca7482,
+    0x7c9a7ea4, 0xab768d96, 0x79899468, 0x7b739675, 0xa778a0cf, 0x70b0a49e, 0x8499c07b, 0xa79e9c8a,
+    0xcf85af75, 0x82927280, 0x8f9e5abb, 0x9db8aaa9, 0xa07e7c92, 0xa1a69884, 0x7a8aa788, 0x90b69e9f,
+    0x7d89aa89, 0x8289b9a0, 0x869573bc, 0x71b78c8f, 0x9854928f, 0x90bc868f, 0xa2a2b47f, 0x5a9878a7,
+    0xa7bd7b9e, 0x85a2a2ae, 0x82aec677, 0x7c88bcae, 0x7d858d8d, 0x8984c08f, 0x99606ba2, 0x5da48f6d,
+    0x9e9cadc9, 0xa2847559, 0x77877f79, 0xc3977966, 0xad74a17c, 0x9679977d, 0x669ca984, 0x5d6fbb81,
+    0x6a6bad9d, 0x77cb8f80, 0x8daf865f, 0xc25cac81, 0xa1a98993, 0x847fa398, 0x76c77b64, 0x8c889b66,
+    0x87709c6d, 0x8e8bbaad, 0xa7a28383, 0x6b6b97b1, 0x957bb8b2, 0x62a98f7d, 0x8f9a8685, 0x7d9daeb0,
+    0xa58981af, 0x858aa6a8, 0x748eaa7e, 0x88a3a195, 0xaf9977ac, 0x89af6480, 0xb193a46b, 0xb45d7fad,
+    0xcd8baeab, 0x8ea1b2a7, 0x8a8188a3, 0x947c8961, 0x895e76c6, 0x8c887a73, 0x8979836c, 0xa4bba293,
+    0x5e62c7aa, 0xc573bc99, 0x7b88ce85, 0x61ce8c7b, 0xa1a99486, 0x987ead91, 0xa864ac8b, 0xc27f907e,
+    0xa07c976d, 0x93849a6a, 0xae9bc59e, 0x5eac7a95, 0xb892aaa2, 0x9989b68b, 0x8f7d6281, 0x749c77ab,
+    0x8b908cc2, 0x7b7184a2, 0x9366615e, 0x95b39668, 0x839aa1a9, 0x7dc59aac, 0x8970966d, 0x95857094,
+    0x8d96b3c7, 0x90ada77d, 0x8972a86d, 0x7975ad6d, 0xa37b5aa7, 0x848882a1, 0xa9768ea6, 0x53b495b5,
+    0xbaaf8ea2, 0x80aaba86, 0x60a0ad94, 0x8c9365a3, 0x8e617797, 0x6e80b27d, 0x9cc287b5, 0x8089be65,
+    0x86ab6cc9, 0x8f836d5f, 0xabc5c08f, 0x889d6a96, 0x84c87c85, 0x879e916a, 0x58b4aba1, 0xae9f8f8a,
+    0x8491916e, 0x548fc996, 0x7f908e8d, 0x72a5a489, 0xa0828980, 0x9791819b, 0x6854aeaa, 0x9e70c8b1,
+    0x86926dad, 0x88758aa7, 0x7b9dca71, 0xa4777da8, 0x74ae8993, 0x6d548a9d, 0x958997cc, 0x73777da5,
+    0xc08f986f, 0x917dba92, 0x976f9871, 0xa273abbf, 0x8d847dae, 0xb9868292, 0x78898381, 0x8870978f,
+    0x8b977b97, 0xb9a0739b, 0x7963c1a9, 0xa896ba87, 0x869c897d, 0x8a649ab1, 0x9e989fb8, 0x5f97aea5,
+    0x868ea396, 0x717cb155, 0xbd89ab7d, 0x7e709d9b, 0x638b8aaa, 0x71a4759b, 0x82997e8e, 0xa49ea777,
+    0xa69d8abd, 0x816c75bf, 0x86b2a6ab, 0x6f969388, 0x73c4bfa5, 0xb1945daa, 0x87b29654, 0xb698725f,
+    0xa1839395, 0x679f85b5, 0x97937d88, 0xa8999e98, 0x9a91b3ae, 0x69788c9b, 0xa7b180ae, 0xad946e9f,
+    0x8991907b, 0x759d95b8, 0x769e6862, 0xb1bf679e, 0x928980a8, 0xb3aaa596, 0x74b4777a, 0xa8c09981,
+    0x8e79aeb1, 0xa1a492a8, 0xa970a6cc, 0xb887709e, 0x958a66a4, 0xaf827db1, 0x855a8980, 0x7d9c90a8,
+    0x90a7987f, 0xc38dbe89, 0xbe927b78, 0x9261a37d, 0x7979aea0, 0xc78a6ec1, 0x7b898b96, 0x885f7396,
+    0x7f62a58b, 0x65996987, 0x85919d9d, 0x82b98b89, 0x799eaf6c, 0xaebd9b6f, 0x5e558691, 0xad9583bd,
+    0xaa938f7b, 0x96787b93, 0x79938ca2, 0x7c7f85a2, 0xc37c59bb, 0x699b89a9, 0x79939183, 0xa07e968e,
+    0x6b9092a2, 0x549e8a9a, 0x9b835b7f, 0x6cc47f67, 0x7f9d8c88, 0xbb648f83, 0xa680aacd, 0x5cadaa7b,
+    0xa0a0c1a4, 0x78a0b4b1, 0x5da3b88f, 0x9c78a778, 0xa9b8ab81, 0x90c85882, 0x6c9b5f91, 0x9468986d,
+    0xa0b3a5a3, 0x7bcca787, 0xcfadb1b7, 0xb380afaf, 0xcd7e8767, 0x6581b288, 0x98a0c0a8, 0x746b93a1,
+    0x60929299, 0x8b6ea1c1, 0xa37b80a0, 0x90b88a9c, 0x7175898d, 0x8a82b178, 0x9d849199, 0x8a5a57b3,
+    0x7e8e9772, 0x99ad9dab, 0xa4a08598, 0x6bbc6ca8, 0x856e7487, 0x7d8e8799, 0x7e7e8f8b, 0x8c77b05c,
+    0xa6a8bfbd, 0x9cbf9490, 0xbf8d7480, 0xa591c987, 0xa4805792, 0x9e799a87, 0x92b7ab95, 0xab9ca299,
+    0x9998a396, 0x9697b3a4, 0x6e8e968f, 0x918e5ca6, 0x9cbba597, 0x8fc07899, 0x7798a694, 0xa79eac58,
+    0x8ecaa558, 0xa884b57c, 0x94a0817b, 0x93798599, 0x8ba55e94, 0x81ac7077, 0xae79ab8f, 0xaa7ab287,
+    0xc6cc8060, 0x7ab9c7b7, 0x6e7491b3, 0xac6d6657, 0x91875777, 0x825d909b, 0xb0835e89, 0x8da77c65,
+    0xb8747aa6, 0xc0ad7862, 0x937f986a, 0x94a875a5, 0x9e8e7ca9, 0x8f9a8653, 0x95afafa3, 0xb281ae75,
+    0x89b1b47d, 0x8a9b806a, 0xad87897d, 0x9e94a463, 0x5a97a973, 0x6d736e91, 0xb28e7c86, 0xcc7869a7,
+    0x9e948482, 0x878ec2bb, 0xb38c9083, 0x88a1a079, 0xa797676c, 0xcd909164, 0x7fb766a6, 0xb4988f94,
+    0x907cbec3, 0x846c607b, 0x6a9eb387, 0x78a1ca83, 0x8a77838f, 0x59be5877, 0x89ce90b4, 0x949187bc,
+    0xb7799a87, 0xbdb984ae, 0x8eb1909a, 0xcfb669af, 0xa38a9063, 0x659ab490, 0x8959818e, 0x94806e70,
+    0x7fae61c7, 0x8b678e71, 0xa0827bcc, 0x9074755f, 0xa2947370, 0x788d838b, 0x9090b492, 0x87ae958b,
+    0x6d8f8687, 0xa377969f, 0x9889a29d, 0x5e5d7a95, 0xa1ba9a82, 0x8d9596ac, 0x9f9b8b8f, 0x869a7379,
+    0x98a16783, 0x95809f85, 0x88b5ac9e, 0x99bfa091, 0x7a838e69, 0x88a9a5c4, 0xaf72a591, 0x8d946c88,
+    0x95a67ba4, 0xa293859c, 0x6a7190ba, 0xc27c9784, 0x8395a07f, 0x818968a6, 0x8696bda6, 0x758f8dbd,
+    0xbb8e899c, 0x77bb8f56, 0xa56283aa, 0x949d77b6, 0x61a7929d, 0xc25da193, 0x8a78889f, 0x6a9f8c7d,
+    0x898f7875, 0xa959a277, 0x8e69a7a3, 0x9acb61a9, 0xa7aa8a95, 0x66aeadb0, 0x89998f7e, 0x63a4b0b6,
+    0x8096659e, 0x889ac483, 0x8e94927a, 0xa082a56b, 0x9ead9b85, 0x86799b8a, 0xb8859762, 0x62619780,
+    0x778fb396, 0x87c4a1ba, 0x8382978c, 0xac85abcd, 0x8ea16db9, 0xcdb28787, 0x7aa25c91, 0xae7a6f6a,
+    0x946bcba8, 0x8b9493bc, 0x946e7d92, 0x6a838d9d, 0x9c9e71a9, 0x738a8289, 0x8966ada0, 0x5c969aaf,
+    0xb27a7778, 0xc17b9a97, 0x7a579787, 0x65769475, 0x9c82bf58, 0xb7ce858a, 0x7e93a884, 0x8974b77d,
+    0xae8e71b7, 0x8bb4ca9b, 0x5f897db7, 0xb95a92cd, 0x82839382, 0x66886281, 0xb3a87789, 0x87a0989d,
+    0x939eb382, 0xa37c6fad, 0xada6b259, 0xc8646a88, 0xaa9c8291, 0xa0a89163, 0x9ca9a7c3, 0x8e9e79bb,
+    0xa471be84, 0x66829faf, 0xa797c798, 0x6570adce, 0x8a7a9caa, 0x74727780, 0xb47e9779, 0xa2c8b273,
+    0x9e78568c, 0x5398cba5, 0xa4948a64, 0xcc6ec099, 0x6272c77c, 0x91b67892, 0xaca55f6e, 0x78607eb1,
+    0x80847b90, 0xb6a86a8d, 0xc2bd6ba9, 0x86a25575, 0x91919c9b, 0x95b86dad, 0xa9ae89a5, 0x6cb4ada4,
+    0x9aae9e64, 0x7b5c8254, 0x87a49182, 0x7d807677, 0x949a82ab, 0x8d729188, 0xa1625d87, 0xcd6d7f9e,
+    0x6f88a679, 0x8dc09c85, 0x87c7c09c, 0xc993a88e, 0x65a3c371, 0x7396bb9f, 0x8059a28f, 0x9f757da5,
+    0xaeca8dab, 0x8194c9c7, 0x77bf745d, 0xa78ece64, 0xb08e5c94, 0x8587a1b3, 0x5b918780, 0x9576baa2,
+    0xa6b083a0, 0x787cb2b5, 0x799cc065, 0x8297a3b9, 0xac89708a, 0xbcb17e7b, 0x93c2945d, 0x819a906e,
+    0x80b86f8c, 0x7b5a8a90, 0x7893999a, 0x7b6181a8, 0x9d87878e, 0xb791bc6c, 0x91a4aaad, 0xad74ada8,
+    0x906c9660, 0x7aa95960, 0x82768c91, 0xbc70c0a6, 0x689c82ad, 0x989b9161, 0x656c6c89, 0x8676919c,
+    0x99977e5c, 0x879c939b, 0x705b9459, 0x71b98c6b, 0xa58b88b6, 0x8e96b683, 0x7f878f6b, 0x94709c74,
+    0x93896b9d, 0xae8e9c96, 0x9bb976c6, 0x977d9b8e, 0xb68ba389, 0xa77e8eb5, 0x8a9cb88b, 0x6a919f6f,
+    0x857391a8, 0x84b473b1, 0x6baea59b, 0x799a6668, 0x8fae8478, 0xcfabab93, 0x9873998c, 0xcca69e86,
+    0x8b859e61, 0x66b186a0, 0x76c4b8a6, 0xb299c09e, 0xa2a6ab7a, 0x9f7b999a, 0x7973889a, 0x8a7f7c92,
+    0x72c864a0, 0x927fc082, 0x9da2828d, 0x979584b7, 0xce9e76ba, 0x57b99ec4, 0xaa72a47e, 0x79908797,
+    0xc698829a, 0x7e867c7e, 0x8bc6a584, 0xaf9b8d89, 0x6d9d7d9b, 0x6d92a07f, 0x958980ae, 0x8a817a7f,
+    0x93879ac4, 0x61556086, 0xaa64a86c, 0x818eb885, 0xb97f8f9a, 0x869494af, 0xa38b9267, 0x5d9e76a0,
+    0x7a796e7d, 0x90b67c6f, 0x8aa1a592, 0x6c5ca493, 0x73c669a4, 0xa2b28d95, 0x858a87ab, 0x69a9beb3,
+    0x8f8ea189, 0x5987788f, 0x9b82b677, 0x8b81af9a, 0x779589a9, 0x6cc9aab9, 0xacb67891, 0xb1908299,
+    0x7385839b, 0xbc71b6a2, 0x9cb89276, 0x6c8d8da8, 0x94997eae, 0x7da9a0b5, 0x6e8d6185, 0x8f7e8d7d,
+    0x82729ec2, 0x8ea68292, 0x8c74789a, 0x9c876a82, 0x6fac809f, 0xc5999d8f, 0x756fca8d, 0x9776cd64,
+    0x9b877e7d, 0xa59bb096, 0x6195996d, 0x669a9684, 0x8cab8f94, 0xcf5a9f9a, 0x9462abac, 0x80b0b48e,
+    0xb2988c93, 0x849f7ec3, 0x98979a70, 0xa58b8b7b, 0x9f8e6aa4, 0xa2996f67, 0x8e71657a, 0x889480a1,
+    0xaea68090, 0x9998b770, 0x748b84ab, 0x98a17bad, 0xb57f9996, 0xbc9ea19f, 0x5f8c768e, 0x999980a5,
+    0x965e9a98, 0x9f90c99c, 0xa085a575, 0x7c9e7ac9, 0x92937aa0, 0xd799c299, 0x92cb7274, 0x97a4c37c,
+    0x87a56bac, 0x82938da9, 0x909ca07c, 0xbab89892, 0xa4988e85, 0x92a96aa1, 0x6cb1a283, 0xa169896a,
+    0x89549f88, 0x7e8d5b69, 0xa6d5b5ad, 0x7d909b80, 0x6bb0818d, 0x84a06493, 0x86b2af97, 0xb1c0547f,
+    0x868e9bbd, 0xa7978f61, 0x81bdb280, 0x56ae718e, 0x5f8d9682, 0xb2659cbb, 0xa8b68daa, 0x906a8a72,
+    0xa1b2ad8c, 0x739da085, 0x59797b88, 0x77a3a19b, 0x89666b7f, 0xad8672ad, 0x939f906d, 0x80787f5a,
+    0x8072786c, 0x897e5a90, 0x8f817c73, 0xa6a489c4, 0xc6ab9d8a, 0x93a89aa5, 0x7f80cf7c, 0x7c7998bb,
+    0x8c90766e, 0x5e6e849f, 0x85b698a7, 0x81aa9485, 0x87bcaf9f, 0x90839978, 0xc3ab7d52, 0x8f9973a0,
+    0xa77b71ad, 0x82707fbf, 0x91988da6, 0x9bc781b0, 0x7a9051a7, 0x5c88536a, 0x9c96aa83, 0x6f99816a,
+    0xb3b78880, 0x70505aa9, 0xab76ba89, 0x53a575b9, 0x84ae7998, 0x8d7a708f, 0x999e6bac, 0xabaa8ea8,
+    0x5e929ba1, 0x67a65e8e, 0xad87aa6c, 0x8469c467, 0x656daa8d, 0x808e7a8a, 0x608e8898, 0x78b78c75,
+    0x80909c84, 0x7b7275ad, 0xba63698a, 0x76945f8a, 0x9165a1b1, 0xac91ad98, 0x72a88c75, 0xa282ba5b,
+    0xbe598772, 0x9c8da17c, 0xa997ab96, 0x7da388cf, 0x6dcc58b5, 0x6b81bbd4, 0x905985b4, 0x817664a6,
+    0x799eaca2, 0x5b8368b1, 0xa25d89b5, 0xb38c84b2, 0x58b76dba, 0x89838676, 0x6c8d877c, 0x86675aaf,
+    0x948fb66d, 0xb4b7a059, 0xb869b95d, 0xafaabf9a, 0x9f68d15b, 0x6dceaa90, 0x90859890, 0x56aa80ab,
+    0x8852a57a, 0x999267c5, 0x9b89ca83, 0x798a7267, 0x97a77c8e, 0x636b9ebe, 0xa8b09e7b, 0xac91bbae,
+    0x856ab578, 0x66ab7caa, 0x6d6b4d98, 0x7b96bea2, 0x8b8098a0, 0xa99c936d, 0x837f92a3, 0x81989295,
+    0xaec25dc4, 0x7b61c0a6, 0x559d8286, 0x6e988c73, 0xc16b7571, 0x8292d282, 0xc29fb196, 0x9854bfb1,
+    0x948dcb95, 0x6670718e, 0x7fa2bb79, 0xa4acc28d, 0x9f73de94, 0x89ba6695, 0x779877bb, 0x7db1bed8,
+    0xda8287a9, 0x946c9988, 0x9a879cb4, 0x77c993b5, 0x99a580a2, 0x8d8f5ea9, 0x67b9b5c1, 0x758abf79,
+    0x79c37db0, 0x85bc94ad, 0x94a6a397, 0x8ca56bbd, 0xa87a919c, 0x707a90a8, 0x919da67a, 0xb4b97ac3,
+    0x879a67bd, 0x58987abe, 0x6e739a83, 0x7e9199d4, 0x8da6a6c0, 0x82a8de91, 0x847a875a, 0xb7a1946f,
+    0xb5b9a45f, 0x8eaaa07d, 0x61b1c584, 0x576cc983, 0xc19d9771, 0xbf8671c7, 0xb3997cb3, 0xb6628480,
+    0x8f5bc8b5, 0x92517687, 0xa2b8a989, 0x8f8ebbaa, 0xbe73b19e, 0x60426bb4, 0xbc9bb49c, 0xbc73c271,
+    0xa86a90ab, 0xaa6a8a6b, 0xb4717ca7, 0x9aafc8b7, 0x708d9f61, 0x86b984b4, 0x7b937196, 0x9398b798,
+    0xc190aea2, 0x8b689daa, 0xbcb18780, 0x8b918dcd, 0x85a4aaa4, 0xd6a6b185, 0x6f8d8681, 0xe9a2927d,
+    0x8169b588, 0x8659927d, 0x91afabbc, 0xbc78a769, 0x9db5a19d, 0x5b7f7195, 0xaf8f7f8b, 0x68ab9499,
+    0x7071be8a, 0x8a9fa857, 0x908c66b7, 0x7a6e9c9f, 0xd4d08881, 0x5c8998ad, 0x9983c07e, 0x6675a091,
+    0xa88da89b, 0x6e996f95, 0x658bb296, 0x96b09ca3, 0x8c90a39b, 0xa6b079d3, 0x838d898b, 0xd0ae7fa4,
+    0x897c7aa2, 0xa8ae68b2, 0xa18d8498, 0xa254abb5, 0x7e9a997c, 0xac7dc88b, 0x9e9c9f8e, 0xa9958eaf,
+    0x9f9bc081, 0x96567a98, 0x7daf8a7e, 0x7a90aa75, 0xba61827f, 0x7dbd64a8, 0xafb2896e, 0x7c88a8c2,
+    0xc38fd487, 0x987190ac, 0xae897087, 0x7783756c, 0xb5e0a881, 0x8f5c947d, 0xb57eb08c, 0x93a3c074,
+    0x89798ba4, 0x975d868b, 0x9778aa9a, 0x88e67f9d, 0x8ad084aa, 0x6fbc9dba, 0x6dbd5c87, 0xa2b58896,
+    0x97c68abd, 0xbfa46aba, 0x66a863ac, 0x8574a194, 0x93af7080, 0x9a958aa7, 0xad938896, 0x8672be9c,
+    0x8d8eb283, 0x745a7cb0, 0x97869789, 0xa7807999, 0x7278639b, 0x73d0aa96, 0x937187a6, 0xa59b9c95,
+    0xa2a6b967, 0xb9a89496, 0x9aa474c0, 0xb68ebf77, 0x856c9fbb, 0x6f58b0b4, 0xaf81a6b6, 0xa778887b,
+    0x667c87b1, 0x8a79a58e, 0xb98c8591, 0xb370a382, 0x5098ba79, 0xaa917eb6, 0x94a483b5, 0x987872aa,
+    0x8da87493, 0x80769477, 0x8a9995b1, 0xae8cc6aa, 0x7a937b74, 0x84948fc7, 0xaf8f9861, 0x74715fa7,
+    0x8968b466, 0xd2678a7a, 0x6275708b, 0xad90ad50, 0xb87b61b7, 0x8b6980b6, 0x87607a6d, 0x5db67dac,
+    0x91bfa079, 0x7e88bf79, 0xd3b199c5, 0xad80b26f, 0x7c88a57e, 0x9a857b8c, 0x95937979, 0x7c91bdc4,
+    0xbe785892, 0xdc658db1, 0x9a7cb0a2, 0x778f966b, 0xb0628d77, 0xa7807e88, 0xb982ac6e, 0xa4a88072,
+    0x858a9879, 0x76916f90, 0x87a89982, 0x967c998c, 0x57956b5d, 0x86a5ba98, 0x967e9791, 0x9974a08d,
+    0xb4a78ebb, 0xa8906dba, 0x796f9059, 0xa268ab7f, 0x969dbc6c, 0xb1c07d80, 0x85bd876a, 0xa88666a2,
+    0x94a2e481, 0xaeaa84ae, 0x98a6a199, 0x4e9c6c8b, 0x9e6f7192, 0x788c76a0, 0xbd708598, 0x9cc6b091,
+    0x7eae6c63, 0x84ab8687, 0xaa93b5af, 0x8a6f8cb9, 0x7fbc7b83, 0xb09db598, 0xaeb9acbb, 0xc0d57aaf,
+    0x89848aab, 0x82bb9a9d, 0xb6af9761, 0x965ea180, 0x9d816979, 0xacc5b871, 0x869d7eab, 0xba9eae92,
+    0x8dafa88c, 0x87799490, 0x6f8b8e86, 0x83899d99, 0x8f869589, 0xb198a795, 0xa7a49668, 0xa46a7ace,
+    0x94709463, 0x8a6c7e9f, 0xa085987e, 0x8c9c907c, 0xa2a2949d, 0x53b06fbb, 0x628a7180, 0x709fccc0,
+    0x99a9ab94, 0x9294a38d, 0x7f807762, 0x6c77c4a6, 0x96627e77, 0x73c26fb7, 0xb19bb1ab, 0x8cada688,
+    0xa9ca88c2, 0x72b299cc, 0x8b975582, 0x5e75abbd, 0xc49b697d, 0x9cacbbc7, 0x8c825fb8, 0x759f5d56,
+    0x889cb179, 0x857d73af, 0x996c968d, 0x79c6e095, 0xc45ec35d, 0x9861bd7d, 0xa3547d74, 0x7f91d9b3,
+    0xa96d8684, 0xa4a68c4a, 0xba8c6a7d, 0x9976c06a, 0x91b17887, 0x9c906cb8, 0xab95c5c1, 0xa09e605a,
+    0xbb95968d, 0x8e5ab85b, 0x86a695b3, 0xa8b7929d, 0x818966af, 0x6ab67e96, 0x997f957f, 0x99b7b8ba,
+    0x8d9389a2, 0x938e7ab8, 0x798d7eaa, 0x6f93a79c, 0x6f93a38a, 0xb56ea2b1, 0xa2b088a1, 0xb4659877,
+    0x6c68ca78, 0x6d86b3aa, 0x839494c2, 0x9c8c8769, 0xb85b816d, 0x51789a85, 0x9069a791, 0x625f8ac9,
+    0xc1648fb2, 0x91a56991, 0x97948f6f, 0x8b7ec686, 0x71ad79a7, 0x82735d89, 0xae92b07c, 0xd9577fa1,
+    0xb16177b6, 0x87856abe, 0x9693a694, 0x6ca7c896, 0x52a27ead, 0xc6b5a564, 0x6e6f5db2, 0x9fa7c0ab,
+    0x7f65989d, 0x86b164a6, 0x8895a45d, 0x91868fb3, 0x7f8f88a8, 0xd2a1a5a5, 0x96a1aba9, 0xdf94749f,
+    0x867ebb77, 0x84a9ae96, 0x68a9a758, 0x8f9bccc4, 0x746f9ab3, 0x888488b5, 0x897f938a, 0xbf829b81,
+    0xc5a0ac7b, 0x7597916f, 0x8f8e947a, 0xa585ae84, 0xc1b868aa, 0x99729da0, 0xc79b8c87, 0xa9c29888,
+    0x7a83a0a8, 0x7aac8d87, 0x72b87791, 0x8a7b869a, 0x81898ac7, 0x81877aa8, 0xb45f6ba0, 0x93a4c37d,
+    0xae566884, 0xbd908ab3, 0xa5a35ba5, 0x66787393, 0x949fb5a4, 0xb490a5a5, 0x80b778a8, 0x8a9a75c8,
+    0x8284b39e, 0x85b854ad, 0x90ba74b2, 0x8e9789ac, 0x7783afab, 0xa18974bf, 0x7c97b674, 0x74c180bf,
+    0x919fbca1, 0x7f96a975, 0xb46599aa, 0xa0bc8d79, 0x84be97c2, 0xafbc93ce, 0xc57a9273, 0xae9a7d98,
+    0x706c5596, 0xa79ba29b, 0x7bc694b2, 0x6fd19ab5, 0x958f8c86, 0xab6f9e90, 0xab8e8289, 0x9059756d,
+    0xac6bb773, 0xb2986475, 0x809794ad, 0x7f728dc1, 0x657c9b85, 0xa57c9199, 0x8276ae8a, 0xac9e8160,
+    0xa5897092, 0x83a58378, 0x959884b4, 0xb0648870, 0xa277cb9b, 0x8ea37576, 0x61676090, 0xa8a397a9,
+    0x9c7e9a78, 0xbaa68793, 0xcd9d66bc, 0xadc08084, 0xb36fb496, 0x65787284, 0x94837a6e, 0xa88b8da3,
+    0x89558a65, 0x92745a71, 0x59aea788, 0xa8819ba9, 0x7d72a899, 0x7cb0a2ac, 0x94b9a79d, 0x7f8c9ca0,
+    0x74799389, 0xcf8858a0, 0xbf8e7a72, 0xbd927a76, 0x9b7e7387, 0xa985a17c, 0x78c2a0a5, 0xa28e999f,
+    0x83b05f5e, 0xa9939e93, 0x85a08b94, 0xba799fad, 0x95c08e92, 0xba929283, 0x8ba76690, 0xab7cb28b,
+    0x8caf5fb3, 0xa98785a2, 0x62869b84, 0x916fb784, 0x708c7bb3, 0x8e9b9fb4, 0xac9aab89, 0xac8b909b,
+    0x86958d93, 0x63758771, 0x81916d6e, 0xae6da5a5, 0x629266a9, 0xb7736abb, 0x658f9e91, 0xaa7cb17b,
+    0x92aac371, 0x6889999c, 0xaf8a5f9c, 0xa2a59f91, 0x7b729389, 0xa294bc8f, 0x989aa2b8, 0xabbb9b7c,
+    0x8d809fb3, 0x68aab9ae, 0x8485939f, 0x91af6165, 0x85b5629d, 0xa8826e68, 0x93587698, 0xbb8faa6f,
+    0x847f87b2, 0xa8c16678, 0x936a9a86, 0x767c9bbc, 0xc6949e95, 0x81a5888d, 0x6a857882, 0x739d8679,
+    0x9fb086ab, 0x756fab99, 0x748fb1c3, 0xa995be7d, 0x7d909f85, 0x6a869f8a, 0x80977181, 0x8a7ea397,
+    0x8ccf6db3, 0x78aea79b, 0x6e6486bb, 0x91aba45c, 0x70c7978b, 0x6d7366ad, 0x63a48561, 0x9192a964,
+    0x7b78b8a2, 0x9a8c779d, 0x93bf878d, 0x7ca56197, 0x9ac8bab0, 0x9387b770, 0x8f6db671, 0xb5b0c37c,
+    0x797c668a, 0x81915485, 0x9ebf6b8e, 0x68ad8ca5, 0x79617387, 0xb4878677, 0x64a1ce7a, 0x9d828a8b,
+    0x908d8e9a, 0x9a908d8a, 0xb18b8073, 0x9b5ba781, 0x91a66a7c, 0x9c93ab66, 0x63aaacc1, 0x86b0a973,
+    0x7da07e7c, 0x92be9195, 0x7d96bc80, 0xbfa27a89, 0x6ca07f9c, 0x63c4be7f, 0x8cc78c9c, 0x88a59a5f,
+    0xaa8ec9ab, 0x7fa46da4, 0x76657a6f, 0x92aa936d, 0xc69b857e, 0x9796778d, 0x867b7993, 0x95a1b587,
+    0x7a956cb4, 0xabb65b86, 0xa1ab7892, 0x8795b477, 0x8cc6889c, 0x9784af6c, 0xa7986ca1, 0xb0b77297,
+    0x938a917e, 0x81a373a1, 0xb976868b, 0x9297a66f, 0xa357aec1, 0x7f87b593, 0xaaab7d63, 0x99798d9d,
+    0xb18fb39f, 0x789f8670, 0xa696aa8f, 0x9258aaad, 0xaf76b064, 0x899bb381, 0x9c71a9be, 0x815f668b,
+    0x84c89e8a, 0x9d8f7da9, 0x9baeabab, 0xcec26271, 0x67755eb7, 0x805b948b, 0xa273a39a, 0xc286a9aa,
+    0x6183bda7, 0x57a0ba9c, 0xa85b90ac, 0xb5b29d7c, 0x5ab5b49a, 0x8ab0758c, 0xa1b1848d, 0x64a0797b,
+    0xbc8892b5, 0x977b978d, 0x718ab05d, 0xc96e9d7f, 0x79969d91, 0xb0a16d7d, 0x9f917d61, 0x8a747ca2,
+    0x92b29e60, 0x9e9a65bf, 0x7f946e74, 0x88819fb6, 0x906a94b6, 0xa59d9386, 0xc96da08f, 0xa06c7a9c,
+    0x8170ad5d, 0x857ab6ae, 0x7fa8659e, 0x6ab16873, 0x8992b9ae, 0x95c97256, 0xac819b7f, 0xb2bc7ac8,
+    0x9e9777a4, 0x8da2b997, 0x6d6a9b98, 0xbca98067, 0xa77ea6af, 0xaa989761, 0xb3b8759e, 0x97b6b0c9,
+    0x968a88ba, 0x84aa7c83, 0x8baa9275, 0x8b77729c, 0x98809575, 0x918179a9, 0x868a99b2, 0x6d76ad99,
+    0x8bb075ae, 0x879396a3, 0x9f977273, 0x6e81777f, 0xac977b97, 0x765c9680, 0x8099a67b, 0xa26babad,
+    0x93bcb76e, 0xad91ae85, 0x53a29088, 0xc7cab4be, 0x8ca99f87, 0x9a8db685, 0x8fb9888e, 0xc87a8061,
+    0x7cb17d76, 0xb38e8691, 0x76868189, 0x9172a8bc, 0x9ba1bd8a, 0x90939e90, 0x91b2c48b, 0x998e9ba8,
+    0x7b758cbd, 0xb68d9183, 0xb6778592, 0x729aa477, 0xaa80a88e, 0xb19e89cd, 0xac58a2b0, 0x9588ba8f,
+    0x7da7a2a0, 0x91aaa0bc, 0x7d8981b9, 0x8da3b093, 0x926d787d, 0x91a89777, 0x889e63c7, 0xad908d9b,
+    0x7e9b9c98, 0xa58d8b9a, 0x8f8d6899, 0x9d6f76be, 0x8c7fac87, 0xa292a4a1, 0xa767ad7b, 0x7e9ea483,
+    0x68777898, 0x92b37366, 0xbcb9739c, 0x8a5bb68a, 0xb498948e, 0x99a69b8c, 0xcd969f5b, 0x7ea1c27a,
+    0x8783867a, 0x7f6fa3a9, 0x9ab6ae67, 0xc2c5858d, 0xac8c5796, 0x7b6fb571, 0x787b5e96, 0x97819d75,
+    0x86a594c3, 0xa8c4a28f, 0x81978783, 0x85a6819c, 0x77a55fa0, 0x837dbc9c, 0x91c168b2, 0xb8916b86,
+    0x95a8a879, 0xab688887, 0x8c9b7a7c, 0xacb495af, 0xa784be98, 0x6a887d79, 0x829082a4, 0x81659691,
+    0x6fa67d89, 0x9a6a9085, 0x86769174, 0xb693ae95, 0xa19e886f, 0x9a92a9bc, 0x94c4766b, 0x7bcd5f82,
+    0x7db086b5, 0x5a935a91, 0x8e838381, 0xa4a192a3, 0x76879bae, 0xb499899d, 0x949e9c7d, 0x7c8cb79b,
+    0xb895bc95, 0x7cc0768f, 0xbccab693, 0x8095717f, 0x9d8ca091, 0xd5789b8f, 0x5e5d9585, 0xa277a4b8,
+    0xa2d8a750, 0x6273a479, 0x9e7577ba, 0xb6889d8c, 0x67607f86, 0x8b798c63, 0x80769bb5, 0x8b847e82,
+    0xbb8f8877, 0xb88fa979, 0x91d16c96, 0x888b9a86, 0x7e957192, 0x86ab8679, 0x94927984, 0xa3b7a28d,
+    0x57a49bb9, 0x738f9e96, 0x7ea9957d, 0x629c7897, 0x869a9578, 0x93b6869b, 0x92aa9663, 0xa859a3b1,
+    0x8f6a99b3, 0x8ac59eb4, 0x809b7aa7, 0x736d696f, 0xa1a48f7f, 0xcf979da1, 0x9195bdbc, 0x8ac08fb7,
+    0x9b7aa991, 0xb2af97be, 0x6f978198, 0xb889c794, 0x9b86898a, 0xaa75c48b, 0x7bb08c95, 0x95a6ae88,
+    0x998b876b, 0x93c2bd7c, 0x7d937cc3, 0xa4729e5f, 0xaa9a9997, 0x95787583, 0x6ba4938f, 0xae9a668a,
+    0x9fc4a295, 0xaab39394, 0x8f7250b5, 0x7d8f8a71, 0x82a697a7, 0x957e8194, 0x92a69cc8, 0x67a6968f,
+    0x8684a392, 0x9f928687, 0x93ac5b93, 0xbe9f7baf, 0x96a988b8, 0x8192c9a6, 0xc27898ba, 0xca5c8a9d,
+    0x557f798b, 0x7c7e95a4, 0x896f9884, 0x77acb8a2, 0x788ca06c, 0x7684819d, 0x948cbb86, 0x8f76bbad,
+    0xb566a0ac, 0x87945a92, 0xa1977c6d, 0x64929e8f, 0x8d97889d, 0x9379b6a5, 0x939f5b95, 0x9574879b,
+    0xb8917e84, 0xb7a0af88, 0xa287bc97, 0x9d9678a9, 0xb0806571, 0x917060ba, 0x80a76f9c, 0x84779da5,
+    0x767ca6b6, 0xad728bb7, 0x797d8e81, 0xb58756a2, 0x8ba1bd61, 0xa39cb5a8, 0x81838fcf, 0xa7915e9e,
+    0x9a7faf9f, 0x72b17a84, 0x71aab094, 0xa486d353, 0xa18fb283, 0xa6acb1a9, 0x688fa57a, 0x8c81bccc,
+    0xa15e9463, 0xa4907aa3, 0x808f7b7c, 0x799b98a3, 0xaf9a6577, 0x8b628db7, 0xa2917587, 0xb9566eb7,
+    0x929c96b5, 0x92729260, 0x7367b863, 0x838b6cd6, 0x7091aa80, 0xcd819386, 0x778e81a3, 0x7990b2b8,
+    0xc362a0ca, 0xaca6699f, 0xb092a696, 0x52a08c9e, 0x4c76978c, 0xcd8a936f, 0x6976a087, 0xa9547bcc,
+    0xa38aad5c, 0x57967e7d, 0x7b9eabb1, 0x8d7fdb9f, 0x936bb982, 0x84736cb9, 0x7b81a685, 0xa6a57d8f,
+    0x7873c472, 0xb0adb973, 0x99c16f84, 0x6b73c25b, 0x87868778, 0x8e8f84ae, 0xa6719181, 0xbd8f7276,
+    0x7ca881a7, 0x875c8560, 0x7fa551a4, 0x839fb3a1, 0x83af967d, 0x9ea98ea3, 0x7e6487a6, 0x818c719e,
+    0x717478ce, 0x7f5d98a7, 0x9c7aa7bb, 0x8c598e6d, 0x678a906a, 0xd4969196, 0xb1809f8e, 0xb6699279,
+    0x8e68ab4a, 0xa673b18c, 0x848f7f9f, 0x567cb099, 0x6eb98688, 0x76b575ae, 0x959f637b, 0x58949f98,
+    0xb5a9699d, 0x6c9a769d, 0x98e38896, 0xad7b987a, 0xd69d89a7, 0xa757aba4, 0x82908b84, 0xa3956992,
+    0x9a736a9b, 0xc9916a86, 0x87848469, 0x64ab6fca, 0x5f9e89a4, 0x698e87ab, 0x756d9b91, 0x7392adb1,
+    0x778c6ac3, 0x9366659e, 0xb8bb8fa8, 0x875c9ed1, 0x99686396, 0xe067ba7b, 0x94629581, 0xc4a7b682,
+    0x9170bc43, 0x6c858463, 0x8aa48873, 0x8a8ab371, 0x6dafc972, 0x7ea686b3, 0x8b8b8979, 0x9e9492ad,
+    0xc66a5f6d, 0x9b837599, 0x78c1936c, 0x7dc1a391, 0xeba5836a, 0x877388be, 0xa172b3a8, 0xda737b84,
+    0xbc888a89, 0xa8a3cab2, 0x89a77fc5, 0x7e9d67bf, 0x42a97769, 0xa59396be, 0xae5c548c, 0xbab56ec2,
+    0x8a937586, 0xa9788486, 0x56b07969, 0x5ba48184, 0x88746b71, 0x8860b561, 0x61afc59e, 0x8167a97d,
+    0x8e63a237, 0x9c979774, 0x65837367, 0x65757b75, 0x80c8c8b3, 0xa5ab74c1, 0x72779274, 0x8072a8bd,
+    0xc2629179, 0xa369a146, 0xa1db73a6, 0x4b94a588, 0x99a2a272, 0x596da4ea, 0x8e58c04e, 0xe7889a78,
+    0x52a5c487, 0x91907c98, 0x3e5c4b74, 0x7d827aa2, 0x8a828884, 0x8783b694, 0xa57e60c5, 0x8f92a47f,
+    0xc3867598, 0x9d847ab1, 0x95648e6d, 0x7c7a8789, 0xad9852ad, 0xbaccc597, 0x9c7494b2, 0xbdbfaa50,
+    0xb772b29f, 0x70ba6a65, 0x6993b383, 0x887ed18a, 0x8c8a7f7d, 0xa8b8a897, 0x794bbf9d, 0x3988b4d6,
+    0x9b82c872, 0xc45a7f70, 0xb6c38ba1, 0x9d70a474, 0xc5a46b9e, 0xa55ea8c4, 0x903ede79, 0xc39d807f,
+    0x8e707da6, 0xa189b8bb, 0x85ae6fb6, 0xabb255be, 0x3d6f5894, 0x53645acc, 0x79628799, 0x9a839070,
+    0x558f5780, 0x9a6e9795, 0x5b936697, 0x76866bc0, 0x6b964595, 0x8ac1797e, 0x846ed1ae, 0xc399ab80,
+    0xacafb034, 0x716f916e, 0xaccb8b60, 0x5b69c37f, 0xa0acdc81, 0x90a7a9a2, 0xae7c938e, 0x6a86b2be,
+    0xd151c457, 0xa246bd64, 0xa3bb7497, 0x7d79707a, 0xcfae7a67, 0xb5829aaf, 0x94568a5e, 0xcab1d3af,
+    0x926ea38f, 0x7f886a8a, 0x338b7c8d, 0xa2c47bbc, 0x63748b76, 0x5cb5a3cc, 0x8d93837d, 0xb6b89699,
+    0x7ca59fde, 0x8b54798e, 0x8f91aebf, 0x4c93a298, 0x89b86e71, 0xe4c7beb2, 0x947a8ba5, 0xb05e8f91,
+    0x6969d43b, 0x937b657e, 0x8b8448ac, 0x8d8dbc76, 0x8a77bea1, 0x8eaf99a6, 0x74857b5c, 0x4c79d089,
+    0xab6ab686, 0x6072685f, 0xe58c8bb1, 0x8ca68ba5, 0x8add9c94, 0x7f818b92, 0xa157b47b, 0x9d93d68f,
+    0xba6c5e99, 0x8e7fa0a4, 0x565f6f81, 0x8d8cbeb8, 0x69c35981, 0x87ac936f, 0x9961919b, 0x6fb87bc3,
+    0x877e62ad, 0xbf968e8b, 0xbb836ebb, 0x6d82a7bc, 0x8c924567, 0xc6a7a9b8, 0xbcaa86b6, 0xa97b998e,
+    0x797d8142, 0x90bd737c, 0x4b9e92b3, 0xb6938e97, 0xb18d9f73, 0x61cd92b5, 0x6fa095ab, 0x928ea9c0,
+    0xd14dd787, 0x9981b453, 0xcdb78682, 0x9781986c, 0xbcb7b694, 0x6268708b, 0x9985a374, 0x9e9bb5ad,
+    0x9062b89b, 0x93737da2, 0x5b925b8a, 0x68af999b, 0x677eab84, 0xa891717b, 0xae8e77a6, 0x6cd688a9,
+    0x749896a3, 0x6f996fa6, 0xa2cb8d79, 0x63628392, 0xa7a87e51, 0xdc96a471, 0xa3a29db1, 0x9b856993,
+    0x9b72c841, 0xa7927d57, 0x6757567d, 0x68489c7e, 0xa263a967, 0x8dab9a9e, 0xa4659274, 0x8769a5c0,
+    0xd178ae8e, 0xab65786d, 0xa599969e, 0x6a5cc489, 0xc2b77d84, 0x958fb2af, 0x626ce081, 0xa9bca498,
+    0x88ab6f9a, 0xb1728399, 0x7c8b8670, 0xb38298a0, 0xa8b06d81, 0x8cb6a38a, 0xa8ad5ad5, 0xb87faa7d,
+    0xa06353c2, 0xc39896c1, 0x859480df, 0x7c8e8a90, 0xb96550a3, 0x9f7a9a95, 0xb1ada7b7, 0x997ec381,
+    0x736caa72, 0xa76688a4, 0xc3a35f6c, 0x996cb774, 0xa2949757, 0x6b6b7bb2, 0x8241a87d, 0x9f97b0db,
+    0xaaa0ad6d, 0x646fa197, 0xa8937e76, 0x7da9b37c, 0xb8c39e7e, 0xa4a9a196, 0x9c5a9f65, 0xaed4b488,
+    0x99814878, 0x8ea76890, 0xb288c1a1, 0x89b38faa, 0x6fab8f93, 0x87bd9988, 0x9f977489, 0x96bf6688,
+    0x928b60cd, 0x918c5ea0, 0x959c84d0, 0x94a5787d, 0xa17973af, 0xa9b4b37b, 0x85c5997d, 0xaa82a757,
+    0x788d86a4, 0x87c48960, 0xa1a956ac, 0x8283b189, 0x8887ab8c, 0x967174bb, 0xa141789e, 0xaf9ac2aa,
+    0xda73c67a, 0x927a74a3, 0x99ce669e, 0x5c7fb160, 0xb599814c, 0x768075b5, 0x8c8ec782, 0xa38ea490,
+    0x7f917586, 0x7b6f6868, 0x5677bf8b, 0x6fcb6b94, 0x89977f6d, 0xadd29b80, 0x9578978e, 0xc6c87798,
+    0x64b273e1, 0x8f8d7da9, 0xaacd6bd8, 0x677d9fa9, 0x8a75988e, 0x8c68888e, 0x6ac984a5, 0xb69e6d9d,
+    0x6f809e5e, 0x4db08da5, 0x877d8c8b, 0x9a9fcaab, 0xa778795d, 0x69577d9b, 0x7d7b7058, 0xa681b596,
+    0x8462dc95, 0x8d8f765f, 0xbd8b93b3, 0x538e9684, 0xb2bbb07c, 0xa0a2a2a5, 0x6266a25c, 0xaaa4a075,
+    0xa98c81a4, 0x624d615a, 0xa497806a, 0x91ab65bc, 0x6573a690, 0x7099b3a9, 0x728c5b86, 0x91af6d99,
+    0x95acbdc6, 0x88739e97, 0x5f9f8183, 0x8b7bb084, 0x8f865399, 0xcd68b074, 0x89ad9acb, 0xbe69a0a5,
+    0x4776c2b0, 0xa297a7a2, 0xcbb0a970, 0x81c0d0c4, 0x9f6cbda4, 0x817c9782, 0x7a65c176, 0x8b5598f2,
+    0xb178a686, 0x6d9fae9f, 0x70e28e87, 0x7bc5c6a0, 0x82be7d92, 0x644faaa6, 0x9fa89959, 0xb6ad74a4,
+    0x8394b37a, 0x64718f7d, 0x91ab7e87, 0x7cbb7fac, 0x419f5d6e, 0x958fd0ab, 0x798db78d, 0xbcaf9c6d,
+    0x9d8f7296, 0x6dac9cc5, 0x86a59b9a, 0xb054869d, 0x99776e79, 0xcd8c9f7d, 0x8adb949e, 0xb8afbcba,
+    0xaa75a575, 0x5ebe645c, 0x63aa795f, 0x5aafeb61, 0x8f8a8eb0, 0x9f8bb98d, 0x9a8083a4, 0x7584a096,
+    0xb164928f, 0x9b9aa998, 0x7bd55fb5, 0x87a98594, 0xc5bab490, 0x9059abc7, 0xbc696558, 0xa768af6d,
+    0x9d836576, 0x7e96ad4e, 0x92ad7d8d, 0x82ccb488, 0xba838cae, 0x93878485, 0x6390aaa8, 0x899789bb,
+    0x81987d95, 0xb26f97ab, 0x9ca1897d, 0xb05a9492, 0x6981609d, 0xb68ec9a0, 0x91a397bf, 0xb0858a8a,
+    0x6697a8b0, 0xa299939e, 0x7ba6929d, 0x9283868d, 0xa1acdb5f, 0x51a679a7, 0xa5576f7a, 0x6f6d96ba,
+    0xc895968a, 0x6874939b, 0x7bc4a067, 0x919ce0ad, 0xa9cf83c6, 0xa387829c, 0x8981957f, 0xaca29093,
+    0xa8ab77b2, 0x8e9979b0, 0xc26ca898, 0x85c1a69b, 0x75887b90, 0x96bb6ba0, 0x948a8e93, 0xa3a19a85,
+    0x67b15aad, 0x9d6d7896, 0x70787fae, 0xb1606c62, 0xaa9881a6, 0x97b4bd74, 0x9aacc388, 0xa852c774,
+    0x7b68d573, 0xa0bd808d, 0xac66ad61, 0x725f9b9d, 0x5fc6b475, 0xa76098c8, 0x86b69e4b, 0xb1afbe85,
+    0xa375a988, 0x858d9772, 0x9bc4947a, 0x838da483, 0xb3a8748d, 0xcb7f7388, 0xa099ca75, 0x9e8ba68f,
+    0x8c4bbd7c, 0xb180b7a3, 0x9875c36b, 0xaa878971, 0xb88a9c89, 0x89966792, 0xab7e8dca, 0x7dac5f96,
+    0xa2619e76, 0xb16ea1a5, 0x8e9c9c76, 0x8a918482, 0xbf5e71b0, 0x9ec989bb, 0x7fad7285, 0xa69f968d,
+    0x999fbe7c, 0x8ca37498, 0x8dd86f79, 0x9688a7a3, 0xc15d9f7f, 0x96638a69, 0x8f8e9c90, 0x899f9758,
+    0x8ca08573, 0xaba2c798, 0x776e77a8, 0x9396b0ab, 0x98beabb1, 0xaf9a81c1, 0xaca67396, 0x9e597b6c,
+    0x67588693, 0xab7b9476, 0x7db09a65, 0x5a9b73bd, 0xa49a8d7c, 0xa499b7b4, 0xb7aa5ea5, 0xc3b18eb1,
+    0x8e65b276, 0x7d946c80, 0x836aa470, 0x8f95a2a1, 0x7e9d8893, 0xb1a1657a, 0x8cc5957a, 0xb69ea19c,
+    0x969e818e, 0x73977877, 0xbf72638c, 0xada69f66, 0xb46ac084, 0x70a0abaf, 0x6d9a97a7, 0x738a92c0,
+    0xac878953, 0xa5798a5c, 0x787e8084, 0xa8a2c499, 0xa66788b4, 0x877ec093, 0xb0b7b087, 0x6ec08d62,
+    0x61afaa53, 0x898a897b, 0x949b8486, 0x958996b3, 0x6d9a7ac5, 0x91b5657b, 0x978978b7, 0x5c5d9d96,
+    0xc67e7577, 0xaaab9288, 0x97bd757a, 0x95bf8174, 0x679978a1, 0x7482bfa6, 0x899575a9, 0x7b8869a3,
+    0xbf786089, 0x888a748f, 0x87b08f99, 0x748aa862, 0x998ba4a5, 0xb8a4a785, 0x9a678789, 0x8d909286,
+    0x53a88db2, 0x98688da3, 0xbc9a9a94, 0x82769ba0, 0x63b27bab, 0x74988194, 0x659da057, 0xa3c6b5a0,
+    0x627f995c, 0x76b7be92, 0x8b7e5c69, 0x709ca0aa, 0x929f9b91, 0x6b56a088, 0xae5eba6e, 0x73837c63,
+    0x8da97cac, 0x758caca7, 0xa27893c8, 0x8d8f5ea8, 0x93887567, 0x5a80567e, 0x758da2a9, 0x887da49f,
+    0x6a7bb799, 0xbb8a9389, 0x9d76629d, 0xa0a4aa6c, 0xa7cac17e, 0xa8787258, 0x6fc4a372, 0x617daeb7,
+    0xce827dac, 0xba9b8588, 0xac77977d, 0x85c1aca7, 0xb0885b7e, 0x77798e63, 0x9c92ab7b, 0x6e90c087,
+    0x79758c67, 0x91c1a0ad, 0x9bb19da0, 0xc46eac75, 0x9e86b6b4, 0x879e8f9f, 0x83879685, 0xaab3b8a4,
+    0x90986670, 0x74cd69ac, 0xa27c8f65, 0xac82ab73, 0x7d878eb4, 0x8da18fa2, 0x5b779067, 0x8a73b089,
+    0x897dcda5, 0x8b747b89, 0x569bbb6a, 0x98b687a6, 0x96697270, 0xa6a49181, 0x94ac8279, 0x8c9a959a,
+    0x8f68a0c7, 0x80847081, 0x806687a9, 0x75a38eb6, 0xb18282b4, 0xa88072a3, 0xa7729660, 0x7d66b6b6,
+    0x836bafc9, 0x968b7a5e, 0x98a8828f, 0xad897072, 0x61b2ab7f, 0xa6868bb9, 0xa472b5b9, 0x709e9aa7,
+    0xb9abae78, 0x9f577f99, 0xa78a847d, 0x767a7b87, 0x6e8f8a9d, 0x8158896f, 0x6292a886, 0xaf867cbe,
+    0xa2c6b47e, 0x709759cb, 0xa6aebd9d, 0xc1737fae, 0x816d8f94, 0xb86bcd7d, 0x8ac8abc6, 0xa88e8f7d,
+    0x8cc58c9c, 0x7a6796b6, 0x65878297, 0x759cb28d, 0x96a37e7b, 0x998f8d72, 0xbf96bcab, 0x966373b7,
+    0x957e81a1, 0x69b3c5a1, 0xa09f75c2, 0x9cc17d7f, 0x96b58dce, 0xb19f84a1, 0xb57a9c73, 0xa0a2839e,
+    0x6d757b82, 0xafa8767a, 0x86977471, 0x8fbb8bac, 0x9290a171, 0x5ebb6ab7, 0x9c989c85, 0x8d91bb98,
+    0xbc8777bf, 0xc7ba6689, 0x5a738a98, 0x8d70acbd, 0x765fadb4, 0xb4b87278, 0x89995e83, 0x8f7f7f67,
+    0x6e72ae8d, 0x83b083b1, 0xbb5e8555, 0x89a49184, 0xa0a2cc8e, 0xc1647d77, 0x947f9ca9, 0xa9b78caf,
+    0x809974b2, 0xbc94cc9e, 0x9998b09b, 0x9688a1a1, 0x808aa7c1, 0xa98b8b84, 0x87978d8a, 0x9c747e89,
+    0x8c6c9d74, 0x92b1b695, 0x9fb69988, 0xa095b1ab, 0x90b67371, 0xa2a2cfaa, 0x82878a96, 0xad8158a1,
+    0xa1879a83, 0xc6817384, 0x62bc808f, 0x617071a5, 0xc090c19b, 0x87c6a08d, 0x5ab28d81, 0x838c97a1,
+    0x6569886d, 0x7b7891bc, 0x6f7fba81, 0x736d98b0, 0x81aa7ea5, 0x84808264, 0x8f709290, 0xab746584,
+    0xca9a66bc, 0x6b8ec87f, 0x7f739682, 0xaea370c2, 0x6c7671b5, 0x959876c2, 0xb2949c89, 0x777979ab,
+    0xa4b28faa, 0x709579b9, 0x917f5c77, 0x5d8389aa, 0x9ba85c8a, 0x9568a6a2, 0x5c9ea06d, 0x9b6f8387,
+    0x617f9388, 0xb28a908e, 0x746f94a4, 0x6698859a, 0xc996746c, 0x9fad90d7, 0xbb9d5a9b, 0xa4c07fa5,
+    0x87be90a5, 0xc08b54b0, 0xa19589aa, 0x7aa79b90, 0x8acc7f96, 0x709da9b2, 0x9da2aa7a, 0xa090a770,
+    0x92688977, 0x9ba883b2, 0x9c6b9b77, 0xaf839380, 0x7483a8a6, 0x7e917488, 0x894f9ab8, 0x89849d90,
+    0x689973ac, 0x8cb499be, 0x9859ad8c, 0xa5b17579, 0xc6ad558b, 0x93a8cf9d, 0x78b29c6a, 0x828fb999,
+    0x8eac6d7e, 0x828a66a4, 0xc67b8683, 0x967d7e98, 0xb98a7788, 0x8d7497b5, 0x74aaa682, 0x95b39f8b,
+    0x966cbb8b, 0x99a0718f, 0x6ccacba7, 0xae7d9aa2, 0x92cb7eba, 0x8767c0a1, 0x7d7989b9, 0xd09a7f79,
+    0x83a2905f, 0xacab8d92, 0xa87dac70, 0x9baf77a0, 0x8382965c, 0x86806c83, 0x927862b6, 0x8c8d7e80,
+    0x909e8ebc, 0x868fb465, 0x55707c92, 0x5c8c9aae, 0x7f8f8d7f, 0xdd95b091, 0x8e9d7ba4, 0x8d8d8ca4,
+    0x598fbf95, 0x93c9919a, 0x7d838c96, 0xae8bb081, 0x9c967d76, 0x5b9b6dba, 0xb6879eb3, 0x9393ac90,
+    0xbd706464, 0x989984b7, 0x9184c45d, 0xa8877b9d, 0xada1a090, 0x924e61d7, 0x7fad839c, 0x9dc59aa9,
+    0x70a07479, 0xaab65c8c, 0x97ac9a8a, 0x79897b8d, 0x6fb58362, 0xb39bc2a5, 0x9e789d87, 0xbf837579,
+    0xb5687b6c, 0xce616fac, 0x9582867a, 0x999c77c2, 0x75965a98, 0xd3808767, 0x7979987c, 0xdd8eafaa,
+    0x8461a967, 0xad8f76a4, 0xa9ac7f94, 0x9f8e78ba, 0x959cc5a4, 0x5ab1a9a4, 0x78a26876, 0x847d75a0,
+    0x6f76977b, 0x65909bbb, 0xa493909a, 0xa7b38a8a, 0xa48dcc9e, 0xa578a6a9, 0x7b55a0a1, 0x9d96837c,
+    0x71a57c7e, 0xba719cb7, 0xae717290, 0x9692b4c9, 0x799c8a8e, 0x929eac74, 0x87686ba5, 0xa0899985,
+    0x948888ba, 0xb7708aaf, 0x8396857f, 0xa46f95cb, 0x839e628b, 0xb153c35e, 0x9fa5bf9c, 0xb85aa0a6,
+    0x7286a885, 0x76ce7d7c, 0x90aac77b, 0x8f7f9698, 0x8485b075, 0x87968ebb, 0x548b78ac, 0x509ba852,
+    0x5f638495, 0x7c419875, 0x84bd89a3, 0x988756b2, 0x97b8b9ac, 0x8d4bb3c6, 0xad72bb63, 0x9acfa692,
+    0x8e9a6da5, 0xb08e8ebc, 0x60648d7d, 0x927d9a9e, 0x4e6a8294, 0xb08499c2, 0xbe58379c, 0xd394a5ce,
+    0x93937e7a, 0xb7a57b8c, 0x4d8a4f5f, 0x66635b97, 0x8196428e, 0x8aaa908e, 0x6a786b6f, 0xa183747c,
+    0x7490bc79, 0x73ba5669, 0x846b8a83, 0x966492c1, 0x646d9588, 0xa9c2a0b1, 0xaea4cea7, 0x92afb58b,
+    0xa4396d76, 0x82667a59, 0x6077a093, 0x8d936769, 0xbe75c2b6, 0xb48599b2, 0x8e879b7c, 0xb1b38f62,
+    0x64876e6c, 0xbd697da7, 0x6944a0aa, 0xb5a55f90, 0x4e9d9c94, 0x639477bf, 0xab87469f, 0xa992ada8,
+    0xb9887594, 0xa989a7ae, 0x9b69a353, 0x907270a4, 0x63a7676c, 0xac87ab82, 0x8f9074c9, 0x7a85688a,
+    0x7193e440, 0x5db17290, 0x59999b84, 0x6cb2b8cd, 0x6ea7a171, 0x87ad65b7, 0x897b966e, 0x66aeb1ab,
+    0xad5a6c80, 0xac746f90, 0x7f8a866d, 0x86ae7280, 0xc25ba483, 0x855b97d5, 0xa6a9a0a1, 0x7ed4b679,
+    0x97b26f7c, 0x7f8364be, 0xc0a5bca5, 0x79839096, 0x7189b454, 0xa1a7a372, 0x915862cf, 0xd6526776,
+    0x728a5671, 0xb65188bc, 0x4661ac9d, 0x7570979d, 0x86bd4e8d, 0x885b8f5f, 0xa06c7189, 0x8c6665a9,
+    0x746b9b51, 0x6c85565a, 0x845d9c5a, 0x9366ad8e, 0x82b1a781, 0x789290ba, 0xa5b08753, 0x6f6cb392,
+    0x9d665754, 0xa7a97c89, 0x6f8c79bc, 0x95a57379, 0xb9528fc3, 0xb68fa3a9, 0x8179917c, 0x76bc9cb1,
+    0x87b1925b, 0xa957749f, 0x866a8e72, 0xac83b2ad, 0x3e9463b1, 0x908a8d88, 0xc6b83f79, 0x8e838182,
+    0x70559a81, 0x9fab9197, 0xadab779a, 0x646b52bd, 0x4ea07a94, 0xa2647252, 0x94587eae, 0xb98c73ae,
+    0x6f8bdd31, 0xa1de8381, 0x52858e60, 0x9b879559, 0x7ccdb65f, 0xb06e6db9, 0x8b5fa698, 0x598a7d93,
+    0x9a44cc6e, 0xa1704b74, 0xacc98165, 0x60b35d82, 0xb87e9a8e, 0xb17f81bc, 0x978b7285, 0xad94cf90,
+    0x7bab7268, 0x8a6c77b8, 0x5a9a947c, 0xa87a5bc9, 0x2d78567d, 0x8b94a98f, 0xb28f647e, 0xa15774ac,
+    0x43764fac, 0xa7967296, 0x586ca564, 0x60617d9f, 0x819c78a5, 0x7c796e8e, 0xb1767965, 0x6e81d4a8,
+    0x9b87f12a, 0x97c57a51, 0x45b46777, 0x8798cd86, 0x8fbea789, 0x7e94a5b0, 0x6a557386, 0x7294a8b3,
+    0xad8a6c85, 0x9664aa6a, 0xb08eb1b9, 0x929e8e73, 0xa08ab1a2, 0xa2969396, 0x9175748c, 0xcda5e8d0,
+    0xa8976e6a, 0x7b6040b5, 0x7a4d787e, 0xa9c0697d, 0x919d6d88, 0x608fa383, 0xaba24f75, 0xa06a889a,
+    0x6da17b92, 0x6f5e6ea3, 0xa884c78b, 0x877a8ea3, 0x547f4cbb, 0x7b94ae96, 0xb4577d7b, 0xa7807886,
+    0x658ecd7d, 0xa87a703e, 0xab77ada9, 0x9888a47c, 0x86a2b04e, 0xb9a39d85, 0x6746867c, 0x376b77c1,
+    0x8a39b149, 0x8291a96c, 0x88b372a4, 0x717d8289, 0xce83b690, 0x90909796, 0x90758592, 0x89ba90cd,
+    0x787db1ba, 0xa17dabbf, 0x957b9f70, 0x9f8274ae, 0x51853678, 0x668e778f, 0xb2b25d7e, 0x7d836499,
+    0x6d8da595, 0x9b7d6b8b, 0x59705d7b, 0xa17f9a8d, 0x9c78269b, 0xa67e8e73, 0x6286797a, 0x8ea78a8e,
+    0x4a8bd369, 0xadad654f, 0x5cb5a042, 0x587dac61, 0x9db6ad94, 0xa6849982, 0x9d77a692, 0x4f58c289,
+    0xc84d7979, 0x63806862, 0xa68c8997, 0x58b48d75, 0x818eac72, 0x6b6459d6, 0x849bab8f, 0xc89570a2,
+    0xb77c9d7d, 0x8b7c8a8c, 0xa3839f96, 0x84bb89be, 0x519d85b1, 0x95b4945d, 0xc174706b, 0x757b8389,
+    0x80727ca3, 0xd8858b98, 0x68809abb, 0x767c87a6, 0x75cf7a7e, 0xba92b4a6, 0xbf94a487, 0x8547a56c,
+    0x9e6ab170, 0x9eaa7e6f, 0x769b9d69, 0x887ea0a2, 0xb29d6e71, 0xa39e9ca3, 0xb941ac71, 0x756ea0c2,
+    0xac72aa8c, 0x9e477947, 0xa3cd9480, 0x9698a779, 0xceb86991, 0x97587ba8, 0x97a5c964, 0x96adb396,
+    0x985b9590, 0x789e7d75, 0x7b62696e, 0x7e8d93b8, 0x31a1846f, 0x65cda79e, 0x9c977da3, 0x93be9eb7,
+    0x757ea6be, 0xca759881, 0x92e0a197, 0x6c524fba, 0x68a09ab4, 0xae8c75cc, 0x9d9e92a0, 0x91668b71,
+    0x4d9b9aa1, 0x8ba8899f, 0x777bb08f, 0x8847a193, 0x7d6ca750, 0x9e9f72b3, 0xb64b8b66, 0x5c6e73c8,
+    0x9955d197, 0x8b7ca176, 0xb5ad64a1, 0x638db467, 0xbb6f7883, 0x7d787b86, 0x8a687e89, 0x8ca67ad0,
+    0xa085a88e, 0xa2695f80, 0x86559c49, 0x97e392a3, 0xa270a288, 0x68b48da5, 0x9095628c, 0xbf7271c7,
+    0x8eaf89c7, 0xa1738b8a, 0x51afaa9e, 0x969e9091, 0xbc8c8c8e, 0x7b927f8e, 0xc2aec5a4, 0xb23c6db4,
+    0x676bc67d, 0x999f7e88, 0xa75c9946, 0x7f898483, 0x586a8e65, 0x7a6b6b71, 0x877d6d92, 0x8e62c0bf,
+    0x87a99774, 0x597d9c82, 0xb8a78780, 0x7a8bb450, 0x88c59e69, 0x8a72acab, 0x874e8683, 0x97a298bd,
+    0x998c9759, 0x7d8d7f85, 0x807d7a97, 0x93cc68c7, 0x4f73789b, 0xa4a26f9d, 0x786d7b81, 0x7fa6a892,
+    0x5c6d7483, 0x8c7d7593, 0xa8ad87ac, 0x8d9aa5b7, 0xb4a78f9f, 0xad6c968d, 0x95af5b58, 0xb46b7e6e,
+    0xaf85a37d, 0x817aba8c, 0x9ea79b79, 0x7371b34c, 0x5eb58c6c, 0x868e7381, 0x864fa772, 0xa790b2bc,
+    0x9f5cc384, 0x6c5a917e, 0x6adf5d9f, 0x7a55c549, 0xa7cd6e66, 0x7862c685, 0x826cc778, 0xac88977f,
+    0x71718ed0, 0xa5659293, 0x7fc17f72, 0x94d1539c, 0x4c808a8f, 0x708884a3, 0xaf9b9879, 0x62b36497,
+    0x7c7f43c0, 0x87766fb6, 0x7ebba7a1, 0x5980ac74, 0x81565f75, 0xb278996f, 0x9fc79887, 0xa770969a,
+    0x8d8ba3b9, 0x727fa98a, 0xc3b2a06e, 0x8983bfab, 0x87846a60, 0x516b878b, 0x9592896b, 0x957199c4,
+    0xbb90a4b2, 0x64a89263, 0xadce8f6f, 0xa37b8f72, 0xb7a37857, 0x607a99d0, 0x9a687d80, 0xd6847f87,
+    0x85987d5d, 0x8a896b67, 0x7fa49d58, 0x97c0969a, 0x82b87281, 0x6bc2a8a1, 0x727f96ae, 0xbb9e98b5,
+    0xa7606196, 0x9e72ae9a, 0x889cb6b4, 0x7b868497, 0x93a99370, 0xb387ceba, 0xa7835268, 0xb87263ab,
+    0x55a59889, 0x7b6e789a, 0xa2ba7a70, 0x9c69d798, 0xa17c906b, 0x7688907c, 0xa2a28270, 0x9098ada6,
+    0xd2a99881, 0x6f8ea59f, 0x8bd88c72, 0x9bb9a964, 0xb1cfb18d, 0xc74e5d76, 0xc79db65e, 0xb67d985f,
+    0x6a9161b0, 0x7698a755, 0xa850c7ab, 0x5ab286a3, 0x75b17a5f, 0x65a46c98, 0x697c9770, 0x8c8b9092,
+    0x878a9cb3, 0xac937abb, 0x96807780, 0x6ba3ac98, 0x99899a89, 0xc082598a, 0x9966a9bd, 0xcb578069,
+    0x986f8792, 0x858f867a, 0x74b58fb5, 0x6ab0b47e, 0xa090ad7a, 0x9398917b, 0x8462b67d, 0x9c98a3d8,
+    0xbc9db1ac, 0x8477c79d, 0x83ae948c, 0x7482ae67, 0x9cb2739b, 0x7ba2899a, 0x95aba773, 0xc670827d,
+    0x79839388, 0x7d7d6c5a, 0x7a9aa6b7, 0x8b8059a1, 0x918b4ca2, 0xb56e88c8, 0x83917cb8, 0x856387c1,
+    0x6a8461bb, 0x869fb9af, 0xacb36e68, 0x7a7494ca, 0xb36e6e7f, 0x7e96af84, 0xa0ada196, 0xbca0a26d,
+    0x7c547698, 0x65a089bf, 0xa7a16891, 0x7977b797, 0x9c84a665, 0x7e58a09e, 0x6f8db4aa, 0x8598909d,
+    0xb5937764, 0x7198c591, 0x9297a38d, 0xa97bb66f, 0xa38c7aa1, 0x7b83695b, 0x7b9e897e, 0xb288869c,
+    0x4d99bd93, 0x9e815d89, 0x959b729f, 0xa8ba81d0, 0x657d7bba, 0x81a99893, 0x7d8f9083, 0x93b1589f,
+    0x927873c9, 0x8a8070e9, 0x8f859b7f, 0x88878fc6, 0xa089b181, 0xc0977696, 0x6769a498, 0x7e557256,
+    0x7f9c9f93, 0x8e905f93, 0xc2818691, 0x62b67088, 0x92938667, 0x73b06f77, 0x649ac289, 0x7d7d9896,
+    0x986ed1b6, 0xaba774b1, 0x9091aba7, 0x96a0905d, 0xc39bc994, 0x9f9f847f, 0x94babc73, 0x7fa28445,
+    0x77868b7c, 0xc5c7af9f, 0x8983864b, 0x68918f5c, 0x8a8fa78b, 0x9e91af78, 0x8ca96f70, 0x9d8978b4,
+    0xad639185, 0xac8b7c8c, 0x86bf8676, 0xac948f99, 0x99c992ab, 0x609b8864, 0x8d9a7a93, 0x99ab707a,
+    0xaca0938d, 0x7e99818b, 0x749b7e9a, 0x8160c392, 0xa3768d6d, 0x739fa2d0, 0xb3a78b78, 0x7a9f7679,
+    0xcda97f8d, 0x8d788e94, 0xa493c998, 0xbf6e9bb9, 0x5d9db58a, 0x999d82ac, 0x8f876d91, 0x849486a4,
+    0x915c8987, 0x87718376, 0x747f806e, 0xa6a88876, 0x606b7a9d, 0x70aca68e, 0x859a6d66, 0xa68ebdb6,
+    0x6eaaa78c, 0x9c6a8eae, 0xc2a5c0c1, 0x8793978f, 0x7da1a79b, 0x9978b986, 0x996f7cc9, 0xab857a72,
+    0x8d5599b7, 0x8c666794, 0xbc74726b, 0x939e878f, 0x9cb6a794, 0xb2818990, 0xbd928d8c, 0x92bb7a9c,
+    0xaeb26692, 0x9e8f8498, 0x7574ca6b, 0xa6cba397, 0x59a18591, 0x61988b9f, 0x849eb05f, 0x8b9eb697,
+    0x6d8e9467, 0x839f9273, 0xb4589788, 0x978fb8af, 0x7dba828c, 0xb9b7a38a, 0x859674b5, 0x8bae65a0,
+    0xaf9aacae, 0x84c87a73, 0xa069b17c, 0x65a2967a, 0x8e7d9b97, 0xb89c716d, 0x90a2a185, 0x92608db2,
+    0x957bb27d, 0x95567c76, 0x84b2ae93, 0x7e6f7978, 0x8f786f8a, 0x7d6fa5cd, 0x8c8faa7c, 0x9a6fa2ae,
+    0x76979366, 0x638c9173, 0x97bd7d88, 0x7a92ad96, 0x70b6aa75, 0xb0aa79b6, 0x88ac87a3, 0x58a8919d,
+    0x897b9482, 0x98a19b9c, 0x925890a8, 0x94c3ca5f, 0x808da183, 0xc094908f, 0x83648c8b, 0x87bc9668,
+    0x8b98ae60, 0x7cbd6ead, 0x8f7eb0a5, 0x6a6d9fa1, 0x5c6c957e, 0x9bad856c, 0x9d9c827e, 0x75698291,
+    0x9b805e9d, 0x91c3c08c, 0xb57893a8, 0x549a7c9d, 0xac79b48b, 0xb566789f, 0x8d98c277, 0x6592c678,
+    0x796ba9ac, 0x8491946b, 0x889595ab, 0x8785be89, 0x78a1b28d, 0x999ab9a2, 0x8a79ad8f, 0x80726f73,
+    0xac558981, 0xb5a256b9, 0x9390bc90, 0x8587a29f, 0x699cc995, 0x83aba65f, 0x74c99c61, 0xa9ca9791,
+    0x786e8b66, 0xb4846eab, 0xa56ecd84, 0x79966b8e, 0x66828298, 0x8f9f8c92, 0x8597c66d, 0xaa787789,
+    0x6e7a8faf, 0x8d9884a3, 0x9f70b29a, 0x8a709799, 0x95867fac, 0x597c9176, 0x847782b3, 0x64a37b82,
+    0xaa77949e, 0x6fb0bc93, 0x9b69659e, 0x9386baaf, 0xa7b98c81, 0xb3b7958a, 0x8267949a, 0x74a7658c,
+    0x67948faf, 0x83aaa0a3, 0xa491aecb, 0x868864b9, 0x847a9582, 0x7dacce90, 0x5b7c9465, 0xb6b5918e,
+    0x6184ba9e, 0x7690b66c, 0x8e907f9d, 0xa6739888, 0xbc8b9899, 0x8a68af76, 0xa0958182, 0x98c19892,
+    0x698b7585, 0xba9bb696, 0x807a8383, 0xb5bf827a, 0xa9798d8e, 0xb48184af, 0x889886a8, 0x5cca937d,
+    0xaf948ba3, 0x8e8ab3a0, 0x876ca476, 0xa4b39978, 0x7eb2b35c, 0x88876fa3, 0xaba68b85, 0xb884afb1,
+    0x70709586, 0x8dbe75be, 0x89c49e9e, 0xc871819c, 0x77c09c67, 0x75779686, 0x885ba18f, 0x8b8cad8c,
+    0x9f9fb5aa, 0x9c9d9f64, 0x5eb6b878, 0x989dd2a1, 0x9d938c82, 0x8a746a8d, 0x7bb291a4, 0x53766994,
+    0x9781a2bb, 0xb5ad69a2, 0x759e7ca8, 0xaba35e75, 0x989c8897, 0xa48499a2, 0x9ac4a95e, 0x99817977,
+    0x998c9fb7, 0xa9678f97, 0x9a68a774, 0xb7739882, 0x9fbe9599, 0xab716e7c, 0xb371695e, 0x8d8ab370,
+    0x92b7b367, 0xc599867e, 0x90ae93a9, 0xcd5076bc, 0x73837f96, 0x6a6d6171, 0x83997587, 0x859b7592,
+    0xa57f62a4, 0x88979ca2, 0x9d969a74, 0x73b682aa, 0x7689ab80, 0xad818381, 0x7c7082af, 0x68ba9990,
+    0xa5799d94, 0x9fa1958c, 0xa9cda270, 0xb583857e, 0x8e879a9f, 0xb78b539d, 0x87bd9098, 0x808f94b1,
+    0x70a34b6b, 0x7ca59eb7, 0x89c1859a, 0x569d7c60, 0xbf9383c0, 0x64a78792, 0x818fbf7e, 0xa8ba9fab,
+    0x999baf8f, 0x917954c1, 0xc088c066, 0xa18c9fa6, 0xb29b95a2, 0x7a69ba72, 0xa4af8ac0, 0x7e6d667b,
+    0x8a8e8980, 0x7d97949a, 0x77b18e87, 0xa8b7ac88, 0x969e819d, 0x9da35fa3, 0xc8ad73a5, 0x6f6d9db4,
+    0x63afc47e, 0x7fa29d94, 0x90987a4c, 0x8ea9ae78, 0x9774c193, 0x8eb893af, 0x8f928a84, 0xa3b0817e,
+    0xafa4a58d, 0x57849fbe, 0xc380739b, 0x81ba708f, 0xad78cb6d, 0xaba8ae69, 0x9fbd978b, 0xa29ee27f,
+    0x6f86617b, 0xa58995c3, 0xa25bcf95, 0xd1759661, 0xab9ca89b, 0x8c76a65d, 0x808f7c8c, 0xa27d87a3,
+    0x829cb579, 0xac749595, 0xbf8e8a96, 0x6690967f, 0x928e968f, 0xa58fb796, 0x7c8baa9d, 0x71a6b0b7,
+    0xaeb09abd, 0xc09c808e, 0x928cbba6, 0xc27e779e, 0x9a7b8e91, 0xc5a58875, 0x95b4727f, 0x9faa7c89,
+    0x85685a43, 0xa68f9a74, 0xc8948091, 0x4a96417d, 0xab4ec4af, 0x76a3ab99, 0x755d9260, 0xc2b2b8b9,
+    0xa0ae6b67, 0x9c7993c1, 0x86667cb1, 0x82ab9898, 0x8c877f89, 0x69645a7c, 0x78846e86, 0xa0a69db5,
+    0xafab9c7b, 0x88977895, 0xb187b28a, 0x987f9c92, 0x758a4995, 0x6697be9f, 0xa169a27e, 0x867688c4,
+    0x6e737e8b, 0x84a76f91, 0x947acca8, 0x527cc183, 0x708fad68, 0xbaaeaadc, 0x817a74ab, 0x90a2a771,
+    0xb4a58b78, 0x949a9f61, 0x9e949c76, 0x7e6c4976, 0x8c65b8c2, 0x8e5e8aa6, 0x6e8260aa, 0x869986b2,
+    0x4fc39c85, 0x93a96e93, 0xaf55c37a, 0xac7a8975, 0x7968a662, 0xaa9db1b3, 0xa98f8584, 0x92b086ad,
+    0x9a98b0a7, 0xab54977b, 0x51ad8372, 0x597e8b9f, 0x6e8c83a5, 0x9a6d77a5, 0xaa678fa2, 0xa756b78f,
+    0x759d9b7d, 0x7fd5867d, 0x5c8d848b, 0x88ae919a, 0x82939586, 0xb19da071, 0x97499f79, 0x94728053,
+    0x82596787, 0xa0505e74, 0x876da491, 0x6cac5862, 0x954883b2, 0xc781538e, 0x87b18385, 0xa6bbacb6,
+    0x81849bab, 0xa97e73a5, 0x8099af91, 0xb15098c1, 0xb3489790, 0x947f7181, 0xb0a065ac, 0xdd51638f,
+    0x99b0438d, 0x5ea0ae74, 0x4c88a197, 0x86b0a770, 0x66857d7f, 0xb38ea272, 0xb55dad9a, 0x6674bfaa,
+    0xab70ab9c, 0x90916b8f, 0x89859a87, 0xb7b46c7b, 0x3ea7b981, 0xa5a37093, 0x3f4a914d, 0xa47b8665,
+    0x82834b97, 0xabaea77d, 0xa2687fa5, 0x6b8a8289, 0x8489b7b1, 0xb95296b1, 0x8c6b8154, 0x90a1b56e,
+    0x549ba265, 0xb453b4b8, 0x9252b270, 0xd4828a9f, 0x8662c568, 0x96a675a3, 0xab8568a7, 0xa8865aa2,
+    0xae6178a3, 0x939078b3, 0x9380af88, 0x989a6c7d, 0x659368a8, 0x7d71ac73, 0x737d748a, 0x863d9f9c,
+    0x678c8293, 0x8e717493, 0x9796806a, 0x8395b370, 0x6368a094, 0x6c95acb4, 0x7c87a880, 0x86a8766b,
+    0x7287715c, 0x92559fb4, 0x83865995, 0x8dbf737f, 0xb773a7b1, 0x9e6749b2, 0x81b0cf71, 0x97b1aba1,
+    0xa96b9f87, 0xe3754f93, 0x9368be7b, 0x98716780, 0x9e88827c, 0x72755d83, 0xcf9a55c5, 0xbc7b6270,
+    0x5f59a4a2, 0xa97750a9, 0x9487cab5, 0x958b9b88, 0xafc07089, 0xb7646a62, 0xa57c9e8c, 0xc3b3b3c5,
+    0x815faa6a, 0x9bb66f87, 0x6aa2c368, 0x84a57579, 0x828aa090, 0xc9856cce, 0x8f82a680, 0x93708ba7,
+    0xaa7f9743, 0x8e457f5c, 0x8ac46f95, 0x84a1a682, 0x5c62d1ac, 0x8e5a6598, 0x78b6c48c, 0x86b0a394,
+    0x6b899c75, 0x886fa6bb, 0x9048b4bf, 0xc77bada0, 0x909d8a53, 0x505e53a5, 0xb8ab8d8a, 0xa2987bab,
+    0xbe809494, 0xb5b8aa69, 0xb89080c8, 0x78b394a8, 0x73937d63, 0x98ae918f, 0x84839855, 0x719ccd9d,
+    0x81948b6c, 0x9db368ad, 0x8ba383b2, 0x975e64ba, 0xaec2a888, 0xafb8ab95, 0x61ad9a75, 0x63828a83,
+    0x806a957e, 0x8d7c815c, 0x837a4d81, 0x83807da2, 0xb262beb4, 0x7a8497ad, 0x99898170, 0x89a4837e,
+    0x64b0b06e, 0xbc809cb5, 0xc37c7f70, 0x7ca26f80, 0x7e80bd93, 0x7dba8c7b, 0xae655f9c, 0x7d9b9d92,
+    0x8b969aa4, 0xc5687656, 0x5b7dc469, 0x6faf867c, 0x77c354a0, 0x8cb85267, 0xb89c7275, 0x8299ad8d,
+    0x77857d8e, 0xaeb26e90, 0x6798a1aa, 0x75ab6ba4, 0x839a8c8b, 0xa68190a8, 0x79719b73, 0x84aa877f,
+    0x66768b7d, 0x8d4972a1, 0xad9294ad, 0x947e7b77, 0xab859d5e, 0xb6585c82, 0x63b3a37f, 0x999cb087,
+    0x9f899b93, 0xb1839cb5, 0xbb5aaa84, 0xac99bb98, 0x749ea946, 0x8dab7f62, 0x95c34c9a, 0x96aa5a96,
+    0x97996677, 0x83895d8d, 0xc6747d8a, 0x437582a8, 0x93875486, 0x97b1c78c, 0x846fb3a7, 0x68a893be,
+    0x896f7d7a, 0x8f946879, 0x8772bd78, 0x828cb589, 0xa290c5af, 0xab997f99, 0x90897096, 0x81a69ea2,
+    0x84489e7e, 0xc8348c80, 0xb8a869ae, 0xa0a25674, 0x6a6a827a, 0x826865cf, 0x9f7f8e74, 0x7da084b2,
+    0x93a2b161, 0x857d5abb, 0x7e88cb8e, 0x847d6a9e, 0x4889a970, 0x8a90928a, 0xb9ba6082, 0xbab2ad76,
+    0x729aa6b6, 0x6580a282, 0x7ca7cabe, 0x6193b48d, 0x648c7caa, 0x8c6ba257, 0xa39a9570, 0xc0bb7497,
+    0xc370bc9c, 0x959c8d85, 0x6f718595, 0x6966a455, 0x76988689, 0xbe859b95, 0x97967b7b, 0x56b27793,
+    0x977f8481, 0xa9347aa2, 0xbd886594, 0x646e8cbe, 0x77789374, 0x87abb690, 0x896ebc63, 0x76c3a1a4,
+    0xaaa9c370, 0x95619cb2, 0x8052a9c0, 0xbfa29382, 0x5a9e8458, 0x5f7548b3, 0x956b71a4, 0xa4a3786e,
+    0xaa6a9d6b, 0x69a678a4, 0x86646ca2, 0x439ea37c, 0xb870748c, 0x7b8a5772, 0x8fa988c2, 0xac5e9294,
+    0xc8928b9e, 0xb5995c56, 0xb58aa762, 0xb2be9a8a, 0xa688b984, 0x7b795f8e, 0x8886ba86, 0x3b77a095,
+    0x7f648f75, 0x99706f88, 0x967e70a3, 0x8d5ebc6b, 0x865d8d79, 0xbc8e6f7d, 0x5faa898a, 0x83a18277,
+    0x97b27291, 0x836597c7, 0x96a289af, 0x8fc59fcf, 0xa586b150, 0x8a72739d, 0x99855e9e, 0x7cbc9996,
+    0x8b66967d, 0x854d47a0, 0x897880aa, 0x6a7bb687, 0xa09e4f84, 0x678ea57a, 0xc08b957c, 0xb8a0a190,
+    0x7973976d, 0xba9f775e, 0x65928584, 0x8f62c469, 0xa4a3987a, 0x7d8e9e92, 0x9877a37f, 0x7167aa98,
+    0x7e7c8c9e, 0xa576bb7c, 0x948f74c5, 0x9ca3c05b, 0x7398ab5f, 0x82948abe, 0x798080a4, 0x96c458b1,
+    0xa4a69742, 0x8176556c, 0x818a87a1, 0x9d90697d, 0x8092858f, 0x84966c75, 0x7991b4a0, 0x738f7fbe,
+    0xbd948dc3, 0x817675bf, 0x9270a59f, 0x757bc97e, 0x87bcb68c, 0xbc6c8975, 0x889c8888, 0xac92bd8d,
+    0xa0b09497, 0xaaad9094, 0xa484ce9d, 0xb497a381, 0x97688295, 0xa3a4827f, 0x8477ac4b, 0x689294c9,
+    0x938caa6e, 0x9b73819a, 0x97bcb180, 0xa0a86c83, 0xab6a7f7e, 0x8d7d8a9e, 0x8164be7b, 0x766a696f,
+    0x896d9d61, 0x99b09397, 0x7f9db77b, 0x969774bf, 0xb085a69d, 0x92b2b1a3, 0x97855572, 0xa0a55fa3,
+    0x7c56b092, 0x918d6883, 0x699681b7, 0x7eaa848f, 0xa49d6d81, 0x9c9eb47f, 0x9aa9ad91, 0xa99e57aa,
+    0xca79967a, 0x8aa8a377, 0x95c89aa6, 0xb5789ac0, 0x9f81979e, 0x93b29a88, 0x6d828d74, 0xb29a8ca6,
+    0xaf82ad8d, 0xa0a790c1, 0xb9b9917f, 0xa56a8876, 0x9eb4b083, 0x8f628aad, 0x64716c5e, 0xb295b0a0,
+    0x7f718b78, 0x8a87a56d, 0xb58865c9, 0x92a37f64, 0xac789b73, 0x57bd72a9, 0x72b2a481, 0xa88b9fbb,
+    0x636987af, 0x769153a6, 0x6ab192a6, 0x66a28788, 0x8c68c26e, 0x85ba7988, 0xad989ac0, 0x7d72a28d,
+    0x8f5e6b99, 0xa16b7ba6, 0x87939d89, 0xb180a58f, 0xa66dcebd, 0x60a4869c, 0x7263b764, 0xb082b493,
+    0x87c59da4, 0x7fab9f96, 0x7f9a87bb, 0x9c95cc93, 0x87be92a2, 0x7b7d7082, 0xaa75b1a3, 0x895a75b4,
+    0x92a69f7a, 0x737e645e, 0xbab37abf, 0xa4cfaf8c, 0x777d946e, 0x6f91ba8b, 0x469a898a, 0x84a4a0b4,
+    0x8387c06f, 0x84bb81a2, 0x547b92a3, 0x6a8a859d, 0x8b71909a, 0x98918975, 0x94ce76b5, 0x9c709da0,
+    0x91999aaf, 0x8777869c, 0x96bfd4bc, 0x92758a5b, 0x9b866881, 0x988f9a98, 0xc17ac689, 0x96ad9fc2,
+    0xbb9abe76, 0x6584a064, 0x5aaf6788, 0x889ba386, 0x8ba05e91, 0xb46175a8, 0xa45d8878, 0xb3836278,
+    0x7ba77590, 0x4e818b97, 0xb563ac92, 0x91a37d5b, 0x956a999c, 0x6ebb8a87, 0x8586bea6, 0x97966a9d,
+    0xa17595ba, 0x95cc7fbd, 0xadb08e9f, 0x8d817196, 0x74667473, 0x8a62aebf, 0x80a68088, 0xb5b99686,
+    0x9d95a571, 0x916a877b, 0x6caab7a5, 0x73b1be7f, 0x99baac8f, 0xa6809887, 0x7764c267, 0x90b8be91,
+    0xb174b082, 0x80bc8e7b, 0x9787908d, 0xb9789953, 0xbe7cc489, 0x71967162, 0x91878b6e, 0x746a439e,
+    0xd3886d85, 0x478ea031, 0x8f9b9a70, 0x8bae9e85, 0xab6d875c, 0x8ab46db3, 0x87859287, 0x5eb470b1,
+    0x7b9b7cb4, 0x64a65fb2, 0x8bb68b8b, 0x898691ce, 0x92a7967a, 0x967b5b97, 0xa0979ca5, 0x93746da0,
+    0x3dab67b8, 0x6e8697c5, 0x98868f8c, 0xb47ac498, 0x706ca680, 0x628c8e7b, 0xac90aeae, 0xa74ac38e,
+    0x93d6b198, 0x5cc5b9ba, 0x4abd766b, 0xb3c0b0a4, 0xa1ee8299, 0x81acac76, 0x95b4aba8, 0xb94f806c,
+    0xaa547f9d, 0x71a95669, 0x86869c6c, 0x8a7f7954, 0x76908b7b, 0x6f8c779a, 0x8e8a8d81, 0xb3b1b76b,
+    0x9ca38d98, 0xbda99976, 0xaab670b2, 0x94b2bbae, 0x779dc883, 0x90977778, 0x74548573, 0xb77b5597,
+    0x96865fa4, 0xaa88a06f, 0x6491bfa4, 0xa597d667, 0x86906263, 0x6a797282, 0xa5886c91, 0x818a73a0,
+    0x96ab6881, 0xa2958689, 0x8b799076, 0xa0b09865, 0x8a869e6b, 0xa58d8d65, 0x82948a70, 0x93736268,
+    0xa8664b65, 0x95a9a3ad, 0xae57b077, 0x8b769b94, 0x818b96b8, 0x6a87a7c3, 0xbf7d87bd, 0xae808993,
+    0x79924e92, 0x738c9875, 0x65b8a2d8, 0xbbb1d085, 0x9c5f9874, 0x7270a16d, 0x887a6b7d, 0xa196715c,
+    0x87905d99, 0xa66b7cbe, 0xa090a9a2, 0x88b8b488, 0x9e92b1a3, 0x8aa77566, 0xafaaa08e, 0xbf8b7c9d,
+    0xa0aa80a1, 0x8c7b898e, 0x7f658c5c, 0x879fb7a3, 0x88988bae, 0x78747f69, 0x76976db2, 0x899bb17b,
+    0x967f8388, 0xa15591ab, 0xc0829673, 0x98a8c781, 0x6da06a93, 0xcb71a366, 0x9195948b, 0x8d856670,
+    0xb06d7dd6, 0x5f708b6b, 0x6fb08475, 0x936d7756, 0xa1b85698, 0xaf9b92a7, 0x6a8fb181, 0xa77c8780,
+    0x8da297af, 0xa9669486, 0xbd69827a, 0x749fa7a8, 0x7c73838f, 0x80638285, 0xa9c09db2, 0xb2aea89b,
+    0x916bcb89, 0xb4708aaa, 0xbd8eb991, 0x6dae8763, 0x97886e93, 0x9c62b27c, 0x758fb0a8, 0x677b6679,
+    0xa462a6aa, 0x9b919aab, 0x9f9c7a62, 0x8db3b1a7, 0x8096acb9, 0x69886e72, 0xbd819a99, 0xa0ae66a3,
+    0x836984bb, 0x837a99ca, 0x98a3877f, 0xaabb90a9, 0x7e525c8b, 0x7b7e708d, 0x8a94768d, 0x74868d87,
+    0x71ae8e60, 0x92ca8259, 0x9fb17e94, 0x8492a289, 0x8180be5e, 0x939caa7f, 0xa78d7590, 0x6d82c594,
+    0x78c886a6, 0x8b5b9693, 0x998fa1c4, 0x7191879a, 0x9a887fb5, 0xa78eada8, 0x878eb0cb, 0x969dab63,
+    0xc0b78e72, 0x85cb7072, 0xa19aa669, 0x7a8abcae, 0xbd767e6a, 0xc77a9692, 0x9998ac78, 0x8f989596,
+    0xb4a0a7a5, 0x899b84b3, 0x7398af92, 0x946d9391, 0xb48a7557, 0xaca28da8, 0x9db9c77f, 0x97b1797c,
+    0x7aa5815e, 0x71a195a2, 0xaaa0707f, 0x8a638c71, 0x8461ae90, 0x8c896ab3, 0x7c7d987d, 0x8ba7aca3,
+    0x87785f91, 0xa37474c7, 0xa1928d9d, 0x7b5c7da2, 0xaaa97da5, 0x9297857f, 0xb0adc4a5, 0xa28b8c8d,
+    0x89b68fb2, 0x58a370b0, 0x945a7482, 0x99b07fb4, 0xb2639a79, 0x5f9a99a7, 0x707d5a9b, 0x988c858b,
+    0x88b77576, 0x81979896, 0x9c827799, 0xa3adaabf, 0x65a36494, 0x82669288, 0x97c7a386, 0x83a45c85,
+    0xa9b38fb0, 0x8daba4b2, 0xa494a865, 0xa2a67e6b, 0xb291a3a5, 0x688c9b78, 0x6fb08983, 0x90a06eae,
+    0xa2b2a472, 0xb47580c0, 0x98b08ea9, 0x7199ad9a, 0xb19fc4b8, 0x6c7dc08b, 0x768693b3, 0x6c71c5c8,
+    0x90b39cb5, 0x828472a2, 0x878fae9d, 0x9a9894b1, 0xc0b98069, 0x919e8f94, 0x6f695b7b, 0x5c918e6d,
+    0x729ccf7d, 0xb98aba90, 0xa57e86a8, 0x6f7461a8, 0x93be876a, 0x7d7d749a, 0xb58d7ea1, 0x787f9b9b,
+    0x857bc168, 0xc0a486a8, 0x799d8491, 0x81a9a8a3, 0x9b91ac8b, 0x85b4ba6c, 0x797ea37e, 0x7c86b7a0,
+    0x7ca787ac, 0xb1a291a7, 0x7873b583, 0x528f72b8, 0xbe81b098, 0x8f939b98, 0x819283ae, 0x5e9ac9cc,
+    0x7158979b, 0xa66e9e89, 0xa790d599, 0xb59c7380, 0xb8af8378, 0xba917190, 0x69a3b859, 0x8fa56f7d,
+    0x9cc3c36b, 0x80a0a369, 0x716e8690, 0x6899638f, 0x68c09e96, 0x9a70a289, 0x9f9196a8, 0xad90d2ad,
+    0xc393a28e, 0x9a829980, 0x849f9470, 0x62875f9b, 0x936373a9, 0x839c6fa0, 0x5584587a, 0x6c7a9d6b,
+    0x90906064, 0x889aa096, 0xa67e58a9, 0x9fa373a9, 0x6bd17c7c, 0x95a48297, 0x708d9e59, 0x5f9199c9,
+    0x69917c61, 0xc7a97b95, 0x7a8e6385, 0x837a8079, 0x8ba765b2, 0x939d9596, 0xaea36c6b, 0x6f855aa0,
+    0x8bb87f98, 0x85b68980, 0x8a957ca3, 0x9fbc6b5e, 0x859a9575, 0x6b6e857f, 0x9e775d7d, 0x7f7e8a87,
+    0x7bb898c1, 0xa7c5767d, 0x8683d0ab, 0xa1c47c9b, 0x7f616e6f, 0x8eb57872, 0x8465b66b, 0x81a78a83,
+    0x74a44eaa, 0xa4a7916a, 0x927c935a, 0x6c8ba269, 0x8c66abbc, 0xb7b2a479, 0x7e9caaa6, 0x8baebba2,
+    0x9ba9b75e, 0x7385625e, 0xb089d2b0, 0x73756d75, 0x82a88772, 0x6f8c7486, 0xa4677c90, 0x837aaa84,
+    0x6d7d9985, 0x77ad7186, 0x6d9995ad, 0x876b6d53, 0x7997b59f, 0x86876ec2, 0x78a2ba9f, 0x40819c9c,
+    0x90889f95, 0x63bcbfa4, 0x8ea47d8b, 0x846659ad, 0xb295535e, 0xa5667988, 0x7a796f88, 0xb585875d,
+    0x6c8d7675, 0x9ba8618e, 0xbc725c94, 0x73b072be, 0x9c8f91eb, 0xa3b47995, 0x8ca07d73, 0xa065afb2,
+    0x857275af, 0xc7b255d4, 0xbd9dbf99, 0xa08c8daa, 0x9e8270c1, 0x698797a7, 0xa57dab9f, 0x6e6776c0,
+    0x9c977aab, 0x91a599b4, 0x769bbf7f, 0xb48ab8a5, 0xa99384b7, 0x79776f75, 0xa2ab9f83, 0x8c62cb9e,
+    0x7a75a079, 0x8ddb8d8f, 0x84aaa876, 0x67a17c77, 0xa99bc275, 0xaf749f89, 0x85736f5a, 0xa4696974,
+    0x6e91935c, 0x8a879d76, 0x9a8abc81, 0x909e8871, 0x817c9e90, 0x976e47b7, 0x8d5c7b96, 0xa199e1a6,
+    0x705e8c78, 0x868e8278, 0xa857b88c, 0x98835675, 0x9c5c9586, 0xa7a5525d, 0xcfcfaf9c, 0xbf6d95bf,
+    0x90796ba3, 0x69b4b4ce, 0x99888094, 0x8e7d6b96, 0x678b6c7e, 0x687c575d, 0xae8490a3, 0x814db381,
+    0x9dac9753, 0x719ca973, 0xb1a79e8c, 0x7795728c, 0x5b96b64d, 0x8f8ac25e, 0x9179a580, 0x898f9e84,
+    0x93915996, 0x7880bc5c, 0x8a949580, 0x75ab6f92, 0x767eb4a6, 0xa1958567, 0x6592a4bd, 0x8da1ac78,
+    0x528d6490, 0xbda492a6, 0x7c68b259, 0x816a92af, 0xb63dbac0, 0x7f9e866e, 0xc37c78ae, 0x9d7f997e,
+    0x9f8a8bad, 0x78867282, 0x9aa3bf95, 0xb586a57b, 0x72bb7f87, 0x926cbfae, 0x847387b3, 0xa961baaf,
+    0x586e94a7, 0xb3ab816f, 0x9880be78, 0xa6799990, 0x7ea0bc6b, 0x99909ab9, 0x5a7f908d, 0x7c9fb6a5,
+    0x7690787c, 0xa0997384, 0x80877880, 0x8e7f4774, 0xce4d93bd, 0x987e4fad, 0xbd8b9486, 0xb4a9a7a5,
+    0x8b8c7497, 0xaf5f74be, 0xb479b588, 0x92ae7995, 0x706c9c92, 0xa7a06a7e, 0xc7948e84, 0x8a817f97,
+    0x5c5285a9, 0x717b9084, 0x97776e9a, 0x5d63738d, 0xa3a87a89, 0x8ea36e92, 0xac5d8e95, 0xa35a9772,
+    0x5fa8846e, 0x68ab94b4, 0x7c6f8845, 0x677a9797, 0x7aafa976, 0x56788e86, 0x3e77a963, 0xa46f6e8f,
+    0x92a76e6c, 0x77ad7e4f, 0x7f8e8796, 0x5a808f72, 0x71777d8a, 0xb185a0d4, 0xa57696ab, 0x9aa0a49c,
+    0x91a8b085, 0xa560c1ab, 0x7d589893, 0xae87a185, 0x75899189, 0x78b77a7c, 0xb6b3a7a0, 0x79947c8b,
+    0x95557771, 0x6dc36084, 0x6e8b70c9, 0x7d628d7e, 0x90a89772, 0xc0579186, 0x9691c2ba, 0x94557391,
+    0x9297b796, 0x87ad7194, 0x6faac5b7, 0xa35f7ecd, 0x6883829f, 0xa790ab93, 0x597da17b, 0x60739599,
+    0xb57ec35a, 0x6f5f5992, 0x98b18b76, 0x608583ab, 0x685ab7af, 0x8f775699, 0x977cca7e, 0x5976c0ba,
+    0xc4a57a6b, 0x7490a4aa, 0xa181b667, 0xc78b5f94, 0x7a8c8e73, 0x8d738d91, 0xb185b26a, 0xa5645371,
+    0x81aeb5ad, 0x98bb5272, 0xbc86a07a, 0x6a60b671, 0x819aacb5, 0x89b8757b, 0x9f58b5a3, 0x6e6dacae,
+    0x8b6eb583, 0x8c9da293, 0x8489ae85, 0x917d928b, 0x7e8092a3, 0x759297b2, 0x529b4e63, 0x62995283,
+    0x9caa8a7a, 0x8f9aa395, 0x9286619f, 0x61b756aa, 0x8da8aea1, 0x9a7e7baf, 0x83b9a67b, 0x8d9f7191,
+    0x8b879779, 0xb184ab98, 0xa38f978e, 0x6382a990, 0x81a0a17a, 0x62508992, 0x947c6499, 0xada68b71,
+    0xaa676b94, 0x558b5e98, 0x8168c36a, 0x58a6a17e, 0x8dab906c, 0x8478835c, 0x8e5f8881, 0xb098b089,
+    0x9ca2928d, 0x7598ab6a, 0x5e667f9f, 0x8765b780, 0x889d9294, 0x71915aa1, 0x8a8c63a8, 0x6a8a8a84,
+    0x85788c95, 0x77b17cb7, 0x828962a4, 0x5aa59980, 0x8ea27c64, 0xa07a83b9, 0x86c49f94, 0x95a48d91,
+    0xa4a1a56b, 0xbb76a09d, 0x95b1a6b2, 0x7196a49e, 0xae869579, 0x7a6e7c92, 0xa2aa7984, 0xbc84826d,
+    0x9bb16a98, 0x8d437370, 0x9a9b71a9, 0x7cac8a9e, 0x7cb37c79, 0xce867770, 0x86909aa9, 0xc85b8286,
+    0x89b4be96, 0xa3b980a8, 0x4ba5ab70, 0x7aa19579, 0xa5a28b69, 0x87b19a6c, 0xc69775b4, 0x82ac978a,
+    0x5051ae6d, 0xb3566aa1, 0xc071a0a9, 0xa39895b6, 0x777078ab, 0x979faa65, 0x7ca7a093, 0x6784c57b,
+    0x98c1bd79, 0xcc7b9891, 0xa68e858e, 0x8f7a897e, 0x4e9b9f93, 0x738a5ab5, 0x9ca0699a, 0xa998808a,
+    0x90baa27f, 0x556d7084, 0x95a7a9a1, 0x9996819a, 0x7abeaea8, 0x859c8f96, 0x8895b150, 0x745a6b9e,
+    0x9175b976, 0x6b939485, 0xab907fc6, 0x718c58b1, 0x7993ada3, 0xd3af94b4, 0x9c8f6a86, 0x7c929f77,
+    0x4b79607e, 0x967f8895, 0xb07d61a3, 0x76a794a8, 0x709488a5, 0x71687097, 0xb685a6c4, 0xb191977e,
+    0x89b5ae50, 0x74a88383, 0x72889e83, 0xc0b5a082, 0x7abe6369, 0x61b04b5e, 0x979e83a9, 0xa489a295,
+    0x94aa61ba, 0x5a79335c, 0x8a7fc98b, 0x3fb1a4b5, 0xb29e7fa5, 0x9781cc75, 0xae6ea966, 0x7c688d97,
+    0x7ec8906f, 0x8a9b899c, 0x848189bc, 0x87907f94, 0x7d71c57a, 0xc7ada37c, 0x95c0687c, 0x5783a17d,
+    0xac7ea581, 0x8b9eb187, 0xae6e7f93, 0x7277a286, 0x8075b072, 0x6c7a55b8, 0x81b3927d, 0x91c8acbe,
+    0x88ac933f, 0xb1858585, 0xa55d9885, 0x9d9f508e, 0x7fb9919b, 0x837b7974, 0xa2796877, 0x7fc0af7f,
+    0x848c64a1, 0x6c887c98, 0xb5779f7b, 0x647d818c, 0xbbb08299, 0x97ba8a62, 0x81969688, 0x926c9795,
+    0x9ac1a895, 0x7acd7481, 0x5e8f8b8f, 0x7ba48f81, 0x829f6da9, 0x7ab0be8e, 0xb9958b5f, 0x4da5b16e,
+    0x9baebb3d, 0xbc6876a5, 0x8a74569c, 0xc9a49096, 0xa59aa569, 0x7ea065b5, 0x8a83a9b7, 0xc8a68588,
+    0x85beae65, 0xa8858e81, 0xb9688c9a, 0x8b9f945f, 0x9ba58478, 0x4ba05caf, 0x99bda58a, 0x8aa284b3,
+    0xba6b82b9, 0x48924a7c, 0x87797bb4, 0x4dae9a7d, 0x928e9a74, 0x7bc9c98a, 0x726787ae, 0x5d7fb9c6,
+    0xd49c7e53, 0x91947b88, 0xac5ba069, 0xaab3d58b, 0x905bb6a2, 0x967e7a75, 0x86a89ab0, 0x6a905ecd,
+    0x63817fa1, 0xa29ba385, 0x858c60a4, 0x896b8d8e, 0x75b5ae62, 0x9197876a, 0xb7ac8d91, 0x9fc568c1,
+    0x958aa03d, 0x92718abc, 0xab879f95, 0x86c5aa5f, 0xb8947f5b, 0x6a996b76, 0x77759d9c, 0xca7f916d,
+    0x7c299d9b, 0x92bd7f6d, 0xaca1ac82, 0x569982a7, 0x716b8778, 0x9097a671, 0xb289927f, 0x8b6c80c1,
+    0x718b9691, 0x8692989e, 0x848da4ac, 0x908f9971, 0x5d8cbb70, 0xd27891bb, 0x669fac7f, 0xbe745fab,
+    0x8779b660, 0xbe957d75, 0x9c956b9b, 0x848f75a7, 0x8ba98056, 0x6baf7ea4, 0x9057889d, 0x8e90a773,
+    0x69d5c133, 0x9a6298a9, 0x7569b693, 0x95d79659, 0x9d929961, 0x77945d85, 0x987b7f66, 0x9b85b5c2,
+    0x9b50959a, 0x97ae7db3, 0xb794c0ac, 0x75797586, 0xb48386bc, 0x82ac7886, 0xab8e7fa4, 0xa89f996c,
+    0x937772a7, 0x8ba6689e, 0x74ab897f, 0x8a928c57, 0x7aa08561, 0x7f999568, 0x71829280, 0x717faa93,
+    0x9d518b7b, 0x80a79094, 0x5e806f93, 0x7b8c897f, 0x6ba9885b, 0x99979b86, 0xc66b995d, 0x66b66b99,
+    0xc1969549, 0xa3a0987a, 0x968ec079, 0x97ab9581, 0x86bf9973, 0x80878b9f, 0x617c70b1, 0x8d80b071,
+    0xa23dafa8, 0x6b9b7994, 0xb78d7184, 0x988c7f7c, 0x85b1957d, 0xa1ba7072, 0x978f9499, 0x967e92b8,
+    0x98a1ac87, 0x8d8e9579, 0xa4c99b89, 0xbc8edf9e, 0xaa6277b5, 0x85717e87, 0xa7b9bf93, 0xba6d88a1,
+    0x75b39374, 0x7885ab88, 0xb07a787f, 0xa182b26b, 0x6ba38a64, 0x8f999777, 0x96ac769f, 0xa69788a8,
+    0x98838d7e, 0xb6658fad, 0x967b63b5, 0x76bb8f85, 0xd2649383, 0x7fa445a8, 0x5b8a84a6, 0xb38790a1,
+    0x6c617286, 0x98c56a7e, 0xa7868d91, 0x5b68c06f, 0xb6928570, 0x738b7d6a, 0xa2a08067, 0x9f9b82a0,
+    0x85848e77, 0x637d7696, 0xa0998483, 0xa6c5a78a, 0xa04e96b4, 0x8bb07960, 0x9176a8a9, 0xb99eaea6,
+    0xad889785, 0x7e9dabb0, 0x5c967598, 0xa9917aa5, 0xacd77d66, 0x7e9b6e76, 0xc6708f5c, 0x6c955072,
+    0xa282764c, 0x70a7a279, 0x5eab92a5, 0x68e29f73, 0xa398a056, 0x82774697, 0x6db9aa87, 0xb45f716b,
+    0xa59483b2, 0x66ab85a2, 0x598daed3, 0x60a6919b, 0x854a8288, 0x9acb7274, 0x8d794dad, 0xc5a19c92,
+    0x81b4859c, 0x9a4a6f69, 0x91cc909a, 0x9aac926f, 0x6f898896, 0xaabbbf84, 0xb1857686, 0x877e78ac,
+    0x98bdcc6f, 0xa7a18b5b, 0x644356b4, 0x9673ab8e, 0x6fdd585e, 0x8abac286, 0x8f608472, 0x6d986a5f,
+    0xb07b8f57, 0x7d8fa674, 0x92ae9197, 0x99b88fa4, 0xc25ba16b, 0xad7e83b8, 0x598e9660, 0x4f9498c3,
+    0xadb5a39f, 0x6680618b, 0x7dbe8ed1, 0x967d9386, 0xb7798f98, 0x969f5e88, 0xb19e70d9, 0xb4c94676,
+    0x62667a95, 0x9653b86a, 0x86b3aca6, 0x93a5a995, 0x6a548a90, 0x52929192, 0x637892b4, 0x9f699886,
+    0x8fb5a6a2, 0x749cd558, 0x607d8f66, 0xb088ce89, 0x7d82875b, 0xbb9c8774, 0xbb5a9b9b, 0xa28a3293,
+    0x7ea29d57, 0x647f906d, 0xaa5aa986, 0x80ce848c, 0x9479699e, 0xa38e59a9, 0x3d8fa4ad, 0xa1928dd0,
+    0xb957bf9d, 0x6d566dc4, 0x7e754e9c, 0xc3ada88f, 0xd85a8d98, 0xaa8a9697, 0x72a686af, 0x8891ab76,
+    0x989c9db4, 0x798da7d6, 0x97817789, 0x9b5fc66e, 0x59709f6b, 0x8c8db0a0, 0x9a6a6b74, 0x8f82bcca,
+    0xab9eb2a5, 0x55a0669e, 0x928b7181, 0x5474cb84, 0x91d15194, 0xcba4be75, 0xb7a085b2, 0xb9806e67,
+    0xc373676e, 0x889e9886, 0xaf929c85, 0xbed78f8c, 0x6084a269, 0x9f7d7186, 0x5699b19b, 0xa989958b,
+    0x9ba3a6cf, 0x976d8c77, 0xbe8493c9, 0x9ba5bc5d, 0x8d60939a, 0x458c6cac, 0x4f838e5b, 0xd7675baf,
+    0x8965748a, 0x7db377b0, 0x9995955b, 0xa2cec9c5, 0x807578b3, 0x718989a7, 0x909d9583, 0x998179ce,
+    0xa85da394, 0x8c78c08f, 0xa878af83, 0x948eaab4, 0x977372a7, 0x6093a893, 0xd8a9b690, 0xaa9e7185,
+    0x97b79a7c, 0x54b1ae7d, 0x87b5a183, 0xbfae7d92, 0x9e81b77d, 0x814eb593, 0xa183647c, 0xc7af73a5,
+    0x969ba9a3, 0xacb67b6f, 0xc084568c, 0xb97ea5b6, 0xa67e709f, 0xad9b6867, 0x8a787048, 0x797e8784,
+    0xaa91a277, 0x6989a491, 0x8bb99ebc, 0xa195a2a1, 0xb6847fbe, 0x94698881, 0x8481b4b8, 0x848a8191,
+    0x80569a9e, 0xb59367ae, 0x93a572b3, 0xb6829db6, 0x6c696f8a, 0x8ba5a351, 0xdb62997c, 0xae8771ad,
+    0x768778a8, 0xa0a57094, 0x6d937483, 0x898981b3, 0x93c59667, 0x8db47ec0, 0x98bc9ca5, 0xac82b0a9,
+    0xa1b970b0, 0xbea2cd81, 0x59bc6e91, 0xb47cbd8f, 0x8174839d, 0x89748471, 0x9b89978d, 0xa1648aba,
+    0x807387ab, 0x99b67bd1, 0x6d9ba58b, 0x9ba57d97, 0x9bca9295, 0x9f85836c, 0xa2c09a75, 0x9ca57c64,
+    0x7e7e8493, 0x98b181b6, 0x9c62aa92, 0x81a1c15e, 0xa58ba47f, 0xc0739d7e, 0x618a8d84, 0xa79699c2,
+    0xb3549489, 0x7369a255, 0x817d638f, 0x5e9ca47b, 0x6d958355, 0x999e7698, 0x8fb8cd67, 0x9370b6b2,
+    0xa196849e, 0x7c8282a3, 0xafb58578, 0x8f5d7897, 0x83557375, 0x8e81ab8c, 0xb57e8a92, 0xa6967b92,
+    0x91b09e9d, 0xa559789c, 0x8c9891b9, 0x8c83c879, 0xca86767f, 0x7ca99677, 0x8aba82a4, 0x7b706683,
+    0x807f9f83, 0x94afb295, 0xc7aeb2ab, 0x89a2ce6c, 0xc8b79381, 0xaaa17b89, 0x86b55c8d, 0x9f708cab,
+    0xa0a8918d, 0x90889cad, 0x9dabbdb2, 0xb6787ba9, 0x84906681, 0x4eb1b3a6, 0x63897d8d, 0x7f6ab165,
+    0xcf8e969b, 0x799d94b5, 0x909b9684, 0x9ea7bbc5, 0x94908f9a, 0xc7b598b4, 0x918b677e, 0x9c899fc1,
+    0xa2a7ba8a, 0xb98e7a5f, 0xab989f8d, 0x84918f57, 0x7984be88, 0x7f849e74, 0x6584a16a, 0x936296ae,
+    0xbb997799, 0xbfc09982, 0x809e8c8e, 0x91829894, 0x536f7c70, 0xc49c8aa8, 0x6cba7a8b, 0xbcb172ab,
+    0x96b37a98, 0x74a7a5b9, 0x936e9c76, 0xadb17daa, 0x918fa4bf, 0x77967d7f, 0x748fa687, 0x62b79ea5,
+    0x9b93cf8a, 0xabb8c598, 0x9f718177, 0xaebf6792, 0xc3a18f74, 0x74827ca9, 0x9ec1adb9, 0x9a72849f,
+    0xa9807680, 0xae9b738f, 0xab9a825f, 0x8ba29a98, 0x78997d7f, 0xc862957b, 0x9e9b9056, 0x6c7d9180,
+    0x8b7eb499, 0x858e8b98, 0x9a74a651, 0x9f888ca6, 0xad8fa2b5, 0x878b7389, 0xbca2845a, 0x638a9eaa,
+    0x9cc39899, 0x6ba78684, 0x9c67687a, 0xb7796b88, 0xb08f766e, 0x9a9d9b9c, 0xd68e9f81, 0xa4937890,
+    0x80beb876, 0x767ca895, 0xb8618eb2, 0xb77b8065, 0x8687b1a3, 0x617e75a5, 0xabc2837a, 0x505e9c9b,
+    0x9f76a56f, 0xbcae6a4c, 0xa5ae9075, 0x7c67b5a3, 0xab88a765, 0x8180575b, 0x9694917c, 0xce6f8779,
+    0x7b7b91ba, 0xae96976d, 0xc687ac79, 0xbea9896a, 0xb2888d8c, 0xa1bfb192, 0x49639c7c, 0xc5b2d394,
+    0x607dbfa2, 0xa0888dc7, 0xa16bb880, 0xb96170a0, 0x9b82c198, 0x9ca17f58, 0xa39c777d, 0x639a78c2,
+    0x9993ab92, 0xa38ea689, 0x759bba7b, 0x9d915687, 0x906f7ab8, 0xa7979ba9, 0xbbb16e74, 0x639fcddf,
+    0x68776f5e, 0xa4827aad, 0x92b9acb5, 0x63948a8e, 0x89ce936d, 0x8282a171, 0x98955d56, 0x94989c6f,
+    0xab7e48b5, 0x80738a7f, 0xa79b847c, 0x92729f6c, 0xada182ca, 0x718195ac, 0x58ba9bbd, 0xad99bbcd,
+    0x6879b2cf, 0xc79279c8, 0x938380ab, 0xac737ca6, 0xaa9bc588, 0x959a765e, 0xb0899c6b, 0x91828f81,
+    0x636f7274, 0x84a483ad, 0xa898958a, 0xbaa9a293, 0x7e619aba, 0x5498b5a3, 0xa774b88b, 0x9d93b27b,
+    0xa275838f, 0x75778193, 0x66a8c98e, 0xb9cb7977, 0x739eba6d, 0xb379ab8e, 0x51bd9c8d, 0xad835d72,
+    0xcc8a8377, 0x54cd8869, 0xa27288a5, 0xc8d6498e, 0x9c95b1a7, 0xab9086a6, 0x76846273, 0x858f9eab,
+    0x877384c6, 0x5d8d619f, 0xb37992a5, 0x65958574, 0x7f92af99, 0x92513b53, 0x9fb8697e, 0x7d969b8f,
+    0xae8bb082, 0x6ba1b188, 0x829ea78d, 0x84ae93a3, 0x69a5a3b7, 0x878e8483, 0xc369d19f, 0x4f7779a0,
+    0x85649159, 0x7b8581a9, 0xa4b78c6b, 0x8291819c, 0x657c9d53, 0xa9a0adaf, 0x79844d75, 0x93b15b50,
+    0x97756fb1, 0x7379975b, 0xb6718350, 0x8b98557e, 0xc76878af, 0xa27e7c87, 0x826f5d82, 0xa09fa8b9,
+    0x7e71aeb6, 0x9e6daab7, 0xa86a8588, 0x8b67989c, 0x727373bd, 0x857488a1, 0x8f9b6f4f, 0xc0a67668,
+    0xa3645592, 0x49a6b38b, 0xa1b29f7d, 0x7b93ab96, 0x9994a184, 0xa2946d7c, 0x829785c3, 0xa08bc1ad,
+    0xa48b9f6f, 0x9c927e96, 0x68687257, 0x80b27d78, 0xb88a6758, 0x70a6bab8, 0x77a7a88e, 0x96719890,
+    0x99b487c4, 0xbd937070, 0x9fbc8c8a, 0x64823b48, 0xbf6cc484, 0xa97e87b1, 0x8a78b45d, 0x8d6d8892,
+    0x7e78a883, 0x66594f86, 0x9c50d183, 0x5a938e9b, 0xae7bac9e, 0x7580a463, 0xb1837fbc, 0x875c7da7,
+    0x7d706c94, 0x4a839f9f, 0xaac8a982, 0x8f9b7472, 0xc45ab665, 0x5c704c83, 0xa368847a, 0xa97bb099,
+    0xbe5cad73, 0x8b78b2c1, 0x569fc03b, 0x9d927395, 0x5284a076, 0xa17fa48f, 0x87999e73, 0x87a68b65,
+    0x856b6278, 0xa7949d8c, 0xb0608ca9, 0x7a81a17e, 0xaa6090bf, 0x609f609e, 0x58bc9990, 0xa395c987,
+    0x789e80a4, 0x6f3e9e8e, 0xb08c8374, 0x779f7978, 0x7c7e8aaf, 0x5b878a50, 0x847faf86, 0xd4a19d5c,
+    0x926883a8, 0x7dac57b5, 0x7e958a89, 0x8bba6d85, 0x9f7b579e, 0x79828c87, 0x726da156, 0xb64aa78d,
+    0xaf745b8a, 0x9ab38aa7, 0xa68589a8, 0x65947aa2, 0x5b947c61, 0x7a7da0a4, 0x767f8d4a, 0x8b646f72,
+    0x7ca58d9f, 0xa29a755a, 0xa97ea451, 0x66b58f8a, 0x9c6fa39e, 0x779a9ebd, 0x67c29c95, 0xbcae99aa,
+    0xa96e8899, 0xa23b6f6c, 0x8f499e45, 0x7592786a, 0xa25abb6b, 0x36a7a29b, 0xc28d8c9a, 0x949e7f77,
+    0x747f6196, 0x967a927e, 0x948098a1, 0x919bb87e, 0x739d8167, 0x4f8e848d, 0xb6709198, 0x7f64c091,
+    0x92597aa9, 0x5f78906a, 0x96a9857b, 0x83689c7d, 0x76a4818a, 0x5da59c7a, 0x687c9076, 0xc45a808b,
+    0x6d857785, 0x61a44e89, 0xa57e7461, 0x94817f7c, 0x796597b1, 0x8076ae6f, 0xa3a690ac, 0x81a376a8,
+    0x798dbd5f, 0xcb8b6874, 0x9e2cc261, 0x94727490, 0x8383c089, 0x8490b8a7, 0x75859aa8, 0x7e7a749e,
+    0xa5a18898, 0x618972a9, 0x978f8595, 0x6d898b75, 0xa9b799a6, 0x6595a564, 0x98786284, 0x7f907c80,
+    0xb2a374a9, 0x7a93c48c, 0x84809c65, 0x769eb38a, 0x9f786c8c, 0x8ea5808d, 0xb0847979, 0x9a7753a1,
+    0x415280a4, 0x95946a92, 0x6a5fa4a9, 0x80707c9c, 0x9fa1a9b0, 0x8c828489, 0x79a98665, 0x6aaa94b5,
+    0xc8648188, 0x88889acc, 0x784ab554, 0x87a66e79, 0x72a9c2a0, 0x4ca08d9f, 0xa883859a, 0xaeaf8c94,
+    0xc284b194, 0x8c8c6d58, 0x8b928b86, 0x87a9a192, 0x9a989458, 0x71745399, 0x9f7ba683, 0x97b6b4b2,
+    0xb6556e5f, 0xc6a96683, 0x7e83a0a8, 0x94b97d91, 0xa6a3a9a9, 0x8daa8c72, 0x658dbb9d, 0x9bbd5f96,
+    0xafa3a987, 0xaa9e85d2, 0x8992897f, 0x58aa7a7e, 0x7a82b5cb, 0x83698795, 0x61bd9f58, 0x668c8b92,
+    0x8e6b8f7a, 0x8bb2a6b1, 0x9f8e9a6e, 0xb1a68a7b, 0x8fa6789d, 0x8ea7c15a, 0xb675a9a9, 0x97829a8f,
+    0x976c5a59, 0x9a559c56, 0x748fb3a8, 0x70aa9576, 0x8676a9b7, 0x9d889873, 0xaf8b9d90, 0x5e9877af,
+    0x5e9588b4, 0xc3b27570, 0x6b9c827e, 0x9682b662, 0x6686939e, 0x898c4b53, 0x75b18c99, 0x879796a6,
+    0xa9b6c05f, 0x7d9f9885, 0x9fad7d67, 0xcc8f7e99, 0x8686a7cd, 0x8b668bc3, 0x819f69b9, 0x7d989c6c,
+    0x74a97e7a, 0xb8b392cb, 0xa89184b1, 0x85697d7a, 0x3c9eb24d, 0x8f878fa0, 0xac9882a3, 0x9c95af7f,
+    0x94c08585, 0xbd3e8b87, 0x76649e9e, 0xa8989a87, 0x84879d8d, 0x7c85a28d, 0x999e766b, 0x7d91a0b7,
+    0x73a1697e, 0x7f9680a1, 0x76aab288, 0x8fb6a2aa, 0xaa9f80b5, 0x7f837b94, 0x6a99955e, 0x8c7d77c0,
+    0x807497b3, 0x665f8dad, 0x749d6f98, 0x878e7995, 0x7870aaa4, 0x87729c83, 0xacd3a189, 0x6ea9ab7b,
+    0x97689f6b, 0xd4899799, 0x6e4bb679, 0x75c58e81, 0x67986557, 0x9a86817d, 0xc5779787, 0x95a17aa2,
+    0x8a7cb694, 0x8d578c74, 0x929599b2, 0xc281c068, 0x61918e7e, 0x6a7d897f, 0x83ac7c84, 0x6277a5b3,
+    0x93768a62, 0xa05b7aa0, 0x809ab58e, 0x89998492, 0x4fa6768f, 0xbfa86851, 0x89907589, 0x61b06fa6,
+    0x45729d8a, 0xda328fc0, 0x9c7e91ae, 0x9e779354, 0x90c0ac77, 0xa16d9095, 0x4b8a6771, 0x6a8a7c79,
+    0x876ca581, 0xcfb7a097, 0xb8adb885, 0x6b94a282, 0x5ca79273, 0x88758662, 0x9db65b98, 0x94879379,
+    0x7f769498, 0x8c6d9a96, 0x90aab6bb, 0x70b6ab81, 0x4c879aa5, 0x939aa78d, 0xa06b7666, 0x90797477,
+    0xa790ba66, 0x8a88875c, 0x8f5495b5, 0xa58d9dc7, 0x92b093af, 0x9fa75e8a, 0x6dd346a5, 0x25646ba5,
+    0x8691abcf, 0x83708176, 0xae8870b9, 0xabc7a0ba, 0x977aa4ac, 0x9d7975a8, 0x76b38e75, 0x65759096,
+    0x91a499ac, 0x86c39356, 0x9e87ae67, 0x7fb68571, 0x587d908e, 0xbcaa9a64, 0xacc38379, 0x799e8e7b,
+    0xbe805956, 0xb4717e8d, 0x848ca17d, 0xce8e9b8e, 0x5d937194, 0x7e8ea75a, 0x779c9b8d, 0x9b7c8ca8,
+    0xa97f8fac, 0x7883707e, 0xba8c797c, 0x65a5956f, 0x4c7a8ea6, 0x92949ba3, 0xb88d6e91, 0x69b0b9a6,
+    0x9d95b6b5, 0x9689918b, 0x908879a1, 0x8788c191, 0x4f9d93c0, 0x8f959dbe, 0x7db4877f, 0x8199a392,
+    0x6d9a86a3, 0xbebb9c84, 0x87759196, 0x9c9f6067, 0xc3a16f93, 0x878f9478, 0x9fc085a0, 0xa0999c74,
+    0x905e9f7e, 0x9c6e6c90, 0x807a87aa, 0x9b75714f, 0x8bc1807d, 0x9075936f, 0x879d9188, 0x6ca7c290,
+    0x87865c88, 0x919bc1a3, 0x90a79866, 0x7f869cc4, 0x91b96182, 0xd0a08171, 0x72999b8a, 0xbf8bb77f,
+    0x6971776f, 0x9a886fb6, 0x84a37f91, 0x90b485c6, 0x5e94907f, 0xa2ad9573, 0xb2a570a6, 0x8d928576,
+    0xc3aac189, 0x828892a8, 0x9594b3a0, 0x83ad78b0, 0x949c8d63, 0x53965f94, 0xa7667ac9, 0x80b3948e,
+    0xb1796e7f, 0x86dd998e, 0x7a868073, 0x97786b70, 0x8c7e8b95, 0x80a39770, 0xa9c89c95, 0x9d6fc780,
+    0x8e97aab1, 0x89a9ad8e, 0xb09b7c8f, 0xa488b794, 0x937b9cc3, 0x71a69b61, 0x7ab67f9e, 0x98ac65a8,
+    0xa6907e5d, 0xae86725f, 0x664c65a3, 0x6781c79c, 0x8a949392, 0x837586a2, 0xa6a768a8, 0xb3ab9c86,
+    0xa58a8d5e, 0x84966399, 0x99a68e9d, 0x85c17a56, 0xab88656c, 0xb08d4289, 0x828b828c, 0x9e826e82,
+    0x93657574, 0xa5af8ea7, 0x8e795eb1, 0xad807372, 0xb788a9bc, 0x88af8ea9, 0x86719a88, 0x6fb674ae,
+    0xae99898f, 0x9695aec1, 0x7ba57065, 0x82a7a965, 0xa49fa990, 0x7e618891, 0x8587a192, 0x9496b4be,
+    0x807a958a, 0x7fb6837e, 0x917e867d, 0x81989e99, 0x93ae959c, 0x8b599b74, 0xa68498b3, 0x618766b7,
+    0xae958d85, 0xa59592b3, 0x81a8c3a4, 0x94a1865a, 0x8e73af98, 0x6b646998, 0x90a0a2a1, 0x7f81a695,
+    0x8b787c4a, 0xa0ab81ae, 0x84a48ec2, 0x729497ae, 0x98976e7c, 0x80759266, 0xa38a5c7d, 0x6e9a76a0,
+    0xceb38f69, 0x749189a0, 0x8176668a, 0x797ebe91, 0x8299a6b7, 0xaa7caf6c, 0xa380b2a9, 0xb384b4b1,
+    0xa8a6cd61, 0x9382a0b4, 0x6b45649e, 0x8894c29b, 0x50758d8f, 0x99a4a66c, 0x87568f85, 0x62aa437a,
+    0xa7a27e66, 0xc196b27d, 0x81718fbc, 0xab819a65, 0x7f899185, 0xa3b84a5d, 0x9d85a3a3, 0x807093ad,
+    0x99a7819b, 0x5b757594, 0x627b92aa, 0x7ea77ba9, 0x7368a27a, 0xa0b3779c, 0xbd8eba9d, 0x9275a58d,
+    0x9a82727b, 0xb86491c9, 0x7872999d, 0xc6ab9552, 0xa5718398, 0x999e8781, 0xc1a0836b, 0xbfa185bb,
+    0x92a2745b, 0x8985a684, 0x867783a2, 0x74b0dab2, 0x4bcba337, 0xa39bd076, 0xbb917e79, 0xab945582,
+    0xde9aa173, 0x6e77555e, 0xae9d9bb5, 0xb8bcc485, 0x9499b9aa, 0x9eb8577e, 0x879c8b9f, 0x88a6b0ab,
+    0x80bd5a79, 0x56926273, 0x668e85a8, 0x9e9882a0, 0x8870af78, 0x85a5598d, 0x6f73798a, 0x876f6cc0,
+    0x6ab09680, 0x555fc898, 0x799b725f, 0xa299b38a, 0x876a6570, 0x84a8e076, 0xa96a88ab, 0xd69966b3,
+    0xa089907a, 0x5e8da476, 0x7c79807b, 0x8091828f, 0x6a8c8f6c, 0x7ac47e7c, 0xbf9a849d, 0x9c814c65,
+    0xa5a68655, 0x6ba87d63, 0x976da279, 0x97a0a17f, 0x90a6ad6c, 0x6688a6a8, 0x56529093, 0x76d7b7bc,
+    0xabaa8083, 0x76c25683, 0x9f9a77c7, 0x7cb8736c, 0xa967a76e, 0x7890769e, 0x8e678276, 0xc2b57ba5,
+    0x7157949f, 0x7352d99d, 0x7e7b6894, 0xd776de64, 0xa5756a92, 0x6f92ac87, 0xbe939687, 0xa3a15cb9,
+    0xc68b7d87, 0x70b884b3, 0x97ad717c, 0xad8ad7e1, 0x5c5f6c50, 0x9bc4d776, 0xc26a9fb8, 0xa34d9575,
+    0x979d3c81, 0x81b3a262, 0xb27faa7f, 0xac8e90a0, 0x80a26157, 0x9a6d906e, 0x826d9dbf, 0x49a1898e,
+    0xbc6154a7, 0x968a5375, 0xc89690c6, 0x9c9ebca4, 0xd1656b90, 0xa0a48a93, 0xbba9ac73, 0x97bea47a,
+    0x46687ca4, 0xa585c89b, 0xa669b689, 0xbc95de79, 0x8b94507d, 0xa34f8885, 0xa26b74a5, 0xa87184c2,
+    0x7578b283, 0x8578af77, 0x848a7546, 0x94bec992, 0x7a5fa552, 0x71aaab7c, 0x8881788e, 0x709f7aa8,
+    0xcb955188, 0x8f629162, 0x8fb68e82, 0xa6c17e95, 0xb4628eb1, 0xa29facc2, 0x8f798189, 0x7c7d6ab1,
+    0x9db674a1, 0xb08f8e53, 0x91b696d7, 0x5d8c88b9, 0x818ca48c, 0x618a8989, 0x8f9fa344, 0xdbbabc77,
+    0xb1768da1, 0x7888d0bf, 0xce76b2c1, 0xb699ccb9, 0x839975d4, 0xc377d3ab, 0xba967b5c, 0xa6a579c0,
+    0x8d75a777, 0xa7737295, 0xa1a6926b, 0x959de495, 0x9cacc479, 0xacaf9286, 0xb96799b5, 0xb5a88861,
+    0x9887959f, 0x746b6e7b, 0x6acdb378, 0x8f804750, 0x65a096a8, 0x729aa3a8, 0x89928b87, 0xb3888d8e,
+    0x856a6189, 0x91929c94, 0xabcf736b, 0xb28aabc0, 0xb07b71a0, 0x8d8d7186, 0xa5a06371, 0x80b2869c,
+    0x78736db1, 0x58ceb1c1, 0xc9a9b9a6, 0x709289a4, 0xb47bb382, 0x798f9490, 0xd3b1a2a4, 0x787b8db7,
+    0xa590a977, 0x5b7c977c, 0x89a585b7, 0x81bb8396, 0x8cbbb578, 0x7478bd8c, 0x9993ab86, 0x95ae8a8a,
+    0xa48d9673, 0x7ea66bbf, 0x9494649b, 0xa872837d, 0x647194a7, 0xcfb8c15c, 0x9d969b97, 0x6e9da284,
+    0x66a5a677, 0xa5788f8b, 0x6ca993a5, 0x9173af87, 0x5d6765a3, 0x9761a390, 0x9d85a084, 0x6e53af76,
+    0x81beb986, 0xaa997ac9, 0x8081a080, 0xac928c7c, 0x9c9d9d8c, 0x868581aa, 0xb2b29da9, 0x82908e82,
+    0x756ec3ce, 0xb17f8d83, 0xbab2aab8, 0x79c2699a, 0x9d917fac, 0xb1a59d84, 0x8fb28a89, 0x7bb9927c,
+    0xaa9773c1, 0x8da175d6, 0xb5bb9096, 0xb0837b9b, 0x799c6aa5, 0x75c0786e, 0xaf78858f, 0x829e688c,
+    0x97b28093, 0x8f72a168, 0x9dba8896, 0x5e8c89aa, 0x706eb5b7, 0x73a3b1a4, 0xa6967f7c, 0x887e98b2,
+    0x9661c161, 0xac686298, 0xbdc87b92, 0x7aac8678, 0x84aaa49b, 0xbf4f67c0, 0x9d946e6b, 0x626b679c,
+    0x8d799152, 0x7e896f7d, 0xa1b6a2aa, 0x86716980, 0x97afa379, 0x8e957d78, 0x858d74a8, 0x808797a9,
+    0x547196a4, 0xc096aa5c, 0xa67ba19e, 0x909bb37e, 0x5fa89ea8, 0x799c6796, 0xbc84ad66, 0xb9a6cc74,
+    0xaa6f9853, 0xa0a1988d, 0x90829bb9, 0x82a47f79, 0x86b3c677, 0x73625bb1, 0x9e80b4a3, 0xa179886d,
+    0x727c8f88, 0x90719096, 0x9a9cad8a, 0xa8748e81, 0xbc7e6bab, 0x7e8ac89d, 0x909e7b8b, 0xbfa57a88,
+    0x88a38ba0, 0x5fafb79a, 0x847bc776, 0xb9938370, 0xa57fa7a7, 0x97ae8293, 0x88909990, 0x907ca16f,
+    0x7d62a287, 0x87a375b0, 0x7f8d5a55, 0xbc736973, 0x9e8279a5, 0xa3878f83, 0x98a0a0bb, 0x83686e60,
+    0x73907861, 0x6295ab85, 0x7a998caa, 0xa47d6861, 0x8a7daa6d, 0x7e8583d7, 0x796e9dac, 0x478561ad,
+    0xa6937e8e, 0xadaa78a4, 0x989e8ea5, 0xcf947dc9, 0x7e8a7b61, 0x9463a78b, 0xc5c56698, 0xc7aa7fb0,
+    0x869c756d, 0xa1985875, 0x886fa36a, 0x6f9b7a7c, 0x68a19cde, 0x8bc298a1, 0x54a39b93, 0x60a184ae,
+    0x78a39893, 0xc0584489, 0xa46489c0, 0x7d519fa8, 0x8f649a9e, 0xc0927587, 0xb47fa8ac, 0x9594b5a4,
+    0xbeb1a1b5, 0x4491819c, 0x7a77b37c, 0x97917a73, 0x7b938fc6, 0x68928c91, 0x846b8e9e, 0x9c619b7f,
+    0x96c37068, 0x72835b76, 0x6a9da857, 0x75877cb5, 0x6db2776c, 0xb55694cf, 0x78a2aa50, 0x93978b78,
+    0xb6695eaa, 0x75a0896c, 0xc9888aa0, 0x75a68269, 0x9b818d6c, 0x5d658cb7, 0x3e5b977a, 0x9dcca7a9,
+    0x6e746e5f, 0xa6964086, 0xa08cc59a, 0xd9849f74, 0xac7c6bb0, 0x716da947, 0xb8c9a98b, 0x8d52bb71,
+    0x935cc574, 0x5c90ab9f, 0x6778889b, 0x999e7d72, 0xb077b3cc, 0xa067899b, 0x9353977e, 0x6991b097,
+    0xad80c1b3, 0x98729097, 0x976c717b, 0xa7705175, 0x86a08d86, 0xc5758d9a, 0xac87ae91, 0x7f5a9a6c,
+    0x758c8fa4, 0x8ab9798a, 0x8177ac9e, 0x90e1596b, 0xb86e807a, 0x57bb659e, 0xb7a8a88f, 0x8583a0b4,
+    0xbc885d67, 0xb1806a7a, 0xc65d9d50, 0x7d99b695, 0x6a83bab4, 0x8662628d, 0xcf867f8a, 0x8da19080,
+    0xa58e83a0, 0x64b0738f, 0x93bace92, 0x9f91509e, 0x758b7584, 0x818a7c8d, 0x79699bc3, 0x8f6570af,
+    0xbd577683, 0x70aa826c, 0x73afb541, 0x6b646a78, 0x6cbcae96, 0x9ba3a274, 0x8388797d, 0xdc7f7d59,
+    0x81815094, 0x679eb384, 0x9162d79a, 0x877090af, 0xb982679e, 0xbe8857a6, 0x62aa9969, 0xb38ba9bb,
+    0x66819f7b, 0xa085ad75, 0x8a5a7698, 0xb997a5bb, 0x769d89b0, 0x748c748d, 0xc0888fa6, 0x7c5f60aa,
+    0x969c859d, 0x3aa582a4, 0xc08ea0a9, 0x7c8d9299, 0x9ac28dae, 0x6a6e89bd, 0x99718c72, 0xb637ae69,
+    0xad85759b, 0x60906c85, 0x7c91a94b, 0xd29fb2a5, 0x6c6f666f, 0x91a0756f, 0xa09e7358, 0x7c557876,
+    0x74849a6d, 0x54b09e4d, 0x9d7eb58c, 0xae79598b, 0x8d7f7e70, 0x7b804ca5, 0xa9556c67, 0x7aae89cb,
+    0x9c5c97a7, 0xa8668c7c, 0x878ca560, 0x8ea9869a, 0x9066aebc, 0x80748f6c, 0x8b73818b, 0x974d9375,
+    0x937da387, 0x9d97bd74, 0xc4969499, 0x9db5807f, 0xc28a9b99, 0x98c18898, 0xb868aa7d, 0x8a708077,
+    0x92a7b891, 0xba9baaa3, 0x93ad9c55, 0xa89c778a, 0x7f957680, 0x905aa39f, 0x8180b279, 0x91aa868b,
+    0x876d81ad, 0x96d18994, 0x718c9a9e, 0x9a73a885, 0x94459391, 0xb6a19f5f, 0x928b868d, 0x90b59c9e,
+    0xbb966c76, 0xa64699c4, 0xa441a490, 0x807284b6, 0x686e92d8, 0x6a8193aa, 0x9bab9b8a, 0x88776583,
+    0x908f8f98, 0x8ca69096, 0x9686a0af, 0x76a3aa77, 0xb379a380, 0x9a8557c9, 0xaf5c8878, 0xb1687a90,
+    0xa674688e, 0x7f7a7e99, 0x80929168, 0x7b949a7e, 0x78738982, 0xbb7c8e6b, 0xa18a7491, 0x8274719b,
+    0x7f759684, 0x64948eb3, 0xa8b49b7b, 0x89a568ba, 0xb190be83, 0x788b8885, 0xc0b07551, 0x546b67a5,
+    0x7197a576, 0x9f699dc2, 0x85806f6b, 0xc4999d88, 0x859197ad, 0xa17e926b, 0x7e797395, 0x7e88a167,
+    0x6b95bba9, 0x788271af, 0x8c897970, 0x979f858c, 0x8d68bb9f, 0x948493a9, 0xaf68a582, 0x923dc87d,
+    0xbd9c7d90, 0x859097a9, 0x74a56da6, 0xb482799e, 0x85597c5a, 0xb1a28887, 0x8a9091af, 0x7a7d8c8a,
+    0x87987c94, 0xcda4a899, 0x5d79c699, 0xb7abc172, 0xc3887e97, 0x954e92af, 0x83c58172, 0x7596809b,
+    0xa46b8f8a, 0xa2a7a285, 0x6e608670, 0x6f99868d, 0x6d6caa94, 0x7c7d9980, 0xba7eba83, 0x6e6d9689,
+    0x80b28c41, 0x9f6c9067, 0x8a846dbc, 0xa592b4a1, 0x7a6ec06d, 0x66bca4ac, 0x86ad9d95, 0x9679948b,
+    0xa87cb196, 0x86636e6f, 0x7a66ae55, 0x899c8ba6, 0x8293b3b4, 0x7b798d64, 0x7b7a9fa0, 0x766e798b,
+    0x5471c2a2, 0x8f69666c, 0xb7a38987, 0x8ea5d784, 0x8454b278, 0x9d638b74, 0xaa6aa19a, 0x5fb09089,
+    0x7fb48688, 0x988d67b4, 0x6e7bb38c, 0xa2a7a89a, 0x7f988689, 0x6f86799b, 0xba899078, 0x7a8e894a,
+    0x64628f6e, 0xc160a761, 0x8da15b84, 0xbc5998ae, 0x82a18b79, 0x8389bf90, 0x8a6e83a9, 0x897abab3,
+    0x87808d96, 0xb685a3a4, 0xa0825eb5, 0x57998caa, 0x844ca08d, 0xaf5a9b9f, 0xb28287ae, 0x78aa74a7,
+    0x6462a1a6, 0x708c74cd, 0xad82998e, 0x7e78847a, 0x778ba49b, 0x9164a7c8, 0x9fb07b87, 0x4198afb7,
+    0xad7ebf9b, 0xb16acc8f, 0x635ea57b, 0x8c899aae, 0x5e78926b, 0x897f91b5, 0xb77c9663, 0x8ca59096,
+    0xbb86c64d, 0xb3428d56, 0xafaa8099, 0x8c7f7d8a, 0x68ab8766, 0x6c8b6393, 0x87a47b6e, 0x6e7a8d6b,
+    0xaaadabaa, 0xb5a084a6, 0x787a6d8e, 0x829a96bc, 0x838c7483, 0x6c7160a3, 0x8c7b6f89, 0x578e589b,
+    0x5bbc8f96, 0xb2647ea3, 0x699b9d57, 0xb5c47fb8, 0x82b18f9e, 0x8e767999, 0x7b8ab1a2, 0xae818576,
+    0xaa9a8fab, 0xa69e8f81, 0x948c8384, 0x8c7e7086, 0x45819c7a, 0x8db9e461, 0x8c78727a, 0x8e8d8871,
+    0x978a7a5a, 0xa22ebf9a, 0x7fb2c7ab, 0xb87a5a66, 0x5e91858c, 0x74827c97, 0xa3a2a578, 0x499195a2,
+    0x6a89ae83, 0xc6b48ca9, 0x838746cd, 0x5aa49d89, 0x9f87b284, 0x728a6b72, 0x7a8f9ac7, 0x63787cab,
+    0x8db5969f, 0xa4788cbd, 0x9b975586, 0x658d95aa, 0xa784cc93, 0xa569a79a, 0x91bf8994, 0x7daf9ec9,
+    0x94869b98, 0x997667b5, 0xa765998e, 0xab917883, 0x5da26b96, 0xb577e78f, 0x70b19594, 0x96b5917c,
+    0xb3625cb0, 0xd18ea883, 0x8b6bba8e, 0xab7e885d, 0x6ec18a96, 0x97a59388, 0x9468806b, 0x939a9f91,
+    0x88909cb7, 0x8e9ac884, 0x93817ab4, 0x8f8dc36b, 0x89a580af, 0x798f326a, 0x7a7b99ae, 0x1c8da39f,
+    0x6f8f86a4, 0x767d99c6, 0x98ac7e86, 0x72c19c8e, 0x6e559bc8, 0xb3359acf, 0x8daba093, 0x7bbaa08b,
+    0x818fbca1, 0x7bbf826d, 0x84718e88, 0x82cb846d, 0x75a9906e, 0xbbb1b48d, 0xa574af97, 0xb18a8663,
+    0xa1679873, 0xd282c78f, 0xa9918677, 0xa5787f7e, 0x61aab2a8, 0x67a2855c, 0x84c09064, 0x6d89b0c7,
+    0x9199ad92, 0xa9ad8d70, 0xad8365ab, 0x79a793ae, 0x787c6f9f, 0x7d604aa3, 0x99bd9f98, 0x30717eb0,
+    0x598298ab, 0xcc508dc8, 0x608772c2, 0x899d95b0, 0x757eb0a9, 0x7e63848d, 0x9f9a5c6f, 0x8d9c7e71,
+    0x9b98998a, 0xa2a09cac, 0x9f656d9e, 0x93799da0, 0x8d8081b3, 0x7f6985a9, 0x80a49c91, 0xb08b8b71,
+    0xb8508d71, 0x9aaaa880, 0x83a6c9b1, 0xb6b6997b, 0x818d8e8b, 0x9d848574, 0x879dabad, 0x71938a95,
+    0xafa3c377, 0xa88aad83, 0xb6876a82, 0x809eb09f, 0xb1a8bc9a, 0x87688570, 0x81c34597, 0x74887881,
+    0x8b9e6987, 0x83bd919e, 0x956e9dcf, 0x9ebb62ac, 0x558095b6, 0x68728ba2, 0x7ea0a0a7, 0x91b8aeb7,
+    0xa984ae85, 0x829f9077, 0x7e757766, 0x86abad52, 0x83cd7cb7, 0x85a0acb0, 0x6e759872, 0x7e9f8068,
+    0x9b24b955, 0xa686a68e, 0x669dd09d, 0xaf96a26f, 0x968598a9, 0x8a70817b, 0xcb876388, 0xa1658f9b,
+    0xaaca675b, 0xb297a0c1, 0x879d8678, 0x9fceb27f, 0x65ad8dbc, 0xae6fa48a, 0x7d714dce, 0x798d8bc2,
+    0x729bd474, 0xbf899ebf, 0x9a66aad4, 0x9f9bc6a4, 0x896a7cac, 0xaa6aba9d, 0x94a49d95, 0x589773b6,
+    0x82769fb9, 0x89636ea4, 0x9e6eb098, 0x78b5b158, 0x7f6e938e, 0xbf67a783, 0xa1655aa4, 0x8e80c6a6,
+    0x7956b16b, 0x8a9f919a, 0xa28b9c9d, 0x9b8ba6a6, 0x96aaaa86, 0x8b81679e, 0xa2c6759a, 0x77bb9f7b,
+    0x89a4b484, 0x818c728f, 0x67966d8e, 0x99bbc699, 0x989e9a9c, 0x7aaf8376, 0xc48b8392, 0x7d796b9a,
+    0x476fb8ab, 0x86c39384, 0x873dbe84, 0xbaa2b273, 0x829781a5, 0x7566be90, 0xad8eb7a3, 0x77a4909e,
+    0x7b76cda4, 0x8c9fbc5f, 0xbb835e9a, 0x96848b81, 0x6c6d98a1, 0xbf94b1bf, 0xa072ac68, 0x8f9ea184,
+    0x79739d68, 0x95ad7d7b, 0x8871afbc, 0x7a779996, 0x79938ea5, 0x5c7ba08e, 0xbbb67a8e, 0x875a7595,
+    0xba99667d, 0xbb65b882, 0x8b6f7296, 0xa3b0a8ab, 0x7e8b757f, 0xa4ad6e82, 0x7a7aa987, 0x869b897d,
+    0x999a6593, 0xab8aa2b7, 0x9d5aa284, 0x69a690bb, 0x3db87b6c, 0x88b0c399, 0xa3907f8f, 0x669c75a9,
+    0xc07e97a6, 0x8e6ca76f, 0x9494af97, 0x93a2a680, 0xa889b881, 0xb49b82a8, 0x7e7db183, 0x63766c69,
+    0xcc94b7c2, 0x6bc78e77, 0x9f778b95, 0x658c8368, 0xb76a8b76, 0x41b367ad, 0xacb9a6a8, 0xa7ca968e,
+    0xa9946990, 0xb77f6c5e, 0xb293699c, 0x8ca09994, 0x8a9a638a, 0xcd85ab60, 0xc1937e9b, 0x9aac8298,
+    0x6fb27f88, 0xafb6948d, 0x3f4284a9, 0x9ec1d6bf, 0x724aac88, 0x7aa8a97c, 0xa09ead79, 0x756a55a9,
+    0xa7827c85, 0x9e998a7c, 0xa6b1956f, 0x9186aab8, 0xa87f7fab, 0xb79080b3, 0x5abb64bc, 0xc6d9ad86,
+    0x7ba69b7b, 0x5e6e8985, 0x7876b19d, 0x82b669bc, 0x9d8c657e, 0x6fbca76b, 0xb18f9ea8, 0xa7986578,
+    0x988b68ad, 0x6357b48f, 0x937d8e93, 0xb49bcd7d, 0x87746d8f, 0x99938597, 0x6dafba70, 0xa89b9692,
+    0x736c9572, 0x9e969d6e, 0x7e63998a, 0x98a0a69a, 0x6b76999b, 0x84d3b59b, 0x889a7ca4, 0x7a8759c1,
+    0xb9937f96, 0x815abc38, 0xbb9cbd62, 0x8966b9a0, 0xc08ea68e, 0xa09670a6, 0x6e8785a6, 0x7e9eb277,
+    0xcab17887, 0x458a907a, 0xafb372e0, 0x65aa6f9b, 0x8780b23a, 0x65c05d94, 0x888ab8b6, 0x75a98390,
+    0x7c8768b5, 0x7291b8c5, 0x7ea89da0, 0x99ab7ba7, 0x895882d5, 0x6689aa42, 0xa5787493, 0xa98867a2,
+    0xc5a6a580, 0x90a8c8aa, 0x626dab79, 0x8e91dda0, 0x3c779674, 0x74a0cb7e, 0x90666185, 0x8c8c8c4f,
+    0x9e62899a, 0xbd669344, 0xc3858879, 0x96899962, 0xa3877fbd, 0xb4c281a2, 0x49779184, 0xc7d3b296,
+    0xce7a4f91, 0x4298978e, 0xd57478cb, 0xa6c3b57b, 0x914c8b55, 0x75896893, 0x6d8f5c6a, 0xb56e808e,
+    0x7f985585, 0x6d6b8287, 0x999c9357, 0xb8967f52, 0x828a9fd3, 0x819ba881, 0xd68f797a, 0xb5d98ba6,
+    0xc28c9447, 0x928e918d, 0x7a798d6f, 0x70ddc7a5, 0x899b677c, 0x95cc906c, 0xae65579c, 0x54536b6e,
+    0xd19f4fab, 0x75b4967d, 0xdaa6b690, 0xcea37574, 0x7772bf5c, 0xbcaf5784, 0x8e6986b4, 0xb8b68499,
+    0xab7073b3, 0x7e4ca9a2, 0xb9b59ad6, 0x8aa29c56, 0x84815f63, 0x61a1704f, 0xa4a0b979, 0xab96969a,
+    0x4a6c8489, 0xb47ba8d3, 0xabb4c964, 0xcab1a49f, 0x646e7d82, 0x679ebca9, 0xa87774a4, 0x799a56e5,
+    0xb250ca72, 0x8faa8493, 0xc0995787, 0x5692e5ae, 0x96816958, 0x6e87c581, 0xdf9da15b, 0xb8aba884,
+    0xd0677074, 0x78858188, 0xa1ceb8a9, 0xa6b9a8ae, 0x806cc15a, 0x75ce6064, 0x9f9b77c7, 0x438d8c70,
+    0xcf7fc9af, 0x9f8a829c, 0x679575af, 0x9b94b2a8, 0x716f3f83, 0x8bc08283, 0x89909177, 0x9b9197bd,
+    0x4a8788b0, 0x9268cfc0, 0xa47ecc90, 0x969a8194, 0x869779c3, 0x5ab3b8b2, 0x943f9898, 0xbd82729b,
+    0x80b7abb3, 0x986da59e, 0x88a65b6c, 0xc19bfc8f, 0x4c999359, 0x7bcc889b, 0x966c84c6, 0x757b73b5,
+    0xa0875b94, 0x989481b3, 0xb97c8cb8, 0x8ea3b48c, 0x7876b098, 0xa39c957c, 0x73818880, 0x819ab98b,
+    0xb3b79273, 0x808f7d7f, 0x8fcc87d0, 0xaf8f7f9e, 0x7a99a7a2, 0xaa975b6a, 0xa3799b8d, 0xb5928aa9,
+    0x61af847c, 0x7b95bbab, 0x7a819a5a, 0x9d919288, 0x85968096, 0xa3a598a0, 0xb36e6c9d, 0x78ad6891,
+    0xba978f9a, 0x8c8da68c, 0x9b5ba3b9, 0x8c8e808d, 0xc0ab8aae, 0x857eb288, 0xbd9aa9a2, 0x93638b7a,
+    0xb65789b6, 0xbca0c0a0, 0x99977676, 0xa573a598, 0xa76f5bc2, 0x69858e5f, 0x57ab74a3, 0x6764ad99,
+    0xa17fce7f, 0x876c7d95, 0x899d92b0, 0xb57e8e8c, 0xb3828c94, 0x888c5f56, 0x7fa98fba, 0xbd669591,
+    0x8a85919f, 0xbb9b7e85, 0x89749c76, 0x6e83807e, 0x5b84689f, 0x805f7dc1, 0xa472b79b, 0xaf91918c,
+    0x908e7db2, 0xb376666f, 0x697b9374, 0x66938db9, 0x89a59b86, 0xba95696e, 0x9e94cb61, 0x7596a392,
+    0x6e908f67, 0x88af938d, 0xbcbcae7c, 0x6f647eb1, 0x94bec3c8, 0x7da48962, 0xa58e7587, 0x9d8b9984,
+    0xbe57af9b, 0x5892a28b, 0x817a96b1, 0xac77be8c, 0xa1c092a5, 0x776d746c, 0x9bafbea2, 0xb399999e,
+    0x998e909a, 0xb367aa6a, 0xa87c9d84, 0x859c8a9e, 0x8d95807f, 0xab73a26e, 0xb5b4938d, 0xa368a4a4,
+    0x779a9376, 0x8db49d96, 0xc56ca3a6, 0x846284ab, 0x7aac9ea5, 0xa1916d96, 0x93beb49e, 0xa5a3a679,
+    0xa09b815d, 0xaaa5b4c7, 0xa59a6391, 0xcac387c6, 0x879974c3, 0x9e7b9b95, 0x6f6cbb6e, 0x92ae8c98,
+    0x9c7d736b, 0x869fb5b3, 0x94b58a6b, 0x99979d9f, 0x8bbe8f94, 0x7c9c7fb2, 0x84768ead, 0x8194a073,
+    0x9f90c59e, 0x6a6c96a3, 0x8f8aa187, 0xaba495d7, 0xca8b9767, 0xcb97a092, 0xa4b282c0, 0x91adc189,
+    0x899eacc5, 0xa0ae5991, 0x75a79090, 0xcca1b39d, 0x765f8e82, 0x91b2799c, 0x5ea9b173, 0xb9a5876b,
+    0x6e97b1c4, 0xb174b88a, 0xa58c8899, 0xb9418d9b, 0x6e6f8579, 0xa874617e, 0xbe85667e, 0x815eaa97,
+    0x92a1ba57, 0x7e89868b, 0x7abf9770, 0x9f7aa4bd, 0xb39888b4, 0x9798a190, 0xaf738a93, 0x506fb486,
+    0xae9e8ba4, 0x85a39f88, 0xa9989486, 0x7ca29b9b, 0xb45fa352, 0xae836f7f, 0x967c7dab, 0x8ea78d5b,
+    0xb17d539c, 0x93a6a09a, 0xaaa0c39e, 0xbfb8586a, 0xb0a861c9, 0x95ceb7a6, 0x79907885, 0x768ece78,
+    0x6b7ac3ab, 0xba758be8, 0x9476a7aa, 0x8169cf70, 0x8a9497e1, 0x68979b7e, 0x8c5bb096, 0xa0b97899,
+    0x7767a090, 0x5ac3a28b, 0x8a768cac, 0xa0bd889b, 0xb58a8d87, 0xb28892af, 0xa785c78e, 0x5261abaa,
+    0xa959b15e, 0xb4ad9b56, 0x773fb89a, 0x938f747c, 0x8691c989, 0xca929eca, 0xb4556293, 0xd2747b6f,
+    0x6d8c61b4, 0xaaa992a3, 0xc79ed98e, 0xa2ad8e6d, 0xa7c0b7b2, 0x8d9aae8c, 0x8a798665, 0x8e99b0a4,
+    0x8b7575a6, 0x8d9f9abe, 0x8481a581, 0xaa5e6495, 0xb35aabca, 0x55682f9d, 0x9b8cc499, 0x9a91649f,
+    0x86779e83, 0x6b70b97d, 0x9085886b, 0x519aa269, 0x83c3b1ad, 0x747a5e9f, 0xc2a8b8b9, 0x7ba7dbc7,
+    0x9b7b7470, 0xb98e6f81, 0xb682864d, 0xb096a59f, 0x798e5987, 0x75919562, 0x75626876, 0xa7b9ad67,
+    0x94867a9b, 0x859baead, 0x9f6d8467, 0x92a56253, 0xab9c9863, 0x6d8fa48a, 0x91828156, 0x65c27473,
+    0x6b985bb3, 0xa3958685, 0x82819186, 0xb9887d97, 0x88a4929f, 0xa37c69ae, 0xaa8e92a4, 0xb99572aa,
+    0x86788999, 0x54a7ad6c, 0xaf7fb6a1, 0x847e9d7a, 0xaf8599a4, 0x7ea896dd, 0xb2619187, 0x6d92aba4,
+    0x808b8776, 0x71799e7d, 0x8577cd92, 0x9a85687d, 0x7f9b7d4d, 0x9ca474a3, 0x738392a1, 0xc36b7667,
+    0x7f5f81a3, 0x928c61a6, 0x8666b2b5, 0x956f4aa0, 0x9958a764, 0x6b969996, 0x75cd8782, 0x5787b492,
+    0x6482a4b0, 0x962b68b8, 0xa8aaca89, 0x8f669484, 0xaa81abb9, 0x5a806568, 0x878eb978, 0x84607e7b,
+    0x6c588fb1, 0x6ab07c85, 0x92848f9d, 0xacac8688, 0x856956a4, 0x6baaac98, 0xb45e967e, 0xc1a5b57f,
+    0x82a09ca5, 0x70a3ae77, 0x947c8750, 0xb6667d9c, 0x73b5b29a, 0x91a57496, 0x578283b1, 0x6b7a6e97,
+    0x98648c72, 0x6fac7db4, 0x8898a383, 0x72ac7e6a, 0xaa7098a1, 0x909492ce, 0x68be659c, 0x9b739b9d,
+    0x86a58fa5, 0x716c88a1, 0xb6549b65, 0xa4c8649c, 0x9495878e, 0x606c7b81, 0x9c877c7e, 0x5c975377,
+    0x9d9bbc95, 0x7b938bab, 0x88b78c9f, 0x9c92a387, 0xb8a3a07a, 0xaca292b3, 0xd16688ae, 0x9c5b7da7,
+    0xd0737a7c, 0x7d72c494, 0x5e897e8f, 0x9871a169, 0x629c7b90, 0xb5608f69, 0xb6ab7292, 0x7fb880a0,
+    0x9084896c, 0x769792b6, 0x6e8c9192, 0x58898097, 0x965eb4ae, 0x80737a6f, 0xbb9bb4b9, 0x9f80688a,
+    0x8e597fa5, 0x9985abae, 0x9b9ac67c, 0x7cb36ba4, 0x7e7a71ad, 0x73959ca8, 0x96b08aab, 0x669fa5a4,
+    0x977f7b63, 0x7289b69e, 0x869e8a84, 0x6a587683, 0xa97faf6d, 0x8e7c866a, 0x9e839f97, 0xb571819a,
+    0xd970b98a, 0x9791938e, 0x8db98375, 0xb47fbea6, 0x56718ba1, 0xae5eb25b, 0x87726e9e, 0x82b26688,
+    0x7b7bb392, 0xae919478, 0x718ba752, 0xbe8b77aa, 0x89669e8e, 0x92ab8787, 0x7b878085, 0x779ab987,
+    0xa27f6aad, 0x878db8bf, 0x7f53a774, 0x6b85877b, 0x9a9a9aae, 0x6d789595, 0xa18d937f, 0xab709286,
+    0xa4718abf, 0x7e899b7e, 0xaf789ea5, 0xa492ab88, 0x6d888180, 0x768870cd, 0xcd55946e, 0xaa6e8ba5,
+    0x70887f91, 0xc69d768c, 0x71ac9b76, 0x826d939e, 0xa3598d89, 0xa68f54a7, 0x8ba0968a, 0x99b8948a,
+    0x60a89f8f, 0x88a78096, 0x6e5c8876, 0x8f9b80c2, 0x898ac7a8, 0xaf6670a8, 0xac90abc7, 0x6cb6968d,
+    0xc76e8a93, 0x9b4e839d, 0xb5487a57, 0x97898799, 0x7791a5cb, 0xbfa69f5c, 0x65b467b2, 0x8c92c881,
+    0xb1956ba4, 0x8c99b56d, 0x9b70a0b7, 0xc18a927f, 0x7886966d, 0x628683ae, 0xbb91b385, 0x92a4c2aa,
+    0xe57d7889, 0x9b89949c, 0x879ba991, 0x9db19ba7, 0x5c598a83, 0xa1aea7a3, 0x91b55b8a, 0xbf808299,
+    0x58a785ac, 0x927b61a9, 0x9da9c66d, 0xa27bc77a, 0x7da17bd6, 0x8e6fb7ae, 0xb7a4a66a, 0xb384569b,
+    0xc78c989a, 0x7a75ae8d, 0x7d6a9236, 0x9f8d8a8f, 0x8e76b4a1, 0x864bc492, 0x618696ab, 0x9590747a,
+    0x6c9f8765, 0x7bb4ba6e, 0x808383ae, 0x9d7a9690, 0x89a38787, 0x5b9784a2, 0xc69f8260, 0x7a657ca3,
+    0xb891965b, 0xa38b8465, 0x988f68a7, 0xad8a80a9, 0x8a6d8b81, 0xb47e6e7a, 0x9dc39a8d, 0xadc06dc0,
+    0x6376a280, 0x9b895f8a, 0x835a9e76, 0x88728799, 0x8b94b97e, 0x8c797c8a, 0x589b7f65, 0x87a372a5,
+    0x99b68292, 0xbd7b719c, 0xa37c5f7f, 0x858c759d, 0x62a77cb0, 0xada1c059, 0x9b725f8b, 0xb69f8c7f,
+    0xaf958a79, 0x904e9c7b, 0x6e8c80a2, 0xb2abaaa1, 0x92ba8678, 0xa8608f8d, 0xafa66987, 0x71bfb468,
+    0x9d97808a, 0xa56d7a72, 0x4e899764, 0x93b8cd76, 0xa67557a2, 0xaebc82ac, 0x7fc3775d, 0xa0a661b6,
+    0x6180789a, 0xaa5769bd, 0xba849079, 0x9b8da084, 0x987ea7ae, 0x874ea4cd, 0x728e837f, 0x7d867a61,
+    0x9293669c, 0x85969cb2, 0x898e84a2, 0x7b93a49b, 0x76b7c688, 0x8eb1857d, 0x824e9169, 0x93a97db3,
+    0xb8b07e9c, 0xcf5bcb94, 0x938a6d91, 0xcf98b09c, 0x66717f7a, 0xc393bd87, 0xb6b2bf95, 0x7494bc81,
+    0x95989f7a, 0x93cc62a5, 0x71ae7a7d, 0xaadb8269, 0x8d8eaa80, 0xc3974e87, 0x72ae857f, 0x5b876d9c,
+    0x9cc7a894, 0xb04ba1a7, 0x9683b5a1, 0xa0ba6eaf, 0x80bec4a7, 0xb859999e, 0x97bcb194, 0x576fc59b,
+    0x7e9aacc0, 0x7e8fa468, 0xb2a49baf, 0x9b3c787f, 0x4f95b4b1, 0xc07cb17b, 0x957596a9, 0x8d816f67,
+    0xaa7aa361, 0x90757e9c, 0x857fb57f, 0xbe5c9b6b, 0x5e95b9a5, 0x7f81c479, 0xa7a9a042, 0x758b82a2,
+    0xa3b19ec0, 0x79b28872, 0x5a94607a, 0x6bb15f97, 0x968d8f6a, 0xbba35a85, 0x796eadc6, 0x3286bb7f,
+    0x72a8a490, 0xbf757792, 0xa2749586, 0x967b8b73, 0x92967ec1, 0x9856b796, 0x93bba691, 0x94a48d98,
+    0x7d737cb3, 0xa592b790, 0x8ba88a82, 0x98a49d95, 0x51a15d79, 0x9e81c7b2, 0x80a275a9, 0xa4a18c70,
+    0xa66ec36c, 0xbb81cf60, 0x88a59bba, 0x9c7ea790, 0x428c7b81, 0x767a8cb5, 0x9e7f668a, 0x9899bd80,
+    0xb69bae95, 0xb9828a88, 0xba886f95, 0x98c56e94, 0xbaa78f8a, 0x8b817e6d, 0xbd9c75b1, 0x7072649e,
+    0x5b717a91, 0xa09278ad, 0xba648dac, 0x69a4a379, 0x9c51af73, 0x985b8292, 0xbac99280, 0x7a9acd7a,
+    0x8e7ab8b2, 0x867690a9, 0xa2a78aaa, 0xa3826e85, 0xa3918c8f, 0xad85a585, 0xb396a576, 0xa17e978a,
+    0x8740c153, 0x7d8ba48c, 0x9f8c98bc, 0x8e708e62, 0x5a82a0bf, 0x83ac67be, 0xa672836c, 0xa0959191,
+    0xbb928fa7, 0x9dcc9489, 0x9ab8648d, 0x83949ea7, 0x8b925b81, 0xa674b283, 0x84aa7bb9, 0x6a919aa5,
+    0x73927788, 0xacb38ca4, 0x917a8a9c, 0x988eb3b3, 0x8192878b, 0x898bce75, 0x608a8889, 0x63c098a6,
+    0x7c76e7c9, 0xa05caab4, 0x9da9b3ae, 0xba648a6c, 0x937ab469, 0x5f81896d, 0x8eb08b79, 0x628c888d,
+    0xac786f89, 0x6faa777f, 0xb467c394, 0xb6b99e72, 0x9ba5c3a0, 0x69968a95, 0x7d8a8195, 0xab9fa983,
+    0xa2a6829a, 0x5e8bab7c, 0xaa998eaf, 0x93c29aa6, 0xba9c7898, 0xa4838f86, 0x90b760aa, 0x989f777a,
+    0x479caeb1, 0x83b279b0, 0x671c92ae, 0x8ea781bf, 0x8580aa6c, 0xaa5d8a79, 0xb1abae65, 0x73867f7a,
+    0x8377a0c0, 0xaa74a37d, 0xb6939074, 0xa1806e7a, 0x9d77a88a, 0xb96b7986, 0x779781b3, 0xac9eae8a,
+    0xb985bda4, 0x8396a14f, 0x858570c1, 0x7486727a, 0x6f8a81a1, 0x768aa994, 0x9273ad7f, 0x64939b90,
+    0x818fba79, 0xa2ba96c4, 0x9790ada6, 0xa16f5492, 0x91c3759c, 0xc3a18274, 0xc59475ad, 0xb095738c,
+    0x6c9ba577, 0x8aab7d7a, 0x6608a7a3, 0xaac1daa0, 0x66729c9c, 0x7897999e, 0x94709486, 0x60b28c9e,
+    0x9c93a75f, 0xa892ae9e, 0xbb6c6478, 0xae7f7f74, 0xac91afaf, 0x8e5a8975, 0xc3bb7f9a, 0xb4656392,
+    0x89ac6caa, 0xae94aa5b, 0x75a0b5d6, 0x63978d5c, 0xbd7e7a97, 0x6cafacb6, 0x60a47297, 0x95ab9e6d,
+    0x9ca85363, 0x949ebb8a, 0x79a39f8e, 0xd49c667b, 0x92a57488, 0xa55d9e98, 0xb6824592, 0x91b46267,
+    0x8d5dae52, 0xaf7cb094, 0x636d81a2, 0x967cd0c4, 0x87698a6b, 0x9161ae50, 0xb8b8968a, 0x508b74b0,
+    0xb5b69d92, 0x967dbf85, 0x7da49e5c, 0xa6806279, 0x5ba6867e, 0x76a58377, 0x938eb7b3, 0x7abbab8b,
+    0xa58b5669, 0x9994a547, 0xc08893b4, 0x7ca7a298, 0x926db19e, 0x6d66ac87, 0x9b919ca6, 0x68786288,
+    0xad8487ad, 0x7079a6b7, 0x7668b964, 0x8d776166, 0x64788089, 0x9f87c16e, 0xc1a97fa7, 0xb67582c3,
+    0x6487846e, 0x7f8b7560, 0x94757264, 0x819fb26b, 0x9c9bab7c, 0xa490ae71, 0xb6529481, 0x988d4889,
+    0x61aeafae, 0x9ec19399, 0xc5a481ac, 0x9758b089, 0x5d8ebb8b, 0x9a7a347e, 0x71777570, 0x9b9f948e,
+    0xb1a8a0c7, 0x4788715e, 0x6c9298ac, 0xab836386, 0xa796ab66, 0x56886890, 0xbda18089, 0x8ba966b2,
+    0x7c9875ad, 0xa286b19a, 0x65879c58, 0x918669a0, 0x4f846ba8, 0x92607382, 0x9a8b95a2, 0x6c7d7a81,
+    0x6680a08b, 0x97907477, 0x6e6d748c, 0x9098a67d, 0x6f877679, 0x7eac9075, 0xa5b1a68b, 0x85996f64,
+    0x818cb38f, 0x837d8b75, 0x74a9a6a7, 0xb77c84af, 0x957fc195, 0xa4a6739f, 0x4c715b91, 0xa5cace9e,
+    0xa29a8a99, 0x6a688f86, 0xa390a67f, 0x947faa95, 0x9761699a, 0x93b79695, 0x848ca761, 0x91908aa4,
+    0x8cb3638b, 0x7768a275, 0xbfb8bdaa, 0xaab06277, 0x58a86a8f, 0x9858d378, 0xe297419d, 0x6f884e69,
+    0x9288be72, 0xaf8fb9a8, 0xa13caba5, 0xb8909da8, 0x8f649270, 0x73bbbaaa, 0xc49c60aa, 0x8d8d3f51,
+    0xc27a6396, 0x857d9537, 0xcc95a239, 0xa88c7f7e, 0x8c6da461, 0xa59837a3, 0x6146889e, 0x6bc7be86,
+    0x91986f97, 0x5cb15059, 0xa8916a99, 0x5a6dc27d, 0xa9616847, 0x737c7759, 0x8c8a5777, 0xb4896e9e,
+    0x6a5e5a9f, 0x5050c9a4, 0xa890ff85, 0xc1935b7d, 0xab4d56c1, 0x7b59c294, 0xc6797184, 0x718e9494,
+    0x949baf8b, 0x868f6e87, 0xbd5e599d, 0x9ebfe2bf, 0x53636863, 0x86c8bb8d, 0xd794336c, 0x926b8083,
+    0xcb999d4b, 0xaca6a667, 0x8ba7c174, 0x83bc8189, 0x919fcf59, 0xb391809a, 0x8c509fb3, 0x6dbebb60,
+    0xd4e69882, 0x71bd5699, 0x978a7e94, 0x99a6b674, 0x5d7b7257, 0x6b995d79, 0xb5c99a67, 0xf57c948b,
+    0x589470af, 0x577cc3bb, 0x72cbc27c, 0x90aa9667, 0x777078a0, 0x777bbab6, 0xc2a267b9, 0x7e6c6796,
+    0x7d8ba74f, 0xa18db28c, 0xb582a96a, 0x55b1e775, 0x5c8f7a5a, 0x67a6ceae, 0xc27b57bd, 0xa8845b7f,
+    0xae7f4250, 0x8fa07dc8, 0x93a2c275, 0xd8887980, 0x5ea578a3, 0xb67b8987, 0x9274a99f, 0x7be0b677,
+    0xa18c907d, 0x4f709060, 0xbd929de6, 0xbe6ff59a, 0x9a697da6, 0x94726298, 0x7d789345, 0x9594c6a0,
+    0x88468c90, 0xa19c9bdb, 0xc68f7377, 0xb8d59062, 0xa68d77c6, 0x9a99a8a1, 0xe5ae96be, 0x818680c8,
+    0x9b9f8d99, 0x75807a87, 0x827c7760, 0x8dd9ae97, 0x75816a95, 0x7b96c85f, 0xdf5dae85, 0x56888092,
+    0x8b69a37d, 0xaa68a5a8, 0x92ca967d, 0x9f8b72ae, 0x6382545f, 0x8f7490b2, 0x938a87a3, 0xb197cb8b,
+    0x957c5a71, 0x9d685fbc, 0x8c8559ad, 0x80afa261, 0xb899a39f, 0x84b06980, 0x97798889, 0x99b9b19f,
+    0x9878a776, 0xbc77b77a, 0x8d81d0b2, 0xbba16c9a, 0x8c84a781, 0xad90918c, 0x9b91a4a6, 0xa69dac90,
+    0x8c4d8774, 0x9cad8aa9, 0x6e946553, 0x706fa1be, 0xb3a3b7bb, 0x84a887b4, 0xa56473ad, 0x75777364,
+    0x66848a96, 0x83849fb6, 0x7e9388a2, 0x98b9817e, 0xb8957384, 0x79a39a96, 0x7da45d8f, 0xa7947c87,
+    0x689d75c3, 0x9c8664a4, 0x78658580, 0xce7f9eb0, 0x99ae8d9c, 0xa268aaa3, 0xa1a696a4, 0x7fb08cba,
+    0x877aac82, 0xa4ba7995, 0xa86fada9, 0x95c77cb8, 0xa68cb06b, 0xa7989784, 0x6464baa6, 0x7587a4a5,
+    0x96aeb096, 0x868fa095, 0xa38cadb4, 0x95b67597, 0xa2ba7976, 0xbf7a5579, 0x94b9ac73, 0x918ba061,
+    0x97688e7d, 0x4e6ab49b, 0x748e7a8e, 0x9c875cc8, 0x707767c0, 0x7573b683, 0xab688f9c, 0x5b5e8881,
+    0x588f8070, 0x8383c88a, 0xb6a88e77, 0xba735e7d, 0xb36f7d8e, 0x866fbd84, 0xb8a8aa62, 0x9fb0a3a3,
+    0x8eb8aa50, 0xba6d5fa8, 0x9f75b1ac, 0x9c985ea7, 0xa1708687, 0xb9ba9e93, 0x7a79866f, 0x7f8a997a,
+    0xb0bd90a3, 0x88aaa29a, 0x6e92968d, 0xa6a2b191, 0xb18c67b2, 0x9096939f, 0x9dae9387, 0xa66d9b7f,
+    0x8ebc70ad, 0x79ad9180, 0x6d95888c, 0xa3b3a09a, 0x5d7fc5ba, 0x60b1c68e, 0x92758bbf, 0xb67c6ea0,
+    0xa483ae94, 0x927d9685, 0x786d9583, 0x58a56389, 0x9166aba6, 0x96677c91, 0x9b84d389, 0xa5c988b6,
+    0x8d5dceb5, 0xa7ac8c57, 0x87a09469, 0xb47dafbc, 0xa99b8c63, 0x9d9da8a4, 0x63b775c4, 0x5b9b4684,
+    0x67969088, 0xa7b37fa4, 0x79adab80, 0x7f7d8372, 0xa3898488, 0x95a1668f, 0x8383bfa6, 0x807ac789,
+    0x9e78a99e, 0x9dad8997, 0x9eae90a8, 0x958a857b, 0x9c4dabac, 0x7c947589, 0xb0997d84, 0xccb26d95,
+    0x91898797, 0x757a9374, 0xa79d8c7e, 0x746c74c5, 0x70a48cce, 0x7c7fa6aa, 0x7978ab82, 0x6d7a8a77,
+    0x84888884, 0x7f869b8f, 0x9f60ae61, 0xbe975f94, 0xb8ad8ba0, 0xcb538c98, 0x816b9fbb, 0x87a38a44,
+    0xa39c849e, 0x73d28381, 0xaa8da556, 0x84b8607f, 0xad4d93c3, 0x9db0968c, 0x59b17d74, 0x89a28f7a,
+    0x885b91a5, 0xbfa358c2, 0xb4b5d68b, 0xa6509369, 0xb365aed4, 0x6379797e, 0x7d9ca6a3, 0x9c8d8d80,
+    0x98888679, 0x66838b8e, 0x8f9eb2af, 0xa59a789e, 0x9f839a76, 0xa66e9fcc, 0x7868aa56, 0x67909166,
+    0x9a828a9e, 0x71aa8e96, 0x7f6abf57, 0x837a678d, 0xa97c9096, 0xb86d8abc, 0x84b99450, 0x9b738d5b,
+    0xc94f8ea1, 0x9aae82b9, 0xc4a1e287, 0x769d73ab, 0x9e60ab9a, 0x9a7565c2, 0x9e769f5c, 0x9180c09c,
+    0x6c62a084, 0x8f539fb3, 0xca647c91, 0x568a8c93, 0x947798e8, 0x904a8d81, 0xa0a6beb9, 0x69939a70,
+    0x84917d8c, 0x39ac9494, 0x62b474a0, 0x99a2adaf, 0x6b99ada0, 0x81a36f97, 0x7e5f9a93, 0x7c94838f,
+    0xb9865d74, 0x898cb29b, 0x71acc77b, 0xa57eae7e, 0xa36b5b91, 0xb883888c, 0xa6a26479, 0x60c44d5a,
+    0x9b526894, 0x717f737b, 0xaf5e9c84, 0xa87f647c, 0xb0a48680, 0x9aa180a1, 0x7b75935d, 0x7898aa72,
+    0x5b8f7ebd, 0x7c6e9877, 0xb367a0ae, 0xaea9af8c, 0x6bbb7f91, 0x8f65a096, 0x789da3a7, 0x957ab65a,
+    0xb09a78ab, 0x8884ca81, 0x898a7588, 0x849f9090, 0x9b5ab0a1, 0x7ca88d99, 0x9836c5a6, 0xa07687ab,
+    0xaa7c8088, 0xbd9e6459, 0x5a8d8d94, 0xa8c5b763, 0x7a6b9e85, 0xe6a1858a, 0x57816f97, 0x8f7b6749,
+    0x9c85507c, 0x74c45f9e, 0x8f6bab66, 0xbd9b7072, 0xa3449294, 0x7887ac51, 0x64a8a08e, 0xa983acb5,
+    0xa9828b8a, 0xa96b919c, 0xa18e9d77, 0x736a7182, 0x8067839c, 0x7a9b889c, 0x54909f81, 0x6faf7894,
+    0xa16a59b5, 0x8ba1a476, 0xa37e708c, 0xa3a9b18a, 0x7c91b996, 0x629668be, 0xa07d7d9a, 0x88a6ac9a,
+    0x857054a2, 0x986784a5, 0x70849d7f, 0xaf77aa76, 0x9687a650, 0x917c8473, 0x729b6db7, 0xbbc2688b,
+    0x818ab2c7, 0x589f939b, 0x738ca086, 0x889a6dae, 0x7f7299a0, 0x858586b7, 0xd17ca687, 0x70ab855d,
+    0xadab639b, 0x9e766b60, 0x8d34b876, 0x7596a099, 0x73818fb3, 0x7f8a9085, 0x8b778bbf, 0x7f7f8a6e,
+    0xa47b8e95, 0x928a9a96, 0xaf7d74a8, 0x979c857e, 0xcb916bbb, 0x5db67ad7, 0x9d5fc759, 0x9345ad7c,
+    0x9864628e, 0x6b5a6783, 0x58abc3a5, 0xb87088a0, 0x4f808694, 0xab8ea5ad, 0x9978ba7d, 0x6293878f,
+    0x6178a571, 0x639b929b, 0x7e8ca895, 0xbaaf829c, 0x9676c18b, 0x8e77998e, 0x9c8771b7, 0x818e6092,
+    0x8c819689, 0xb1988050, 0xc7a67261, 0x8a95be9f, 0x69a4679f, 0x5990885e, 0x67986cad, 0x6a71906c,
+    0x93a5bb75, 0x8b7b8b99, 0xaa8276ad, 0x85908c94, 0x9292c2c8, 0x67748fad, 0x7f93829e, 0xb97c7e8e,
+    0xbfa8909c, 0x9b918c8d, 0xac8e97b2, 0xada46088, 0x6a847199, 0x7ca98d8e, 0x77c4917b, 0x938e66b7,
+    0xb29d8ab3, 0x5ea382a9, 0x8c74a180, 0x9e92b260, 0x917f87c3, 0x58909f88, 0x9e9d798c, 0x848ca667,
+    0xa1c19a6f, 0x80afae49, 0x9a68aa88, 0x7488909a, 0x937e7b75, 0x629a989c, 0x6b82b2a5, 0xae807c6c,
+    0x7087a6ba, 0x66c3a99b, 0x708d42a2, 0x81b45fa8, 0x9d978f65, 0x7c9976c1, 0xa68fc897, 0x9ca08385,
+    0x9d8ab9a6, 0x51529690, 0x746b8d91, 0x9e9e868a, 0xa27287c6, 0x8f8b69b7, 0xc8b288a7, 0x67ba5eb8,
+    0xa98f95a5, 0xbac4aab2, 0x72528974, 0xa488aeaa, 0xa08e7f5d, 0x978995c8, 0x8285a590, 0x5e725a53,
+    0xa7c090a6, 0xaba49e48, 0xd57d9c71, 0xa298826f, 0x9185a39d, 0x7f8992b2, 0x70ae77a6, 0x8faaa4b6,
+    0x9b8776b1, 0xb78aa379, 0x87738a8a, 0x7e6b82bd, 0xbdab867d, 0x8eb19387, 0xb483947d, 0x7f8f6494,
+    0x90726087, 0x9e9999b0, 0x7886867e, 0xae89a19f, 0xae64729b, 0xa088897a, 0xbdb1979c, 0xb58a60b6,
+    0x9d87b591, 0xa4989691, 0x7e9e7987, 0x89758998, 0xa0a0b972, 0xc68e847c, 0x8cd2a780, 0x568c734c,
+    0xaf8e589e, 0x66b87e50, 0xa3498154, 0x85849484, 0x688d89b3, 0xbca6b29b, 0x9d49b289, 0x677ca9ac,
+    0x779687a2, 0xb65b839a, 0x9d627cb8, 0x6885a29a, 0x88948665, 0x8796a8a4, 0xa2b89ea6, 0x928b78ae,
+    0xa89a8b8c, 0x77659fa0, 0x5c87779d, 0xb3a175a2, 0x61a5b18c, 0x6cb59c8c, 0x7b6268ac, 0x826e707b,
+    0x68b1baa4, 0x959f8e8f, 0x8d6ba2af, 0x90b4b188, 0x7f947acd, 0x7aa99b75, 0x94909481, 0x979a8586,
+    0xba8895b3, 0x7fb7c262, 0x93bf997a, 0xbda0a68d, 0x828ba78c, 0x7089ad9a, 0x3db28077, 0xb69aa779,
+    0x6e98be6a, 0x9c519645, 0x96668c87, 0x6fa8799a, 0x99a1704f, 0x549581c3, 0xa4b3c090, 0x50abb086,
+    0xa3a7719e, 0x7bae5f9d, 0x9c677f9a, 0x6f74887f, 0x8cb4ad98, 0xa5be5d78, 0xb5ac6ea2, 0x8d70a480,
+    0x6f8ec2c4, 0x86779d99, 0x7a96a97f, 0x8c947fc8, 0xa8a06da3, 0x9a8cc89e, 0x819b6473, 0x51598b54,
+    0x987c84a7, 0xa25db567, 0x5eb97e81, 0xbe986e8f, 0x61a677aa, 0xc46f8d76, 0x888a758a, 0x5dadac7c,
+    0x877fa747, 0x7c43a56a, 0x4f92b78e, 0xa4a8407e, 0x59a99789, 0x93848a94, 0x8557b952, 0x67a09f98,
+    0xb079a380, 0xb88c5086, 0x5a708ba0, 0xba7c7f75, 0xc7b98e7c, 0x7ca7476b, 0x9759b38c, 0x6b8d9393,
+    0x528978b1, 0x90786d99, 0xb0acce5b, 0x769b898e, 0x6b8f66b8, 0x9562a554, 0x5f8395a2, 0x8235d6ae,
+    0x68917cb0, 0x7d6dc6a2, 0x95739694, 0xca78a27f, 0x8c7a59ae, 0xaa6dba9d, 0x9ba67d6d, 0x6ab09582,
+    0x7d879178, 0x6c7cc593, 0x667caf7c, 0x7b965e45, 0x37b197b5, 0xad8998a1, 0x855bbda7, 0x5b879192,
+    0x9a6bbb58, 0x8daf72a0, 0x7898b990, 0x899f699a, 0xa7b08f7a, 0x8a876876, 0xa1ab6495, 0x58a7ba91,
+    0x6e8b807f, 0x7c3fa09f, 0x946e856f, 0x7dc18069, 0xa07576c2, 0x8991cba7, 0x66b1b09a, 0x7bb4a699,
+    0x4f938f8b, 0x767a98b5, 0x78a17c8a, 0xb023536a, 0x7672bea8, 0x7a907367, 0xbeb18b7b, 0xb393789a,
+    0x855daa73, 0x9cba9a70, 0x8d89aa5d, 0xa5946097, 0x64c1b1a8, 0x956169b5, 0x99afb290, 0x7a8b858e,
+    0xa9a7ae79, 0x7eba828d, 0x718da276, 0xc1984ba4, 0xab689875, 0x84a69d84, 0x9e828c90, 0x58746a67,
+    0x7a808899, 0x7a918795, 0x8f2ac6a8, 0xa78a6387, 0x856c85ac, 0x668f9867, 0x89b09382, 0x7d939899,
+    0x6ca58e78, 0xb56976b3, 0x868f7e8c, 0xaf438aa4, 0x8b758da1, 0xc35f978a, 0xaa8d5f70, 0x7aa19d58,
+    0x7a7a8382, 0xa88dcd80, 0x718daa6e, 0x657f5ba0, 0xb08fbd91, 0x75646588, 0x9e8086a9, 0x5d727985,
+    0xb7c7717f, 0xbb667fbc, 0x9ca6ab6b, 0x8f922480, 0xad85728d, 0x98939d8d, 0x61b673a9, 0xbca4b154,
+    0x7c788085, 0xb6b9688c, 0x5532aea6, 0x8a7c6fc4, 0x8a61aaa3, 0x6b9eb35b, 0x839c6e84, 0x6ca89d8f,
+    0x93a0bfad, 0x73b2b1b4, 0x6cb79e76, 0xa500835e, 0x859673bb, 0xbb52a28b, 0xaa8dba9e, 0x957cb87d,
+    0x8dc1b190, 0x8e88946b, 0x74849298, 0x8fa16f8a, 0xbc7c8f9c, 0x549987b3, 0xba9dac8b, 0x5e839fbe,
+    0xaf9d8696, 0xaa7aaa8b, 0xb38f8d76, 0x96794596, 0xbc526979, 0x848b8883, 0xd5957a91, 0xb4a58151,
+    0xad7f6fa1, 0xc7857091, 0xb225a9ab, 0xb68c5d7e, 0x5c9b7ba4, 0xa0948e98, 0xbfb25ea6, 0x73c0948f,
+    0x9b747e9a, 0x9a80b980, 0x6a98a58d, 0x841b8358, 0x98ba90c4, 0xaf917c85, 0xc4759d75, 0x986baa69,
+    0x6184577c, 0x8ea89078, 0x6997af7f, 0x6f9790a5, 0xbb759e77, 0x7d76a09b, 0xb87dab7f, 0x6b4e598b,
+    0xd39e9688, 0xaea36a83, 0xaab6bba4, 0x8a9326ae, 0x8b896ca9, 0x89797e67, 0x9b6c75b1, 0xb3728879,
+    0x67997c8a, 0xb6c771af, 0x8475c5ac, 0xd28a64b0, 0x9b698d98, 0x919fb46a, 0x8d96b3a1, 0xac99ad93,
+    0x8593becb, 0xaaa1b79b, 0x846e8c7d, 0xa332b590, 0x7e65b0ac, 0x8e57846b, 0x85949396, 0xa7aecf73,
+    0xb7c4b190, 0x76898e8f, 0x80869283, 0x89ac9ac7, 0x959392b6, 0x9c93a672, 0x98937c70, 0x998c8d6e,
+    0x969e8ac7, 0xbcb08a87, 0x84b99587, 0x9464556b, 0x9a88659b, 0xa192a58a, 0x9bac5e99, 0xb8886653,
+    0x7a7b7d7f, 0xa1777365, 0x907090b0, 0x92c760c6, 0x708b82c6, 0x93cd7b96, 0x898e6786, 0x7297aec0,
+    0x8994b690, 0x908e7097, 0x9d86a352, 0x9114ac92, 0xbdaa7396, 0xa37f8785, 0x597b8b93, 0x93aaa368,
+    0x9ab97f67, 0x8d6ba55a, 0xa1bcbb83, 0x9791b186, 0x7a51987f, 0x88966e86, 0x81bb9293, 0xb96b62b3,
+    0x8facaf93, 0x73999970, 0xa7a5b96b, 0x9897298f, 0x7c8191b6, 0xb17e7eba, 0xafb279bd, 0x9cab382e,
+    0xb97c958e, 0x97a7829d, 0x7989c593, 0xc097a199, 0x578188a1, 0xa4a981c1, 0xbb9476b1, 0x94b15ca5,
+    0x79809177, 0xb57c9c65, 0x9991b198, 0x8643846f, 0x788865a4, 0xa1868593, 0x746e66d2, 0xb497848d,
+    0x667d8f90, 0x95bc8e9e, 0xd897975b, 0x8f8fae8a, 0xb46d758e, 0x8868ada2, 0x8f8997b5, 0xc368a38b,
+    0xc68c9a71, 0x936b7fc6, 0x92aad081, 0xbf8e135a, 0x909a9db7, 0xa096a35a, 0xa487999a, 0x97a4634b,
+    0x80a47d89, 0xb192a788, 0x446a8a75, 0xabab69b2, 0x7189739b, 0x5491db92, 0xbc8294a9, 0x646a39cb,
+    0x829f9488, 0xa880a05b, 0xccafbb58, 0xaf76885c, 0x75a4ae8f, 0xbd4c7b96, 0x7b60a2a1, 0x8aa2c072,
+    0xc4ae78a3, 0x60b1618a, 0xc85a6ea1, 0x9893a9ae, 0x797e915a, 0x3db98b7b, 0x737d9d61, 0x839b869c,
+    0x63d850a4, 0x638d7bb8, 0xa889bc49, 0xc4884b7a, 0x7e5a719a, 0x9f6ca2a7, 0xecb861b7, 0xa1913253,
+    0x6977a288, 0x9b8c9085, 0x78b4ad89, 0xa89c8ec5, 0x8ac28e81, 0xa6cbed70, 0xba9c8850, 0x7c8b7169,
+    0x918a8278, 0x9577a680, 0xd6b8b979, 0x8c849250, 0x47736c59, 0xc488a176, 0x286970b8, 0x6cc6e845,
+    0xe2b19c82, 0x5d748051, 0xa6777f92, 0x658af693, 0x79413c7a, 0x939ca18b, 0x6a889577, 0xd867b5d2,
+    0x8d8767a5, 0x75628ba4, 0xaea7fe78, 0xc4ce6461, 0x7c8a6388, 0x76489aab, 0xe68d55e2, 0x8ece8273,
+    0x6191ce9d, 0x7aa46c74, 0x94969476, 0x9bba95e8, 0x6eb2745a, 0x88ade865, 0xa67d5493, 0x7187726f,
+    0xc9666983, 0xa163b55a, 0x7c87dc7e, 0xa67a6859, 0x705f794d, 0xdc81638c, 0xa75d4fb9, 0x70a6d35c,
+    0xd2a5b5a5, 0x4a788b8e, 0x919d94c6, 0x654bca4a, 0x7f7d3269, 0x5185294e, 0xb56cb07f, 0xb394b0d7,
+    0x6e6043c8, 0x6a6cd4d3, 0xa185a851, 0xd2987f61, 0x9a9392a6, 0xab90ae70, 0xd6669eb7, 0x9b689486,
+    0x8c5e9a52, 0x95a78879, 0xa6a25a5d, 0x46ac92bb, 0x3b8f6991, 0x62cfd09a, 0xd2754e86, 0x9f628b94,
+    0xc77f8b8b, 0xb7838a78, 0xb2cda65d, 0xab91ba4d, 0x6d955294, 0xa4915587, 0x8396929a, 0x9e8bb192,
+    0x9fbaa56c, 0xbd888860, 0xac6dbc95, 0xa3bbc66d, 0x689a9270, 0x919145b3, 0x83808a53, 0x756fa4a8,
+    0x6aae6d8e, 0xa0a5be84, 0x8da3bc7f, 0xc5b69a92, 0x70a18b8a, 0x95bdb786, 0xd466afcd, 0x8db2a19d,
+    0x8281b763, 0x439f5ca3, 0x88639b9b, 0x7087a390, 0x7e717753, 0x9c81dc8b, 0x8d9ebe92, 0x587c9d8f,
+    0x957355a6, 0x78876d7e, 0xb4aba070, 0x908ea296, 0xbe71a6af, 0x959a9c7d, 0x947f6793, 0x76717e66,
+    0x767b9698, 0x9fa69d8f, 0xa8918d9a, 0xb95f6a93, 0x6eaeb08f, 0x7da49c70, 0x7a83936b, 0x7a8987a6,
+    0xb5b0975e, 0x8b5a76cb, 0x889c9585, 0xa5aea2b2, 0x7794ab59, 0x9fa28974, 0xa7759992, 0x9e847ba1,
+    0x77b7c289, 0x9f7fbdab, 0x9e677380, 0x8fbcca73, 0x73c36e7a, 0x999d9a8e, 0xbb8d8a87, 0x75b99daf,
+    0xa3698ab3, 0x629ebb6e, 0x638f6795, 0x919d99a1, 0x7cb087a8, 0xc48bb2a9, 0x6262738f, 0x8f91a47f,
+    0x9b81a259, 0x9e8cb383, 0x828ea5be, 0x99589e81, 0xab719e79, 0x887385aa, 0xbd87617c, 0x70baa081,
+    0xc688947d, 0xbf898a76, 0x9ea08966, 0x98aaaa65, 0x89ad9a9e, 0x6b556ecd, 0x8898836e, 0x8590bd9a,
+    0x8e7dc781, 0x61806882, 0x63709699, 0x96a08f81, 0xa7a8b0b2, 0x8ea3936d, 0xa766918b, 0x7f86907e,
+    0xa3588082, 0x8757a566, 0x969fc58f, 0xb67e8c8f, 0xc8ab75b1, 0xa5959c97, 0xa4bc8e50, 0xad50a486,
+    0xae75ac8d, 0x7d86ab9e, 0xb08c7e8c, 0xc48c96ac, 0xad9e7a98, 0x956e8ab8, 0xb078989f, 0x6dbe8091,
+    0xa68fa396, 0x9e886780, 0x70adaf9c, 0xbb79b07c, 0x80b88c98, 0x756592c7, 0xb275959f, 0x779885b8,
+    0x9162a2ba, 0x58b0719c, 0xb5a8c497, 0xcc7ead93, 0xb86b85af, 0x679cc687, 0x91739a69, 0x7db9629b,
+    0xbdc8a866, 0x8ba9b19b, 0xa17f9e75, 0xc5aaa19e, 0xa1b5a6cc, 0xbe827f94, 0x99b4af92, 0x9d7c778a,
+    0xb55ca252, 0x735b8e7a, 0xa6616d81, 0xa079908f, 0x94a3a085, 0x6ea7bcab, 0x83839dac, 0x6293c56f,
+    0xe8adbe60, 0x8fa4537c, 0x5377a587, 0xc18e7886, 0xc3727383, 0x7f825a93, 0x5278a897, 0x9c967760,
+    0x6b757f99, 0x89ac8f83, 0xac5a9a8e, 0xb294658b, 0xd08a63c5, 0x7d9892b0, 0x6e8687ae, 0x7acaa89d,
+    0xa573a19e, 0x8e73a7ae, 0x8e7b7267, 0xa36ea07c, 0x8a98c88a, 0x81769542, 0x73aa7280, 0xb49c8083,
+    0xb487975f, 0x597d7a77, 0x6fa2cdb5, 0xcb606cae, 0x74749b8a, 0x865ac683, 0x96a67c67, 0x91586b9c,
+    0xba98a253, 0xb3b46f42, 0x7e879c54, 0x819b8495, 0xc1ba7ba9, 0xa983b86c, 0x8db387ac, 0x67bb3871,
+    0x97658096, 0x5ab16a8f, 0xa45bc37d, 0x96e1518e, 0x8490aaad, 0x87ad8e96, 0xa49e90b0, 0xa179e29a,
+    0x68729a6d, 0xa4606da2, 0xd6aeb790, 0xc181874e, 0x8a6279b5, 0x9b9b6b8a, 0x869996a5, 0x6e87a485,
+    0xab81ad9b, 0x69869d53, 0x97956e9b, 0x7c5db29a, 0x8eada594, 0x8d8d5aa1, 0xa695c08a, 0x9ab19b85,
+    0x7490639f, 0x92a26999, 0x828b9e4b, 0x7b9dc06c, 0xa7ac9a50, 0x944f857f, 0x83b8a1bc, 0x6e8c4a9b,
+    0x7e9a5978, 0x748d7b8b, 0xb089ad7a, 0xaca3985e, 0xa4a576ba, 0xbca59070, 0x856b9e94, 0x7ebfb771,
+    0x53b26eb6, 0xab8d808a, 0x9a52ba93, 0x9f53935e, 0x7f819586, 0x91649567, 0x7992789f, 0x847d86a1,
+    0xa6569aa1, 0x6da0746b, 0x7aa48aac, 0x8baa6694, 0x93bdb19d, 0x699a89c6, 0x9a6ba27c, 0x924b597c,
+    0x99b87aac, 0xae96aa93, 0xa1a2716f, 0xa88f8b99, 0x899bbc59, 0xaf5d9290, 0x61a99d94, 0x75c67786,
+    0x8287668d, 0x88c29592, 0x90abce89, 0x9590637f, 0xb678709a, 0x71b47659, 0x79be7351, 0x5f8b7b7f,
+    0x909f5993, 0x9262639c, 0x96a98170, 0x98abb48a, 0x8f97a9b0, 0x59a76493, 0x4c78618b, 0x9b6c8298,
+    0x869fa99e, 0x856f6aad, 0x9968676d, 0x846a8ab5, 0x5ba1808e, 0xab85a69b, 0x7f96d08c, 0x739c9177,
+    0xb5868b70, 0x62938fc3, 0x93609575, 0x847d79cc, 0xbc73a769, 0x9f6bb286, 0x77817c7c, 0x8c8e6758,
+    0x777b9c95, 0x48a577b2, 0x83928c5f, 0x92837291, 0x97666a98, 0x7f5b789f, 0x69a1766a, 0x5a7c6ea8,
+    0x9f986e92, 0x7da1a558, 0xd3648777, 0x7463d766, 0xb7a67e95, 0x4571a2a1, 0x4b9c8acc, 0x80c682a1,
+    0x73958b93, 0x9c959f7b, 0xb8576396, 0xaca78fa9, 0x7a6eb57c, 0x9aaa856d, 0x9a809e79, 0xac826d5c,
+    0xac8567be, 0x978a759d, 0x89a77685, 0x8ba9788f, 0xcfb63f65, 0x9f53819b, 0xb1acc26a, 0xbe8e90ab,
+    0xad8c6a8f, 0x96867fb2, 0x58b884ad, 0x6f8070ae, 0xb0618c72, 0x899b876d, 0x8ac694b3, 0x8a796a63,
+    0x909f76b6, 0x88738b56, 0xbe8984a0, 0x77b6abab, 0x788d6cb2, 0x86b37d8f, 0x22779ab5, 0x7c727cb7,
+    0x95607399, 0xc9c17c94, 0x817045a1, 0xa692bc72, 0x8b757f77, 0xc494a77b, 0xc96b858b, 0xc0944d95,
+    0x8ea378af, 0x65abbf84, 0x75656fc7, 0xa5b0887f, 0xa5848aca, 0x8a596d7e, 0x83a39f8e, 0xaf9a856d,
+    0x8db6bfb8, 0xb09993c9, 0x47a3b9aa, 0xc471ba6d, 0xbd5b8884, 0x858f916d, 0xb17788b3, 0x938b5468,
+    0xad999178, 0xb178a52f, 0xcd6e9f56, 0x9aaca49c, 0x8aa8959a, 0xb19f9d6a, 0x64bea778, 0x98766993,
+    0x5d9ca58f, 0xbe6dbc85, 0xad7e8398, 0x9d83a277, 0x80a88267, 0x7f9e8c77, 0x80b3a989, 0xb05a6876,
+    0x76927393, 0xb3648a8e, 0x81b194a9, 0xb37cb772, 0xb5a38e8e, 0xa86bc77b, 0x6d8971d1, 0x8b9d5e99,
+    0x6a779396, 0x7ea668be, 0x56b0b463, 0x768875bd, 0x9a6c8c7c, 0x89bbc6c2, 0xbfa68cc4, 0x7d643e6e,
+    0xb0865195, 0x639e714e, 0xbb54b06d, 0x91997ba7, 0x6bb989a3, 0x769c929c, 0x3e729988, 0x6683a75c,
+    0xaf87836f, 0xb37b7096, 0xcd825b74, 0xa77fb681, 0x8ea8bd6d, 0x909fb2a9, 0x8280996a, 0xc76f8779,
+    0xaf50948e, 0x9b6fbc92, 0x9b89b196, 0xaeaf9f9d, 0x92879ace, 0x6c6f9d65, 0xa25fa489, 0x8897a286,
+    0x9b89bba0, 0x6ed17f78, 0x7a82c467, 0xd06d79a5, 0x8ec265b2, 0x6b6a979f, 0x9a7080b5, 0x67465c2c,
+    0x7dbe80a7, 0x6fa09f13, 0x9d54924e, 0x7fb8bd6e, 0xb3c1aec9, 0xdb94a6a0, 0x2c7da56b, 0xa287caaf,
+    0xbdc69a9f, 0x99aa9e96, 0xac8e3d70, 0x707a829b, 0xa6618a6f, 0x88b57292, 0x6189b594, 0x8e6a5a91,
+    0xba7a6e7e, 0x684a8c98, 0x64839374, 0xddb97380, 0x8fdf6f8a, 0xbeaba285, 0xd0b8c19d, 0xa6b38672,
+    0x9a8a95a0, 0x87ad8da9, 0x63a98b6a, 0x898498a2, 0xada88a77, 0x97649693, 0x878c759e, 0x65285c80,
+    0xa5809ead, 0x759aa55f, 0x94718792, 0xc08d6190, 0x8ab08d95, 0xa96692b3, 0x446c6b8d, 0xa89e9c89,
+    0x8b647a76, 0x6b9db58e, 0x8a8e969e, 0xa67987c0, 0xad798e5a, 0x6bba8899, 0x7bafac9b, 0x9370458a,
+    0xb58f765c, 0x83808f98, 0x698b9eac, 0xaa978b97, 0x877e6488, 0x4d5e9c8c, 0xac9d9da4, 0x77b1748f,
+    0x87818d97, 0x9fa6b1a1, 0xbb678d5f, 0xc77ac692, 0x8d867881, 0x8397b9a5, 0x88a69968, 0x71218a4b,
+    0xa8b08398, 0x6c878a77, 0xa1739c80, 0xb880a4bf, 0x5f7a7bb8, 0x68936e8d, 0x3c7eb291, 0x817cc58a,
+    0x8bc38385, 0xa255967e, 0x7d8d9060, 0x8061847a, 0x839a874a, 0x7d737f8d, 0x87ab996f, 0x5cb5afa6,
+    0x9589696a, 0x92787f48, 0x87a2bfa4, 0xbeb68392, 0xad9f6dc8, 0x7d7d9398, 0xc684c676, 0x48c1919a,
+    0x77748793, 0xa49d835a, 0xa763b094, 0x895b6a85, 0xc1b16699, 0x7e67917c, 0x90877180, 0x8944969c,
+    0x957e709a, 0x8e79b388, 0xa6b2aac5, 0xc35897c6, 0x857362c6, 0x9b69b17c, 0x955c874a, 0x8cb89379,
+    0x7eacd336, 0x88509687, 0x6d826695, 0x935e94a6, 0x826f6d85, 0xa88faba2, 0x3f80b45e, 0x42ab868c,
+    0x93af634c, 0x779e5c62, 0x858bb4a1, 0xa3695c5e, 0xb7ab8fb9, 0x9e845596, 0xa1accba9, 0x2e9c9187,
+    0x8a4f5f93, 0x6876758a, 0xca8ec276, 0xa68a896d, 0x78956185, 0x56466f7f, 0x93856c67, 0x8e19c389,
+    0x4d71706d, 0x5272b99e, 0x7eb46ab4, 0xa9737892, 0x93675f9a, 0x9544885f, 0xaa81965d, 0x5b90845b,
+    0x7680da74, 0x756eb795, 0x7189bb58, 0xb9ac9e6c, 0x6666b77c, 0x70ba8ed4, 0x906fab41, 0x55a49781,
+    0x996ba394, 0xa06c6a6f, 0xb57cbc69, 0x81997159, 0xe7bd8d87, 0x91a0a0b5, 0x727586a3, 0x39c89069,
+    0x88ac5693, 0xae727a82, 0xa978c28c, 0x9f684a9f, 0x97646687, 0x95a07b5e, 0x7a665d53, 0x739fcba2,
+    0x8d6e44c8, 0x8963ac7a, 0x7cd683ae, 0x986a8690, 0x9498af9f, 0xaa535a72, 0xb598c089, 0x974b6d92,
+    0x7488b97c, 0x5da4a652, 0x7289792c, 0x917d8675, 0x99a491c1, 0x8d4d8db9, 0x8f938ec9, 0x8e9d7ea9,
+    0xd27f6a92, 0xc6cd6599, 0x9ab9d1ac, 0x91835488, 0x8b9d87a1, 0x907a8d9b, 0x9d7564be, 0x896ba344,
+    0x9f7132b3, 0x6dd68b76, 0x9464e37e, 0x73a3619d, 0x56a47fc3, 0xa790a873, 0x91a29999, 0x7d7888ab,
+    0x5588789e, 0x909b8ab5, 0x99a6b29d, 0x815a7c74, 0x9b909da0, 0x9f4d7776, 0xa4a19679, 0x7d7aa499,
+    0xa078859e, 0x526da584, 0xafa2b93c, 0x80b0a4a3, 0xab8ea898, 0x7f816ba0, 0xc448c1ac, 0x7b88a087,
+    0xae7b96b8, 0x95bc75b1, 0x87a992c2, 0xc7834690, 0x8b8aab8b, 0x7eb8a6b4, 0x956a6a9e, 0x84877d64,
+    0x77c461b4, 0x8aaf7d7f, 0x7f80c198, 0x80a6538c, 0xa2858bac, 0x90818d76, 0x7b9f986d, 0x5db59f7a,
+    0x4d7a6ba4, 0xaf747aae, 0x9aab6956, 0xc33c8194, 0x98999c9a, 0xb8899e6e, 0xa3b48a9b, 0xce4d668e,
+    0x848fa74f, 0x6cd5a37a, 0x7b74d14c, 0x92b68c90, 0x7fa0b4bb, 0x4baf8995, 0x93928981, 0x7a73b0bc,
+    0xbd989d9b, 0x729c8276, 0x8ab38f7d, 0x97c219c0, 0xa08b7f68, 0x8a9080a0, 0x87b38cb6, 0x86934934,
+    0x60a35f82, 0x9378a395, 0x648170b8, 0xa9956089, 0x60489276, 0x809f5a9c, 0x69949893, 0x9c83b17c,
+    0x47999b87, 0x98ae75a4, 0x7ba9acb6, 0xac15af8d, 0x91b7ac9e, 0x9252b995, 0x8f72897a, 0x9e739e54,
+    0x82bca585, 0x80819b86, 0xbe77953c, 0x83a79280, 0x70836c92, 0x7d86949a, 0x75888087, 0xa67f90c7,
+    0x96a59096, 0xac8b948f, 0xc7a4a5aa, 0x9d92409b, 0x80778869, 0xb670bc6e, 0x7da89392, 0x73b86d1b,
+    0x9a84418c, 0xac9e897a, 0x6c8f959c, 0xae922a93, 0x895ba2c6, 0x88acb49c, 0x6e986d8f, 0x7f666ea0,
+    0x8798b792, 0x8a788f73, 0x6db78f8d, 0x90147190, 0x7d98637a, 0x6084cb70, 0x98aa6fa4, 0x8f5f6595,
+    0x9ca78c72, 0xa28777aa, 0xa14bcc22, 0x939b8e70, 0xaa9a84b3, 0x7dba8ea4, 0x8b707a8b, 0x57866ba3,
+    0xc2989286, 0xd7996a7b, 0xb49d9a7e, 0xae9839cd, 0xb2b0c089, 0xe28483b4, 0x9db446c3, 0x80866c33,
+    0x9b815db3, 0x7f797ecb, 0x575ca59f, 0xa8981f8b, 0x7c7c87b8, 0x617bb46e, 0xab8c72a3, 0x83675389,
+    0x5697979c, 0x988ea776, 0x8196bd5e, 0xad449f7e, 0x5fb1929d, 0x7964829f, 0x81b5746a, 0x9549b15c,
+    0x7ac872a4, 0x6f7b7057, 0x959db935, 0x74c99aaf, 0x77ac96b5, 0x71859fab, 0xba839f64, 0x829b8d93,
+    0xafc39897, 0xb775957c, 0x89c3898f, 0x78972dc2, 0x797c667e, 0x92838b70, 0xb09a9aa5, 0x96a8341c,
+    0x709fa990, 0x8a9d78b3, 0x5fb99185, 0xbfba7177, 0x826688a5, 0x877a7c8a, 0x9595a7ac, 0x948f5c7c,
+    0x3d8b9685, 0xc2bdb479, 0xaea98b86, 0xb804bd87, 0xa38695b5, 0x8c747e5e, 0x896f7189, 0x6474d0b5,
+    0x76ac896c, 0x7b749769, 0x9b788d6b, 0x8f6a9cab, 0x8d8f767b, 0x7f9cc9c0, 0xc4939a50, 0xb67b697b,
+    0xc0888f86, 0x9692b289, 0x9c708b5f, 0xbe7a4288, 0xaba96ead, 0xa166a28b, 0xc0998e8b, 0x75805831,
+    0xa98673b0, 0xcf989088, 0x728999da, 0xc2a71a90, 0x958b847f, 0x709d8596, 0xb5968c6e, 0x839264ba,
+    0x93a9a08a, 0x9fa1b441, 0x8fab8c7b, 0x8410ae96, 0x84884a59, 0xab7d72ab, 0x919c4cc3, 0xc14fa379,
+    0x879f9b93, 0x857e8374, 0x989fc16d, 0xacb4bc90, 0x81389b79, 0x918e67af, 0x8cbb9ea9, 0x7b9790b2,
+    0x9d917283, 0xa4786c77, 0xa6a9915b, 0x7b891e98, 0xa89b5e86, 0x807b74b2, 0x7ab26590, 0x68a4885e,
+    0x637d575a, 0x9d857c9e, 0x357a5f8d, 0x9db046e1, 0x77ce8971, 0x5464799f, 0xc8a95d9d, 0x627e537c,
+    0x6c82aea6, 0x8a688770, 0x9a9da98c, 0x96659035, 0x69727088, 0xcd50676f, 0x4f3b848b, 0x62a3cf7f,
+    0xaecbaad2, 0x51598937, 0xcfc08361, 0x8c7cbb69, 0x8970af6b, 0x7f838b72, 0x5495ab5e, 0xaf9173bf,
+    0x72a565bf, 0x5d7f93b1, 0xa0adc937, 0xb0966f62, 0xb57c35c9, 0x503f8bbb, 0xbc9085ad, 0x6798675a,
+    0x8e6d8c53, 0xb06a7f7a, 0xa88e828f, 0xbc9c89e1, 0x759f9d8c, 0x54b5ca87, 0x8cb37da6, 0x258d65a0,
+    0x8871874a, 0xa65bc3a4, 0x90a4f268, 0xb0867994, 0x5f607189, 0xce679e80, 0xa25171c8, 0x79c0b17c,
+    0xd9ea68ca, 0x83567d5a, 0xaa6b8aca, 0x8351e57f, 0x5d557973, 0x6ac07977, 0x82917f51, 0x747884ca,
+    0x5e7934c5, 0x646e99c6, 0xc1b3d756, 0xcd9c8d50, 0xad4ca59f, 0x71958bac, 0xde475acc, 0x5e6483ad,
+    0x7a59975b, 0x51914b9a, 0x6abc875a, 0x9fca62d4, 0x7b8e728b, 0x6b8bc98b, 0xcfa7a79c, 0x797f8aa6,
+    0xac667a96, 0x6f9e80b0, 0x9a80d795, 0xc29e814b, 0x8093c9a6, 0xd0af7c71, 0x70925c81, 0x7eb1b95e,
+    0xa3887485, 0xac7e8d8a, 0xa489a593, 0x9d8dab8a, 0x86987f8d, 0x9cc3666d, 0xa8755961, 0x89c97f9a,
+    0x9f4e4477, 0x958277b4, 0xbab6e474, 0xed6475a3, 0x9684938f, 0x8b83c37f, 0xfd5db4c2, 0x89958f97,
+    0x6878af8f, 0x676d5068, 0x966ba64c, 0x64b171bf, 0x7d8f977f, 0xad97cc89, 0xd79d7cc5, 0x526aa188,
+    0x9653898a, 0x62839089, 0x9978b05c, 0xa8747fad, 0xa29c9ab7, 0xcd6466a5, 0x7a779885, 0x978c9f6e,
+    0xc3aebc9e, 0xa9945351, 0x567b7e95, 0xbaa99ca9, 0xaa8e75b0, 0xa4747e66, 0x7d9798a1, 0x91918fb7,
+    0xb46f75b2, 0x92c77ca0, 0x938caab7, 0x9ac3909b, 0x939c6cb0, 0x72917ba6, 0xa3838bad, 0x97c884b8,
+    0x71986f95, 0x589d70a3, 0x92958ab2, 0x94a6b485, 0x769c707e, 0x72826b93, 0x63a997c2, 0x71aab979,
+    0xa2b5879e, 0x818877a1, 0x6e63966e, 0xc89a6aaf, 0x6c9e8b81, 0x8f89c991, 0xaa899b6d, 0x747472bd,
+    0x647a9096, 0x5eaa8cab, 0x8b99527c, 0x7ccd4d9f, 0x87748aa5, 0xb28ba5ab, 0x8dadc872, 0x7cab8a88,
+    0x87a27f5e, 0x95817f8e, 0xa795a277, 0x9399896c, 0x65bea77d, 0xca816a83, 0x75708096, 0xb5a1a663,
+    0xae7183a0, 0xa2a27ab5, 0x66b69da0, 0x889cc96f, 0x6d70b191, 0x8e87bca5, 0x6a758981, 0x875c5c81,
+    0x596aa48f, 0x648f8b97, 0x9ab26f91, 0x8ca565a5, 0x6ca268c9, 0x7f8f7678, 0xd4746a92, 0x6faeb192,
+    0x7a738a85, 0x858f949f, 0x6a8d7e8e, 0xa8a189ba, 0xa697a99b, 0x6584a188, 0x76baab8e, 0x69af86a0,
+    0xc5adad6a, 0x958bb593, 0xbcc0a880, 0xa56d8575, 0xb68d90ab, 0xbf9c81a7, 0x84c5a1c1, 0x7597918e,
+    0xcca0a295, 0xc2ab9973, 0x82907ba9, 0xcd9d777e, 0x787d9e94, 0xc056a07f, 0xb99eada1, 0x5e8bb881,
+    0xb3af6bcd, 0x9798a684, 0x916495bc, 0xa2869dba, 0x858586a0, 0x6a829d44, 0x87737d86, 0xa391a861,
+    0x829f7fac, 0x525cc88c, 0x486a988f, 0x8e8b60ba, 0x6f7dc56d, 0x695f6fd1, 0x7683909c, 0x718b929d,
+    0x817a9c5c, 0x948a6b7c, 0x9b53b38b, 0x8d818187, 0x8f708cae, 0x9a7e5791, 0x666d80a7, 0x8a5e8063,
+    0x746399a2, 0x74ad4a9f, 0x6f73b587, 0x96925d85, 0xa0a79bd2, 0xb59aac4f, 0x64a4a780, 0x6e616f8e,
+    0xaa73c38a, 0x9584a4cb, 0x9b92aebe, 0xb69c8f92, 0x9ba66cc0, 0x95817984, 0x858ab095, 0x6497616f,
+    0x646dd89e, 0x844e9b8e, 0x4ba173a3, 0x825b4db7, 0x99666688, 0x7da087cf, 0x666e719f, 0xa0b099ad,
+    0x85789932, 0xabc79989, 0xbab1a859, 0xd468965c, 0xc172ad7a, 0xcaa2aaab, 0xaf96a171, 0x626c73b7,
+    0x8b4e8570, 0xb7948185, 0x977bd486, 0xa3a0af6d, 0xa278b4ad, 0x8b97a196, 0x537fa57c, 0x89c3aac2,
+    0x978a9ed6, 0x85869a9f, 0x8889aaa8, 0xd262768e, 0x767666c6, 0x8c5b9869, 0x7b848266, 0x959c8880,
+    0x9855b46c, 0xae5aaa72, 0xaf69a5c1, 0xbf6487a7, 0x9a5e86c8, 0x727d8997, 0xb678d775, 0x6f99b097,
+    0x856e5ab1, 0x9f8ca19d, 0xaea4ca5b, 0x814d615b, 0x98b14d97, 0x907a9687, 0x9b8cc8a4, 0xa7c0707a,
+    0x6c798479, 0x66c4b5b5, 0x63a38f9b, 0xc6689d56, 0x96a158b8, 0x8d5a7c65, 0x8f707b6c, 0xa2646592,
+    0x998892b3, 0x86869388, 0x97ab6e60, 0xa1b0ae8e, 0x9d794ca9, 0x687898af, 0x8bb086c2, 0x746aac92,
+    0x73827a6c, 0xc0789b7b, 0x656a5567, 0x8b7a786c, 0xa1758799, 0xa7a1a18e, 0x6066b287, 0x6f81a758,
+    0x697b689d, 0xa09d9397, 0xaf88818f, 0x83acbb82, 0x9a946280, 0x7e71b496, 0x8f86a095, 0x8cba6179,
+    0xa17e9188, 0x91b776b2, 0x4a68b753, 0x877a978e, 0x8b778185, 0xbfaf7f5b, 0xa7bb7e94, 0x816dab76,
+    0x8f9c6f9e, 0x90609048, 0x90996881, 0x5c9fd578, 0x678c5a9e, 0x8ac6bb85, 0x717f8195, 0x8d8e8d88,
+    0x73b4b271, 0xa9a699ac, 0x93425392, 0xad7eb369, 0x6789618b, 0x50a39f89, 0x8158a972, 0xa26f5d8d,
+    0x7c8e6b7f, 0x99747baf, 0xbe8a97ac, 0xc29e8292, 0xb7a5827b, 0x795b7890, 0x9a849d7b, 0x5ebd9eb4,
+    0x809880aa, 0x5ba174c0, 0x79a18571, 0x8ca77086, 0xa0678b86, 0x9072745b, 0xa4b13b82, 0x8e3f6072,
+    0xa5a68a5f, 0x758a9a3c, 0xacb6908a, 0xc070af9e, 0x86a27a85, 0x7eb1b783, 0x3984c493, 0x51716f89,
+    0x8c959e86, 0x746ec7ac, 0x839d7899, 0x99947e96, 0x8237c47a, 0x96b19bbb, 0x67b16a5b, 0xa18f5e87,
+    0x64866daa, 0x989eb588, 0x8ebb6cb6, 0xadae9f9c, 0x905a2cc7, 0x6e8b9e64, 0x8aa195c4, 0x76ab96bb,
+    0x53919887, 0xb79871a0, 0x86696868, 0x94a1b499, 0xa885339c, 0x8d9694a7, 0xbd985c93, 0x7a6a897c,
+    0x99747aa4, 0x4fb95d1c, 0x82586e87, 0x72c2af79, 0x6ab3727d, 0x8aa4bdb1, 0x5e908463, 0x9a66a8ba,
+    0x7d5f55a9, 0x7aa77b8f, 0x8375777d, 0xb963969c, 0x9b84af6d, 0xcabd7a90, 0x93bcc197, 0x979372aa,
+    0x949a73aa, 0x7e91849e, 0x8fad797e, 0xad66848a, 0x8ea166a7, 0x72968aba, 0x848da290, 0x7ecfb2a9,
+    0xb9c075b1, 0xa391ccc0, 0x74a6a4a7, 0x8668838b, 0xb6874781, 0xb3b57392, 0x9fa24698, 0x75243c6d,
+    0x7976768d, 0x84aba011, 0x7164b261, 0xd18d89a2, 0xa0795f8e, 0x779b7db2, 0x256dc98e, 0x8c79ab6a,
+    0xac867087, 0xa6acaeb3, 0x9a6f6388, 0x919da26e, 0xb154c056, 0x63b49875, 0xa29f9a81, 0xab5d5c84,
+    0x89864acf, 0x5082a7bc, 0x88906ba5, 0x98868fb7, 0xb5655790, 0x9ca37472, 0x8fa7b38e, 0x9a877bab,
+    0x9c7b9cb0, 0x7a899a9d, 0x8ba25eb3, 0x9676aebe, 0xa87a525f, 0x9e7a8e72, 0xbf967e72, 0x8e473e68,
+    0xc7a745a2, 0x6caab328, 0x71a0ab69, 0xa38e968e, 0x9b8788a1, 0x9bae876d, 0x5f8b9cb0, 0x4aa188a5,
+    0x99976886, 0x5f73876d, 0xae957163, 0xb9a6cd96, 0xa183984c, 0x599e6ba0, 0x6a9884a0, 0x99818d92,
+    0x5fa24e9f, 0x6099b570, 0xaa8aa37a, 0x84b5a898, 0x66ce61c6, 0x62a5786f, 0x60b17ca7, 0xae8897aa,
+    0x80a5c19d, 0x978a7c97, 0x7eae9174, 0x9267ae97, 0x69925c6e, 0xa3a27c93, 0xc3b34ecd, 0x77586278,
+    0xccc68a9d, 0xad924d47, 0xb0428f5f, 0xb6767bc2, 0x697b6a7b, 0xa29f8ba2, 0x45909977, 0x82aaae79,
+    0x95be749f, 0x9d8896c4, 0xa67f738e, 0x8f839bb6, 0xa5519c71, 0xa4bcb0bd, 0x42918995, 0xa37baa62,
+    0x7d807274, 0x3fb08dd3, 0x81a1b6a2, 0xd39985c8, 0x7f987e8a, 0x81927679, 0x83917dd6, 0x81b98d84,
+    0x72a5c6a1, 0x80757e7e, 0x8a88b782, 0x8f99a6a8, 0x5f7d2974, 0xa99b8880, 0x897850b2, 0x873d7f88,
+    0x888b6f85, 0x5d8b926e, 0x849fb377, 0xbb9abaaa, 0x9a9f657a, 0x86c09c8b, 0x867abd7e, 0x778a8b75,
+    0x7f867777, 0x675c8ab6, 0xb99e737d, 0x8eca9bdd, 0x8e308446, 0x94b1b4c5, 0x62888f98, 0xae84bd89,
+    0xa1627392, 0x79727280, 0x8d8eb86f, 0xa272939c, 0x866b74c8, 0x767cc06b, 0x9bd281c9, 0xab60a8a5,
+    0xa499ad81, 0x6c89a784, 0x95868845, 0xa59ba79d, 0x819d2068, 0x969b8359, 0x7e6c3f8b, 0x81307d6f,
+    0x84939091, 0x81547a6f, 0x8d7ba287, 0xbf68975e, 0x9d70537e, 0xce7eaa94, 0x85886cae, 0x959fae7c,
+    0x799a80b9, 0x9266b7b6, 0x9772869e, 0x9da6c892, 0x94874785, 0x8d8076b4, 0x26c35b9e, 0x6eb0bb98,
+    0x836b788e, 0xb9b68d64, 0x7ec7aa60, 0xaa85888b, 0xc0635e72, 0x6e845b80, 0x56a381ab, 0x7fb28f9c,
+    0xa97b7986, 0x77448e75, 0xdcad8170, 0xb49ea5a7, 0x87cf3d5c, 0x96a4884a, 0x859052a6, 0x9353a4a2,
+    0xab93a2a9, 0x81ab97a2, 0x78dc9298, 0x7d719f6d, 0xab994d7d, 0x96549691, 0x8d3e6689, 0x81a18884,
+    0x7985cc6c, 0xa95e85ac, 0xb4b55c82, 0x9ea2a673, 0x5f5f609c, 0x90986d8a, 0x2a938d44, 0x75b5a9a1,
+    0x7c8f4477, 0x9fa98f5e, 0xc5a5a9a8, 0x9f6e7260, 0x845a5a81, 0xab9f3f77, 0xbf8ea1a1, 0x6c9db06c,
+    0x986260a4, 0x9e6e4d78, 0xcb81bf58, 0x9d997b8e, 0x76bf659d, 0x9f7c7e51, 0x94506e6d, 0x7037c99e,
+    0xa6513288, 0x758184c1, 0x8ad393d5, 0xa36aa6a9, 0x959474a8, 0x975ebd89, 0x9061a967, 0x98ca796c,
+    0x7983b086, 0x988bc882, 0xa88ba881, 0xb380a270, 0x6d94afc0, 0x7b8c647b, 0xaa9d5e8d, 0x6acb878f,
+    0x5e746ba4, 0xa08a8294, 0xb7b09db3, 0x7878818d, 0xae947e85, 0x988f75ba, 0x57838a7d, 0x8991a550,
+    0x959d889d, 0x478a5861, 0xb0706e51, 0x91ba6992, 0x627c6c9a, 0x6dac823d, 0x614f635d, 0x579d9c8e,
+    0x926b588f, 0x9579947a, 0x819087bb, 0x67a27cae, 0x9f6b8494, 0x737c7b85, 0x91b0a085, 0x8a75448a,
+    0xa47fa2a8, 0x918ea29c, 0x5e84a387, 0x9baf6f81, 0x6e7ebca8, 0x8bad7bb5, 0xaf825b70, 0x7799879f,
+    0x92296e5e, 0x7a978d76, 0xb18f9d77, 0x998b9e9c, 0xcac36ea7, 0x93aca47c, 0x685dac5e, 0x8a94a082,
+    0x94ad4288, 0x61a67266, 0x988a8759, 0x7a745f88, 0x6d6d99a8, 0xad888d96, 0x596b75ab, 0x6dc5a0b5,
+    0x59867fa7, 0x71846383, 0x9e838b7b, 0x8b82ad7a, 0xa093958f, 0x9a83b38a, 0xa08ce483, 0x798b8471,
+    0x9dab9582, 0x8d94a992, 0x925db858, 0xb59185a1, 0x94ab90ba, 0x82a573a9, 0x8a857fb1, 0x95ba8a97,
+    0x8d709396, 0xac99a991, 0xbb968e8c, 0xaa747c98, 0x96788673, 0xcc746586, 0x6c908a95, 0x994e62a2,
+    0x8daa5196, 0x95dbc5b9, 0x649faa5e, 0x9a7e678c, 0x6c987c98, 0xc2a7919e, 0x74b05785, 0x968a66b0,
+    0x5e7cb0c2, 0x69c59c9f, 0x6874b49c, 0x9a8e88b5, 0x7c99977c, 0x7377a986, 0x969e8d99, 0x7d5b8668,
+    0xaa8f8ea3, 0xbaacd69e, 0xa2817347, 0x7d7cadb6, 0x7684b8c2, 0x837e9376, 0xa07482b1, 0x74505ea2,
+    0xac9e99ab, 0xb6aa8c8a, 0xa9c79a9f, 0x9a758a9a, 0x83a26484, 0x969576ce, 0x61b15775, 0xc0707b75,
+    0x908a74a6, 0x8dbaa4a7, 0x68a59271, 0xa0a04783, 0x9f72a7ae, 0xc38038b6, 0x82ba70bd, 0xabcab19b,
+    0x9ba8bba8, 0x93818b7f, 0xb08d8e91, 0x874a82a8, 0x7579847d, 0x9083b284, 0xc6adc285, 0x8479987c,
+    0x788d8992, 0x928cc392, 0x93a5a742, 0xd28aa0ac, 0x927c89b5, 0x989184a5, 0x768aaf61, 0x9581a277,
+    0x8d92856d, 0xb6895e89, 0x679eb3b9, 0xa9a593c1, 0x7aa978bb, 0x8cae916c, 0x3281637f, 0xb18d7c6b,
+    0x81aa5699, 0x77bda5c7, 0x93a1907e, 0x995a1e9a, 0xa4779e86, 0x998d7c71, 0x6fbdac9a, 0x8d946fb7,
+    0x5dce84bb, 0x9283a78e, 0x867e6c5f, 0xbd52a4ab, 0x778c938f, 0x85c192ac, 0xa761967c, 0x7289acaa,
+    0x60697cae, 0x9b90da85, 0x928fd74d, 0x999d6e82, 0x8aa0a6d0, 0x8780a799, 0x7bb1619b, 0x6f6f8093,
+    0x9fb49b66, 0x93986398, 0x998571ae, 0x7b689079, 0x9989c37d, 0x896690a2, 0x73bb588e, 0x83b37f39,
+    0x80be42ab, 0xac68ba9c, 0x49c697a5, 0xd1863255, 0xabaf7cb0, 0xba8e6f81, 0x38aa5692, 0x8e8c90bc,
+    0x7d61c1aa, 0x7b7bbe85, 0x98a27e82, 0x8867bf8d, 0x57905873, 0x707fab8e, 0x6fbd9ea4, 0xcb5c9f9c,
+    0x93a59c6f, 0xc797cea7, 0x8b64a149, 0xc08f5d90, 0xbc8d9991, 0x60a08780, 0x5d9fbda2, 0x867f7389,
+    0x9687a67b, 0xce8e577a, 0x83d280ab, 0x75b28170, 0x78c17581, 0x9f675296, 0x326c778a, 0x9c738580,
+    0xb7925b8b, 0x6f7682c3, 0x47a97596, 0x8c7e2fa1, 0x7d8c7d9a, 0x4f5c8670, 0x4aa4a5b7, 0x908c668b,
+    0x63a69288, 0xd19bba92, 0x68a2ac58, 0x794f959f, 0x5290947f, 0x97759469, 0x84946ab7, 0xae4ad08e,
+    0x53927c66, 0xa58d9ab5, 0x976aa614, 0x6e965f78, 0xb056af5e, 0x5f848d8f, 0xaebbbb80, 0x8b6d6faf,
+    0x96a6b8c2, 0xb77e92a6, 0x7e79a196, 0x7b8573a1, 0x5dc89fa6, 0x9e784a7b, 0x79dc8693, 0xb693a436,
+    0xb37c5dad, 0xbc7567b0, 0x37749b93, 0xe95b297b, 0xc0777368, 0x5d5783af, 0x28678664, 0xa0547b67,
+    0x5e67bace, 0x7c7f8c76, 0x5c6a926e, 0x913f718a, 0x5f94758b, 0xcf6aa7a8, 0x51616a89, 0xd95de872,
+    0x789c98b7, 0x6c797f7f, 0xdd3dcf26, 0x7aa480aa, 0x90628977, 0x9fb6ca81, 0xafcbbf84, 0x967376b1,
+    0xbbc67395, 0x57ba8784, 0xa19e4c5c, 0x758c4795, 0xc3788697, 0x6f70b192, 0x78caa7ca, 0x65856421,
+    0x735eb38e, 0x926949b3, 0x68bd879f, 0x9e601da8, 0xbc985aab, 0x80617782, 0x48706abd, 0x87617187,
+    0x738cc286, 0x9d8ba185, 0x7fe4bd4a, 0x7a89b27e, 0x58877784, 0x91996bb8, 0x5e3e9faa, 0x9789e239,
+    0x6be58a84, 0x7f534058, 0x79b6944d, 0xc08fa260, 0x73a19f60, 0x78919b46, 0x9ab18878, 0x9095b59b,
+    0x8d947e82, 0x59965b8d, 0x8294c5a0, 0x869a4f9d, 0x7e5e9cc4, 0xada56e92, 0x9f6a7bcf, 0x56c36c66,
+    0x80948d6f, 0x9268558c, 0x6b67aa92, 0xba9a3ee0, 0xa88a8e6c, 0x4d8c866e, 0xaf7c8376, 0x82829072,
+    0x83939977, 0xc395beb6, 0x5fbc8196, 0x8ba3a954, 0x7b8faec9, 0xe68c80a7, 0x73476d67, 0x8987d892,
+    0x8e9671ae, 0x81af8e5d, 0xb253738f, 0x865e867f, 0x82725eaf, 0x99925e8e, 0xafaca92d, 0x9e7391bd,
+    0x715648b0, 0x838b9474, 0x96be8e9a, 0x94789d40, 0x7a8d9593, 0x7083a2a1, 0xcfa67e86, 0x7e78537b,
+    0x62468550, 0x8153747e, 0xa48f6c5c, 0x81b86494, 0x7292b27a, 0x79a0c3a6, 0xca9c8864, 0x8c8e917b,
+    0xba4da176, 0xcf9bb662, 0x907adb92, 0x675f8853, 0x956e738b, 0x9269afc6, 0x8785b088, 0x5d9fca56,
+    0xa37a7e9b, 0x607e895c, 0xb7ad9fab, 0x96b1be97, 0x9c746375, 0x829a757b, 0xb8a19a4d, 0x7fac82aa,
+    0x94576eb4, 0x8098b7a5, 0x8ebab587, 0x86a7906e, 0xa05c7d85, 0xaa958d9d, 0x9c94929b, 0x7e99a791,
+    0x6aa47cb2, 0x8f9990b0, 0x78827a54, 0x70baadbd, 0x827281b6, 0x946c8778, 0xd280a69b, 0x8a4e7266,
+    0x8d82737d, 0xa09681ad, 0xa89596a0, 0x757b8366, 0x817eb588, 0x9a618ab5, 0xbb67b975, 0x9bcb7b89,
+    0xa5a2998c, 0x6b936c81, 0x8cb677c4, 0x70b4969d, 0x959a8fa4, 0x977c7d8e, 0x848ca94f, 0x91b9c1ad,
+    0x5ca4a57a, 0xa1ba908a, 0x8c9c9887, 0x828f9390, 0x91b287b3, 0x7e7c639b, 0x9d8db17f, 0xb870c081,
+    0x9acd7f72, 0x97a6a57c, 0x6d7280a3, 0x8897ac67, 0x8b936d8a, 0x7486b492, 0x9863c496, 0x71ac68ab,
+    0x66978abb, 0x7185825e, 0x5caa7f76, 0x90869997, 0xa38f8dae, 0xbc739d77, 0xa6cd8094, 0xa08e6450,
+    0x61bc747e, 0x9aa37ec4, 0x65979bb3, 0x918a8398, 0x9374a277, 0x858688a9, 0x8e76589f, 0x8a86b6b0,
+    0xab94bdbd, 0xa880949b, 0x80bb7c94, 0x93708985, 0x8abd8cbe, 0xa1c06181, 0xc877af82, 0x7ead6a80,
+    0x969672ad, 0x988f8590, 0xa79d78a3, 0xa4807d9d, 0x57898892, 0x77777292, 0x98c5af5c, 0xa283ccb0,
+    0x82938890, 0xcf8d9d67, 0xa7667fb5, 0x947bab9f, 0xa08eb7ba, 0x8a71a88e, 0xbf7a70a1, 0x70849373,
+    0xa9669f67, 0x757ed7a4, 0xb45280cb, 0xae99a8b1, 0x8a7c7167, 0xb2819bb6, 0xa2b79f8c, 0x6963ad77,
+    0xab97a678, 0xb3ba6f9f, 0xa0a6a278, 0xab6a6980, 0xc392b7ae, 0xc587819c, 0xb2cd7ca6, 0x60948cb0,
+    0x86ad6ea0, 0x7da08784, 0x9c8fc670, 0xa18c7872, 0x829990d6, 0x9ba4a8a7, 0x88d38993, 0x92be697e,
+    0xacaac684, 0x86756285, 0xc07a8d7e, 0x8c6a93b8, 0x9a7c6aa0, 0x818ba457, 0xab68906f, 0x5c8a7b82,
+    0x9d7db08d, 0x85a2a479, 0x6989599a, 0xbd6d788a, 0xa75e98a8, 0x99b0acc5, 0x9b79bb73, 0x778765b2,
+    0xb8b49356, 0xbac7627e, 0x73af866b, 0xbc6c715a, 0x849590a7, 0x5f919d7f, 0xbadebf98, 0x8e9d687d,
+    0x7b906ea0, 0x787a60a2, 0x7a6fb571, 0xbd8c91a2, 0xd194adcc, 0x815276c9, 0x8cbfc079, 0x915dbaa5,
+    0x72a6d2c0, 0x669c5a46, 0xc0ab817c, 0xc9819a5e, 0x5a8e6aa3, 0x8f71b578, 0x85b39f9b, 0x8acd9197,
+    0x7f7fa886, 0x5a90b671, 0x5c73929d, 0xa66d84ad, 0xb273907a, 0x97a19ac8, 0x5697d3bf, 0x6eb69593,
+    0x857b817a, 0xa079567e, 0x795eab56, 0xb3608ca5, 0x7ea3667b, 0x67ab9b83, 0x93aaa076, 0x858b8978,
+    0x77629cbc, 0xa9ab82b5, 0xaf9f8966, 0x90c0809a, 0x6d559976, 0xb17a8649, 0x959c6d62, 0x9e998898,
+    0x74a5c1a1, 0x8c6b6a70, 0xbe8762ac, 0xa6549661, 0x514e6c92, 0x8a9890a3, 0x6baa91b8, 0xb1c8917b,
+    0xd068829a, 0xd0839069, 0x7863688c, 0xb1a24998, 0x5b6c8183, 0x84a26fc7, 0x4465b270, 0x5fb066ad,
+    0x80974393, 0x89717c81, 0x839aa8a5, 0xbd8198b3, 0xc68b5277, 0x709c8587, 0x5c59998a, 0x61887383,
+    0x8aa662cf, 0x9d6e9e6f, 0x874db587, 0x9572c05d, 0x90b6509d, 0x828e6b49, 0x7e8f8474, 0x8748b5a9,
+    0x55b46283, 0x5b7c644c, 0xa2a8a796, 0xb1939874, 0x8bb54d90, 0x8c6fc37a, 0x19a4b398, 0x968c99c5,
+    0x725a7746, 0xc4a79e6d, 0x9a8a7c8d, 0xa3a49094, 0xaf6a9893, 0xb761adbf, 0x625cc05d, 0x818b818c,
+    0x66948aad, 0x8aa3b785, 0xab907b81, 0xccaf769b, 0x6f8b3c78, 0x809d9a67, 0x85abc588, 0x669f5681,
+    0x87985f9f, 0x6a896088, 0xba939c64, 0xa161a691, 0xae78848c, 0x6668b869, 0x99719583, 0x723f8656,
+    0x7a8265b4, 0x52875622, 0x91c19e7a, 0x87c8ca95, 0xb7b36396, 0x8c947abc, 0x3bb181a0, 0x79697d8e,
+    0x98838451, 0x9fbe7b7e, 0x8a937a89, 0xa3b8a5ad, 0xaa519b49, 0x8c79a9c2, 0x7ab5889a, 0xb19d6b58,
+    0x6a723596, 0x6e7fbe8b, 0x79b896c1, 0xd08ecfa2, 0x85915798, 0x5773895c, 0x7c8e9bb6, 0x7b6a9ea5,
+    0xac8489a7, 0x96798689, 0xbbd26d79, 0x8670ad96, 0x5bac578b, 0x936fac82, 0x888459a4, 0x612e7275,
+    0x8f80757c, 0x7c6ea33e, 0xb28a87ad, 0x8b65b891, 0xbea7469e, 0x93d2bec0, 0x516f8d87, 0x90746bb2,
+    0xabbbb1b2, 0xa686b880, 0xa2974da3, 0x86a78479, 0xaf248a78, 0x9d9ec0b3, 0x7e71ce85, 0xa8954c88,
+    0x84be5398, 0x8b899dbb, 0x53be82a0, 0x9fb97d8d, 0xaa7470a7, 0x7f9b8b5e, 0x626ba199, 0x71aeac98,
+    0xa796b2ba, 0x686da377, 0x63947863, 0x9d509290, 0x7b853e7c, 0xc0959078, 0x9a9331b7, 0xa749585f,
+    0xb0a2a9a9, 0x54758b46, 0x9494af81, 0x95b18296, 0x92ae676e, 0x9a77b1c4, 0x4a78b599, 0x91868dad,
+    0xc38c7399, 0x88b595b0, 0xc0be8675, 0xb596b09e, 0x694d718a, 0x6cae9081, 0x5a9ba197, 0x819a6178,
+    0x849a58ab, 0x527fc796, 0x8c9d9ecd, 0x87a7abb4, 0x9a8996af, 0x54699d7e, 0x80835ec3, 0xa65fc99e,
+    0x92af8b92, 0x6faf7c7a, 0x9497a963, 0xab6570ac, 0x6a87448c, 0x7b76a366, 0x7f882e9d, 0xb246593e,
+    0x9c9575af, 0x89d3729e, 0x8d8f907c, 0xbb7dcebb, 0x94817364, 0xbcb37a9a, 0x84709ca2, 0x6e9b817a,
+    0x989f9994, 0x86c2b7a4, 0x85b29682, 0x81808aad, 0x9577b791, 0x68b6a16d, 0x68b08d90, 0xb38b9e93,
+    0xa8848fc8, 0x9d91a0b7, 0x8fa7a498, 0xae9e638e, 0x95a26b92, 0x5d949e88, 0x9e5d9caa, 0xa0a18fad,
+    0x6ba57371, 0x909ea996, 0xa59ebd86, 0xb09b91a4, 0x986c357e, 0x88aec148, 0xa0675b81, 0xaa5aaa7a,
+    0xc07db786, 0x6ec0a696, 0xaa93b360, 0xa776b181, 0x9197618c, 0x9cd86876, 0x6676c1b0, 0x4d8b7299,
+    0x65995290, 0x9cc6b1a0, 0xb57da79f, 0xa9a592bf, 0x9286af8a, 0x666ac696, 0x9a97b696, 0xd99ba5aa,
+    0x70a592ac, 0x5088a2bf, 0x6ec1af90, 0xbea67fa1, 0x96d1829d, 0x7476cf83, 0x9984679a, 0xa485c98f,
+    0xb6d99496, 0x7dc29a5a, 0x9db18f91, 0xbe8f9e85, 0x6abc4c96, 0x8cacbc68, 0xb5883b9b, 0x9a57808a,
+    0xc39b85a8, 0x73987d8a, 0x9194ac58, 0x889a6cab, 0xb2828655, 0x89a1aa99, 0xae7394cd, 0x807bc3ab,
+    0x9e8061a9, 0x797c748c, 0x80a7678d, 0x978db8ce, 0xae7a8e8d, 0x7b967579, 0x59878ea6, 0xb36a80a6,
+    0x73af7c9b, 0x398aa9c2, 0x76a9c3be, 0xa4c49cb8, 0x6aa878c6, 0x5278c256, 0xb086afb8, 0xd98bc38f,
+    0xcbc08f8b, 0xa5999e9b, 0xad996fa5, 0xb592b29a, 0x9e847265, 0x8dd49d4f, 0x876a7796, 0x6e899da9,
+    0x789c65a2, 0x8db987ad, 0x949daf5a, 0xbfcf9488, 0x9670705f, 0x6ba4737e, 0x6177a38e, 0x73aeb7a7,
+    0xa2985dce, 0x94ae6a9b, 0xb0c5729f, 0x80b97c9e, 0xb46b8f99, 0x5b618b69, 0x52b262a5, 0xad9cbda1,
+    0x648a7a9b, 0x97a2a58a, 0x957d8f76, 0x9892a04a, 0x799c789f, 0x6066737d, 0x897b91ba, 0x9371957e,
+    0xa479be62, 0x9583bcab, 0xb0c482a8, 0x9caeb4da, 0x3b9c5d80, 0x6fc3d3a5, 0xc886339a, 0xb598adaa,
+    0x89626b44, 0x8c856b96, 0x9e8ab78b, 0x8fab845e, 0xa9734a8b, 0x8e86a9ae, 0xa8708575, 0xa0bbe498,
+    0xcace9495, 0x86898985, 0xaab1aa70, 0x5e98b571, 0xae879398, 0x83bb7b85, 0x3ac82fac, 0x9cd69793,
+    0x4ba34f5c, 0xb07a677f, 0xd08dbaad, 0x98899045, 0xa2ae41ba, 0x7d7b5dbf, 0x7e7899a3, 0x62bcb0a2,
+    0x96b29a71, 0x5b776674, 0x869d6378, 0x74b5a1ab, 0x8b9e3d5b, 0x7aac9b9c, 0x807c92ae, 0x7a638369,
+    0x6d867880, 0x9895a4aa, 0xc1b48b94, 0x6172a898, 0xbecd897d, 0x9a8c9791, 0x7f5fb59f, 0x8baa5fa8,
+    0xaaa37588, 0x7a846d63, 0xb0719a8e, 0x8a9ac581, 0x868481c8, 0xa28f7990, 0x62b74d55, 0xa3a9c2b3,
+    0x496275ac, 0xc3bb7b8e, 0xc4a1aae0, 0x863a734f, 0xbeab60b4, 0x9d8c5977, 0x6d6aa574, 0x88a1a686,
+    0x8d753482, 0xa0798097, 0xdc774957, 0xa09a8156, 0x8fb14fb4, 0x80967978, 0x61729cb4, 0x76a39c78,
+    0x6e923f6f, 0x7fb87f87, 0xa0b493b2, 0x7b836ba2, 0xb18f4c5a, 0x84a08271, 0x8857aa6f, 0x5f86a36d,
+    0xa77fd66b, 0xb98bc26c, 0x9265aa90, 0x758f9849, 0x6b6e96cb, 0xb5886698, 0x6fcda4a1, 0x9a957d83,
+    0x5b647d64, 0xae709a52, 0xaab77e83, 0x75398295, 0x909f67c2, 0x899091b2, 0x8948a47b, 0x90a6907f,
+    0x8ec55eb8, 0x4f8a8d95, 0x7d926136, 0x8477507d, 0x7faf6296, 0xa7749f5e, 0xafb0ad73, 0x6190d37c,
+    0x9094519e, 0x8eae6385, 0xab92ac8a, 0x7e907885, 0xa0a3566b, 0x926db27d, 0x7582d892, 0x518fac8a,
+    0x8863c297, 0xa08e649f, 0x89b1a57d, 0xaebaac6d, 0xb8957dbc, 0x8e9766b1, 0xa05e9093, 0x79a3a08b,
+    0x80629a88, 0xa39f75a4, 0xae5e8a86, 0x6e54a5c7, 0x7e7b7e97, 0xa8a2ba6f, 0x5270586b, 0xafa0b998,
+    0x99a073b6, 0x5da588a2, 0x729c963a, 0xab8b4e77, 0x9f8179a2, 0xb8d17b7e, 0x508493b2, 0x828e9ba5,
+    0x5b8067b8, 0xb59f9066, 0x7d858a82, 0xab847298, 0x996fbaba, 0x6fbaa0ab, 0x67639056, 0x8587aca0,
+    0x6676928a, 0x9ed3b3d0, 0xb9957387, 0xab80a1c4, 0x92839a7f, 0x71568483, 0x977aa093, 0x945aa9aa,
+    0x9751aa71, 0xa6887e65, 0x867d7cab, 0x797dac8d, 0x6fba8cb4, 0x916f7c72, 0x4bbf817b, 0x82a29c7e,
+    0x82d27dca, 0x74e396a6, 0x86c3b95f, 0x64886a73, 0x8a899dba, 0xbc86748d, 0x5c8f6cc0, 0x8c8e65a8,
+    0x6da07796, 0xad9e3296, 0xbf597582, 0x93c289c1, 0x88c5636a, 0x57c18168, 0x79b5ae9f, 0x988f54b2,
+    0x696aa49c, 0xd4759999, 0xaa7f678d, 0xb26e8178, 0x9364b093, 0x816f7a89, 0x9dbea884, 0x7d69ada4,
+    0x7b907d85, 0x8cbba97f, 0xa8a37d83, 0x8b90a477, 0x8e885f87, 0x90817eb7, 0x21949d9d, 0x9aa25f93,
+    0x999297a1, 0x7970aeae, 0x877fa498, 0xb2806d79, 0xbf8384cd, 0xa15292c2, 0x3eba66b0, 0x9eb486a6,
+    0x878d7378, 0xa4e68b93, 0x6a4d865d, 0x858c8fa7, 0xb6a7b85a, 0x4e7098aa, 0xb8a394c3, 0x877b9094,
+    0xbf8d8a9f, 0x815c7e70, 0x82837b4a, 0x9ebb6c7a, 0x72c6ba93, 0x8c9a766c, 0xa5a79676, 0x608b85ad,
+    0x9e9377a0, 0x96a98b6f, 0x539c7787, 0x7e6f799f, 0x999c829c, 0x9a87716a, 0x2d7f5f7b, 0x9b8667ba,
+    0x84a2589b, 0xb3a564a5, 0x8b9085b2, 0x98963b96, 0x6c9b9d7a, 0x9f8a5573, 0x68ae6b7b, 0x748a5185,
+    0x7d817eba, 0x889a7475, 0x96518266, 0x57839d9f, 0x6bbf446c, 0xa4959bc2, 0x55adb27c, 0x933aad8a,
+    0x70697d8d, 0xc29c926a, 0x94669e4b, 0x915893a0, 0x8c6d6aa7, 0xd2c9acab, 0x928489a2, 0x96903c73,
+    0x77b4a2a9, 0x7250c5b1, 0x95905ac6, 0x967f75cd, 0x9674857a, 0xa8a08ca2, 0x33da6a88, 0x5d8e89a4,
+    0x8ea66bbc, 0x9a829e8e, 0x8b7c85b1, 0xb15e277a, 0x9d8ab69d, 0xca7a39ba, 0x4a7c977e, 0x6f8c6194,
+    0x7aa1bc93, 0xa2a68cb3, 0x7d64908c, 0x5d8c8ca4, 0x62d1a37c, 0x8f9370c7, 0x747d9881, 0xaa618980,
+    0x6b8881ab, 0xc3c0978f, 0x967b9225, 0xb7bf7f98, 0xadb3926d, 0xc7978867, 0x82c37db3, 0xabb8947f,
+    0x9594988e, 0x857fa17f, 0x8d9e58ac, 0x82597a94, 0x958a85b8, 0x9db48467, 0x547d5d9a, 0x72958a35,
+    0x898d4384, 0xa3c6aaac, 0x70b48abf, 0xb432598b, 0xa892978d, 0x936523b8, 0x18be84a3, 0xc2a88c9c,
+    0x549895b7, 0x9c87a47d, 0x72a58654, 0x7a6e779a, 0x6c7a836d, 0x826190bd, 0xa0b99aa8, 0x9755a7a7,
+    0x6b488bac, 0x72957191, 0x94809359, 0xba835677, 0x936f8a3a, 0x8979e185, 0x8cc863a7, 0xa5c3833f,
+    0x9bb3988e, 0x73a195a9, 0x87b641a1, 0x68b56183, 0x7b76c787, 0x6e867f97, 0x2ea2b79f, 0xa8a09259,
+    0x6a766d87, 0xc29bba9e, 0x9291bba0, 0x8d7151b1, 0xb3897cb1, 0x9f6f939e, 0x37a66ba9, 0x9f8ca692,
+    0x648fe199, 0x8bb2a876, 0x3d8ea081, 0xae64ba9c, 0xa9b24360, 0x81bca7a4, 0x6b99968a, 0x93508c9d,
+    0x6b714c95, 0x7e86567b, 0xd0707a6e, 0x94847ca0, 0x8c846c81, 0xb4a0ab80, 0x98ab87ae, 0xadad6473,
+    0x7a8e7e7b, 0x6c8d8b5e, 0x85b54da3, 0x69728f98, 0x6d7597d4, 0x7f7c9e91, 0x73b3b1a3, 0x7c9d8f50,
+    0x66706b95, 0xaf8a7a9f, 0x7dbc7ba5, 0xb48c4769, 0x86838ba7, 0x6c954ab1, 0x63a4898a, 0x5aad996e,
+    0x68898686, 0x81938e7b, 0x4b93a2ac, 0x887bb098, 0x75d09cb3, 0xab8f6582, 0x7d817281, 0x98a498a2,
+    0x926075a8, 0x7296868a, 0xa06c8240, 0x769d8c8a, 0xc96bb588, 0xb7a8d28e, 0x529b83c3, 0xc2959b6c,
+    0x82bbac7e, 0x78a09260, 0x8c9464b2, 0x5c7e8071, 0x948887a8, 0x55c68dc9, 0x67af8166, 0x49bf7b7f,
+    0x787fbd5b, 0x96834951, 0x75d08397, 0x786e5192, 0x7763899a, 0x7c4960b6, 0x6776ae72, 0x8195877b,
+    0x8494c261, 0xba7c939e, 0x88c8789e, 0x8b6da472, 0x8fc298ba, 0x87478c6b, 0xd95b8673, 0x6e6a707c,
+    0x937eb19d, 0xa06d6885, 0xa5c0847d, 0xb1c59b94, 0x8b9e8e9a, 0x91cc568b, 0xa3869d7a, 0x93b7a67e,
+    0x7ca743c6, 0xaa98886d, 0x6372765d, 0x65658080, 0x6eae9ca3, 0x92ba73ad, 0x688c9395, 0x66db7b72,
+    0xa27a9e5f, 0x97827f71, 0x8c608c55, 0x906d7890, 0x6a608391, 0x7e8972cf, 0x788da880, 0xa39aa0a3,
+    0x7a918199, 0xa1767e96, 0x9c8ec075, 0xd38a9897, 0x9fc4c283, 0x92609b99, 0x8a7c6197, 0x9b828182,
+    0xc1938d94, 0xb79963a1, 0xa964816c, 0x60bcaf87, 0x849b86bc, 0x58946189, 0xb0ac9581, 0x7377a596,
+    0x7baf6972, 0x96a7827c, 0x7e74ba76, 0xb683a751, 0x86ce7589, 0xa77a778b, 0x9a71ac70, 0x78b59685,
+    0x8965974d, 0x836b9fa9, 0xb8828165, 0x7ebb8ea3, 0xaaafcd84, 0x776b8377, 0xa9c07884, 0x739d8a86,
+    0xb28a6f8a, 0x91519794, 0x90bc74b7, 0x9baab48b, 0x8c4c8fa5, 0x9766bb69, 0x8c7dbaaa, 0xa298a68f,
+    0x7b745ea5, 0xbf797697, 0xa684955b, 0xa06d86bd, 0x9a819a7c, 0x60c3bbb2, 0x8d6bad6f, 0x5eb69c8d,
+    0x6b99886f, 0x718c90a4, 0xa49073a0, 0x8080815f, 0xb3a2c574, 0x8b7166c3, 0xbdc07fa0, 0x8e917278,
+    0xae99aa75, 0x97977eb0, 0x9b9b6891, 0x6b789281, 0xcf9793a1, 0xa199525e, 0x738dbb99, 0x98a08b91,
+    0x5cbcc58d, 0xb39d7497, 0xa6c25e9e, 0x92c18182, 0x928266a4, 0x7c9fb785, 0x9b7a9396, 0xa4c09599,
+    0xa181a370, 0x717e9374, 0x89a07b71, 0x7d9dc286, 0x74cf9767, 0x859374b1, 0x837fbcae, 0x808061a1,
+    0x817bb092, 0x908776a1, 0x919d8691, 0x739870ba, 0xaea16e6a, 0x8e6278a8, 0x79bcaaab, 0x9a8c9b73,
+    0x626596a7, 0xab7b9f9b, 0x77839295, 0x6d7673cc, 0x7e779f95, 0xa48da886, 0x8489bdba, 0x9fb4cd91,
+    0x7ecb9393, 0x956ac980, 0x678f769b, 0x7673bdbc, 0x7289bbaf, 0x9761a7a6, 0x81578b7b, 0x7f979362,
+    0x8e956b6c, 0x709db2af, 0xad5a86b2, 0x64998671, 0x5b916c81, 0x9ca46c9e, 0x998a908e, 0x7aa77763,
+    0x95a6ca7d, 0x6da06d6c, 0x936acb6c, 0xa2679d8e, 0x8c817e85, 0xb8978a7a, 0x87858895, 0x83758a95,
+    0xb5938dac, 0x99978d61, 0x828ac0aa, 0x9497b9a6, 0xb15e9666, 0xab7ab357, 0xb6a5a598, 0x847e79a3,
+    0x8d70b4b4, 0x7e9cab80, 0x9ead956d, 0x847f5ba6, 0x9e6f89b2, 0x7464b6a4, 0x86978eb1, 0x8c698567,
+    0x77bfb8aa, 0x98819c6c, 0xaaa9a98c, 0xbf8a77b4, 0x9fad9c9b, 0x937cabbd, 0x927ec782, 0xa2a5b88d,
+    0xad979d84, 0xafcd7b82, 0x9a619e9e, 0xa88b84ad, 0x6e6f849b, 0x7ca57781, 0xa7cd5592, 0x8c8b926c,
+    0xb3975eaa, 0x8f8395a1, 0x875d86a2, 0xbe679980, 0x82879d87, 0x7b9286c0, 0xa9b47e79, 0xab975abc,
+    0x9b95869c, 0x6e875a79, 0xcfab9f72, 0xa8b498b9, 0x888aac86, 0x996d7e56, 0x769f737f, 0x89a49ec2,
+    0x7c929870, 0x8a7eda9f, 0x9ea2a87f, 0xc2778b75, 0x8c4f877a, 0x65707566, 0xb573d8b2, 0x6ca56d8a,
+    0x919a8c7e, 0x6a91657e, 0xa1bf8c63, 0x9bc6bb75, 0x7f729980, 0x717a7b8e, 0xb1ab9a8c, 0x566e719b,
+    0x7e7791cf, 0x48b37f86, 0x7fad7f8f, 0x909c8796, 0xa66085c6, 0x86b3a89c, 0x84627064, 0xa44d9985,
+    0x72a4b99c, 0x73737086, 0x8ea968ae, 0xb89d6572, 0x98a45170, 0x949dc663, 0x54809483, 0xa982afc1,
+    0x97aaa699, 0xac7bb866, 0x4885788c, 0xb4ba5a4e, 0xbd43a86d, 0x69538793, 0x7193897b, 0x94957287,
+    0x6ba78eb7, 0x795d999a, 0x83956e79, 0x9677b3ad, 0xa9893585, 0xa1836281, 0x998da9c4, 0x855f6ca8,
+    0x6b927ecd, 0x935e9389, 0x967ba5b9, 0xbf86a060, 0xc98d4c99, 0x948d8d4e, 0xbda66499, 0x897f6aac,
+    0x9391a18e, 0x8c78822a, 0x728f9baa, 0xbf629190, 0x7a968a71, 0x5b73ab84, 0x3fc1a98b, 0x7a5f5d8e,
+    0x668da2bc, 0x6a81a487, 0x916c8474, 0x75a15b81, 0x7865a962, 0x815d9b72, 0x8b887099, 0x6f9a9c53,
+    0x9b895fac, 0x8a6bbb86, 0xcbb09d78, 0x69aa8f90, 0x6e743f9f, 0x4d777a9a, 0xb87da4b5, 0x8b948375,
+    0xac7d86b5, 0x829ba983, 0xa39d9365, 0xd260b18e, 0x934d5c85, 0xa0be8f4d, 0x74ad8381, 0xa4644876,
+    0x9f7f9fb5, 0x62729241, 0x5a506751, 0x84a9b09d, 0xaa8c5474, 0x8db2b089, 0x34becb98, 0x5c9d5a91,
+    0x64a37748, 0x955d779d, 0x879967b6, 0x6b538799, 0x9c2e978c, 0x8f46b150, 0x757e7dbb, 0xc3bb905f,
+    0x828c7baf, 0x8f848cab, 0x9897bf80, 0x957a8a7a, 0x91976f71, 0x4a54af63, 0xa199a5c5, 0x8f9f7e99,
+    0x9db19b9e, 0x6f898d6d, 0x82c56e85, 0xb26bada9, 0x8c5d5079, 0xb58f9d85, 0x8e622f7e, 0x78607d69,
+    0xa46193a3, 0x689d9b85, 0x8181619b, 0xc18e8bc5, 0x89948a83, 0x707a8ca9, 0x678985a8, 0x8e658078,
+    0x7891a6a3, 0x8e85a29d, 0x9daa889b, 0xa676a2ae, 0x829a9a88, 0x9f987068, 0x3c95a1a5, 0x96776d66,
+    0x799e7cd3, 0x7ca1e48e, 0x72917f72, 0x6f9da699, 0x9d7888c1, 0x6972b1b4, 0x7c725b7f, 0xbb7a8f83,
+    0xaed5c2af, 0x82d0ba90, 0x847193b5, 0x969b867b, 0x7b5c0d83, 0xa8a29768, 0xa4799087, 0x8734785d,
+    0x9dad9b7c, 0x578d8a7c, 0x5b8290ae, 0xb68aa8b5, 0xc2b2a6c0, 0xacd485d7, 0x8464ce80, 0x4e7e62ce,
+    0x87877a7d, 0xb379829e, 0x92c1c273, 0x9b76b5bf, 0x9557ad7a, 0xa35cb490, 0x4d6c72b8, 0x9ea9aa86,
+    0x8695b699, 0x834298b6, 0x6cc5b09b, 0x929692ab, 0x865cad8a, 0x508aa27b, 0x92968aaa, 0xb2ba7ea8,
+    0x9681be6e, 0xb49aa17e, 0x9b97b282, 0xacaf9172, 0x57a81c7e, 0x68b17f95, 0x9ba66a5f, 0xcf6c7b98,
+    0x8f7c7b81, 0x7696ba92, 0x908dbf84, 0x7f889676, 0x7ebc978a, 0xa0a99090, 0xa197777a, 0x8986a1c7,
+    0x76b386c7, 0x728f7487, 0x62a7879a, 0xb7b58ca4, 0x6c74ca8b, 0xa17abe8a, 0x4a7a719c, 0xc9b7969b,
+    0x76a19dbe, 0x7b82a675, 0x638883c5, 0xb7769286, 0x64955fa6, 0x8d549780, 0x9f878fb8, 0x929d967d,
+    0xa6d19793, 0x798dc7a1, 0xb8ae797b, 0x8261897b, 0x9c8345b4, 0xb5a29365, 0x91a067a8, 0xaa84a393,
+    0xa18f94a3, 0x95726489, 0x8294b894, 0xb28987a0, 0xb96e5a9b, 0x9cc67ab1, 0x93a87883, 0x778979b0,
+    0x9fa857a2, 0x9abe70af, 0xa3ae8b97, 0x899197cd, 0x6594bd80, 0x8a82998e, 0x3ab06dd1, 0x996db69f,
+    0xa7a77eb1, 0x83a6b2bf, 0x676b6a9e, 0x91aaae8d, 0x6c85856d, 0x7f59847a, 0x8d596d87, 0xa946a099,
+    0xb476b29e, 0xaaa99070, 0xaf8d8273, 0xa7aa6ec1, 0x7b9c3279, 0xb7bcb56a, 0xc26267a6, 0x77709e5e,
+    0x9b97786f, 0x848b649b, 0x8789b746, 0x72904f8b, 0xb38d7c73, 0xcb7f56a0, 0xa77bbaac, 0x90999cbf,
+    0xbfc694a8, 0x68bf689d, 0xa29491c5, 0xae8e838d, 0x9fa0947c, 0x996b8782, 0x778d42ab, 0xc276979a,
+    0x6b84b8d4, 0x6680beb4, 0x878cc0b9, 0xa8d05ca4, 0x4b7461b6, 0x8269a385, 0x94818188, 0xbc6aa0b7,
+    0xbeb4c58a, 0x86a3c087, 0xa49275af, 0xac729799, 0x629b8367, 0xb1a9ab6b, 0xd8a282cf, 0xa16e7881,
+    0xa75e9b9f, 0x6b9066a2, 0xba61aa9a, 0x89939a6a, 0x8c998a38, 0x918571cb, 0x99ab829f, 0xb98c7c6f,
+    0x82cf62c2, 0x9d702b8a, 0x95c4bec3, 0x53b0d59e, 0xe15690a4, 0x738e6a5c, 0x4e692487, 0xbeaab0c6,
+    0x416f6286, 0x56879e91, 0x8b54bcae, 0x776da668, 0x54aaa980, 0x6e738eb1, 0xce9eada4, 0x8c8a7f9d,
+    0xe3ba7a9f, 0xbe93c08f, 0x8a743568, 0x6bbf71ae, 0x89c6666a, 0x86a6a07c, 0xbd876773, 0xb6a16a87,
+    0x6cb86e61, 0x9bc17198, 0x69a1d38d, 0x85a77b82, 0x9bc26a28, 0xb7749aab, 0xaa4178a0, 0x5a79b66b,
+    0x9e649faf, 0xd88c66b2, 0xa494c775, 0x68799e61, 0xa28552b0, 0xb7857334, 0x76a05459, 0x9caf9387,
+    0x548ca893, 0xaeaeb171, 0x9d8675ab, 0x61878e95, 0x8fa781a2, 0x9b76b3bf, 0xbaa3a771, 0x9fb17ea5,
+    0x78ae87a7, 0x7b80828f, 0x92ad4b52, 0x6fc594a1, 0x70a79a77, 0x7185c77a, 0xa078a0a0, 0x9680afcb,
+    0xa1b7769b, 0xc99096db, 0x7ecdbfb4, 0x817baebe, 0xbdb56595, 0xa1a08ba3, 0x8d7c5f97, 0x5bb9a38b,
+    0xd0cb83a7, 0x9f768588, 0x80b7c19a, 0x89b28c8a, 0x6c7859b5, 0x608c6fa2, 0x5cd9854b, 0x78a5698e,
+    0x36545298, 0x8ec5bb82, 0x7ca78dc3, 0x3b919685, 0xacb97ead, 0xb87d5baf, 0x728c966b, 0x72898073,
+    0xba87527b, 0x577388a2, 0xbf845873, 0x537a7e7f, 0xa0a6818d, 0x836d5b8f, 0x79bb97aa, 0xb192da67,
+    0x848a6c9b, 0x94cc7f89, 0x8c8e85ab, 0x5b8596b9, 0xaebe9aaf, 0xb3bd8fd3, 0x8c60a476, 0x748268d6,
+    0xaaba6a99, 0xb08e81b6, 0xa7ad859a, 0xc294be83, 0x90678db0, 0x7cc75b5b, 0xbfb26597, 0x7cb68898,
+    0x454e8e68, 0xacc48078, 0xb8759ba7, 0x70638685, 0xb9b47271, 0xaac07878, 0x797d9162, 0x77adc498,
+    0x867a7cb7, 0x7da9b5cd, 0x8a9d7f43, 0x88979f71, 0xa29e90b3, 0x83ac7257, 0x979c8e79, 0x9f6682bb,
+    0x48827cbb, 0x87c0459a, 0x9f4fb5c2, 0x5b957094, 0x758e766d, 0x8c9dc2af, 0x9483ad91, 0x779b9192,
+    0x999f9eb9, 0xb8949a7b, 0x68c0779f, 0xbbc09c66, 0xb57b9874, 0x7d56ad76, 0xa4c85db2, 0x64838f7d,
+    0x7e4a6287, 0x7a828ea2, 0x86ab84b2, 0x7b8f91a6, 0x7e7486c9, 0xbb71a18b, 0x927daf62, 0x9189986b,
+    0xb4ab859e, 0x86a58ea3, 0x67939856, 0x67725e6c, 0xa691707f, 0x8188ac8b, 0x719e8a80, 0x7db46fb9,
+    0x77816d97, 0xc0995eb2, 0x8d8490a1, 0x737b759e, 0xa37ebf90, 0xc175a2c1, 0xaa65a09f, 0x47647f8d,
+    0x81877a71, 0x7f9ca785, 0xbed37897, 0x6d9a8f8b, 0x896b73a7, 0x94706c81, 0x8fa38b8a, 0x7357696a,
+    0x889f518a, 0x8d8a79ae, 0xbf59ad9e, 0x4260a3b2, 0x6e9da885, 0x85757dbb, 0x70977fa1, 0x699c96cf,
+    0x8d9870b0, 0x98c0a5b3, 0x6799858e, 0x82a9a070, 0xa69e85be, 0x9db48f9e, 0x946f7c73, 0xc9969882,
+    0x93a33db1, 0x7fbc596a, 0x90738f65, 0x9ac9a587, 0x79b890a5, 0xa88d92c1, 0x9192b958, 0x86736aa2,
+    0x9692c5c7, 0xb8918775, 0x8d9d9b76, 0x9d919683, 0xa690985e, 0x96a39f84, 0x8374838e, 0xae996594,
+    0x55856a8e, 0x83856ca2, 0xb18d8ac7, 0xa6969a98, 0xc196a199, 0xbd88c18c, 0x72878caf, 0x987d8ca5,
+    0x8bb2949d, 0x75b3c56e, 0x878fab8e, 0x7598b67f, 0x9199738f, 0xcb987288, 0x596b6389, 0x867099a7,
+    0x53af6398, 0x859068c9, 0x9f6e6f68, 0x8392b388, 0xacafa67c, 0x807ab086, 0x62809194, 0x639583c1,
+    0x867bb272, 0x8585b592, 0x9f816c97, 0x9554ca99, 0xa081767e, 0x7999a197, 0x61788d67, 0x8567748c,
+    0x698f8fbf, 0x8958ab8a, 0x799882b4, 0x6199a893, 0x8499748d, 0xa1a65e85, 0x278f985d, 0xa657a6b1,
+    0xb6a873be, 0x7170bb82, 0x6d918db9, 0xa2609298, 0xa37f6fbb, 0xaa8f6b8b, 0x7eb5a3be, 0xa5788c79,
+    0x8b9179bb, 0xc78f7483, 0xa66e9887, 0xb39d72a5, 0xa595a45f, 0x709da0b6, 0x82919577, 0x909d98af,
+    0x7f719594, 0xd19fb98a, 0xb37ca396, 0xb691a677, 0xc383ae5b, 0x6d7b6c98, 0x6a97879b, 0xa0599a9b,
+    0x8893a384, 0x79749b74, 0x7f968f6f, 0xac7a9fac, 0x85799f90, 0x7e92a781, 0x579f5aac, 0x7cb0909d,
+    0xa287757c, 0x9bbd81b3, 0x967ba6ac, 0x947e6478, 0x9f8a4973, 0xb4b761b8, 0x8faa899b, 0x8c9180ab,
+    0x6ba09097, 0x507b6292, 0x7b8aa590, 0x7784a1af, 0x908d57ac, 0x55c4c3a5, 0x9eb8ae6e, 0x752e8797,
+    0x9a97b4ad, 0xb0689da8, 0x7fabb553, 0xc1b78ea3, 0xb17da683, 0xc38ba187, 0x86808ba8, 0x84607b69,
+    0x7a92adab, 0xada6b48c, 0x639b597e, 0x8ba2a7c6, 0xa1a67496, 0x97877d9f, 0x6acca996, 0xa6907d7d,
+    0x85a674c7, 0xb66faabe, 0x98aa8f85, 0xa063479e, 0xb1787d78, 0x8e856998, 0x6e998d96, 0x936a7d66,
+    0x6daa6b8f, 0x5a6c8666, 0x397e856d, 0xa97f98b7, 0x70af6c9a, 0x877dc8c2, 0x647b7f87, 0x8c827ecb,
+    0x66a65995, 0xc58260c2, 0x8f80ae6c, 0x9c8f7cb5, 0xa475c973, 0x8d80e9a9, 0x86d14f77, 0xaf8170a6,
+    0x768fa892, 0x816483b5, 0x789950c2, 0x8676a5a8, 0x729b909a, 0x6ea183b6, 0x43a58e66, 0x8f837ab9,
+    0xa45978c4, 0xc79b887b, 0x7a96929c, 0xaa723b78, 0xca856184, 0x5ba43779, 0x3b906ba7, 0xb0835889,
+    0x7d6a7c82, 0x50aaa03f, 0x7e4a82ba, 0x759184e0, 0x78886a98, 0x9a7fa57d, 0x8458567e, 0xac659b8f,
+    0x6a5258c2, 0x779b96a5, 0x8b6fcc3f, 0x688c86c5, 0x7e59ba6b, 0xd699d68e, 0x6d75a5c6, 0xd38a95ab,
+    0xcfb38eba, 0x757a796b, 0x89ad7575, 0x6a6d9aa9, 0x5db18896, 0x74b04f89, 0x7ba0b1a4, 0xa898a08f,
+    0xb8608d51, 0xb15d9191, 0x82b66cde, 0x965059be, 0xb3774f70, 0x7d9049c3, 0x2e68ae71, 0xcb7a7971,
+    0xa96d9669, 0x83946a85, 0x958e76b3, 0x917d7aa5, 0x516a8d74, 0x73504a91, 0xb98f7f67, 0xa57f9daf,
+    0x8e7f6cac, 0x77a4868f, 0x6855967a, 0x69b65ec7, 0x7692527c, 0xa143a391, 0x7d7164b9, 0xaf8e5e5d,
+    0x71b0a75a, 0x986d9146, 0x6ba73c74, 0xcc939fb5, 0x6c8eaf61, 0x73916694, 0x81648a97, 0x788ccc80,
+    0x9071a461, 0xc5bc6186, 0x7eb85e76, 0x6e8a6482, 0x877aca9e, 0x709d889f, 0x2a95958a, 0x7b6c7b45,
+    0xbd75a291, 0x8c6b5cb1, 0x6c55b17b, 0x7ca19a87, 0xa09780ba, 0xb67b9b75, 0xe7a47ba4, 0xc46bb0bc,
+    0x697baa8a, 0x8295897d, 0x58688b9c, 0x5d8c7c8c, 0x8dd78684, 0xb7ab9d8a, 0xc8669f95, 0xae7eb977,
+    0x655f897f, 0x75519a7f, 0x7d73bc6a, 0x91a89780, 0x6dc4994e, 0x8fd4a499, 0x6083d876, 0x83c17087,
+    0x6fb2968a, 0xa16f776a, 0x665e847c, 0x935761ab, 0x806aa68b, 0x61a5795a, 0x70949670, 0x827b7897,
+    0x8594a379, 0xdfc1b2ce, 0x87978fc8, 0x984ca98f, 0x5292a285, 0x60689687, 0xe0ac669a, 0x778bb089,
+    0xb2677ba2, 0x778c9b62, 0x4c476b79, 0x8d76b682, 0x757491b2, 0x598097a8, 0x767c7c96, 0x93769795,
+    0x9f72ad80, 0x926971b3, 0x848cbf72, 0x73588e86, 0x849fab7d, 0xcab17ba3, 0x909cb977, 0xa6b2a867,
+    0x87a35288, 0x6a7b7eaa, 0x66779287, 0x7c98657d, 0x5f7c9d91, 0x7bb4c367, 0x7aa1b081, 0x71a79594,
+    0xabb17ba1, 0x7193c272, 0x8f97ae88, 0x7c746d7c, 0x6a969a7c, 0xaa6f9094, 0x97c8b390, 0x7fa8a688,
+    0xa49c8b8a, 0xb27f8179, 0x808fb478, 0xae9c6a77, 0x9d7458ab, 0x69689da9, 0x9789a884, 0x948b797f,
+    0x9f6a939a, 0x8b7cb073, 0xa55fadb1, 0x77a5727f, 0xac9aa378, 0x8daab373, 0xb6b1bb84, 0xb39b9db6,
+    0x6c6e73b1, 0x888995a4, 0x8d957181, 0x839f8168, 0x92896ca2, 0x7985809e, 0x6f8498b8, 0xb65d9076,
+    0x7573a38a, 0x7d9f75ab, 0x9f9f6767, 0x6892b68d, 0x55735596, 0xbfa85cb7, 0xc1807577, 0xabbc7489,
+    0xbe6495a1, 0x798c79b0, 0x9da36482, 0x8d91ae86, 0x95897d65, 0x5aab7ea9, 0xa977a17f, 0xad8a709e,
+    0xa8807097, 0x9885ada5, 0x65c38ebb, 0x94c5a673, 0xa995997b, 0x929f6d8a, 0x91b08a66, 0x9fa3b788,
+    0x94af8189, 0x73969f9c, 0x9390c497, 0x6b8688ae, 0x7c7e9a9f, 0x768d8489, 0xa787a876, 0xc5976893,
+    0x8d71a5af, 0x5f69847f, 0x6f768c99, 0x89b7737a, 0x8e8385b6, 0x6abc7d6d, 0xb29a625a, 0x9fc5cf8b,
+    0x8da293aa, 0x83805c9f, 0x897890aa, 0x9cb49a7b, 0x88ae8a71, 0xae8fc79e, 0xafb27976, 0x92a87888,
+    0x8ab99366, 0x976dac7c, 0xb393bd96, 0x74ba78ae, 0x98915c8d, 0x937f83b5, 0x879a8bba, 0xc38576a3,
+    0x87927dcc, 0x9cb69f62, 0x776dae92, 0xd3ac9578, 0xa3929c81, 0x99b56371, 0x9f799578, 0x548c6f8a,
+    0xa96ba8b9, 0x837c8f96, 0x81939599, 0xa2c97c90, 0xab9578e2, 0x6b7dae83, 0xb0708469, 0x6b89a96f,
+    0x6c888779, 0x5e7fa6af, 0x6a88a069, 0xc9758f82, 0xb7b5b486, 0xa3a795a1, 0x5a779ba0, 0x7976ac51,
+    0x8d78a576, 0xae94ad8d, 0x7aa99967, 0xafad7488, 0xaf9ea485, 0x6480b2b4, 0x97839b70, 0x889ac0a4,
+    0x7868a492, 0x9295807d, 0xac938c6e, 0xd885ad5f, 0xaa926e86, 0x9c8b8ca0, 0x7a628275, 0x7aa38fcd,
+    0xb26e5bca, 0xa55688bd, 0xaabb6b85, 0x9c9e9eca, 0x8c81b5a3, 0x7f8db54f, 0x809282a9, 0x436c858c,
+    0x4b7e999a, 0xae9d8dc3, 0x8a6f68a5, 0xbf958aa8, 0x93848a6a, 0xb36b8b8d, 0x70525d53, 0x7a745e82,
+    0x9fbf946c, 0x6b6a6d89, 0xbd59cc64, 0x5d938fb0, 0x82adb062, 0xac789e92, 0x9667b5cf, 0xb1a26d61,
+    0x9c7bb19b, 0xa3bb877e, 0xa7b7a15d, 0x9fa95c94, 0xb0b166b5, 0x93a37156, 0x70a27aa7, 0x6d5a9687,
+    0x7a867caa, 0x67776d3f, 0x94aa9f93, 0x6ba578c9, 0xb37994ba, 0x58bf9e9f, 0x7e9d9a64, 0x5aa093cc,
+    0x9d4a7289, 0x8ecbc872, 0x796690c6, 0xe98a8483, 0x9a518fc1, 0x846e9cb7, 0x955f7378, 0x84b567b7,
+    0x4a8f628f, 0x498872ae, 0x7c895995, 0x71ad8985, 0x9b766db1, 0x50617a8e, 0x7a86647f, 0x985466b3,
+    0x71ab5885, 0x4f91a499, 0x7c8082b3, 0x72928363, 0x8d8c79c4, 0xc47f75a4, 0x80765979, 0x9c7f5966,
+    0x5d9f649a, 0x437e8947, 0x8b77446d, 0xaaa88786, 0xbbaa6f55, 0x9094a683, 0x47a79d54, 0x847966d2,
+    0x8e58bb8a, 0xc4a48684, 0x6c73ae84, 0x8ac78ac6, 0x936aa766, 0x794a7773, 0x4083738d, 0x78629a92,
+    0x68cf89b6, 0x83818da5, 0x9c9e6b7e, 0xa786a4b9, 0x8e888b70, 0x6d5a9e69, 0x919f885b, 0xa8ac8b66,
+    0xa497b2b7, 0x9e9a7b8b, 0x73bd9298, 0xa3a36da7, 0x566a488b, 0x6db4883b, 0x74bc5e96, 0x806d5a84,
+    0xc6768ea8, 0x58897795, 0x738a4f83, 0x9eb39c99, 0x9c7c8b99, 0x858b90b4, 0x866c983b, 0x7e5995c1,
+    0x8184888b, 0x897189c8, 0x7c9d6465, 0xc38d4c89, 0x927da56d, 0x65799b93, 0x599c92b2, 0x8d848c60,
+    0x84a1a3c5, 0xa388bf9a, 0x73d77d80, 0x63aa8c78, 0x918a716a, 0x54839d8c, 0x788a8ca7, 0x9e6cb09c,
+    0xb1a88f8d, 0xa7829697, 0x68cc82c9, 0x837ca5ac, 0x43785893, 0x6ab28b75, 0xa69269ac, 0x7d664e73,
+    0xc58ac1ae, 0x8e6a9c5c, 0x9a996d71, 0x90c27c99, 0xa9ab8e76, 0x67bea4d4, 0x94aac77c, 0xa279699f,
+    0x809bae93, 0xa39a55c1, 0x7d9585c1, 0x6da286cb, 0x6e699cad, 0xc063a19f, 0x6e8d749e, 0x9067c29d,
+    0x779bac77, 0x5470b3b6, 0x859278b2, 0xb5dba6cc, 0x836b769a, 0x835f9d81, 0x81aea695, 0x9850c5b3,
+    0x7bbdbfb0, 0x6aa2ab89, 0x8b8bb383, 0xbd6191a8, 0x5f728892, 0x9cab7587, 0x866f86ba, 0x8d568395,
+    0x9d667cbf, 0xaf7f6b99, 0x7f7c61b7, 0x86c15da6, 0xc9a89460, 0xa88da289, 0x67cd9c99, 0x8f4078a9,
+    0x87bb6e69, 0x88a2a394, 0x94918782, 0x659191ae, 0x87778199, 0x8e5e7773, 0x76c7b68d, 0x977ca04e,
+    0xab8278c3, 0x8a9babc2, 0x63c69c91, 0x989e6399, 0x89968374, 0x879a9c80, 0x8e728ba2, 0x9961b480,
+    0xd492b0bb, 0x6c758f72, 0x9e876caf, 0x7e8a85a9, 0x81657e77, 0xb9b68070, 0xa8a47f94, 0x858fc077,
+    0xabb47675, 0x8384a09e, 0x877f66a3, 0x95a88896, 0x99847157, 0xab8c84b0, 0x9cb5a27c, 0xae8f6f92,
+    0x8a9d998d, 0x7f7b71d5, 0x99a59682, 0x977c7ca9, 0x6e848da1, 0x83419176, 0x3d8b7ba7, 0x757e8e80,
+    0x9bc990af, 0x5291a7a1, 0x7e8f9391, 0xac71c594, 0x6c81b584, 0x5d9ca997, 0x80aea59d, 0xca497baa,
+    0x959f8e76, 0x686d8e4e, 0x8c8e51b6, 0xb49f8ec2, 0x7196917b, 0x98b68e89, 0xa055a891, 0x828963c3,
+    0xbbb0bb74, 0xad9f6c98, 0x86ac7d4f, 0xb08d6a9b, 0x6299bfa4, 0xa2b8979d, 0x9e9c9c6e, 0xb3567db4,
+    0xa093a2ae, 0x949880b6, 0x9cb18670, 0x77978dd1, 0xa1a0aaa3, 0x6b68b878, 0x5a7b5ba7, 0xc7769a93,
+    0x668499d7, 0x4d6db186, 0x6a878d9d, 0xb6a46d86, 0x63b49191, 0x7c5fa69c, 0x748eb2af, 0xba9065ae,
+    0xd0c7d4a3, 0x8e869a7a, 0x79ba6b9d, 0xb780d0a2, 0x737c985e, 0x7e9d858d, 0xbc88b378, 0x9f8b7a68,
+    0xa4606563, 0x827a989e, 0x6367967d, 0x7a9c8e89, 0x89a08845, 0x97a89980, 0x6f99a2b7, 0xa5866abb,
+    0xa7944b79, 0xa18589e6, 0x74c5a96f, 0x60caa39f, 0xae739770, 0x867a7366, 0x6f9954b2, 0x915a99bc,
+    0x9fb6a4a8, 0x727781a7, 0xc554aa5b, 0x5d6c9591, 0x66b5aa88, 0x5b9aaba5, 0xa188c4a4, 0x8471728b,
+    0xc5886c94, 0x8a848252, 0x7c785d99, 0x87897191, 0x728ba260, 0xafe39a92, 0x98918b87, 0xc28ea6a8,
+    0xb9bc7b5a, 0xcab3ad6b, 0xb59cc890, 0x4b796f8f, 0x8b74766e, 0x8b9e7393, 0xbc7b94a4, 0x998b80b1,
+    0x947c67e5, 0x6e9f5d8a, 0xdea7b080, 0x7b9cb196, 0x91b08e9d, 0x8c7b8973, 0x796b44ad, 0xb56c7d9d,
+    0x7d9da7b6, 0xb3999a84, 0x828f8784, 0x74917c73, 0x837ca9b2, 0xb7aa94a5, 0x89818b97, 0x849181aa,
+    0xcc7eb361, 0x88907b7b, 0x699441b1, 0xadbdc0a7, 0x9e637473, 0x5175a598, 0x788ead80, 0x889da58f,
+    0x79938547, 0x9dbd60b1, 0xb1c795b6, 0x6b5cc56c, 0xb2a98339, 0x8771679d, 0x86585391, 0xa2c3827e,
+    0xc180aabc, 0xa0658fb1, 0xc3bb85ad, 0x65a2d953, 0xc1b26992, 0x99b06b99, 0x8c9d6a72, 0x72b0a0d1,
+    0x526885ad, 0xb59c9098, 0xa4615dcb, 0x9a8f8f9e, 0xa1a5c7b5, 0xaebb9d73, 0x7973908e, 0x9288b895,
+    0x9fba6593, 0x909a8d84, 0xc79c3a74, 0x777c5f8b, 0x59a08b9c, 0xb09484a1, 0xbe93d9c5, 0xa39f8b81,
+    0x618a5b5d, 0x93b4b3a3, 0x78866796, 0x7f88afa1, 0xae938d6f, 0xc7a7a6a0, 0x8a7b909c, 0x6691b584,
+    0x76aac79b, 0xa4ab9a76, 0xacae8082, 0x9fa27367, 0x7bc267b8, 0x8b839473, 0x779cad75, 0xa6adbd82,
+    0x6d3ba880, 0xeb7d9277, 0x956697b9, 0x5c65b09e, 0xae89a19e, 0xabb29eac, 0x95b8c253, 0x87b8a89a,
+    0x7ca5ab74, 0xab5f9ab4, 0x7a746074, 0x6284678d, 0x7cba6d73, 0xb381ae95, 0x7792acb8, 0xb59dbd8c,
+    0x738f5450, 0x8d96a56c, 0x9cab9098, 0x6c90c8ca, 0xd1a34ac4, 0x93aeb0d3, 0x7872ca77, 0x887eb5ad,
+    0x8e969faf, 0x6aa87cb1, 0xaa887761, 0xb58aa64b, 0x9d85b4a4, 0xb6b99d76, 0x96c67690, 0x8ba3ab7f,
+    0x8746a278, 0xa6af9977, 0x94ac849c, 0x4076a5ac, 0xc0a976aa, 0xa2aaa5be, 0x99897f88, 0xc1a29c50,
+    0x818a6696, 0x50927f9e, 0x8cb98e47, 0x3a8d6db3, 0xb78f7fc0, 0xbf93b082, 0x50706a95, 0x7883bc7b,
+    0x58b356a5, 0x9aa78c73, 0x6499aa7d, 0xa28a99ac, 0xa37085b0, 0x7cc6b2ae, 0x9094cd7e, 0x85606194,
+    0xbb9696ad, 0x9fab7a94, 0x95ae5067, 0x86a48187, 0xd196b9a5, 0xb8594799, 0xa3818a67, 0xbcaf9750,
+    0x824382a1, 0xa87fb99f, 0x95697c65, 0x6a6491b5, 0x7a96a5b7, 0xb1889889, 0x67a1916e, 0x86769796,
+    0xc9d07eaf, 0xa8c79569, 0xb6859b6c, 0x8c66a477, 0xb28e8dae, 0xcd6a6fa2, 0x8a847fb7, 0xb37d7d90,
+    0x4aa550b0, 0x5a7368b2, 0x9e539b7b, 0xaea68098, 0xb29a5ebc, 0x5e9c728a, 0x927a869d, 0xa9a87171,
+    0xa08c929a, 0x957eb077, 0x9fa67dbe, 0xb393ab88, 0x80a66ec2, 0x7a7b7187, 0x9e6485c2, 0x8461778f,
+    0xac868faf, 0xa79ab0a6, 0x958f88a1, 0x8d7eb3c3, 0x7db08f9f, 0x6e9a9e6c, 0x9f95a959, 0xc59e7e84,
+    0x8b9770a5, 0x739ae1a7, 0x586da172, 0xaab47a63, 0x718d8aba, 0xbbb08872, 0x7e9065c4, 0x8c937190,
+    0x508367cb, 0x73875282, 0xb4899d9a, 0x6292989e, 0x98ba8b96, 0x92769295, 0x9c94d695, 0x65954daa,
+    0x8e648b8e, 0x9976da99, 0x61927d77, 0x8daf9690, 0xc470c49a, 0x72948385, 0x8eae74a3, 0x6f848c8e,
+    0x869286b3, 0x8fab6d83, 0x98717aaf, 0x887c7c8d, 0x9c79a393, 0xb185ab9d, 0xb08e8f6b, 0xb474967c,
+    0x78c450a4, 0xaba19d89, 0x97bc8a86, 0xaba8956a, 0xa67e9cb8, 0xabca8c8b, 0x8f858bab, 0x9aae7a5f,
+    0x939a7c88, 0xa08b4976, 0xb556b2a1, 0x98b87387, 0x9f7979d3, 0x64d1b686, 0x6eb5ab6c, 0x8ea25891,
+    0x9d6ab29c, 0x78b1a8a5, 0x96d6adb3, 0xba945f83, 0x9990a990, 0xc39e8391, 0xbb84917f, 0x9255b472,
+    0x8f608d9a, 0x88adbe90, 0xa0917d92, 0x789776af, 0xacbf7595, 0x88978c9c, 0x89bca173, 0xc3959fa1,
+    0xc1b9b09c, 0x96b58fb8, 0xc46ca485, 0xa5846fb5, 0x928483a8, 0xb69dacaa, 0x925f8a85, 0x858f97a1,
+    0x67a46c9b, 0x6b67886e, 0x96768182, 0x98a189b4, 0x9e62628c, 0x83b8898d, 0x8e89afb5, 0xa186767a,
+    0x8b999c9c, 0xa4ba6dc1, 0x6084b36e, 0xbd5c9b52, 0x5778cb8a, 0x75756ca4, 0x82506f76, 0xa54e9c95,
+    0x79978b85, 0x7d689d6c, 0x627ba760, 0x9173ba80, 0x9797ac8d, 0x536875a1, 0x63818868, 0xc982b9a9,
+    0x7e938480, 0x74c29083, 0xa1948873, 0x926a8865, 0x87b991cb, 0x95b0985e, 0x836c976f, 0xa3bf57be,
+    0xb591b2a8, 0x645d59a9, 0x8d729577, 0xa6a25dbb, 0x9a9b556a, 0x77a88578, 0x6caa9d7f, 0x91618f9c,
+    0x777c9faa, 0xb873699a, 0x777e8e88, 0x697595c0, 0xa67ecb5e, 0x8b7495cf, 0x6aa96eca, 0x865fab88,
+    0x7fa89fae, 0xa8a0978a, 0x68b49c65, 0x9eaab483, 0x95868688, 0x6c738c99, 0x427abe7e, 0xb98ed4a7,
+    0xb997b998, 0x69adac82, 0x9fae8380, 0xa57b9888, 0xa26d9279, 0x95ab7478, 0x7db4905c, 0x8a8bcd82,
+    0xa39a8e8f, 0xaa6e776d, 0x726877b5, 0x8f755cab, 0xc96b5aba, 0x599a8ca5, 0x928da55b, 0x9d517898,
+    0xb9a49677, 0x946e8f9e, 0x46709a55, 0x8f5b75c5, 0xa93e9073, 0x8682acc5, 0xab5f947f, 0x905daf8d,
+    0xb2b49b8e, 0x57919190, 0xaa948c5d, 0x84938a8c, 0xb27f95aa, 0x3f74b49b, 0x3ea5bfa0, 0xb999ad6f,
+    0xab85bdaa, 0xa6978a8d, 0x9f7c8fb3, 0xa5657d8c, 0x8fb98689, 0x948e53bd, 0x8998948b, 0xc0718176,
+    0x8f5a9f8e, 0x3b7c9a71, 0x957793ae, 0x9ca16588, 0xaf83838b, 0x5a9f6990, 0xb38056a1, 0x7d98bbbf,
+    0x9274bda7, 0x697d8b7d, 0x6a9cbc7a, 0x7c7152cd, 0x7ea1a881, 0xb544c8a7, 0x904d67a1, 0x95a1a086,
+    0xa1baa76d, 0x82568c9e, 0xa29b544e, 0xb9ecb8bc, 0x799a7980, 0x844c7183, 0x628aa5ad, 0x97a3b56d,
+    0x8172b26e, 0x8d948594, 0x80c39497, 0x8c6f7579, 0xbd8b9f7e, 0x66867a9f, 0x50799245, 0x9d888258,
+    0x899c8995, 0x8791739d, 0x9aa67f6f, 0x91a03f9b, 0xb4a18eac, 0xab736d75, 0xb3613f68, 0xa7737a9c,
+    0x818c8171, 0x8b84a6af, 0xa75d72a9, 0x688a808b, 0x54a2bc67, 0xd774aad0, 0xa2a98792, 0xb668909b,
+    0xb2b6a364, 0x8495ab94, 0x89b86c53, 0xa7aab598, 0x69a18d75, 0x7b975980, 0x5dafb89c, 0x78a6a889,
+    0x7c7aae67, 0xaf585c79, 0x648e77ae, 0xb7517fae, 0xb389659b, 0x966d906d, 0x5f978f97, 0xc9a0719d,
+    0x937ebc6c, 0x978374cd, 0x87a57cc3, 0xb4aca3ab, 0x7d9f9e64, 0xaa5b7da2, 0xae9057a4, 0xa15ca36a,
+    0x84728379, 0x6293a475, 0x64a27c72, 0xa88a77a6, 0x6cc24c91, 0xb7c3b398, 0xb461638e, 0xa193749a,
+    0xdbb3cd96, 0x97859767, 0x6a957e8c, 0x86bd9889, 0xa9b6a489, 0x898850b6, 0xa7c8de85, 0x82a99176,
+    0x50a96f8d, 0x928e92c7, 0x7588c55e, 0xb0696195, 0x9c4ad296, 0xc16961a1, 0x7374b084, 0xa36a5e8f,
+    0x8ba6ba7b, 0xbe8e8aae, 0xbe7d978f, 0x7d78989f, 0x90a0a99a, 0x787eb650, 0x89bd817f, 0xa3a2b86d,
+    0x707172a9, 0xc297a657, 0x8c8ca97c, 0x6d629792, 0x9ab4a179, 0xaba25286, 0x8870a85e, 0x72a16f82,
+    0x867fd453, 0x80b48588, 0x61a67a5f, 0x929f895d, 0xb293a994, 0x84a49b9a, 0x5fd0b380, 0x77bc6f92,
+    0x68938865, 0x93b86677, 0x82a2938e, 0x7b9b9f4c, 0x698ab584, 0xb38880a8, 0x8cb0ecb3, 0x5ba29ab2,
+    0x8fd29e8e, 0xa783ad86, 0x9b886669, 0xa368c662, 0x8782738d, 0x9f8c7f6f, 0x97a38caf, 0x8b90767e,
+    0x8b9cb077, 0x8f5f999a, 0x7a7676ab, 0xbdaac1bc, 0x7a8ba07d, 0x9c978c6e, 0x7193b878, 0xaf8b81b1,
+    0xd09c89a5, 0x9b728a87, 0x8ea9afa6, 0x7cb085a0, 0xb3bb6783, 0xc88a8c5a, 0xb66a7098, 0x60b3ae91,
+    0xadc08080, 0x78c4a59e, 0xb678b558, 0x9d718697, 0x6b6c7e81, 0x819b5f92, 0x7b9b7e98, 0xa4747775,
+    0x91ae6789, 0xb08c5371, 0x8c8ea272, 0x747fbc77, 0x9caa8791, 0x7a8891a1, 0x5dbacbbe, 0xb1d07794,
+    0x7dadab7a, 0x78b0acac, 0xb2798c6f, 0xa6778caf, 0x8cb4935c, 0x7ca37f8c, 0xa0a2988a, 0xbc6377a0,
+    0x6e7aa39e, 0xb0a9ad84, 0x7c948895, 0xc3749a6d, 0xc78b799c, 0x629b7990, 0x9a6cbfbc, 0x9d889dab,
+    0x826e9675, 0xa1d0866b, 0xa773a67b, 0x65808db5, 0x9e9b6da5, 0x8672a28d, 0x75cd9e5f, 0x6f86aa99,
+    0x7387949a, 0x96cc69ac, 0x8c94979c, 0x79bc6999, 0xcbad5a91, 0x8d8e7970, 0xa5a47383, 0x798498a9,
+    0x8f9493b0, 0x8bad696c, 0xb5ba98a4, 0x8c8da6c5, 0x6b8291be, 0x8fa6b88b, 0x76b07965, 0x7c838277,
+    0x8855575b, 0x7aa57270, 0xc5b78187, 0x67a07c64, 0x8d828c8f, 0xb177aaa1, 0x87658575, 0x7ba18765,
+    0xcc83baae, 0x9d9e9f70, 0xb6cb609d, 0x9296b7a2, 0x93b66c92, 0xa59e5871, 0xc49b8b85, 0x8099a599,
+    0xaa5f9b57, 0x977c9a98, 0xbc9fa36a, 0xab848a94, 0x91a1c39a, 0xb1a86f9b, 0xbb8b9597, 0x867277bb,
+    0xa28caa89, 0x9c849576, 0x6f809b91, 0x835a9ab0, 0x8f5f6e82, 0x7778908f, 0xbbc090b8, 0x9d9c9e86,
+    0x937d7990, 0xbdce8a86, 0x9d879582, 0x8c9f9976, 0x749d8fa2, 0xc68a948b, 0xb87c7585, 0x86b0a89d,
+    0x568a815b, 0xc292b69b, 0x668da5af, 0x80c3796d, 0x7f8bc5b8, 0xb186ab92, 0x907b5584, 0x86a37593,
+    0xac8f7198, 0x6f9fb871, 0x98bcafbf, 0x6fb46e89, 0x957d82ad, 0xb29f9ea2, 0x80aea268, 0x8c8b6fba,
+    0x9bba8f86, 0x9daa8d85, 0x4d959598, 0x999e50c5, 0x7587a988, 0xa1a75ca1, 0x93858b88, 0x507d8b98,
+    0x615b85b5, 0xbb8a785c, 0x88c1b58b, 0xc4988795, 0x7688958d, 0xa8b3919c, 0x648b9367, 0x97967c7e,
+    0x5ca48f8d, 0x977f9474, 0x74a8c1ac, 0xa7908052, 0x8a9f968a, 0x92ac8288, 0xaf50766f, 0xbca2b56a,
+    0x8981938b, 0x8aa3a654, 0x9482725b, 0x7393b297, 0x8f98935b, 0x9f91ac78, 0x84aa94a0, 0x91a882b1,
+    0x6a95af87, 0x937f97a5, 0x8f6e7da5, 0x908f858b, 0x7dbdb0c2, 0x8d639b76, 0x8659a57d, 0x809b9bbb,
+    0x42af6983, 0x9c978b95, 0x7dad93c1, 0xa98e6a82, 0xafaca09e, 0xb2ae92bd, 0x6461909e, 0xb750a8ae,
+    0xbba461a0, 0x8f6d5f55, 0xa85d98a0, 0xbabe7ead, 0x59977991, 0x73976786, 0x7aa28e65, 0x70a8a991,
+    0x709d9a9d, 0x7b787b7b, 0x578a6398, 0xa4846c6e, 0xafb47f72, 0xa8819e61, 0x79b4c14a, 0x8b78808f,
+    0x75be837c, 0x93796f8e, 0x6a599f7e, 0xb47369bf, 0x7a9cad94, 0x9466c295, 0x5a698dab, 0x989a91a6,
+    0x96d1b89f, 0x718e70bf, 0x70688a8c, 0xa27d8e79, 0x6599716c, 0x84b59285, 0x9765a2c8, 0xa94c9750,
+    0x79869197, 0x8ea4a7aa, 0x6468a68d, 0x7d75758f, 0x5c666d80, 0xadc04598, 0x6c56765c, 0xa4795cbd,
+    0x88af8a97, 0xaf73b487, 0x2f6a449a, 0xa0a37c7d, 0x898ec15a, 0x847d8893, 0xad9da477, 0x856e6796,
+    0x747273c2, 0xa6b48a83, 0x5793ba7c, 0x818f62d5, 0x77a4c479, 0x7990956b, 0x537d68a9, 0x6499699f,
+    0x7a9582b4, 0x587d9bb1, 0xa78a8784, 0xb0a775bf, 0x9fa5b176, 0x5963bf78, 0x808fa764, 0x97539173,
+    0x81b5a297, 0x948a858e, 0x6f6dc29e, 0x5c518d7e, 0x8483a75d, 0xa7a48871, 0x935a7878, 0xc7947d91,
+    0x76af8c70, 0x7e5989a5, 0x5eb94c9c, 0x95565eac, 0xa4a3a369, 0xa6d5935c, 0x94caa76d, 0x7a385f95,
+    0x3fb08493, 0x75a89ec0, 0x5986c170, 0x997c469c, 0xb48e9d78, 0x7984b37d, 0x3a9c55ad, 0xcabc6e7e,
+    0x8b9ba8a7, 0x8b57bccc, 0x5aa47d85, 0x7b7263bb, 0x9b8eae72, 0x8592856f, 0x4ebaacb5, 0x8d34937a,
+    0x8bb0799b, 0x9c7db05b, 0x499f849a, 0x90a38e67, 0x82b65a57, 0x7b766462, 0x9b6f9dba, 0xcecd6d88,
+    0x6c99b56e, 0x9ba2bc81, 0x579f4aab, 0x636c8488, 0x9f997e65, 0x83a59fa9, 0x89c68e9d, 0x9497839f,
+    0xb3909fa3, 0xa699a16f, 0x9dada5a0, 0x978a80c0, 0xaaadadab, 0x7283c783, 0x849347ca, 0x87afb676,
+    0x89bec1ad, 0xbb619cc5, 0x81bc935b, 0x88a568b5, 0xb18a7f8a, 0x598cbb76, 0x62657b6d, 0xa866cf7d,
+    0xb4869aa8, 0xafb77158, 0x85a391b2, 0x757c927d, 0x5686adb3, 0xc09fb977, 0x64929699, 0x98976153,
+    0xa3599d87, 0x95aab87e, 0x72b18573, 0x908d5d81, 0xb9b99b77, 0x92af7d7e, 0x7db4bf64, 0xc76f6dae,
+    0x81c159aa, 0x85ae7eb3, 0x93798d88, 0xa080ab78, 0xaf81949f, 0x9e67c074, 0x726d707f, 0x72706794,
+    0xc49399a6, 0x8da1d7dc, 0x8e8259bb, 0x946fa8be, 0x6e838b8e, 0x9e91a292, 0x85bf9075, 0x7886abc0,
+    0xa6ba9786, 0x8e6eaa82, 0x3fc28dc1, 0x87797c80, 0x48a57666, 0x7599c4ad, 0xba79bd6d, 0xdea8a576,
+    0xa86f9c66, 0xa4a9ab8b, 0x5bae8b8a, 0x827797cb, 0x71c4874b, 0x879e8c8c, 0x7493758c, 0xa381beb3,
+    0x769483b4, 0x6d7b72ae, 0x6fda86b5, 0xa98ca774, 0x777aa5bd, 0x95aa9fa0, 0xa88f38c1, 0xb4877a7e,
+    0xb6ac9da6, 0xab7ac99e, 0x4d876e71, 0x99af8272, 0x5eaaa566, 0xae7db980, 0x875eafb8, 0xaa7abe87,
+    0xc3999a76, 0xbd7c90ab, 0x71b277bc, 0x89bfcc80, 0x7788c176, 0xbd986bae, 0xa279a16c, 0xacb9a0b0,
+    0x9070a757, 0x82835a96, 0x86887ba0, 0x599b5c7f, 0x95a49a63, 0x7fb88492, 0xaa9ea071, 0xb0549ab8,
+    0x9f835b76, 0x9abe7397, 0xcdc096ad, 0x7fa692a0, 0x89a6c07f, 0x9c81785d, 0x87b4298b, 0xaf8f9fb3,
+    0x538f9797, 0x9e93979c, 0x7d61907e, 0x499c7a6f, 0x87b39fbb, 0x7d8c94a3, 0xb085c398, 0xa7b09d92,
+    0xc078a99f, 0xb978a987, 0x5bb96ca9, 0x7b9a9981, 0x6e5f9ba8, 0xad9f90b4, 0x967daaa9, 0xc4a5537f,
+    0x879a7ca9, 0xa4c18091, 0x6c9690b5, 0x9ebe7b65, 0x8e99738b, 0x9fa594bf, 0x9cc18498, 0x8a94a961,
+    0x989f757a, 0xa6a79f97, 0xac8255b8, 0x9ab7aaa9, 0xc2bb8eaf, 0xd1ab8a7d, 0x98ac4ba7, 0xcb8bba7d,
+    0x3f6caca6, 0x7667ba86, 0xbc7f8b93, 0x4194b077, 0x629d8b86, 0xaeb2aa8a, 0x8566acad, 0xa0c4ac99,
+    0x9099a499, 0x968694a5, 0x6b88536f, 0x57a590cd, 0xc39680a9, 0x87ab8d94, 0x90a67b71, 0xb9a09799,
+    0x87da8544, 0x94c98798, 0x7aad90c3, 0x6692a86b, 0xcc806552, 0xa44fc9d1, 0x9c846cbc, 0x8f8067a8,
+    0xb28bbfc2, 0x9e77367c, 0xbab79285, 0x79b7a538, 0x7c9448ae, 0xb9c05e77, 0xa793a09a, 0xa2c7c772,
+    0x654c7fa1, 0xc0b8a597, 0x90a48ac4, 0x867b726d, 0x83b496a8, 0xabbdbddc, 0xb74faa71, 0xa2adbd6b,
+    0x86935773, 0x5692c3b7, 0x7bba847a, 0x51b3b06b, 0x87cbc5a6, 0x78a8958c, 0x6d8a94b7, 0x95aca9c8,
+    0x52aba172, 0x9b8990bc, 0x9196a0b4, 0x5387b8d2, 0xc4cea89f, 0x818c549c, 0xa5637898, 0x75ab5aa4,
+    0xa96897b4, 0x935fa980, 0x89756a85, 0x6897a790, 0xb6c58b7d, 0xb09a9a5b, 0x9d847371, 0x7dc7745d,
+    0x603e8995, 0x749c8a82, 0x8c7374ca, 0x90529770, 0x8a9582ac, 0x7cc09ea5, 0x8fb77b77, 0x92b8a376,
+    0xb188417c, 0x8e809cbc, 0xa0937e80, 0x51d3ad66, 0x9eb78752, 0x6d9460bb, 0xa986c6c6, 0x9775b1c0,
+    0xb0967972, 0xb1a7847c, 0xb09d938d, 0x6e9091d6, 0xc68ea85a, 0x6e86a780, 0xa75cb9a4, 0xa19e9192,
+    0x727facac, 0xa4a9be82, 0x80bb959a, 0x99958d87, 0xba61677f, 0xac9b6e5c, 0x8d8b8283, 0xa6b096ad,
+    0x7e425f9e, 0xab79969c, 0x6b6d73b3, 0xa2828b87, 0x9ea48890, 0xb48874b0, 0x7f97986c, 0xc9c3b196,
+    0xadad8ea2, 0x6aa3a077, 0xa4848e6b, 0x5e7d937c, 0xaab597ba, 0xb2b1b4c3, 0x8c8fd463, 0xafc4a6b1,
+    0x916748b1, 0x55bb4d66, 0xb77c8777, 0x60885a87, 0xb096a09a, 0xa89b869e, 0x998a9585, 0x8aa867d3,
+    0xb1c4b685, 0xaa94a47e, 0x7aa3956b, 0x69bdbb63, 0xb18b7ea4, 0x88996bb0, 0x9e7885b9, 0x749b7286,
+    0xa748aa9e, 0x7c8ec0a3, 0xbf4f67b9, 0x677db177, 0xbfc38161, 0x9eba8e86, 0x938c815a, 0xc1a7a5b3,
+    0xb7a17c94, 0x7e9c9bb6, 0x878e729b, 0x8e8a928d, 0x687385a8, 0xc5ab6682, 0xb69787c3, 0x7e715586,
+    0x7e9d9bb0, 0xb85e7a87, 0xa149956d, 0x96689cae, 0x95649b99, 0x8dc27b93, 0x83c1e69a, 0x587fafa8,
+    0x5e748ab5, 0xb59caecc, 0x86b18785, 0xc38472ac, 0x7f87a39e, 0x8c608cda, 0xa7a7a389, 0x674bb386,
+    0x83927693, 0x69929696, 0x80697b94, 0x6baf8db8, 0x51907d92, 0x7667bb52, 0x9f63a173, 0x8e8d7f84,
+    0xc7ba6ca3, 0x6a94db6a, 0x7ba689b3, 0x926b8874, 0xc49b89a2, 0xbeae9780, 0x66b27684, 0x9795a7b8,
+    0xa8ae7577, 0x74b2706f, 0x8447597a, 0x6ca38974, 0xbf648bd1, 0x907f937d, 0xa6ad9456, 0xafbf9698,
+    0x5da9aca1, 0x82878da4, 0x738db79d, 0xb78b548b, 0x8e967679, 0x97a185b4, 0xaa7c6577, 0xa39c8d9b,
+    0x878a9c9e, 0xbf7bbebe, 0x5e699a7d, 0x996c8f82, 0x74637a89, 0xb2698da3, 0x92ac8c97, 0xb667a686,
+    0x76b37db4, 0xbf9ba36b, 0x9a75c987, 0x6da08952, 0x80527b91, 0xab9b8757, 0x9d788e90, 0x9f769cbb,
+    0x636d50bf, 0x5163756a, 0x815aaf75, 0xb58b61a0, 0x9fa5aac0, 0x5c7f987a, 0xa46cd66d, 0x939f92a2,
+    0x74738d78, 0x8ab3a7a3, 0x5283a392, 0x9ea07dab, 0x8a7c9a50, 0x5a42ab75, 0xc5429bb3, 0xa4818371,
+    0x5f87ba8e, 0xa3b08abf, 0xc291ae92, 0x93529088, 0xa9b79869, 0x88afb89c, 0x737da47b, 0x91a2838d,
+    0x9dae649f, 0x77d27b88, 0x6c857d70, 0x9985a184, 0xa28a878f, 0x9198688f, 0x75967a96, 0xc594ab84,
+    0xa96abe8f, 0x7c904da8, 0x666c7a60, 0x747e7b97, 0x8a7d8ac6, 0x3878bf8d, 0xa2749676, 0x7f835f97,
+    0x7552ca8d, 0xa9b29467, 0x848e868c, 0x79606eb1, 0x7274aca8, 0xb07290e5, 0xb29d6ba5, 0x8957918b,
+    0xaa71695e, 0x858c6493, 0x95b8b63f, 0x66a3ae99, 0x9a48749f, 0x7b807a68, 0x62b78193, 0x7999899e,
+    0xb39b69b5, 0x9c7ab48f, 0x958e7eab, 0x858d907b, 0x8dc3a2b0, 0xb47e6d71, 0x73568b63, 0x6f769c87,
+    0x5161808d, 0x9581915f, 0x8348b55f, 0x8eb94ab5, 0x99b1acb7, 0x8ba88d57, 0xac7f937b, 0xbd6f6b6b,
+    0x96b39c9e, 0x785fa5a6, 0x96c99ea1, 0x81a675bc, 0x7b87a672, 0xb573a4c4, 0x9577c3b0, 0x708d8fa4,
+    0xa674a89c, 0x86b7baa6, 0xa1b49960, 0x78689eac, 0x7d89ab6d, 0xaf637a87, 0x38bda488, 0x90597397,
+    0xa4648782, 0x9c74709d, 0x8bb1b561, 0x84b455a6, 0xa1bfaea0, 0x86bc59be, 0x8c899b73, 0xbd7b8ab2,
+    0x8377b29f, 0x58a47996, 0xaea5a79a, 0x88a15aa6, 0x9a818cc5, 0x9c87478d, 0x83637f8b, 0xa3626d90,
+    0x8a57a5a5, 0x8f7071b3, 0xaf849878, 0xb6987ebd, 0x7a7f826d, 0xb74f80b0, 0x71898cbc, 0x8a959f71,
+    0xd6897b90, 0xbe6db5ae, 0x8b6f946d, 0xafa2aa7f, 0x8fb68863, 0x7a977f8b, 0x6d94a470, 0x81afd175,
+    0xb9738660, 0x78bd9299, 0xd286a799, 0x9dc87499, 0xc67698a5, 0x8bba678d, 0x72a9ada0, 0x958f8c78,
+    0xb86d85a8, 0x916f8c6b, 0x9871838d, 0x7e896691, 0x8974758a, 0x68b0678e, 0x73767a86, 0xa94e7191,
+    0xad87b9b3, 0x788a9a5e, 0x7c64a45d, 0x90a3bd8b, 0x9d849770, 0xce8dc3b4, 0x91659b82, 0x79768ba0,
+    0x89918378, 0x75a6766d, 0x66a6d34b, 0x9eb896a0, 0x80ab9651, 0x9e9171a7, 0x7a7e65a5, 0x98779490,
+    0x91ac9497, 0x78bf9348, 0x95b4bd75, 0xbd914ea4, 0x7a67678b, 0x938b5e99, 0x497ea84d, 0xb7979875,
+    0x898c7ea2, 0xa06d9485, 0xa34b8b82, 0xa2a789bf, 0x8f5da5a3, 0x72579566, 0xb9a98574, 0x7572789e,
+    0x4b86a2a9, 0x835e6b81, 0x823e86a2, 0x75666fa9, 0x567f9b74, 0xb6a9b0a7, 0x8458878f, 0x6f80a39c,
+    0x7ac7c855, 0x6a948e83, 0x66ad8442, 0x8cb77c60, 0x7699a675, 0x84c07f8b, 0xa3749bb6, 0xae75869a,
+    0x6cacab8c, 0xca715f8e, 0x637c8aa9, 0xa1b14faa, 0x7b45a7aa, 0x959391ac, 0x7694c58d, 0xae987d98,
+    0x839d9176, 0x946ad7ad, 0xda66817c, 0x8d806f68, 0x6f998769, 0xa5556072, 0x84da8bb2, 0x976d4e99,
+    0x8b7371ab, 0x9a6e9d7a, 0x9a949f3e, 0x935698ac, 0x88a05672, 0x89c9a895, 0xcb74c88d, 0xa08b6d7e,
+    0x997d8f69, 0x86a4666e, 0x88887b97, 0x9bb5a99f, 0xa2b8c251, 0xc5b98899, 0x9474c5ae, 0x64606c93,
+    0xbe56806e, 0xb54d678b, 0x766c8da8, 0x8f9c8d6e, 0x99806d8c, 0x8b8a6caa, 0x6db0b49a, 0xbd8069a4,
+    0x6e768a50, 0x9879d88e, 0xad80a5b4, 0x8460b885, 0x784d7cb2, 0x86668145, 0x97c494d9, 0x97c07f7c,
+    0x975880a4, 0xb99a645d, 0x6d80b57d, 0x7c9c836a, 0x79b872a3, 0x55ae97c7, 0xc7809f93, 0x767ab079,
+    0xccacaba6, 0x93769463, 0xb7717664, 0x998b779b, 0x9b96945e, 0x7cbfa5b7, 0x99a98f72, 0x87969780,
+    0xb2677e8d, 0xa95cb1a9, 0x8a7a98a6, 0x9aa2807e, 0x838fa192, 0x9e857b98, 0xacaacfbc, 0x889cb56e,
+    0x7dde6a85, 0xb176898d, 0x9ea38388, 0x9d7b7050, 0x9394a995, 0xb3836d9d, 0x88b488c6, 0x7569ae7f,
+    0x6f6a9195, 0x6f8b6e7f, 0x589c8abc, 0xc2b36063, 0x9fab6476, 0xa27b958f, 0x935c726f, 0x6a6eb78c,
+    0x917f7b7e, 0x8081925c, 0x87727a6e, 0x9c7fa58e, 0x9c73a790, 0x5fa3958d, 0x807bc68f, 0xba63c270,
+    0x9273b8a4, 0x816ea4a5, 0xac91c371, 0x8b918b96, 0x9c76789c, 0x758c8275, 0x9f5a729b, 0x8fc0aec0,
+    0x998f9eb2, 0x8eaca7c4, 0xbc8d695b, 0xa96a7fa9, 0x97a77f99, 0x95a8a888, 0xa0c1956f, 0x92c58a73,
+    0x61aa8bbb, 0xa08776bc, 0xa8b1aaad, 0xd1abaa63, 0xc46ac19d, 0xc485c288, 0x905b978f, 0x7297568c,
+    0x97a985b5, 0x9678966f, 0xb58b5d7e, 0xafc59e74, 0x58997b7f, 0x8b849da9, 0x7075888a, 0x896f9b6a,
+    0x5e9da16e, 0xada585b7, 0x7a8fae59, 0x8e879958, 0x7fc389c8, 0x8f8f9682, 0xa18bbf6b, 0x9a77ba72,
+    0x7c7c9fb0, 0xa48b6871, 0x9eaf9f77, 0x8c84a69f, 0x9c8a7da7, 0x74aea7c0, 0x8e878d60, 0x878aabba,
+    0x916bc5af, 0xb0a96e83, 0xaa86a6b6, 0x87a9958b, 0x93b789c2, 0xafa5c2b4, 0xaf6ca3bc, 0x70957d8c,
+    0x80aa8f98, 0x7272b8a7, 0x8ea4d2b7, 0xb4b3a68d, 0x6080ac79, 0xa4969fbd, 0xab526091, 0x86a48cb9,
+    0x6baf7a8c, 0x7fa25093, 0x8875997c, 0x7bc69299, 0xa8af8c86, 0x84a59180, 0xaba3938e, 0x9472a699,
+    0xaea6cc69, 0xc587b877, 0xcc84d57d, 0xa77b9f5b, 0x8984aab0, 0x8db96376, 0xa18b638a, 0xa2617bb5,
+    0x92a4af68, 0x599e50ad, 0x66aaafaa, 0x9a6a9078, 0x805f8061, 0x656a8182, 0x6f85b09a, 0x81b282ad,
+    0x6cb581a7, 0xa58b6c96, 0xa06a9a81, 0xbfab726e, 0x9e9ccb78, 0xb98285bb, 0x704a7085, 0x8584806d,
+    0x6da6a494, 0x83c9a38c, 0x868f9c8e, 0x84be8953, 0x8a949487, 0x599c9292, 0x97a1a86e, 0x96ce84a9,
+    0xa37b916d, 0xac9a95b3, 0x8abd7f63, 0xa67886b8, 0x6998a166, 0x4f697a9c, 0xa985bdd0, 0xa5cd5b8f,
+    0x8d7094b3, 0xa67b815d, 0x636ed299, 0x74778c7e, 0x6d7697a0, 0x81a1567e, 0x8c77838c, 0x668f6e85,
+    0x80a06d9e, 0x98999c70, 0x8e729789, 0x746a4fb8, 0x9cb9ba9d, 0xbc9cc5c5, 0xb87baa7a, 0x8e835a8d,
+    0x8e877b7d, 0x867690a8, 0xab98c375, 0xabc0aa52, 0x8a7fa0a7, 0x91a58382, 0x4d8d8698, 0xaca288b0,
+    0x928b829c, 0x99795a6c, 0x96b883a1, 0x99829b97, 0x984e92af, 0x4e6b9f92, 0xb09fa2a6, 0xbcbe7fa9,
+    0x8c48639b, 0x6a8f7e7a, 0x80958473, 0x7c86605f, 0x6f997a74, 0x60856085, 0xa45557ac, 0x2f7b847e,
+    0x9499607b, 0x5d7a888e, 0xb98abf89, 0x81729e95, 0x59737f8b, 0x959c9d86, 0xbc785e74, 0x898b6871,
+    0x82998789, 0x579791a7, 0x677996aa, 0x9979ae60, 0x57788e73, 0x7c909b8b, 0x8785b1ad, 0x8cc892a1,
+    0x84847595, 0xe06b8a83, 0x6bb73d6b, 0x8669697c, 0x9669cf6d, 0x897aa79d, 0x9eb9b17e, 0x8f92c498,
+    0x8771948e, 0x8d7c917a, 0x7b69e25d, 0xc56a54a3, 0xadcc7572, 0x928eae85, 0x599c6880, 0x8f5b826a,
+    0xb4b185ba, 0x787b6e8b, 0xb28d959f, 0x6a7a559c, 0xb284b899, 0xb198b888, 0x95b18882, 0x9c709e9e,
+    0xad949482, 0x73939269, 0x7f8479c3, 0xc67f4189, 0x708fa66a, 0x73909cb4, 0x5055b96f, 0xb68291a5,
+    0x8b749596, 0x87a998ab, 0x44a0715f, 0xa5a36ba7, 0xa48fa781, 0x6a94929f, 0xc3a59591, 0x8365a1aa,
+    0x67937ac6, 0x97b385c1, 0x90809062, 0xbb9f5aa9, 0x9f86ae59, 0xd29a8097, 0x9a706e8d, 0x945a9174,
+    0x9b899a8f, 0xa76396c6, 0xa4b6657d, 0xb0996882, 0x709b759d, 0xa8aad0cd, 0x8f878d6a, 0xa4438a6a,
+    0x69918186, 0xaa78bf74, 0x88a798b9, 0x8a6c7684, 0x69726d52, 0xc3899699, 0x82949e75, 0x87c78daa,
+    0x7e958a9a, 0xa484a6a8, 0x536c52a5, 0x7c9e779b, 0x7e87ad82, 0xbcc36fa5, 0x9abcbf97, 0xa8466e8f,
+    0x5e9d9976, 0x7f7f7ba5, 0x657795a4, 0x98a5708e, 0x96b1995b, 0x787b9b6e, 0x7795969a, 0x713f8a8d,
+    0xaea59199, 0xa670a591, 0xa9d26f9b, 0x78a579af, 0x636d6677, 0xafb8a3ac, 0x9079b99a, 0x8e49b497,
+    0xc5be74aa, 0x9d76b48d, 0x2d8f8c95, 0x8b469287, 0x9f949d83, 0x99b172ae, 0x7a8da27d, 0xbc6cabb7,
+    0xafc38a71, 0x8aafbc83, 0x76704262, 0x799c6398, 0x746f9aaf, 0x75a766cf, 0xb1b78651, 0xb3449c96,
+    0x41af6989, 0x849f919e, 0xa1648c7e, 0x79ac57a1, 0x91a49569, 0x7654a3a0, 0x72892ca5, 0x83688a7a,
+    0x8bbda1a0, 0x7c95b4c4, 0x66b15f8f, 0x71839fc0, 0x7bb6b7b5, 0x976bc08a, 0x7eb8969d, 0xc3859e81,
+    0x72c4aa92, 0xb4b0a074, 0x84c28cd4, 0xa4596b94, 0x6f8bad9e, 0xb3b569a2, 0x9c8c8197, 0xa7a9a79a,
+    0x7490a3c4, 0x7f988db1, 0x5159508c, 0x599b6282, 0x8293aa7f, 0xaf7f8d6a, 0xc3abbebb, 0xaa3f998e,
+    0x719ca77e, 0x9da17dbe, 0x8c947176, 0x7bb15a98, 0x97b7a94f, 0xc78b9c8a, 0x648967b2, 0xba72986a,
+    0x7d9fbcb2, 0x973a95d4, 0x808b807e, 0x7aafac93, 0x5a6899c5, 0x9685c667, 0x59879a8a, 0x7c9d9695,
+    0x84c2a7ac, 0xc2a093a8, 0x44936878, 0x9b5fabab, 0x8a81a09c, 0x8e938f88, 0x72b2bbca, 0xa1935681,
+    0xb19f8e65, 0xa89db9a5, 0x6a865c8c, 0x3ea7646b, 0xa5c3679c, 0x7f9d9eb8, 0x92a88fa6, 0x79448e87,
+    0xaa798498, 0xb3a58fba, 0xa8985da6, 0x70857091, 0x6a6ec78e, 0x91b3af59, 0x9cbe5ea1, 0x6f95a267,
+    0xa9b5aac1, 0x967998d5, 0x91886469, 0x72ba8c8a, 0xb1b2c869, 0x737f8d8e, 0x41d4b694, 0x85cba1c7,
+    0x987a8a9e, 0x9163c971, 0x5ca858af, 0x667d92ae, 0xc977c9a3, 0x926f78b5, 0xa383ab7e, 0x77a37571,
+    0x4eb69c88, 0x8578a257, 0xc07d628f, 0x9c97835a, 0x97aa6b68, 0xbab08aa2, 0x8a8ca5b9, 0x755eb1a4,
+    0xa181a692, 0x6ea152b9, 0x7ec76a7c, 0xaa95b497, 0xc1af8997, 0xc09b8a7e, 0x9a8374b2, 0xa3a1b36a,
+    0x4762c1ba, 0x90869d90, 0x7a785bb2, 0x44599886, 0x7379cda7, 0x7090b47b, 0x848fc5aa, 0x697e8ea5,
+    0xb99598bc, 0xac9099ba, 0x54b24783, 0x8298709f, 0xc2c2c67f, 0x8a668683, 0xa4bdb192, 0xd383749e,
+    0xa7ab9584, 0xb1aca7ab, 0x888f89c6, 0x726bc36f, 0x9f7cba66, 0x8aab84b1, 0x8cab87c4, 0x8c78aec9,
+    0x9abd8ba1, 0xa1659192, 0xa5b5847b, 0x8279a485, 0x9cb6798c, 0xa569558d, 0xa491585e, 0xb1b08baf,
+    0x474786c4, 0x7586b2b0, 0x76758196, 0x626b9f80, 0x9f9a7d7d, 0xb28aaa8a, 0x9ebb9c8f, 0xaec47f8a,
+    0x98c15e91, 0x8f62a09c, 0x2c9c4792, 0x527d6c93, 0xb1a7b394, 0x79bc9a85, 0x959aa9ab, 0xda76718a,
+    0x8cc08475, 0xbba4bba4, 0x95949898, 0x4575d08c, 0xc38aa9a6, 0xc5a884ac, 0xb2aa87a8, 0x9d9b7f93,
+    0x689994c6, 0xa183996a, 0xa365759d, 0x93868d95, 0xa1aa689d, 0x8b9e8c7a, 0xae9abea5, 0x8c83a6b4,
+    0x6b74bbb1, 0xb96fd5a1, 0xb079b084, 0x6f70b171, 0xa8a995a6, 0xd6b485a5, 0x5f6d8a5a, 0x619480a0,
+    0x9f896d5b, 0x7a9c8492, 0x9c74a062, 0x86628e8e, 0xb692b57d, 0x96958bbe, 0xb972a0aa, 0xd1a68ea5,
+    0x4bb5918e, 0x7f9582b0, 0x7686876d, 0x5ec873bd, 0xf4a1a16f, 0x9fb48485, 0xab908d90, 0x78875f90,
+    0x87c7ccb9, 0x81c07e92, 0xaccb859a, 0x89957d5a, 0x95a06ebc, 0x9cc373b7, 0x80a68484, 0xaababf8f,
+    0x6f69a0b8, 0xa092a87e, 0x8b869493, 0x6a4e7d7e, 0xbe92c3a3, 0x9fbfacb3, 0xac817368, 0x9e9cb066,
+    0xb7af9a93, 0x886dad71, 0xc4a98995, 0x386e93b7, 0xb481715a, 0x8d8bbf80, 0x9a929c9b, 0x9794cc57,
+    0x7c755d80, 0xba8aa0ad, 0xbaa98f91, 0x7073b1a0, 0xa56e9fb2, 0xac9a5b7c, 0x77cabb9b, 0x71735ad0,
+    0x88a68089, 0x6fc080d1, 0x6eb28196, 0xbca69983, 0xb6878a9c, 0xa1aa83b9, 0x9991a4ab, 0xa57b8b58,
+    0x923e7388, 0x9076798a, 0x76897186, 0x886f89ca, 0x8289af6c, 0xa4a1a37b, 0x9e918b86, 0xa4ae896e,
+    0x83a86982, 0x919cb0ac, 0x8d838d6f, 0x73a37a6b, 0xbd6d9857, 0xa2a0636e, 0x94898e91, 0xd0835d75,
+    0x93c3719b, 0xc4738e89, 0x877b918f, 0x4e9197c1, 0xb26ea6b1, 0x83b89890, 0xa7818ac0, 0xb06e718c,
+    0x6b71b1cd, 0x7ab69697, 0xa9b09076, 0xa5705bbf, 0xa291cd85, 0x7aa47c72, 0xb5af7f9c, 0xa75d83ae,
+    0x7a8b678a, 0xa7869875, 0x7178af64, 0xbc808190, 0x64989694, 0x8887a9a4, 0x7bb5aa55, 0xcb548286,
+    0x98c2528f, 0xa0a4c385, 0x9e9e734b, 0x6db5827b, 0x92a7689c, 0xe8c47e9e, 0x82875894, 0xa7947a88,
+    0x5b82417e, 0x6d967e7c, 0x6d8bbc54, 0x8e949792, 0x8d72e299, 0xadba7976, 0x7a79c0ad, 0x7c9385a8,
+    0xcc888c8f, 0x73cda87d, 0x84bcbc90, 0xc3967f74, 0x948ca47b, 0x62a97a7b, 0x7da0869a, 0x742869ac,
+    0x7b8f8585, 0x74909fa9, 0x9b8786a0, 0x915e9c95, 0x739ca690, 0x8f7a9db7, 0x96838676, 0xbe837990,
+    0xa4ad5e9d, 0x7e7ea593, 0xaa9ab39d, 0xa586808e, 0x753d7ec3, 0xa2a68baa, 0x596b7a97, 0xb9606a8a,
+    0x52a577a5, 0xa3914b89, 0xb9647a45, 0xa29452b7, 0x8f61a79a, 0x93768c87, 0xb5aab877, 0xab906fad,
+    0x665d9c8c, 0xbec29881, 0x7c9e85a3, 0x8dbc8d81, 0x8887cfaf, 0x9e679098, 0x9172889a, 0x736d9dae,
+    0x8f95955c, 0x9c789789, 0x7c71865d, 0x938dabab, 0x7a7faaa9, 0x739980be, 0x797b9e93, 0x7d829eb4,
+    0xbc879e8a, 0x58b7a8ad, 0x9b69829a, 0x9276b884, 0xb17b9189, 0xa5a68783, 0xaa7aac64, 0x7c9a96bf,
+    0x747db7aa, 0x6293a99f, 0x6b4eb353, 0x849d7a97, 0x816b96b4, 0x74916270, 0x938f9470, 0xa08f965a,
+    0xad69887c, 0x5663a383, 0x72b89879, 0x908a6997, 0xb065b5b1, 0x5b8f6c93, 0x6fa6afa3, 0x7f829482,
+    0xaeab637e, 0x758e6e9c, 0x88a0b05f, 0x5f7cb4c9, 0x949a9857, 0xa94b96b3, 0xa674ba59, 0xb99256b5,
+    0x9b7da0b2, 0x64757ca5, 0xb3a9ac7c, 0x84a3a59d, 0xa98a74c5, 0xa6b87f9a, 0x92a7977b, 0xbb6b6c96,
+    0xb388748c, 0xa061b784, 0xba8b8675, 0x8a9e5aa5, 0xb567adc4, 0x58ab816d, 0x9a958ca1, 0x7ab163a9,
+    0x7e57bfb5, 0x7a8c9eb3, 0x66878ecc, 0x7b9b9395, 0x6f6c9486, 0xbd3abfa8, 0x7a4e97a8, 0x928e9ea3,
+    0xb28e7b84, 0x9bcc7fa3, 0x947b7383, 0xaba1698f, 0x97629163, 0x87629086, 0x8d8d8799, 0xc074c195,
+    0xa67a8d9f, 0x7091a669, 0x996abcac, 0xcdb09296, 0xb376767c, 0x7ebf8b98, 0x7e739d59, 0x728ca6a3,
+    0x9a9c9d7a, 0x8376889a, 0xdc8d95b0, 0xaba26a93, 0x8a939a9b, 0x25a2959b, 0xacaf916c, 0x61845588,
+    0xbd6f6d99, 0x71b7c2b2, 0x8f5d8fa6, 0x807e6db6, 0x81b1aa77, 0xa16fb8ae, 0x9d397b7a, 0x69739b97,
+    0x78c59b61, 0x958a8a60, 0x56b3b84d, 0x7d919a95, 0x859c947a, 0x9ea063b7, 0x7c93a1a9, 0xac7aa3bb,
+    0x95acc278, 0xa4b1886d, 0xb2a88790, 0x9a8e9fa8, 0x9e9d6d9b, 0x6aab7682, 0x8378a582, 0xa489a87b,
+    0xaf7c6c73, 0x6c619cc7, 0x9170876d, 0xa687937f, 0x8181caaa, 0x797c5d63, 0xa277776f, 0xb180b997,
+    0x986ba58f, 0x73999084, 0x8d7bc888, 0x73a3a494, 0x7f768e94, 0x6578b3a7, 0xb07485bb, 0xb769c998,
+    0x9aa39488, 0x86a5a7a0, 0x7a78aa7e, 0xb3bba3b5, 0x9ca5a163, 0x9aa4a3b4, 0x228890a3, 0x80728f76,
+    0x6b8ec9a5, 0x8a94c475, 0xcd9862b4, 0x6eb09a8e, 0xa4a05a70, 0x658f9b96, 0x80546143, 0x95839d7d,
+    0x90bc866a, 0x8565a8c4, 0xad9ab89d, 0xbdaa88b6, 0x81ac95b2, 0x82a138b2, 0xba9c6c84, 0xc7397191,
+    0xa58d84a2, 0x82b53c67, 0x9ab7707a, 0xa468a49e, 0x99c97d7d, 0xa98fa496, 0x8e82afc6, 0xa6a0c0a9,
+    0x8e99648b, 0x7391b38d, 0xa8c0b872, 0xb0948c78, 0x8a7fa762, 0x7a9b6885, 0x7aa6af68, 0x5d56ce75,
+    0xa198887d, 0xc77b7970, 0x9574aab6, 0xa063bd6e, 0xae729f52, 0x628c718b, 0x5cb38970, 0x9f5fa670,
+    0xa8618b6e, 0x956bd3c7, 0xb365b097, 0x6192a682, 0xb17eb0b2, 0x6c6f769d, 0x867e65aa, 0xd461809d,
+    0x77a599cc, 0x8483788b, 0x6a48758f, 0x718b69a3, 0xabb065b7, 0x9a8db1a0, 0xa24c9b5e, 0x838486b9,
+    0xa18e686e, 0x51659a9a, 0x98768b78, 0x9da7b23b, 0x4783927b, 0x86aa8b98, 0xadb2a478, 0x4681b56a,
+    0x97819073, 0x9d818a9d, 0xb76e5a79, 0x83556c97, 0xa14abf74, 0x568b73aa, 0x6d88985d, 0x819e8fb0,
+    0xbd90a9a6, 0xbba9dfd5, 0xa058adc3, 0x9b598553, 0x926bb7c5, 0x99749c83, 0xac935d75, 0xd6949060,
+    0x98859ba5, 0xb879b275, 0x80936944, 0xab8f6164, 0x9add9989, 0xa0a49bb1, 0xba78c890, 0x81707bb8,
+    0x9475863c, 0x755d6a95, 0x94845381, 0x9c62aa86, 0xb38fb561, 0x8b6664a5, 0xa79c9b60, 0x69a67476,
+    0xa0817863, 0xa0636c8c, 0x53aab6b4, 0xa7996650, 0x7c62a75e, 0x716da785, 0x6d98c272, 0xc98ea96e,
+    0x8db35b43, 0x9c62c3e0, 0x9bab7a93, 0x8f9bba60, 0x6a47768f, 0x6b577f94, 0xc8a459b9, 0xa97a488f,
+    0xb8846b91, 0x79b1b85a, 0x84a1b07f, 0x4e83907b, 0x7cb57a53, 0x80b17da4, 0xa2717282, 0x7181af81,
+    0x7b9aab4e, 0x71b086a1, 0x96947894, 0x81895bad, 0x8566c76b, 0xc09ba879, 0x78ccc69b, 0xa0b39492,
+    0x55597f93, 0xa771a3a6, 0x5d679dba, 0xa8ba9098, 0xca7f88c8, 0x737d6ed7, 0x6c7ba99e, 0x98cda572,
+    0x5ebf7f9d, 0x7b80929a, 0xa4758573, 0xaa7394a4, 0x91858862, 0x749d9cba, 0x949774cb, 0x9293665c,
+    0x7faf72a0, 0x7d929e8c, 0xb8989484, 0x8fa28173, 0x96997076, 0xafa76d91, 0xb79ba984, 0x717cca8a,
+    0x5daa985c, 0x6e87beaf, 0x9bb1a38f, 0x98758bb0, 0x8a767da7, 0x91666c9f, 0x6e6d97bd, 0x96d46c91,
+    0x8aafb4b7, 0xac865bc3, 0x905a699b, 0x7d78916b, 0x9f8f6778, 0x726d9d9b, 0x5a679e91, 0xc0bfc45a,
+    0x75bd8b7b, 0x878d8b92, 0x937e7da2, 0x8d8ea19c, 0x8899be6f, 0xbda8b496, 0x75b26c92, 0xa9827c98,
+    0xbc88b68c, 0xbb8a8b68, 0x81b063a2, 0x6962b498, 0x9ab2738d, 0x77926c98, 0x918b6c88, 0xaf5ea7ba,
+    0x9372a181, 0x857faec6, 0x8f8d958b, 0xae789eb0, 0xba728a69, 0x5d77a980, 0xa49b85ac, 0x767f8697,
+    0xab848872, 0x8f715da2, 0xa795a298, 0x7994c09b, 0xad788eb5, 0xb98fa38c, 0x7bc692b9, 0x7e9ea1a1,
+    0x8278598a, 0xa88e6695, 0xa5b799b1, 0xb4969c99, 0x929f589c, 0xacac86c5, 0xac7199a4, 0x96b87d6d,
+    0x85a48276, 0xadab8273, 0x8aaf6b8b, 0x5cada788, 0x77858a9d, 0x6c97b89c, 0x6569919e, 0xb16aa26b,
+    0x73827484, 0x907d73a4, 0x68849a76, 0x84708ba6, 0x8e70ba99, 0xb0b7b6cb, 0x7ea47cbd, 0xa46d7394,
+    0x9c728dad, 0x7b8e9c61, 0xb098ca71, 0x7b767361, 0x9b7aa3ba, 0xba7d9b9a, 0xb079779a, 0xa1a07ad1,
+    0x788e8eb9, 0xb476a3a5, 0x959baa7f, 0xbca488a5, 0x95978095, 0x7799a2a7, 0xad9f8aa3, 0x83ac9294,
+    0xb6b08479, 0x7a82a5b9, 0x72759c9f, 0x87899994, 0x74bfb0bb, 0xa9768b73, 0x989da490, 0x7ca79076,
+    0x8a77a377, 0xb0939dac, 0x9c86b3ae, 0xabb5b682, 0xa48a7f82, 0xb0bea690, 0x7281769f, 0xa4b09870,
+    0x90af7c82, 0x7f8d8bac, 0x6893966a, 0xb09da286, 0xa7a38f9f, 0x918e5265, 0x90a795a5, 0x9f9ed2b5,
+    0x828a5550, 0xd58aa3b8, 0x8094b687, 0x9e8dafb3, 0x72779d83, 0x883f9572, 0xaec051b5, 0x76c25c9a,
+    0x93939a77, 0x7d5c5761, 0x9ab290c5, 0x7f8ab684, 0x9a7d5d8d, 0x92973b60, 0xa890547c, 0x89a08f77,
+    0x8aa36d99, 0x99da898c, 0x9b97ae7f, 0x8fc7c69f, 0xc6769a8d, 0x99bdb197, 0xb27db69f, 0x926d98b8,
+    0x97819195, 0x8075768c, 0x6694a367, 0x7de47e9a, 0x7c8e8dbb, 0x79a86d8b, 0x7c9c884f, 0xd3a48ddd,
+    0x93b05991, 0x9383bb87, 0xbe848468, 0x7f818ab8, 0x9f6b8955, 0x8fb7634a, 0xc7869061, 0x8dbe9978,
+    0x80849659, 0x95888979, 0x9c708466, 0x778eac70, 0x82b18aad, 0x68566078, 0xa278606b, 0x8b8fa19b,
+    0xb5a2a23e, 0xadaba161, 0xcda4d051, 0x7b896ab7, 0x65799f75, 0x9eb68dbd, 0x957a65a6, 0x90697cbd,
+    0x736e5398, 0xb95e7d51, 0x6e7e6c9f, 0xa8699f75, 0x52718868, 0x77828462, 0x8c78727f, 0x65e78fb2,
+    0xa2c9a896, 0x7d9b929e, 0x4aa67f68, 0xc57b6475, 0xa981b291, 0x8857726e, 0x857b73b8, 0xd4b59875,
+    0x859a6c6b, 0x7894a251, 0x73a0969d, 0x71bb747b, 0x959bc35c, 0x9b7dab76, 0x9270749c, 0x3b905ca1,
+    0xb16e8170, 0x72ba438a, 0x967ea558, 0xbd7d6d91, 0x60b6b689, 0x8d8093a4, 0xc091968e, 0xb353936f,
+    0x43a1996f, 0x948b7e5e, 0x696e81b6, 0x6e5e776a, 0x86939a9d, 0xb9839289, 0x63b29075, 0x8b90aaaf,
+    0x6fc38a68, 0x9290baae, 0x7fb979a1, 0x77815176, 0x8cb0985c, 0x62aaa25d, 0x98a5a69b, 0x9bac988e,
+    0x4f9d9192, 0x7c868b78, 0x8e535a7c, 0x9c66ad91, 0x83b38062, 0x6e588995, 0xa14f869a, 0x75829499,
+    0x8e9bc38a, 0x827c666b, 0x8e9e8c6e, 0xa892928b, 0xb588b377, 0x69a69aa1, 0xc27b7a99, 0xae548360,
+    0x9e8a96a2, 0xd0acac87, 0x9996b198, 0xb3765088, 0x755db695, 0x8590957e, 0x5450b576, 0xac996e63,
+    0x9ac7af79, 0x86819795, 0x70957185, 0x71b95194, 0xb6928bbc, 0x6195c38b, 0xcb789a97, 0x7d937985,
+    0x8b936991, 0x759fae88, 0x974e9f88, 0x709d7095, 0x92c08a6d, 0x8e85b766, 0x7b865fb0, 0x797a3a79,
+    0x769c7876, 0x53634e71, 0x8c878796, 0x895e8ece, 0x9d8e7e8e, 0x81c76d76, 0x9e9b9987, 0x88c7c889,
+    0x897e8089, 0x685a897b, 0x75b55d8d, 0x8e326b9f, 0xba5fa895, 0xa6986997, 0x41a39f7e, 0x9b5f7897,
+    0x98768e71, 0xa9bca9a2, 0x9785a370, 0x817c3c94, 0x6fa597b1, 0x7198b6ab, 0x9e8d6d8a, 0x7f80b4a8,
+    0x4e68a0a2, 0xa490af87, 0xc66a3e4b, 0xd1a99972, 0x717bcb52, 0xcba0a783, 0x9d901f92, 0x9b3b4761,
+    0x92c9c78c, 0x7351689c, 0x7b917c91, 0x95775d6f, 0x786fb6b1, 0x86877f8b, 0x91adbd9d, 0xbeab8677,
+    0xbfae5f6e, 0xb69b92a4, 0x528162c9, 0x783f8d83, 0x5f548c7e, 0x84897a81, 0x4b7aa382, 0x90929760,
+    0x8a78ae79, 0xb4767d89, 0x587a7587, 0x4f8d93a7, 0xa4978b7e, 0x79dcc091, 0x7e97a26e, 0x8873879b,
+    0x139894b0, 0x808d87a9, 0x656d5478, 0x8ead60b7, 0x8e82665e, 0x9f7bc24a, 0xa79687ca, 0xa26f956a,
+    0x7ec28fb6, 0x8856a590, 0x716284a9, 0x89969d90, 0x808f64a7, 0xadae8185, 0x7b92a9d9, 0x9eb57c8f,
+    0xcda2c075, 0xab60adb2, 0x357382cd, 0xa83a4fab, 0x896d8b98, 0xc6a573b7, 0xa9957392, 0xb0507460,
+    0x76d295b6, 0x887b924f, 0x82b356ae, 0x8f7d857f, 0x79a8aa6f, 0x89b4c394, 0x78c17b87, 0xc434b3af,
+    0x537893bf, 0xc6907fa9, 0xa57b302d, 0xa1765c9d, 0x81c0965f, 0x98bfd385, 0xa8b264b7, 0x9b724d3e,
+    0x6488ad9a, 0x9a398985, 0xba90899d, 0x76879671, 0x9a6c8e89, 0x78a4689f, 0x3d8ea193, 0x7a99a0c1,
+    0xaf8e6f82, 0xc8a48fc5, 0x63a162d5, 0x712da361, 0x98bd958e, 0x8c965fba, 0x8a8daf91, 0x9e6a384e,
+    0x8ca1a889, 0x9f9f7c9b, 0x64a1936c, 0x8383b79b, 0x67b89164, 0x9bae89ca, 0x92cc5f98, 0xa12382b3,
+    0x80784f6f, 0x79b98a94, 0xa1888a52, 0x966f6773, 0x9b7b7077, 0xa29b835e, 0xaba73b78, 0x917a4d62,
+    0x6b5bb78c, 0x73529ec3, 0x7c8293ba, 0x8d488672, 0x8b6eccaa, 0xae838592, 0x739cd96d, 0x77ac8e8c,
+    0x6a7a7b93, 0x818caa8b, 0x41aa7a6e, 0x7a3b9965, 0x7aa2a369, 0x9a8d80b9, 0xacadd673, 0xac9b4641,
+    0x6ea1ac84, 0xb08b797d, 0xc1a895b1, 0x4aa1c3ae, 0x7d86a092, 0x928889af, 0x797ba696, 0x8963a18b,
+    0x848a8188, 0xc07aa8ac, 0xa19e6195, 0xa5989a74, 0xb38cb88e, 0xa2ce838a, 0x6e7db995, 0xc37a645c,
+    0x5f568296, 0xbb368a6f, 0x667c6c99, 0x6e72a675, 0xb9749f8f, 0xac74739b, 0x839c6e7d, 0x9fac8d73,
+    0x9bad9251, 0x8d8fd792, 0x4d977b7b, 0x44567282, 0xa29caf89, 0x8180c7b8, 0xca81c9c6, 0x9a848862,
+    0x89bcb6a2, 0x8da1a5b9, 0x6db487d7, 0x838fc8ae, 0xaac0bda3, 0x9c8f8c85, 0x91a272a1, 0x758f74d1,
+    0x58aaafbc, 0x9c7392a3, 0x797b788e, 0xaf9b8e6e, 0xa7ab835f, 0xc0b148ad, 0x9b9cb46f, 0x9b8d4b7d,
+    0x98836aab, 0xac6d9cba, 0x8ca87487, 0x734e7187, 0x955dacb4, 0xa3838794, 0x6ea9b88e, 0xae8d8c7b,
+    0x9d794987, 0x738db885, 0x5c825d6d, 0x5882a163, 0x8bafa294, 0x9fac9d8f, 0x8ca4b7c4, 0x949b94a6,
+    0x659f827a, 0x955ca27a, 0x83c87e91, 0x635aa19c, 0xbaa1dd69, 0x847b889f, 0x966bcba1, 0x638ac0b7,
+    0x61afbb8f, 0x85878189, 0xafb06460, 0x9b939583, 0xa4ba6c86, 0xd3a07aac, 0xc79db884, 0xa8ae6f8e,
+    0x96458ea1, 0xbf619cc3, 0x65778597, 0x664682ad, 0xa2947589, 0x8abbc8a1, 0x648b8d5f, 0x7ca2c478,
+    0x9aa87c8a, 0x6ba49175, 0x8a64aa60, 0x6f807164, 0xa2b6b389, 0x8de39973, 0x8b83b862, 0x92906d81,
+    0x87b93f73, 0x8fb58f92, 0x7e7d82a1, 0xa38e9e9f, 0xb3a1b2b9, 0x889d8970, 0x828ca39b, 0x998e929a,
+    0xa0878fb0, 0x9bb79699, 0x8a7b9286, 0x767aa2af, 0x9d88a563, 0xb679a27a, 0x9e8f9b98, 0x89b0597f,
+    0x61665ca0, 0x9b7c9e86, 0x83809a99, 0x9d5bb5bb, 0x81b2a27c, 0x85d89fc0, 0x869d9e86, 0x91859199,
+    0xb4a96fb5, 0x9285b6a1, 0x90aeab92, 0xba6f9888, 0xbf87c48c, 0xa6c76d7f, 0xaa936cbc, 0xa2908061,
+    0x459f529e, 0x8aa9806d, 0x9f969047, 0x8f938284, 0xab60b977, 0x61a5799b, 0x9ab589a6, 0x72a0a3b1,
+    0x7798b48a, 0x97bf8e7e, 0x8b998082, 0x8fbc8771, 0x8a9f9f98, 0x726e7db2, 0x989d72b8, 0x9c58a8a5,
+    0x8592a35e, 0x6e6d69a9, 0x7d7e897f, 0x81a75d9c, 0x7e7c907f, 0xb160bd7c, 0x9a84728d, 0x937769a3,
+    0x5ea570a0, 0x56b0a9a8, 0x5164a08a, 0x827d979f, 0x7a998d72, 0x6bd2b895, 0x5ca597a0, 0x9bb47f5e,
+    0xabbb6c95, 0x7e6b859d, 0xa35b753e, 0x9a94886f, 0x757da98c, 0xb5b6946f, 0xb8bdc38c, 0x867e6a9b,
+    0xa192c187, 0x79686696, 0x98be959b, 0xaf68b78a, 0x86b4907b, 0xb16853a5, 0xaa6db1a5, 0x977d809c,
+    0x8ac69184, 0x90a5a795, 0xa674b7b6, 0x7aaf867e, 0x6150a470, 0x8693a29b, 0xc488ad5b, 0xb7868fac,
+    0xa56c9c87, 0x6dae6fb6, 0x6a86a380, 0xb1a9af90, 0xb4728e91, 0x879da268, 0x70bf8490, 0xaf977c6d,
+    0x7688a2b0, 0x87619e86, 0x9b7f7d89, 0xb4737b58, 0x8f6bb68e, 0x5f63b98b, 0xc49c9db1, 0x7db25f91,
+    0xb3976d88, 0xb1bbbca6, 0x977daa96, 0x9f938cad, 0xb4699e88, 0x69769fa2, 0xb389aba1, 0x6660a2b2,
+    0xa995768d, 0x86949daa, 0xb35a5449, 0xad959d82, 0x695a9187, 0x848bc16a, 0x7896a89a, 0x7c7e79ac,
+    0x95aab496, 0x95868b5e, 0x8597ab73, 0x789ea5ae, 0x919e9894, 0x6d787177, 0xac5b7a64, 0xae9a76aa,
+    0x72727bb4, 0x6f6685ae, 0xb6729963, 0x869975a4, 0x8b82966f, 0x80bba183, 0x8c85a9a2, 0x6d96a68f,
+    0xaea98092, 0x94726d7e, 0x8ca9bfc9, 0xa0af9a82, 0x9c93a884, 0x957e8596, 0x8a6e54a9, 0x8582b08d,
+    0x6a83bbac, 0x8fa57698, 0x738ab584, 0x7db09d73, 0x8c6ec56e, 0x9a92897e, 0xa4af9c9f, 0x7faa6e8b,
+    0xaa80b190, 0x8d8abc7d, 0xaa8d8f76, 0x68a79f96, 0x84c6a6b1, 0x6f9fb081, 0x8b674e5b, 0x9d9d9f8c,
+    0xb3836b92, 0x957aaebb, 0x86857f72, 0xb19ba894, 0x7e8b97d6, 0x3c9d7389, 0xaab352a0, 0xa89682c5,
+    0xb3729181, 0xbb769380, 0x7ca79cbc, 0x66a8ba84, 0xa2cb9c87, 0x8c82606c, 0xa36fa1d3, 0x859e8ca3,
+    0x63919265, 0xcebd8293, 0x66b1aa74, 0x84799099, 0x65796da0, 0x8467a3b2, 0x8a658c6c, 0x87818470,
+    0x8aadbf87, 0x6fa9a298, 0xa78776b9, 0xa29d8364, 0x83a2a284, 0x86747882, 0xa78d8b85, 0x7e75ad82,
+    0x88808a78, 0x628a85a8, 0x89747d9d, 0xa7847e8b, 0x7486bfaf, 0x62c76a53, 0xa1a3786c, 0x847b6f92,
+    0xb07a5c7f, 0xb8665eaa, 0xb258a39c, 0x597fa992, 0x9b8e86b4, 0x95a69593, 0x8c7c81a1, 0xa690c877,
+    0x84ab67b3, 0x89ab9b68, 0x73a57a74, 0x7c8ac9b4, 0x7d9f949a, 0xc751bf95, 0x647fad62, 0x937da3aa,
+    0xaa83b8ad, 0x8c818c95, 0xc3cb648e, 0x80cb6ca6, 0x7a867ea6, 0x75adac91, 0xc790946f, 0x84749492,
+    0xa2985380, 0x93ae89c0, 0xae70b675, 0x7da97b70, 0x70aa7b8d, 0x9a648aa3, 0xbb969c67, 0x768d7e95,
+    0x9d6271b7, 0x7091874f, 0x5490c884, 0x717c76a7, 0x8a9c8a9d, 0x773e9385, 0xc0856292, 0x789f868a,
+    0x9382cc81, 0x4faa58a9, 0x50a18b72, 0x94958b92, 0x8bb0b28a, 0x859e9c79, 0x82b4afa5, 0x504facba,
+    0x81b88159, 0xb6699b99, 0xe3839eb0, 0x66926194, 0x9e73aac9, 0x62716b55, 0x8b6c8b70, 0x89657f96,
+    0x8ea36a8b, 0x914d89bf, 0x9686d483, 0x8a97a496, 0x71c5a2bd, 0x75b48881, 0xb1799c66, 0x9846877c,
+    0x937a798d, 0x64a56d54, 0x977b87c9, 0x5fb38cc7, 0x57d45a77, 0x7680608f, 0x94906553, 0x97bdcf9b,
+    0x7bb09f77, 0x92a4a56a, 0xab8bb275, 0x82a77074, 0x6a9c9b7f, 0xaa7174c2, 0x7c998da4, 0x7cafad74,
+    0x8249735a, 0x99889485, 0x92988866, 0x98bb81db, 0xb6667d48, 0x89a0689d, 0x546e9964, 0xab968fbe,
+    0xbeb9897f, 0x8b6b9db7, 0xc975b494, 0x91a59ac8, 0xa47ab4d5, 0x88a47c5c, 0x838c6b8c, 0x90589490,
+    0x4c817eb1, 0x83728890, 0x698342a2, 0x6b5f9778, 0x63b0816e, 0x889584b1, 0x9b775c71, 0x70686394,
+    0x937daea4, 0x7591774b, 0x697f7f7d, 0xa9c8be8c, 0x67aedb48, 0xb3779e8c, 0x92ca6a78, 0x6aaa9f57,
+    0x7694796b, 0xa7988085, 0x6f70ac8a, 0x995ca394, 0xd05da698, 0xa2566eb0, 0x7293c849, 0x8e6fb0a9,
+    0x85965367, 0x8297b5d0, 0xbd646f9e, 0x7986699e, 0xaa61b4a8, 0xb05f616b, 0xa1b5859e, 0x8a608d69,
+    0x758a6285, 0x9889846a, 0x846f5c61, 0x60698b6f, 0x84f29c7e, 0xb992bb83, 0xcc75b285, 0x527c8549,
+    0x749ebdb0, 0x847a588b, 0x9155676e, 0x6177946a, 0x928eed65, 0x8d8d9dcf, 0x6bc6cd9e, 0x7ecb9675,
+    0x5b577c80, 0xd3a67a8d, 0x7a5a6063, 0x9882a481, 0xb64cc287, 0x836991cf, 0x5b6dbdbe, 0xc9c889aa,
+    0x70db79a5, 0xb08ec1aa, 0xc1bd7a6c, 0x6b956c6f, 0x70b2a285, 0x92709658, 0xa7c39ea5, 0x6e8c8eb5,
+    0x6c827690, 0xb26a977c, 0x7f8fa298, 0x918654b7, 0x64cca47b, 0x65779ea4, 0x8398ad7d, 0x59c079ac,
+    0x627b9f5d, 0x7648b286, 0x74948165, 0xa5956eb7, 0x7f9c818c, 0xc5c88c7a, 0xa6c4ba60, 0x9aa76c71,
+    0xa9a28489, 0xaac06a86, 0x779f766c, 0x8759557a, 0x8b72d7ac, 0x938993cf, 0x785ca18b, 0x71b29666,
+    0x4dcbbd8b, 0xa7cd9ad4, 0x8b94809a, 0x5b5188a1, 0x91a7ca86, 0x6a768297, 0xb674aaa6, 0xc7aa7391,
+    0x9a619c8b, 0x997c8e82, 0xa589b19e, 0x7978837d, 0x99c17ab5, 0x9fc9988b, 0xa7bbcc51, 0x6e8094b5,
+    0xb8a1b990, 0x739dacb9, 0x64938b81, 0x82894fb3, 0x8372b797, 0xacbc68b0, 0x8cb98d8c, 0xa17c898c,
+    0x7d72a084, 0x84938f83, 0x7979abb6, 0x8ab485a4, 0xaf83c27e, 0x8c74b990, 0x9c80c176, 0x9da2b98f,
+    0x7d7e6da3, 0xb39a92a0, 0x8ba9a8ad, 0xb275c498, 0x888daaac, 0xad93978b, 0x97af8984, 0x817d727a,
+    0x9d798e9e, 0x7baac98a, 0xb3537187, 0x89aab991, 0x7b87a590, 0x89738c8a, 0x7a96a860, 0x8d7c7f7e,
+    0xa879557c, 0x6f88647b, 0x8d9b5bb4, 0xa9796588, 0x7a9a7b8e, 0x838d5467, 0xca8fbcc5, 0x69718594,
+    0x649caf99, 0x85727e68, 0xd0a791a3, 0xa795818d, 0xc261949b, 0xaf807491, 0x956ea56e, 0x7f9395ba,
+    0x9d9c6e65, 0x7aa0828f, 0x5fc06458, 0xad548cb2, 0xa48c679e, 0x939ba26f, 0x8871c6ba, 0x72aaa6bc,
+    0x698a8cb9, 0xa29ea495, 0xc7d4819f, 0xa78499a4, 0x81b28b73, 0xb07ab879, 0xbd938cb0, 0xac91c49c,
+    0x8cc598c2, 0x8b937984, 0xa97e978d, 0x83aba6a0, 0xa8b091b4, 0x9b84927b, 0x7aa56f8e, 0x5a798a72,
+    0x97c0a5b2, 0xa97469ac, 0xa5738091, 0x6ea16896, 0xa09e84a9, 0x7374b264, 0x9664bd8b, 0x7877bfa9,
+    0x90c679be, 0xc5927aa9, 0xa0a69b5f, 0x99b458ba, 0x76a48f7a, 0x9c7a4bbb, 0xbd8d7081, 0x869f718a,
+    0xa09a93a0, 0x7da99592, 0x81b1d37d, 0x5191948d, 0x5cb38d91, 0xa35e928f, 0x6f52b0a9, 0x7c8bc793,
+    0x848352b6, 0xb3adae71, 0xd25a8da9, 0xac95a86e, 0x7b9b8c5c, 0x858ca983, 0x9c866060, 0xb06f839d,
+    0x6c9055bb, 0x969b68aa, 0xab9d6797, 0x8dbd9a69, 0x66ab62c0, 0x99976845, 0x7394a37c, 0x819daed1,
+    0x9b585373, 0xba7c84a5, 0xa0a1915f, 0xdf7abc54, 0x7b7b85bd, 0x7bab9c7a, 0x98a38e9e, 0xa1c869a2,
+    0x968d896f, 0x6c6694a6, 0x8bd2a2be, 0x916bca80, 0xae7f96db, 0x8ea567aa, 0xd65e706b, 0x76a0bf9d,
+    0x7d6ccb95, 0x80da884a, 0x9d75e356, 0x857fad90, 0x8e9da372, 0xb5a1b0b1, 0x599f8d5d, 0xc768a696,
+    0x899852a8, 0x49b85c5c, 0x98527a74, 0x83abb183, 0x8b7dc8bf, 0x5aa98577, 0x9e7a7d65, 0xb5a4bad5,
+    0x99918f6b, 0xd77271a8, 0xa5b4b78a, 0xa6b3457c, 0x639bb49c, 0xa1607b2f, 0x96a77995, 0xbda17579,
+    0xc793856b, 0xacb24a57, 0x6a72a391, 0x7666b5a0, 0xaa848388, 0x977f7a90, 0xc56c50a9, 0x3c5e8bb8,
+    0x58a8a193, 0xa08b7f9b, 0xe5987857, 0xb39a9dac, 0x8063b479, 0x80c79c7d, 0xa97b527c, 0x88769d8d,
+    0x5b70816b, 0x73a88c83, 0x9a847582, 0x91af9f9c, 0x3d759388, 0x9ba49d69, 0x73b4aa8a, 0x97d158a0,
+    0xa860865d, 0x96689e78, 0x8b71959d, 0x787c5b86, 0x7e84c284, 0xbf5c8b74, 0x987a6abd, 0xc69ac06b,
+    0x8893699e, 0x927548a1, 0x8e639b7f, 0x9f868877, 0x9fb381b3, 0xa595929d, 0x8e778466, 0x805476d4,
+    0x848e9c78, 0x8aab6b76, 0xb08fb66e, 0x988f808e, 0xb377b380, 0xa8b4888f, 0x85a4859c, 0x7c408399,
+    0x7db4b78e, 0x8b787483, 0x638a858c, 0x6cb1bec1, 0x78369f9a, 0x7da98f83, 0xae95c437, 0xb69dadd2,
+    0x968aa779, 0x907ba498, 0x8c917992, 0x70866b9d, 0x9e7da68a, 0x88735a86, 0xc5b06f75, 0xabb7be6e,
+    0x96a26987, 0x53ae8b50, 0x9c5fb898, 0x877fb5b0, 0x5da6a57f, 0x6b6d8680, 0x819a8d89, 0x5fa26aa1,
+    0x8eaf6a67, 0x7e7e7078, 0xae77b566, 0x89b5a581, 0x577da47b, 0x798cb7bb, 0x99aca37e, 0x7483969b,
+    0x7b598a69, 0x6a698f54, 0xa5799bb3, 0xa7aeb3af, 0x637b80a3, 0x7573af81, 0xc96ea992, 0x967e6d82,
+    0x8a8e798d, 0x82a0c989, 0x9a9d9153, 0x80708055, 0x7cb8b884, 0x9f909d9a, 0x78ce8aba, 0x97a0b570,
+    0x72834cb8, 0x96918768, 0x7548a067, 0x8a916e8a, 0x938fbd8c, 0x908890b7, 0xcd7661a9, 0xab6b4b9e,
+    0x8fb79f6b, 0x74a5a47c, 0xa5cf887b, 0x874d796e, 0x6ba4ccae, 0xb3a9a8c3, 0xa69c6eaa, 0x93636e83,
+    0x4c8dcaa4, 0xa957856f, 0xaa8d7c83, 0xab7fa06f, 0xb19baa48, 0xb49b629f, 0x4a947c9e, 0x8eb8647d,
+    0xa476a2be, 0xa4a9a670, 0xa9b4af6a, 0x9fa14f79, 0x8a86947a, 0x9a707571, 0x83827596, 0x9c8aa8c3,
+    0x77c67bb6, 0xa5ba68b8, 0x7b677450, 0x5fa49193, 0x6f8ec079, 0x5d9a9355, 0x9f8d4db8, 0xba7b5d84,
+    0xb9818470, 0x7b706a9b, 0xa3bb9265, 0x8e8b8ca2, 0x694bb3b0, 0x7cb77687, 0xa18ca890, 0x71afb663,
+    0x95797691, 0xca9ab6be, 0x888c428c, 0x83679791, 0xa2acba53, 0x6eb68789, 0x75829d90, 0xaf969a7c,
+    0x68baae56, 0x9b739d9f, 0x9a855ac1, 0xa185ac63, 0x41bb8a5c, 0x89959d8c, 0x8ec05e8c, 0x9faea7ce,
+    0x12bf5e99, 0x9fb3aaa0, 0x7a25a33a, 0x7d848997, 0xa3b67b3d, 0x869a9f7d, 0x808e6ba6, 0x66ab3561,
+    0x7ecbc964, 0x787a5c9e, 0x84af80a0, 0x7a5f77a2, 0x766da7a9, 0x6fc0bd93, 0x73abb481, 0x5ace7678,
+    0xa58fc19c, 0x8467a6b8, 0x8e848197, 0x773da7a1, 0x968cbe4f, 0x6a90966d, 0x62a19c89, 0xa494478b,
+    0x8eb98688, 0x85898969, 0x55b88388, 0x8e82bfa4, 0x97db837c, 0x907ca4a3, 0x8dbf87aa, 0x7b6da0c2,
+    0x4bac658e, 0xa7915c97, 0xa06d7263, 0xb05b83a7, 0x7581ba6a, 0xa281b4b3, 0x90d37797, 0xa28c4955,
+    0x8384d096, 0x70518473, 0x84ca92c2, 0x3363b0bc, 0x818ec0df, 0x859090cc, 0x93b7c791, 0x67877c8e,
+    0x95839992, 0xec7c8b8c, 0x59a664bb, 0x9d3b8572, 0xaca56c55, 0x8055b8be, 0x94cd7bac, 0xb2aa6aa1,
+    0x61999e74, 0x8e689794, 0x9a957da5, 0x6c7cbb82, 0x919b5795, 0x999a8b95, 0x4d7e85b2, 0x9a9187a0,
+    0x17608493, 0x847c8ccc, 0x6a877e37, 0xa28b677d, 0xb0a45f55, 0x79a4bea2, 0xab998685, 0xa9811e97,
+    0x9187969a, 0x6c6e827c, 0xc79972bd, 0x987ba886, 0x6ea07488, 0x8fd3a079, 0xa5b1a491, 0x91de918c,
+    0x9d76927b, 0x82b8bebc, 0x78d86a85, 0xb7726897, 0xc382897a, 0x7b8a6eb3, 0x8f7ab0a1, 0x678c7b7d,
+    0x5d96c784, 0xa3918c59, 0x91ac4897, 0x7f8ea5a0, 0x7596a15e, 0x7a629ac4, 0x86c083a1, 0xa549918e,
+    0x499e6687, 0x7f6794a4, 0xa3666c43, 0x54ae7072, 0x96a19497, 0xc6c04eaa, 0x957bb275, 0x93b8424a,
+    0x8168a7ac, 0x4b31789f, 0xb3928c76, 0x518a9384, 0xac84887c, 0x69ba6e8d, 0x649b6277, 0x8ebfc8a5,
+    0xb6738a8c, 0x9a959176, 0x6790a85d, 0x6a3783ab, 0x83b79080, 0xbb888eb2, 0x63b7a9c1, 0xa59b3161,
+    0x6b8b506f, 0x7f898494, 0x7aa46db3, 0x6a9f9e8f, 0xbf849d96, 0x6f9c8ea3, 0x6cac97cd, 0x85608291,
+    0x798fcb75, 0xb7968985, 0x88508060, 0x989d63ab, 0xb4b98d79, 0x88a46473, 0x7f96b6ae, 0xbdc06247,
+    0x816c8d7e, 0x64557a74, 0xadc085b9, 0x93607eb0, 0xb88fc3a5, 0xc5aa9e93, 0x8d519282, 0x96a0b779,
+    0x919596ae, 0x5c988584, 0x66b5cb4c, 0x6a8a62a8, 0x81bbbb74, 0x9796a288, 0x9578ad7a, 0xb8909d7c,
+    0x4dad77c0, 0xa38b64a6, 0x74c1996a, 0x6c7298b2, 0x96799faa, 0x8b9c869c, 0x76956ca6, 0x67965d97,
+    0x8fbbb68f, 0x95928b7f, 0x55734951, 0x8e80856b, 0x88b3b254, 0xb5a76b7c, 0xb38cb19b, 0x7f8442a7,
+    0xab6c8588, 0x7b77999f, 0x796b8081, 0x7f506495, 0x7ea38a76, 0x8ca29c88, 0x8b756d9d, 0x96599677,
+    0x83825a8e, 0x7c4ca046, 0x9872c66b, 0x6f58b554, 0xb6a89e7b, 0xb0ac5b89, 0xa2729e8c, 0x88b76172,
+    0x78a14aa2, 0x609ea976, 0x8d977974, 0x80867dc0, 0x73b3ac7b, 0x7d91729b, 0xae86a380, 0xa09696cd,
+    0x8da58f73, 0x80a27995, 0xad979f9e, 0x728da789, 0x80aea0a9, 0x8172b7a2, 0x9286bc8e, 0xad7f6599,
+    0x806b79af, 0xb16e92b2, 0x9d9e7990, 0x7d8a66b3, 0x699978b3, 0x6fa5b19d, 0xce797b74, 0x8353b074,
+    0xb9b1528e, 0xa3b87484, 0x958a968f, 0x64a26883, 0x999c9fa0, 0xb7b78b93, 0xb19b9490, 0x82a05d74,
+    0x9268716e, 0x6e68a9a3, 0x9f788233, 0x8979a182, 0x5e958e88, 0xa4785d8b, 0xcb96a47e, 0xae93bb8f,
+    0x7ba47176, 0xc89f907f, 0x82baa27d, 0xb791808d, 0xbaae7193, 0x9d8a7879, 0xbb588493, 0x675c987f,
+    0x8366a19d, 0xa3b88d9a, 0x986a858e, 0x9963798f, 0x9da2c4a0, 0xbd80c8b3, 0x7f7fac83, 0xa07899b6,
+    0xa5b6ba88, 0x7e7a9697, 0x809e7eb6, 0x89a9846f, 0x9c989d86, 0xc3b0a3ae, 0x989e9767, 0xc48896b1,
+    0xa888787d, 0xa4898abd, 0x797b8043, 0x84b16791, 0x7eafa589, 0x888fcd77, 0x97969e80, 0xa99b7b9d,
+    0xa39069a0, 0x858788ab, 0x9e8374b1, 0x6287cbaf, 0x6f837a9b, 0x7c6dc399, 0x6f937496, 0xa26c6b81,
+    0x928e9d8b, 0x8b977456, 0x8071c185, 0x8790afad, 0x6b7788a8, 0xb2856686, 0xa375ab96, 0x5f7f8473,
+    0xa284ae99, 0x73846992, 0x8a867a88, 0xd0a78476, 0x9db480a5, 0xb96d9970, 0x928e8bae, 0x8fa495cf,
+    0x8187af93, 0xb47363a0, 0xbc5fb960, 0x79869c78, 0x604b97af, 0x6a8a657a, 0xaa86686e, 0x94a1bbb5,
+    0x9891878f, 0xc3ae88a3, 0x9897a29b, 0x69ab889f, 0xa2b98990, 0x9c7eb17e, 0x93b47bb5, 0x8b857e7d,
+    0x6889ac6d, 0xb09b74a9, 0x8b8a8190, 0x799cabb2, 0x7766a78c, 0xb266b58a, 0xba65999c, 0x768a907e,
+    0xac889673, 0xac78a291, 0xc0ae9aaf, 0x9694a3b4, 0x95b46d8c, 0x9ba079bb, 0xa687988f, 0xa090af73,
+    0x6f5ea2a1, 0x7159acbe, 0xb15e8877, 0xbdb79e8e, 0x71879c5f, 0x8d9a8f97, 0xaeac7f8a, 0x83c155bf,
+    0xbc746c9c, 0xb26f6d8f, 0xb5a57983, 0xa67f89b9, 0x7b86877f, 0xb878a592, 0x7a767c89, 0x906c9eb1,
+    0x8b8e988e, 0xb2b47171, 0x9b9a9691, 0xb471a788, 0x93589386, 0x7f9d8866, 0x87587982, 0x868383a3,
+    0x8f879aaf, 0xa8858996, 0x8a879a95, 0xb5acbd92, 0xb78d9888, 0x836d837c, 0x6ca2b884, 0xd1a26caf,
+    0x9d7c7c8b, 0x997883b6, 0x9b46a782, 0x998baf7e, 0x8889cd6e, 0x7185bbb4, 0x70587570, 0x9ba65f75,
+    0x976d9583, 0x8fc76a9c, 0x96aa8e99, 0x89878482, 0x806866ab, 0xa0998b93, 0x867785a1, 0xabb19ba5,
+    0x81b8a5aa, 0x7ea0816d, 0x69c08c69, 0x847ba2cb, 0x6ca5b3bf, 0x859898b7, 0x7355aab8, 0x60a09196,
+    0x77b48b86, 0x9d82786b, 0x739c7484, 0x82c5cf62, 0xab79bc9a, 0x5cbfa8a4, 0x8e91887f, 0x959f9fcd,
+    0x8d818663, 0xa48caf97, 0x858f7698, 0x858e8580, 0xa07585a6, 0x5e709ea0, 0xbf7140a8, 0x83a054b0,
+    0x808680b0, 0xa0847c99, 0x6863aca3, 0x79a26f66, 0x868e68a1, 0x879bcf78, 0x94697f68, 0x878faf8a,
+    0x7d77be8e, 0x897d7b7d, 0xb5a28086, 0xca9ba898, 0xb3cf9a85, 0x8d7dbebf, 0x66a79470, 0x86c0ae7a,
+    0x94779d72, 0x82617f7b, 0xbf557c78, 0xaa79bf78, 0x947a7ea8, 0x688a7188, 0x8c90a781, 0xc78dbd8a,
+    0xb491ae8f, 0x97638776, 0xa48e887a, 0x8b889a55, 0x6785bf85, 0x71697f77, 0xc18a6bbe, 0x976b6da4,
+    0x7e895768, 0x90a36c7b, 0x95848c87, 0x60a877bb, 0x7ba87489, 0xb0859d9f, 0x85577fa5, 0x894fc2b4,
+    0x73848672, 0x8571a77c, 0xbca0b259, 0x84cc9e9e, 0x628ebe8a, 0xc267a1b1, 0x89bab658, 0xadb0985f,
+    0xa4639484, 0x8d839482, 0x8d9d3a83, 0xa1afa8bf, 0x9f50925f, 0x8b9368ac, 0xb4a0beb3, 0xbd6bbf92,
+    0x71798b94, 0xd181d5c5, 0x899f7c8a, 0xb175565e, 0x78a2c8c1, 0xb475764e, 0xb18f4eb4, 0x653d80b3,
+    0x8fb17995, 0x737e895f, 0x706c5b8f, 0x7661ae9e, 0x9cde7761, 0x8f877d76, 0xb1538aaa, 0x9d5bc36e,
+    0xa492b079, 0x3a5c9cb0, 0x588d9486, 0xac95c8a1, 0x92acb667, 0xa0ae658c, 0x5795b293, 0x73ac9585,
+    0x7753a942, 0x8e793e55, 0x8e8d7355, 0x5a6b45b4, 0x6b41823d, 0x9b965aa0, 0x80739745, 0x96827b79,
+    0x9baa7e4a, 0xb19eb876, 0xa29e9090, 0x7a7ba36d, 0x6051e97f, 0x7b629587, 0xb8b247bb, 0x76698f98,
+    0x7472729d, 0xb67c3d97, 0x7c6a878c, 0x6c9b8a6a, 0x6ead5470, 0xb7b0a37c, 0xb7726b5a, 0x648f907a,
+    0x7c8f9da4, 0x6c949d9a, 0x79678480, 0x885b80a6, 0x9fa2bc70, 0xcd8c65df, 0x75c47c92, 0x868b9f63,
+    0xa0888b6c, 0xa648577e, 0x8178686b, 0xbb7584a7, 0x994db58e, 0x77867e91, 0x57979a5b, 0xa8b9999c,
+    0xacc48393, 0x9192f2c5, 0xafbf9280, 0x9b849ea1, 0xa64bb2a6, 0x5b769879, 0xa7b2739d, 0xa68e979b,
+    0x645c6791, 0xa585886e, 0x695e5d61, 0x6f6a756f, 0x73ce587c, 0x78955099, 0x798ca383, 0x58b449a6,
+    0x92a7b15b, 0x73494c5f, 0x90778281, 0x9faa94ae, 0x5e7ced83, 0xafc5c3a9, 0x62ccb491, 0x83b4a37b,
+    0x6ea3b57e, 0xce6461a1, 0x7e9d6eb1, 0x8b72558e, 0xaf8cd498, 0xd784adb8, 0x777bae56, 0x8fa28e93,
+    0x609f979d, 0xb99b80c4, 0x74949087, 0x7e8a7179, 0x5c51b5aa, 0x988e928e, 0xa2b3a3b8, 0x7a558471,
+    0x9c90a8a8, 0x56c9708e, 0x9d7868a4, 0xa27f6a83, 0x9a97ba61, 0x76677991, 0x888a8fa6, 0x7684809e,
+    0x7ca9a9aa, 0x7b659f85, 0xb58d6490, 0x9a7c9990, 0x7ba2cd79, 0x86ada381, 0x907a8b63, 0x659b65b2,
+    0x57ad4e77, 0xa08e9a86, 0x999daadd, 0x71a3b5b2, 0xabc5cb89, 0xbd8c8cc2, 0x77709fab, 0xcba98a70,
+    0x76b1bea1, 0x969a918c, 0xa8759890, 0xb479b47c, 0xaa76a083, 0x8f808a69, 0x6fada861, 0x8f6a7698,
+    0x5ab295a7, 0x7f6ac85e, 0x9071965d, 0x77c2ab91, 0xa193888d, 0x79737ca7, 0x9875c7b9, 0x81a9807c,
+    0x9f5ea7ab, 0xaa79a298, 0xa9b9a97d, 0x826b6696, 0x8491918b, 0xaa9570a1, 0xb2bd72b6, 0x8e916a85,
+    0xa6928f9b, 0x9ac68d89, 0x727d5d8a, 0xc07794a5, 0xa7b8a68a, 0xab949fb4, 0x697788a1, 0x7c9f83a8,
+    0x6abd927d, 0x6b70b173, 0x9ba68567, 0xa29ea7bc, 0x9c9dbf9b, 0xb8929572, 0xb3a89d7a, 0xb2cc9b9b,
+    0x7e8d82b0, 0xba7c8457, 0x7472908d, 0x778f6f73, 0x88818e8b, 0x85aa7d95, 0x90a68699, 0xa0797199,
+    0x777ecc9d, 0xb38daa8a, 0x9d826b9c, 0x80cc848c, 0xa39f9cb6, 0x7ca5907b, 0x90718993, 0x8cbd76c2,
+    0x96999b63, 0xc2a67670, 0x85a65898, 0xa7b8b25c, 0x9d65b69f, 0x6f81b8a1, 0x55b66ccd, 0x80af849d,
+    0x9ca79262, 0x84925d93, 0x7e96b1b3, 0x749dabb8, 0xbaa367b1, 0x7ca7979b, 0x62729990, 0x9b869f8b,
+    0x9783ac7e, 0x788dca7d, 0x8ea87d79, 0xc163a79c, 0x6f7c64b0, 0x718670ca, 0x858eaa69, 0xa060a070,
+    0x849cb49d, 0x90938561, 0x95a09951, 0x88887984, 0xb97d6eba, 0x6e8ba178, 0xbf5fc98b, 0x5ca5b289,
+    0x6a737c87, 0x63abbe8d, 0x7677b09d, 0xa36f8886, 0x7b50b88c, 0x95a6c45d, 0x8d898c8f, 0xab96917d,
+    0x99828e78, 0xb49d74aa, 0x74717eb1, 0x887b818c, 0xa4778c89, 0xad6a8699, 0xb85b9a59, 0x5ea259b6,
+    0x6d66ada8, 0x8099c079, 0x578ca995, 0x946c8fa3, 0x75ad6a98, 0x61bb86b2, 0x7f717d72, 0x9d86afbe,
+    0x7077818b, 0xaebaafcc, 0xc281be5e, 0xb99e818d, 0x60ac91b2, 0xa5b3867e, 0x525f5194, 0x8a579d55,
+    0x938a87b5, 0x7a817d63, 0x7a87a560, 0x96a76cab, 0xb2838bcc, 0x97778a51, 0xbca95391, 0x8483ca8c,
+    0x8e6d7f87, 0x7f8c77b0, 0xab77c56a, 0x767d616c, 0x976db3a8, 0x8579858e, 0xb1b878bf, 0xa2a35a81,
+    0xd768b990, 0xa07c4c9f, 0x7fb5a8c8, 0x588dbf7f, 0xa39178a9, 0x7a8547a1, 0xb4637a67, 0x8bb09cc5,
+    0x66aa9790, 0x8ecc5e6e, 0xc09ca783, 0x93bba56a, 0x6192a45d, 0xdca664a4, 0x925ec34a, 0x7c7d9c82,
+    0xac9f9368, 0x76808da6, 0xb8629aa6, 0x95bd7f8c, 0x9b75838f, 0x9a7573ae, 0x7a7f5f83, 0xacb6ccea,
+    0x8d80738d, 0xbb91af7b, 0x91897b81, 0xc3aa848d, 0x665caaae, 0x4b809e6d, 0xbb7da1a6, 0x8699a164,
+    0x9fa78f66, 0x927586a3, 0xa1987d74, 0x7d79b978, 0x7d9177bf, 0x745ba7ad, 0x87736f91, 0x4c9f5b7f,
+    0xb194a592, 0x76879495, 0xacb8b980, 0x8a8da294, 0xa48ec76c, 0xaabf9bae, 0x93826794, 0x7aa980a4,
+    0x686c7486, 0x6457a656, 0x9a8aae76, 0x98b8b453, 0x5f6497bc, 0x938f8b73, 0x9b857c3f, 0xabdb81ba,
+    0xce83ad8c, 0x99748877, 0xe046c583, 0x8e8b5c72, 0x5baebeb3, 0x767c6671, 0x8f89669d, 0xada29388,
+    0xad85707e, 0x845b857d, 0xaa5c8285, 0x3e919562, 0x89758071, 0x9d65826c, 0x8d5466c2, 0x77856ac6,
+    0x9a9461b9, 0x8f7678a6, 0x74c29f8b, 0xa486a298, 0x8684a686, 0x978c6da8, 0xad877a92, 0x5e6f88af,
+    0xaa6595a1, 0x7a4c8946, 0x8875648a, 0x6b8a948f, 0x8b739595, 0x8e9b7269, 0x7578a14a, 0xac9c98a9,
+    0x818ea78d, 0xada691bb, 0x8c85a34d, 0x85803356, 0x557080a0, 0xbe6b80a3, 0xaa86ac74, 0x9f9ba6a7,
+    0xd6b551c3, 0x936b8499, 0xa97db46a, 0x6e72935e, 0x767c7c60, 0x74625c5e, 0xb76a768c, 0x869b76dc,
+    0x8b8f8f72, 0x93727d9d, 0xa47c823b, 0xa27c6c7c, 0x93607362, 0x819662ac, 0xabc08b9d, 0x7992798e,
+    0x4a869877, 0xb85b66ac, 0xc19e5c8d, 0x7f8eabb0, 0x9f85ab73, 0xbc80b6a2, 0x88a0796c, 0x8e828b8b,
+    0xabbf9565, 0xa7b4a380, 0x878b9777, 0x687865b5, 0x6bc2b375, 0x768d5067, 0x9b8e4f6b, 0x959e9d83,
+    0x84a653a9, 0x5ea85e93, 0xb59b7167, 0x78709092, 0x4c92b489, 0x6f9e6a52, 0x8d837591, 0x85bc64d3,
+    0x7196917b, 0x768e8260, 0xb8a1a481, 0x8886ae85, 0x7f51a986, 0xa075adb0, 0xd6849788, 0x83a65786,
+    0x8a91ad44, 0xb37c8396, 0x9d6f4d85, 0x90988c90, 0x858eb848, 0x99b7849e, 0x9496b49a, 0xa39f8fbd,
+    0x9f827578, 0xb187b09c, 0xb969af8f, 0xa6ac7b7b, 0x7eac866d, 0x8ca66ab8, 0x718f6481, 0xc1728d84,
+    0xab7c6167, 0xb4926d7f, 0x7d46b195, 0x7f81b8c9, 0x6b768581, 0x8089bf8c, 0x779b9b7e, 0x8187608b,
+    0x99b69a6d, 0x9e836664, 0x8883b955, 0x8186c09e, 0x57639ac6, 0x6a8471b7, 0xc9b67ebe, 0x45878ea3,
+    0x7e796a53, 0xca9066a7, 0x997c8087, 0x9aa095c0, 0x4e737d97, 0x8f96aa89, 0xa2849382, 0x69b28e81,
+    0x60cf7e7f, 0x877da779, 0xada5a08f, 0x84a1b168, 0x8092926b, 0x97786ba1, 0x7fa2838c, 0x8d82ac7d,
+    0x6ba15f75, 0xc15c4869, 0xb4209787, 0x969b8c72, 0xab9d644b, 0x7c98b16a, 0x96beaa79, 0x9f974970,
+    0x8d9db55d, 0x6f8b437b, 0x7a908987, 0x929a8b93, 0x974f9f79, 0xc38d93ba, 0xa18d9da4, 0x9d9e7e7a,
+    0x92498244, 0xa9884f93, 0x89b963ea, 0x817f66b4, 0x8da5a679, 0xa2847e9f, 0x69a2d2af, 0x6c9c919a,
+    0xb6a4b184, 0xaf879d83, 0x9e9aa57c, 0x8cabc684, 0x6eaa6d59, 0xab719991, 0x899152ca, 0xcb81d9af,
+    0x867d65a2, 0x8da6aa7f, 0x9c5d658e, 0x9f787a86, 0x7aa49474, 0xc4b2d05a, 0x9b9f7b8e, 0x91997ea1,
+    0x8b95a749, 0x4a9a8243, 0x80ce9788, 0x95839e87, 0x7c87a467, 0xa96767a2, 0xa4a4969f, 0x6ec88f73,
+    0x846d6759, 0x7f9f5372, 0x709c599e, 0x7f627872, 0xb0caa45b, 0x657b79d3, 0x61aa757a, 0xb5609abf,
+    0x708bcd86, 0x7f778c88, 0x878e7992, 0x6b868c8b, 0x7c5d99b1, 0xb88e6b84, 0x82c5606c, 0xb35c9a90,
+    0x48807cb1, 0xa35b8f96, 0x4f426a71, 0x9d9a5998, 0xbb636264, 0x96aac85f, 0xbcc1b97f, 0xd49a5d8f,
+    0x8796ae83, 0x766f4a44, 0x95d4b189, 0x54628c88, 0x868ad35f, 0x6f7c82b0, 0x7aa59188, 0x6492a29a,
+    0xc286a658, 0x7b8c9eaf, 0x6abb74a6, 0x8e72907c, 0xd1b0d073, 0x9e73aeaa, 0x5fa3ca89, 0xc5b35072,
+    0x8d8eab6a, 0x948fb791, 0x80a79996, 0xaca99e7e, 0x549fa6c8, 0xbf898b87, 0x80a864bc, 0x82bca99a,
+    0x85b1a18f, 0x65aa6c9e, 0x7b4f664e, 0x6f7e969c, 0x99bc835f, 0xd971beb7, 0x8cb2d789, 0xcb796170,
+    0x9d58a461, 0x7d7e9950, 0x9c82a86b, 0x878aad90, 0x9b7fdfbb, 0x8ca49db5, 0xb182847e, 0xaa90807a,
+    0xb78a9452, 0x6993789f, 0x96d26f91, 0x5a769e62, 0xb48da86f, 0x998e8f8d, 0xbc6fdb9b, 0x9a97796e,
+    0x6f88a396, 0x7e82bf53, 0xa6bb72b2, 0xa287a8c1, 0xaa9bacaa, 0x95b47a92, 0xb26c79cf, 0xa9d4857c,
+    0x8aad8b67, 0xba66b6ba, 0x9796af82, 0x7d62697f, 0x96a49675, 0xb7a0637d, 0x8173937b, 0x6f9c6fa8,
+    0xa081a59c, 0x679d8d72, 0x8e9ea291, 0x996dae7a, 0xd49394a2, 0x717dc2c3, 0xa18c9dad, 0x948a8998,
+    0x937f7f86, 0x9eaf7794, 0x98919e99, 0x9e7d84ba, 0xbe6bad86, 0x5b78a4c1, 0x6ca186a4, 0x848c869d,
+    0x92624e80, 0xa19f9bb0, 0x7aa068b5, 0xadb6b0a3, 0x8e8d8594, 0x8f7d6b83, 0x9d8f9175, 0x8c9c8e97,
+    0x70b2aaab, 0x836f6677, 0x835d8e85, 0x9186abaf, 0x65ad7d85, 0xb5924eab, 0x835ec29f, 0x8c814d6d,
+    0x9b50aaa9, 0x7e7c9774, 0x955d70a1, 0x6f9e949a, 0xbd808c72, 0x8f8d88c1, 0x9b798f95, 0x8b7d8d88,
+    0x917f63b2, 0xa48f8282, 0xa48d949a, 0x9a5496b1, 0x9a7b9c72, 0xa3a267a2, 0x6753a5ac, 0xc06c959e,
+    0x8cad86ad, 0xafc08ba0, 0x9e839e50, 0xaba499b4, 0x926fab81, 0xa499c285, 0x64a66b80, 0xa99bbd9b,
+    0x78a37f93, 0xc0829eb5, 0x97879c80, 0x806e82a3, 0xa8727e5a, 0x8ba7a796, 0x8ca9bfa2, 0x74806a84,
+    0x66a78792, 0x8a657b79, 0x92856473, 0xa9859a66, 0x7987be99, 0x80988089, 0x878c8b87, 0x699ca98c,
+    0xa184a68f, 0x857f716a, 0x73a8b981, 0x6e767761, 0xbd7d9673, 0xb07d6285, 0xbe73a3a5, 0xa99e9d9d,
+    0x898183ac, 0xa67693a8, 0x80657889, 0xa3ae6b81, 0x967a8d97, 0x759c5eb6, 0x9ca86672, 0x7eaaab8b,
+    0xcbb07593, 0x84b5948a, 0xbf957687, 0x72af7699, 0x79839499, 0xc7b59487, 0x6ebdbd78, 0x54758089,
+    0x9a67a79f, 0x8ca298a0, 0x93787a9b, 0x748fb4b4, 0x75838d70, 0x866f77ac, 0xa3a7c385, 0x82af956f,
+    0xb372c1c5, 0x914cb961, 0x9291aa84, 0xaf96c380, 0xa38ca185, 0x87686d9d, 0xaa6d8287, 0x9d979fa9,
+    0x8e907b92, 0x96779f7c, 0xb6968987, 0x786e94d3, 0xae897a8c, 0x6fbe7b81, 0xc78283b2, 0xb4aa986c,
+    0x96814b8a, 0x93838883, 0x788aa498, 0x7e96aa90, 0x7a9168c6, 0xbf999ea8, 0x87878799, 0x9c71b891,
+    0x7791c5b7, 0x8a82aa9b, 0x788fb34f, 0x7d9ead9e, 0x7f487d7b, 0x799980ac, 0x87817ba3, 0xa958a998,
+    0x86767891, 0x8e908b86, 0xc27576a6, 0x8f807e86, 0xa6b29f66, 0x82bd78aa, 0x828d96b5, 0xbeafaa90,
+    0xaf927c50, 0x957a7d82, 0x7684a496, 0x7ba0b194, 0x75babea9, 0x7a746377, 0x7bba729d, 0xce7e7575,
+    0x96a56189, 0x7171826a, 0x609c7870, 0x8d9b8aa4, 0x9aa072ab, 0x85acacaa, 0x606b6c76, 0x9d5bbeb4,
+    0x807092ae, 0xa46b7397, 0x885e9891, 0xc99984ab, 0x9645a768, 0x6f986db1, 0x87a37b78, 0x848a9e90,
+    0x936ca475, 0x7b86bd80, 0x9ca67f59, 0x9681939f, 0xab9c838c, 0x7367c372, 0x8bbc7e99, 0xb081c7ca,
+    0xa9857863, 0xae81a384, 0x8a7b92b0, 0x8b976076, 0x6f7e9c89, 0x9191b9af, 0xd36c7a97, 0x92c68f90,
+    0x86937d95, 0x85906b6d, 0xc66ac164, 0x687e8bae, 0x81777bc5, 0xa2889e6c, 0x80894d93, 0xbb867967,
+    0x9857cf7b, 0x9ba69065, 0x979d899f, 0x6295787d, 0x9cada195, 0xc7b790b2, 0xa59f9673, 0x9db27c98,
+    0x87596e72, 0x907b6ba2, 0x979a7567, 0xa7ad99a8, 0xa4bc7665, 0xb9a17e89, 0x69b49e82, 0xb0ac9dad,
+    0x89817ba5, 0x85598eb0, 0xb843a47f, 0xa26b7b90, 0x7da3825e, 0x6164647a, 0xc4828c7b, 0xba4e649b,
+    0xb0426a5d, 0x7f866e57, 0x899e8b95, 0x67a5a49f, 0x77b38da0, 0x68a88488, 0x70906369, 0x614eb772,
+    0x956fa188, 0xa77e8c90, 0x7c7b9f7b, 0x9ca87b61, 0x7b6aae7b, 0x8d7c97a0, 0x868da086, 0xad77b7b3,
+    0x6f61a271, 0xac5d6f77, 0xc29d8091, 0x8e8f799a, 0xbb987b9a, 0x956979b8, 0xb47cbc9a, 0xa07fa3a7,
+    0x7c9f7178, 0x5e8cd1ab, 0x8aa3bcab, 0xa2ab9259, 0x6acfc769, 0x6299918e, 0x84c54ea0, 0x999b5c70,
+    0xa0a36d83, 0x65b88271, 0x7f8f81a6, 0xaacc78b3, 0x81c28784, 0xaf86657d, 0x5d9c80b3, 0x889aab89,
+    0x7f979579, 0x8c99a69c, 0x9389ba63, 0x918e9a95, 0x7375a9b8, 0x678d808b, 0x6690a17c, 0x7589afb6,
+    0x8d7aa569, 0x6c57887a, 0xa594668a, 0xb790a1bb, 0x9b76acb8, 0xc8796d96, 0x9f72c577, 0x9ab2ba8b,
+    0x959fa23e, 0x9e9bbac3, 0xa7537185, 0xa5b29067, 0x4c8ac979, 0x527f8a80, 0x7a9a8a89, 0x73649871,
+    0xa874406c, 0xb7a96299, 0xad7251a1, 0x88877e72, 0x7ba25867, 0xcaa8ba54, 0x9232ad71, 0x78777993,
+    0xaab1c0aa, 0x7d9e8a7e, 0x9da9ba86, 0x74ab7582, 0x829bb27e, 0x9cb3917f, 0x705ea179, 0x4b858785,
+    0x75526b79, 0xaf443f7f, 0x7d74566a, 0x8a928285, 0x8363a1aa, 0xa47e8d94, 0x89a09b88, 0x8785a87c,
+    0x96807c6b, 0xb8b497a9, 0x6478b6a4, 0x7d8b92a4, 0x5fbc8a82, 0x83868272, 0x798a4cac, 0xb56a7e52,
+    0xa84597be, 0x908c475e, 0xc07c669d, 0x6d6ea38b, 0x9292525f, 0x92c0a63e, 0x72819692, 0x807a8688,
+    0xb173aa97, 0x5c676eba, 0xad95c64c, 0xba7dd34f, 0x9a6eaa8a, 0x9b8b8fda, 0x8b8e709c, 0x8bce6f69,
+    0x787dcd7b, 0x8365acb4, 0x84868784, 0x6ba26fac, 0x8a5ead63, 0x80815d94, 0xa4799377, 0xa5bf9f90,
+    0x9ea7a28a, 0xa291bcb1, 0x6a867382, 0x55a2acaa, 0x69529d65, 0x9a7f7c9f, 0xaab04c75, 0xcc82b699,
+    0x557185c9, 0x65897da3, 0x598570b4, 0xa487906a, 0x64956074, 0xa998696f, 0x8093c29c, 0x9c9c6792,
+    0x8c6f9181, 0x9852b386, 0x8d90af66, 0xacabbd7e, 0x8295ba9f, 0xb3c391b0, 0x81718f8a, 0x82d27e98,
+    0x9476c955, 0xa0755644, 0x9e748392, 0x6a4b845a, 0x8e52be6f, 0x979956a4, 0x7291f367, 0x97cb7c77,
+    0xa1ae715e, 0x9c74a1a9, 0x919d9478, 0x6d889d8c, 0x8c99cf8d, 0x879ebb5e, 0xc79969b9, 0xbab05b6b,
+    0x8e958a7f, 0x9194786a, 0x5b998567, 0x74639c68, 0x79e56f65, 0xadc9948a, 0x98799a8d, 0xa280958a,
+    0xaa8acf73, 0x5b70a156, 0xa78a5398, 0x8473987a, 0x5893b8a0, 0x80adbba9, 0x70a2639c, 0xb4b8805d,
+    0x8eb447a4, 0x9c4a909d, 0x8b6dc0c0, 0x6ca17b86, 0x998cd2c8, 0x99aa95d1, 0x699eb8c8, 0x908e859a,
+    0x72b3bb8a, 0x72c4aba1, 0x7ba27cb5, 0x789b9c95, 0xc6a4a2a0, 0xa9658c58, 0x978a9f89, 0x6b928c76,
+    0x81a9a796, 0x7b9d5982, 0x758e6a78, 0x90918752, 0xa17f879a, 0xb5886f91, 0x8892c996, 0x94b99378,
+    0x9c9a9273, 0x7f926b5e, 0x5a528bc3, 0x8b767e65, 0x97ad979d, 0x95a95bbe, 0x88b36578, 0x9ca3ad9f,
+    0x707aa997, 0x918289a0, 0xa46090db, 0x79829669, 0xc45b995f, 0x979da89f, 0xbfa3be96, 0x8ade78c3,
+    0x6cceaa63, 0x948366b2, 0x6ca194a8, 0x8b9d7e7d, 0x8fa59088, 0x8e78b6ad, 0xad9ebc6f, 0xc3b15891,
+    0x8c82a56a, 0x7483c27d, 0x9a768195, 0x9f757464, 0xbc6da5b1, 0x898aab67, 0xa5a373bc, 0x73776b93,
+    0x89bc9c95, 0x92a9ad94, 0x93c7878b, 0xaea06f7b, 0xa79383ae, 0x71648f92, 0x9e9f7657, 0xa379738d,
+    0x7ea09c76, 0xcb9dae7c, 0x6c82a98b, 0x7f859190, 0x7d95acb1, 0xc1919182, 0x657e878e, 0x6ca587b4,
+    0xa67bd06e, 0x9298b489, 0x726a7765, 0x96898094, 0x70ca807a, 0x9e648f9c, 0x948b7eb4, 0x77967da3,
+    0x89917993, 0xa766786d, 0x7abd628d, 0x77b29aac, 0xb45a9492, 0xae7b9174, 0x9fbf9c83, 0xb4a09a96,
+    0x9278947a, 0x6592956e, 0x968e9a7a, 0x92c26d77, 0x807f7362, 0x777ec276, 0xad6e877d, 0xa28abd7b,
+    0x8ba469a9, 0x88bdadad, 0x828fb38f, 0x96aea796, 0x8982afbd, 0xa07d85a5, 0x6d8dafa8, 0x857fad89,
+    0xafa25e59, 0xc08569a7, 0x7c79acae, 0xb457917c, 0x91beaf8f, 0x8dac8b72, 0x799bb496, 0x8a656085,
+    0x7f71879d, 0xb9707cac, 0xc7a1a49d, 0x6c88bd62, 0x7e7276cf, 0x638d69a3, 0xaf70ae71, 0x9a856880,
+    0x928a6488, 0x5cad697e, 0xa15da366, 0x94569693, 0x857d67af, 0x9755b577, 0x876e98a3, 0xa6a1beb6,
+    0x5ab5a6a2, 0x61abadaa, 0x859377a1, 0x63858a98, 0x76a3a690, 0x6fa38ac7, 0xcd708f6f, 0x76a5be6a,
+    0xb9ca7d6d, 0xb4768ea4, 0xad6d9e84, 0xa47590a4, 0xa4778bb9, 0x66699378, 0x6a928bb4, 0x80cb84bd,
+    0x80a28157, 0x698e62b4, 0x99999667, 0xbea29a88, 0xb273b1ad, 0xc67fae87, 0x6e529ab2, 0xaaa8c6c3,
+    0x5d717298, 0x7e736b8c, 0x8c68c599, 0x79847caa, 0x73aaa394, 0x75a4b7a8, 0xc68c868d, 0x7ba85e69,
+    0x8f579d98, 0x7070ab77, 0x8b90788f, 0x99b65c8e, 0x4fac8585, 0x789d7d83, 0x729a77a0, 0xa2a0cfb0,
+    0x84529390, 0xa7987ab6, 0xa7a7ba65, 0x806b749d, 0x6033a790, 0x655bbb7a, 0xc16283af, 0xae96a1a8,
+    0xe060aa91, 0x7584b168, 0x998b9692, 0x629c7f68, 0x8b9584ce, 0x89907d58, 0xd69b8399, 0x8966da7c,
+    0xa0779d6d, 0xc5c79987, 0xa479a6aa, 0x7779849c, 0xac6fa133, 0x8a71d2d7, 0x76977369, 0x79796371,
+    0x82ab8063, 0x5d7c9e71, 0x7ec37f9e, 0xa4c1818c, 0xc2797ad7, 0x597881c9, 0x7da08f41, 0xb9a27eb7,
+    0x829564a3, 0xb46c8dad, 0x96728b92, 0x978b837a, 0x968a9a82, 0x8595905e, 0xb3ce757b, 0xc7a6726d,
+    0xa3897e77, 0x5a8c587c, 0x89b4997e, 0x6ec49495, 0x74c281ac, 0x66a38b83, 0x99599165, 0x658381bb,
+    0x6c90a68d, 0x799d9468, 0xaa7b7f98, 0xb5a0bcaa, 0x4e8aa78d, 0xce9ba9b6, 0xb4717878, 0x56b95ea2,
+    0x7b5e8593, 0x9f7b736b, 0xa37889b1, 0x79a29a84, 0xb36db7c3, 0x8c815597, 0x7c9db14e, 0x69c9a1b6,
+    0xb6959591, 0xa3b48683, 0xc3808c80, 0xcb8d6c76, 0x6d725a7b, 0x698b885d, 0xcd915ea4, 0xb6897885,
+    0x9d9e7a87, 0x787b3d7d, 0x8284b5b3, 0xa08bb77a, 0x97869eb7, 0x86917c87, 0xa8847895, 0x67725ca8,
+    0x8eb79e74, 0x9f9d976a, 0xaa70994f, 0x75b3d087, 0x797caba9, 0x7bab8178, 0xa1919083, 0x76b463a5,
+    0x8977aa7e, 0x8e75836c, 0x8178429a, 0xb58cb49c, 0x8a8bacb4, 0x7bb05a71, 0x887ac631, 0x7d93a5b2,
+    0x5db47f83, 0xab75d6c0, 0xa384c48d, 0x8b9e7087, 0x4998b876, 0x98744ba3, 0x89a09395, 0xdbab769a,
+    0x97787878, 0x51693346, 0x8978c382, 0x8677cc71, 0x75bb8996, 0x8fa89770, 0x8871835d, 0x83b49f9b,
+    0x9f76857a, 0x85b18c77, 0x9eb08c5d, 0xb7769fb7, 0x7f70937c, 0xb2a0509f, 0x94974ccb, 0x6db19a8e,
+    0x6b6d8551, 0x9fa69d5b, 0x886d609e, 0xabaaac7c, 0xa07caa64, 0x7b91a292, 0xbf789155, 0x80aa97b3,
+    0x87a4942c, 0xd2a08b82, 0x89a2ae83, 0xb8889b85, 0x74938683, 0xbc5f5d68, 0xc0925bb2, 0xa5bb9e68,
+    0x8fb0268a, 0xa9ae8774, 0xb992aa90, 0x6e9ec66f, 0x5bb39c90, 0x6a918e5b, 0xaa9b6779, 0xb9838497,
+    0x74b5c693, 0x87c89a58, 0x9c989780, 0xc3937d99, 0xb1609e86, 0xba8879ab, 0x9b7c8f8a, 0x8db76f9a,
+    0x6a78a75a, 0x97a053c1, 0x7e7b7aab, 0x8e97a278, 0x5a8b988a, 0x80749587, 0xda91b75e, 0x7ab071ad,
+    0x91c9b875, 0xb087a2a3, 0xa68c8da1, 0x7695965d, 0x7f836f83, 0x798a758b, 0x84b68ba9, 0x8cbd8da9,
+    0x96836b9d, 0x56a87d71, 0x8e737f73, 0x88687a48, 0x709d709a, 0x998c688b, 0x717f5e9e, 0x7c7885b5,
+    0x8fb88287, 0x8cb34a88, 0xc8768b76, 0x95b2996c, 0x8f7eb174, 0x5b996cbb, 0x80b2a2c3, 0x8677a4be,
+    0x9b30763b, 0x92b286b0, 0x9a9058ae, 0x6bac909c, 0xaf727b8e, 0x785f9987, 0x7e78c28b, 0x71838876,
+    0x9e8fa697, 0x8ba07a95, 0x7c97b97b, 0x98649684, 0x87918ebd, 0x9b696a7d, 0x8c9057ad, 0xb598aa5b,
+    0xa3984a94, 0x6c8c8867, 0x88779683, 0x8193af99, 0x87935194, 0x7b71a93d, 0xa982a599, 0xb0a4589c,
+    0x96c78e6f, 0x9e9ea554, 0xb987b68e, 0x8b79b2a8, 0x857faf67, 0x8eaa659b, 0xb080829d, 0x7cb7ae91,
+    0x9f7aa72a, 0xbe818a87, 0xbd808790, 0x598a858d, 0x93bc9e71, 0x748c8e92, 0xb2787cc2, 0x7f7b84b1,
+    0x9977796e, 0x8987849c, 0x7ca590ac, 0x90a09e70, 0x8c6b9071, 0x6ba13e9b, 0x98986772, 0x9db87873,
+    0xa7be7097, 0x909293b1, 0x787ab761, 0x746368a5, 0xb8c974a1, 0xd7b5c573, 0x9c607183, 0xb0a76fb5,
+    0xa298b486, 0x91738356, 0xaea77bb6, 0x84a8a65e, 0x8a548e86, 0x729c9cac, 0x7ba38f81, 0xa77d8797,
+    0x745fa04e, 0xb8aa5193, 0x92af5ece, 0x71d2a587, 0xae96c95c, 0x6f4b749d, 0xb8a499a8, 0x86928198,
+    0x9b82c38c, 0x796a848a, 0x8d817ac0, 0x9d93b88e, 0xa0a3b186, 0x7c8f7e87, 0x72be94ac, 0xd888ad66,
+    0x8f97579d, 0x987168c9, 0x817fa1b5, 0x8d67857b, 0xb5808c56, 0x9fb3b9cb, 0x95898d92, 0xb88683c3,
+    0x7da7a46a, 0x72c88d54, 0xcab2877f, 0x9cc06e6c, 0xc37fa2b2, 0x6dac9680, 0xc585abad, 0x6e7f8497,
+    0x9155bf51, 0xab899f5f, 0x9bcd9eaf, 0x6b879ca2, 0xb2be836b, 0x7a9092bd, 0xb993aa6c, 0xa0bf7d86,
+    0x9ba7d454, 0x80739b73, 0xb999baa6, 0xa48797a8, 0x78829e6d, 0x8d785489, 0x81a47c72, 0xc2b18193,
+    0x7e9aae9f, 0x9c5488ae, 0x91638182, 0x7a7e6494, 0x8c8f92ad, 0xa2cb9e8b, 0x9abad7ab, 0x93967a65,
+    0xc4978161, 0x8f97557f, 0x987f6291, 0xaf87c57e, 0xa289ae64, 0x7074569d, 0x989cafac, 0x6f7ca58e,
+    0x9f85a663, 0x8c528460, 0xa4c9a078, 0x7c8ca488, 0xbcbf9b6f, 0x926eaaa7, 0x7caf807d, 0x9e957b89,
+    0x8c8cc287, 0x6495b0a6, 0xa0a58076, 0x8693bc97, 0x806f9fba, 0x9e98aa71, 0x977f7e74, 0x8c8d458a,
+    0x6fab9999, 0x807ea08c, 0x9ebb7c8b, 0xaf839c9d, 0x6d8cae61, 0xc97989ad, 0xc96fdac8, 0xb99f8a70,
+    0x92a9b07d, 0x8c8d9080, 0xa38b8583, 0x7c8b9d89, 0x8ba0ab85, 0x8ab6b2b6, 0x83609486, 0x6f6b89aa,
+    0x89509899, 0x727d9a57, 0x6a99a878, 0x759291b7, 0xb88b798a, 0x7e96bd70, 0xb16a9e89, 0x8f81af96,
+    0xb7779685, 0x88618a8d, 0x937fac98, 0xa09b9ca2, 0x828e658f, 0xbe85a791, 0x67bc8f75, 0xa6ad9982,
+    0x76d48c81, 0xb6aaa9ad, 0x608ea3a6, 0x62955cbf, 0x84598d81, 0xb779c2a4, 0x70abac86, 0x9c998672,
+    0x928c929b, 0x90788271, 0x90918777, 0xbbb4859f, 0xa97cb289, 0x9689aad0, 0x93787788, 0xa880bcaa,
+    0xb9a27862, 0x5b5fa599, 0xb17f7c74, 0xc18e9c8c, 0xac8bc3aa, 0x7353718e, 0x858aa478, 0xb86b7579,
+    0x6c7da98a, 0x8e95a699, 0x83a59c7c, 0x9c927a77, 0x8f95788d, 0x78a496a2, 0xa5a680be, 0xb0d09989,
+    0x95cfb6c9, 0x6ca1a6ab, 0x727d968c, 0x92687c9b, 0x9684a191, 0x858a906d, 0x7d93af83, 0xa8837e75,
+    0x9d73b15d, 0x699898b1, 0xa9afaf96, 0x6fa1c378, 0xa8859590, 0x6e8d9eb1, 0x71c4b17f, 0x7f9385b8,
+    0x799c967e, 0x7889658a, 0xa6897c7d, 0xae82a0bb, 0xaf9d6e7d, 0x6b739c8a, 0x9a628797, 0xafad97b1,
+    0x8b988851, 0x848f7194, 0x9a686f73, 0xa79bb488, 0xa889598d, 0xb7a29387, 0x89ba726f, 0x96909399,
+    0x5888908c, 0x74b764d2, 0x6b809dae, 0x848c88bb, 0x769e7585, 0xd17e8ba7, 0x5666ab7b, 0xa296b0a1,
+    0x6b9e716d, 0xa8827697, 0x727973a8, 0x9b927c84, 0x8b669250, 0x97b1acac, 0xa0688a63, 0x7697b7ad,
+    0x9e788883, 0x8285838d, 0xbfd37e72, 0x836c8493, 0x85938473, 0x8c8d7994, 0x93a4c1a9, 0x8caeb0b4,
+    0x9380b08d, 0x998d85d4, 0xb7805d6b, 0xbcc9a46f, 0x7b7c7f79, 0xa27c8eae, 0x759b7ebf, 0x83b59685,
+    0xbaae5dae, 0x86bd5785, 0x948d8393, 0xadb88498, 0x78849692, 0xa69d9e87, 0xa885bcb2, 0x77838f78,
+    0xa399a896, 0x7a8bbfa1, 0x8e9a7388, 0x80919883, 0x6e6e837f, 0x72708fac, 0x90707885, 0x8760a079,
+    0xb182b087, 0x5294787d, 0x7e7f738a, 0x97b09a79, 0xa489a685, 0x8e8496a6, 0x7082b09f, 0x9da8ad89,
+    0x7bb09096, 0x6a6c87bc, 0x865b9e9d, 0x9b7eb87b, 0x809e977d, 0x7c798f8a, 0x85b44dad, 0x809c748e,
+    0x92844eae, 0x9f956c97, 0x6c838bc0, 0x727a938d, 0xadb4b7a5, 0xa4b1a344, 0x8ec38695, 0x7f71ab81,
+    0x887f9f94, 0xbeb0876c, 0x74909869, 0x5c6c9479, 0x9f9a907c, 0x917f9e70, 0x91718b7d, 0xa2748e7d,
+    0x85aa8d82, 0x858d9976, 0xa6bd35b5, 0x9d9fa6b3, 0x7cb19599, 0x86958e70, 0xbf7ecb87, 0xa7c49b64,
+    0xb7878241, 0xbf5aaf69, 0x715d5f96, 0x74aba674, 0x8682a27c, 0x8eaea063, 0x92a46f9b, 0x7ba78383,
+    0x7dab4b93, 0x88a5899e, 0x6c6185b1, 0x73959081, 0x8cad6170, 0xa2a1876c, 0x96769c6a, 0x7f5b80b7,
+    0xa482816b, 0x6663967b, 0x9b69948e, 0x868fb5bb, 0xaabe948f, 0x7b779d5c, 0xb091a99f, 0x627677a7,
+    0x7a95966e, 0x96878977, 0x7d727583, 0x8489937a, 0x936f646e, 0xab62977a, 0x8aaf7594, 0x96b0c371,
+    0xa2999169, 0x9b87699e, 0x983da87c, 0x89889496, 0x608db55e, 0x5a83aa7a, 0xbfb874bd, 0x9e7b8c8b,
+    0x85ad7c96, 0x80a66b64, 0xa47facbd, 0x89ca7e83, 0x968a89a8, 0xb6acaa6c, 0x8eae99a0, 0x968485b1,
+    0x727288aa, 0x75866890, 0x8874c68b, 0x88979d98, 0xa19e8896, 0xaeb5509c, 0x94709d79, 0x6b6f9089,
+    0x6556888b, 0xa34c7d96, 0xa65b359b, 0x70b6a7a0, 0x7998969e, 0xa4998ea0, 0x667fa6b2, 0x71828aa4,
+    0x8d76906c, 0xa37b9688, 0x7da47f8b, 0x727d9869, 0x7e77cd51, 0x79a598a6, 0xaf9248a4, 0x996650a4,
+    0x8675479a, 0x88c77277, 0x8e677866, 0x65b5af70, 0x7d919582, 0x8ec67551, 0x97776b66, 0xa36bb0a5,
+    0xa4a6a893, 0x9da69871, 0x81816384, 0x957e8bac, 0x906e976b, 0xbba9ac7e, 0x8c9c818c, 0x91bd558c,
+    0x8b8c8166, 0xa86e6789, 0xadae4bb5, 0x528d7e92, 0x7451a652, 0x9eb2a48d, 0xa8938d6b, 0x93d3b693,
+    0x74869c87, 0x9798999f, 0xa56aca7d, 0xa99e5dac, 0x83717254, 0x799b76b7, 0xa77b58d3, 0xad43846f,
+    0x986971bf, 0x7b5d5964, 0x9d7a7cb0, 0xb077ab75, 0x74896d9a, 0x7f9c897a, 0xa7977548, 0x8b73a754,
+    0x8e7aab62, 0x4a76b86e, 0xa079656e, 0xcdaf957b, 0x9ea895b7, 0x807e9f71, 0x4ba27cb7, 0x9c8c72be,
+    0x61a8a97a, 0xc67c8d66, 0x62907f9d, 0x6c7fa486, 0x93759974, 0x8f5b8da2, 0x9bb2bf9d, 0x949cb3b0,
+    0x9eb97f52, 0x6caee885, 0xa48cb2d5, 0x76847f6d, 0x676fb1a6, 0x9a66a8a9, 0xb9a858ad, 0xab6fa38e,
+    0x81a96b8d, 0xb089537b, 0x6d706693, 0x89787f64, 0x9cb53a3a, 0xa6ad5f66, 0xb15c6973, 0xbb779481,
+    0x7f6b929b, 0x706cd4c2, 0x7d6a7f8f, 0x83acc77a, 0x957abd88, 0x95d38293, 0x728b9066, 0x67af8e92,
+    0x4e5fa79b, 0xaa988890, 0x8d7d99a3, 0x9f6eae7a, 0x73889d75, 0x8d838183, 0x9091b79f, 0x98957980,
+    0xa4aac246, 0x7c55d8bb, 0x8079617a, 0x568bbfab, 0x537da37a, 0x9f579d75, 0x809047b5, 0x90795bad,
+    0xb05b705f, 0xba9c7e7b, 0x87864075, 0x568e5a74, 0xb5947560, 0x9ea55a96, 0x9b549759, 0x64b96c84,
+    0x9d719d95, 0x7e4c76a4, 0x77776371, 0x769ddc7f, 0x7fa2b570, 0x8ead76b0, 0x96a261ae, 0xa3a16167,
+    0xa2705c87, 0x9e979292, 0x715290bc, 0x769883a1, 0xa76fb585, 0xc3898099, 0x95899175, 0x9ca67e7c,
+    0xc3bb8d5a, 0x7f94a16f, 0x729d7dc3, 0xabb19665, 0xa279afb9, 0xc190a15d, 0xb78ec1a5, 0x98587b9d,
+    0x62776aa8, 0x9c87819f, 0x509160af, 0x9fa55969, 0x76f1b4aa, 0x658ea86e, 0x9a74946e, 0x5ea35e7f,
+    0xab9da49c, 0x5c838679, 0x637cadb6, 0x8c9dc68e, 0x80a89d5d, 0x7ba679a2, 0x8ccb5ea4, 0x7e90aa77,
+    0x8eb392bc, 0xdb6aa27d, 0x8574acaa, 0x82757979, 0x98b582ba, 0xbe7db98f, 0x5692d596, 0x95a57473,
+    0x7ea583aa, 0x8b75cebf, 0x89898a8b, 0x5f998da4, 0xa971b069, 0x7a79536b, 0xd194ac91, 0x72b28c81,
+    0x72707888, 0x957a7c6b, 0x7cb1a488, 0xb35d6859, 0x7bc38fad, 0xc1b77778, 0xcdb2ba92, 0xa09ba089,
+    0xc959ac88, 0xcc9d8b62, 0x927db683, 0xce91678b, 0xa9799e98, 0x9abb97a9, 0xb4af6772, 0x83c37a86,
+    0x819e779f, 0x6c9f9a8d, 0x6b6355c6, 0x8c7c6084, 0x88a29e81, 0x83a18f6f, 0xa38eb897, 0xac889296,
+    0x7bdaa4bc, 0x9a81759c, 0xcca390b0, 0x8bc199a2, 0x787cc895, 0x8a9d949e, 0xca8b7785, 0x65c18896,
+    0x8867729b, 0x9090af78, 0xa792a982, 0x69a5a67f, 0x9da26cad, 0x7d707484, 0x72819b9b, 0x94a7b188,
+    0x8a796a81, 0xb7765a6d, 0x7993b162, 0x7e8086b2, 0xad86929b, 0x89a077ae, 0xc4a87493, 0x9e90a357,
+    0xacc29f69, 0x7da5afc4, 0x9d619385, 0x9ac26374, 0x6a727494, 0x7fadb79c, 0x849aad8d, 0x66b0af8a,
+    0x9da2b190, 0x9da888a2, 0x9f99ae94, 0x767a9b8d, 0x79ab9879, 0x95826e9b, 0x987a9ecb, 0x9e7bc586,
+    0x896d9295, 0x8ea79f9b, 0x95af8492, 0xabc1a669, 0x73a58685, 0x74b1a470, 0xa5bfa8c1, 0x6ba2b47a,
+    0x9dc97d8f, 0xbf6e669e, 0xb97a8383, 0x8cb5b27b, 0x867bc385, 0x8e6e9872, 0xb78f65a4, 0xb19b80a8,
+    0x8e5f9aa8, 0x9fb567aa, 0x889da497, 0x9fb1cd89, 0x69a39b7d, 0x8bacb3bb, 0xa7848980, 0xbcc9d2c0,
+    0x8fad63b5, 0x969e88a1, 0x77817cad, 0x8b80b67e, 0x9f7858b0, 0x87687ba1, 0xb281a4b7, 0xaa7588b4,
+    0xc28d5dc4, 0xa6618e9a, 0x78bc90ac, 0x878b80cb, 0x899eb77e, 0xc2748863, 0x6bb7b19b, 0x86b07691,
+    0xa59f838a, 0xa68d8cb1, 0x8d6095ac, 0x86a262a0, 0x6195a495, 0x88a986b3, 0xa2bd96c8, 0x62a0c67f,
+    0x9a8a9987, 0x978d8588, 0xd574ba91, 0x74b56a70, 0x8cbba783, 0x89a57863, 0x80828a66, 0x759a8a94,
+    0x8fb57782, 0xd36279c8, 0x9090b69a, 0x668a8c8a, 0x8498af5a, 0x858f957a, 0xa67a84bd, 0xaaa691b7,
+    0xa89fa3a0, 0x91ae9452, 0x81a19e96, 0xa8a3aba0, 0x87c78bc1, 0x766c5985, 0x82a35d8e, 0x96a9bc98,
+    0x8a8b9685, 0xbecd8f7a, 0x8ab8976b, 0x6b749f8a, 0x738b786c, 0xa7b97779, 0xaa81b87b, 0x89528f9f,
+    0x9b75a077, 0x828caf7e, 0x7f515894, 0xb9a45c7b, 0x7f6778a3, 0x9b95b59d, 0x687f6e73, 0xbd93a381,
+    0x85849160, 0xac97a087, 0x8e727d98, 0x6c967f5c, 0x69758389, 0x7566b87e, 0xb86aa980, 0xa2a0749a,
+    0x81956176, 0x7e8f6660, 0xb1a4b2c0, 0x5b926a9f, 0xa9a99dbe, 0x9f907861, 0xa66e968a, 0x9169acd9,
+    0x757b9788, 0xbf9f746b, 0x987d9293, 0x7ca56b86, 0x928fc66f, 0xa4887398, 0xa03cb47a, 0x69887fab,
+    0x8c64b086, 0x84939c83, 0x92779684, 0x83c97988, 0x969fabab, 0x938d4a9a, 0x9289b295, 0x7da19c7e,
+    0x857a5d93, 0xbf76a8a1, 0x8783a07a, 0x6f7a8f73, 0x6d77999a, 0x806f8b61, 0x959f8475, 0x729e6e8e,
+    0x8d91907e, 0xaa7e5d53, 0x88b38778, 0x739ebd61, 0x89c28f9e, 0xa98f63a4, 0x75818577, 0x905e95db,
+    0xcc6d978f, 0x97bf979b, 0x698a7e86, 0x67ca7a7d, 0x845c7f8f, 0x8ac6788d, 0x8d7d5cb6, 0x728b8fc1,
+    0x826badac, 0xb269619b, 0x9069769d, 0x73968a6a, 0x785f87a0, 0x7aab6fa9, 0x905d9478, 0x78b779bb,
+    0xbc6ab960, 0xb1a991dc, 0x919d9aa3, 0x587e789b, 0xbf518db0, 0x5e577da3, 0x7e8f9ab7, 0x87a5a15a,
+    0x87919ea8, 0x759f597b, 0x7ca89dbf, 0x8973cb83, 0x5cd5ac91, 0x7398a593, 0xb564b98d, 0x62c15c87,
+    0x7762b1b7, 0xb7c08b6d, 0x808d77a9, 0x86a5c3a3, 0x6f60896c, 0xbbb0887e, 0x7db3ad65, 0x7f6a6679,
+    0x65adac91, 0x98938980, 0xb1706566, 0x7bcb6ca3, 0xa07c9094, 0x7e8866a2, 0xab699c82, 0xaeb28b6a,
+    0xa5729840, 0xa0a381a2, 0xc6938fa8, 0x957ba860, 0x6eb89f76, 0x99697477, 0xa8b0568a, 0xb7807a55,
+    0x809b7b96, 0x8c8a8773, 0x8c896b74, 0x64a39280, 0x819776c7, 0x9dc7717a, 0x8ba58a9e, 0x7485aaad,
+    0x95b44d8e, 0xbaa4894a, 0x9595818f, 0xa18f7fb0, 0x675d9fae, 0x76d37776, 0x98a5b177, 0x89898bbd,
+    0x93479b59, 0x9c6a757b, 0xa3675d9b, 0x79a085b3, 0x7c879777, 0x7470a385, 0x93727875, 0x79b6a377,
+    0x759b9f93, 0xb85e94b9, 0x8b9b9dbd, 0x9d729576, 0xb096825f, 0x8d948679, 0x92913e87, 0x86846767,
+    0xa47744b1, 0xa69e5785, 0xa57e707b, 0xa3839987, 0x7e7485b6, 0x5873823d, 0xae939f9c, 0x72856b90,
+    0x83878974, 0x9063ba56, 0x74948e8d, 0x95be9eb0, 0x758e8079, 0xaca5769f, 0x867ca2c5, 0x88b26b6f,
+    0x77767b6c, 0xa6879b59, 0x8a856d6d, 0x8c67a394, 0x53bbbc63, 0x88687ead, 0x809b9177, 0x708b739a,
+    0x7aa3986f, 0x7e79c9a2, 0x7d9d9b71, 0x97889589, 0x9d707467, 0x914387a2, 0x877552d0, 0xb59a737a,
+    0x996e5f82, 0x54ad8174, 0x5d8dad93, 0x5b63b798, 0x678a7979, 0xc4ae916f, 0x748a94a1, 0x7e9b84c5,
+    0xa77085c1, 0x7e7f8d4e, 0x768f9075, 0x7fa08998, 0xa6859da5, 0xa1c665ad, 0x669a6782, 0xa36e8f79,
+    0x4e8aa29e, 0xa992646c, 0xa67f44ca, 0x4c6aae96, 0x786aa5b5, 0x8b5975ac, 0xb8778888, 0xa3c6c9a4,
+    0xbca65c97, 0x6f61bc8d, 0xbca47d96, 0xa4c28b66, 0x81c7b561, 0xb65a4e91, 0xa7c485c2, 0x949ca0a6,
+    0xac77729e, 0x69ac7378, 0xc2ad6ba5, 0x84879e6f, 0x6f8b5089, 0x64947370, 0x8caf9c84, 0x6e9a6b80,
+    0x619ec2a2, 0x887e9b6e, 0xa8b2927c, 0xca89a7ad, 0xcb53b880, 0xae75686e, 0x97a4a492, 0x9c8daa7e,
+    0x7675a365, 0x9d88a171, 0xcf6d8dab, 0x6ab5a797, 0x93b1b590, 0x90a0adaf, 0x9ea397a4, 0x9f9d9980,
+    0x99b1b892, 0x85bdbe7f, 0xb8a9969f, 0x96a05573, 0x7476ae72, 0x8d8e8c92, 0x87ad8c9b, 0xb6c19dae,
+    0xa0a77d91, 0x62999790, 0xa2a9a08f, 0x9286cf9c, 0x949aaca0, 0xa46db270, 0x77779c78, 0xa484b1ae,
+    0xca97bd87, 0x9d919b56, 0xb2b5a0ac, 0x93897889, 0xa49b8c9a, 0xaa857fb8, 0xb5b9a88d, 0x5d858786,
+    0x876f9b9b, 0xd48b5c85, 0x90b8abc3, 0xa064b3b6, 0x90849475, 0x7950948d, 0x8d96b083, 0x6e7fa198,
+    0xa27cc670, 0xa17a9799, 0xa176958a, 0xa791a2a9, 0x477b7a8d, 0x7189859d, 0x7483509c, 0x96898b92,
+    0x6e72a492, 0x95845ea0, 0x8fae7174, 0x489d8ad2, 0xcfbe738b, 0xa5a67889, 0x71a1999c, 0x826a67a0,
+    0x9a6ca88d, 0x4aaf8d83, 0x8ead86a3, 0x8c9d8b7d, 0x989fad77, 0x6db0b5bf, 0xa376b5bf, 0x95728d97,
+    0x8c8caba9, 0x918d6d71, 0x658b8da8, 0x638d8266, 0xc890b6ba, 0x7172be72, 0xb8815d8a, 0x74c0bf70,
+    0xb2797c79, 0x90a68ca4, 0x97a48592, 0xb3b17e98, 0x7084949e, 0x96b277bf, 0x8bb79382, 0xbc7391a5,
+    0x9da597c4, 0x58707797, 0x956a8fd8, 0x9a949297, 0xae837c7c, 0x71869ba7, 0xa1837a95, 0xce88817a,
+    0xa5c98080, 0x7e8cbc5e, 0x9dc4b54e, 0x7d9ba472, 0x8fb38e5a, 0x84aa8f72, 0xbca37cab, 0x9b6a81ac,
+    0xaba58174, 0x9085b294, 0xb2ba76a4, 0x907e80b8, 0x84a78f71, 0x837c968a, 0x838f886d, 0xb18b6caf,
+    0x8e889379, 0x5f89ad78, 0x8a8f7a59, 0x887eadad, 0x69ad7261, 0x946f81a5, 0x7469ad86, 0xcc79987f,
+    0x95b36e72, 0x76986daa, 0x7a91a19e, 0x8582a3a5, 0x96878f92, 0xc29fac88, 0x7295a19c, 0xb5a097a6,
+    0x8ba69280, 0x6eb9a661, 0x769bb572, 0x9aa7c262, 0x89869581, 0x9b627eaa, 0x628e9c75, 0xa3c08f8e,
+    0x8059be73, 0x7c76a689, 0xa792a8ac, 0x758ca785, 0x9cc08e7e, 0xac6f82cd, 0x6f95959b, 0x94a07f62,
+    0x877d7e73, 0x7c7f7667, 0x6e627071, 0x8fa484b5, 0x97838f83, 0x558a9d98, 0x86a65586, 0x98b39088,
+    0x6d8da58d, 0x8ba174af, 0xc7665d94, 0x91849ec4, 0x90af8eb3, 0x8484a27c, 0x747a93c1, 0xcd847fa7,
+    0xcd849871, 0xaa919b83, 0x7d959a5a, 0x80938cb2, 0x9ab0a082, 0x808997ab, 0xabb06886, 0x7b96c38b,
+    0x82539362, 0x8f97ab82, 0x8dbba7b3, 0x7caaa86d, 0x9f8e8493, 0x6d81998d, 0xa4b0aac1, 0xa58890af,
+    0xb1789f6e, 0x7fbd8abc, 0x78738b56, 0x5e77a5db, 0x99a8909b, 0x909669b8, 0x78607aa9, 0x6e79b19e,
+    0x8871888b, 0xc35e659b, 0x5dcfa1ac, 0x6f78a793, 0x93906a7c, 0xba94a06f, 0x7a7699a9, 0x8ea9b485,
+    0x9b8b969e, 0x74b97ebf, 0x7969709c, 0x8d8dae7e, 0xb88da886, 0xa07e8278, 0x92b0848f, 0x6c6694b1,
+    0x8a81928b, 0x907ea07b, 0x9ecc8f67, 0x7f74a479, 0xb46962a6, 0x78a177a6, 0xa387ab5f, 0x78658eb1,
+    0xb76fb9ab, 0x88909895, 0x938da072, 0xc08f6faa, 0x7ca95c8d, 0x709eb5a1, 0xaabd9390, 0xa48a88b9,
+    0x74928b94, 0x7c8171b9, 0x806b7c88, 0x73a395a3, 0xa6a49e7e, 0x9aa9747e, 0x77abaf8d, 0x85a69d65,
+    0xb786c05a, 0x70939f70, 0x85718a9b, 0x9c7e9b8e, 0x6285a38c, 0x979f8d7e, 0xaf567e9e, 0x93a6c6a5,
+    0x7864a38b, 0x8ca4847a, 0x77639088, 0xa6b9c29f, 0x848ba89c, 0x65afb6a8, 0x9c7f7b7f, 0x7f9caf79,
+    0x86717e76, 0x8d9bc786, 0xab8f7680, 0x709b8786, 0x8d967353, 0xc0bc9791, 0x8db0a160, 0x9f9e8870,
+    0x97938aa8, 0x79a864be, 0x9b99c470, 0x6f9eac9b, 0x5b5f6a80, 0x9d8b628e, 0x8e8cb291, 0xbbb49a91,
+    0x8a586193, 0x8a91949f, 0x8d63b99d, 0x7a608b87, 0xa18ebf80, 0x80a3647b, 0xa379906e, 0x82b5c98a,
+    0x74869367, 0x65559a8c, 0x94978e57, 0xa2958c8b, 0xae907276, 0x8d81a179, 0x8b8a8d97, 0x8e7c929b,
+    0x837bbb76, 0x8664929d, 0x88857a75, 0xa4889098, 0x847d7281, 0x6b888ba7, 0x90989b8a, 0x92888dba,
+    0x6e69769d, 0x69b84f91, 0x929d977e, 0x639f8bac, 0x899aae86, 0x6f87759f, 0x7d77a685, 0xa05b9a86,
+    0x93939593, 0x748d6d88, 0x6082a396, 0x73b4a555, 0x93aca874, 0x8da87aa5, 0xac7d9b76, 0x8aaf9bb5,
+    0xad65b841, 0x72878e7a, 0xc7a964a5, 0x8f809e5d, 0x56b6d267, 0x85a463a6, 0x8671b0b9, 0x6eb1a4cd,
+    0x927ea782, 0x857dacd4, 0xb184887d, 0x8b98b271, 0xa1a17670, 0x69bf6d76, 0x99a056a9, 0xa594ac9e,
+    0x87a73d9e, 0x9096617b, 0xb693aaa9, 0x8d9a748f, 0x709e4d7d, 0xa8aaa398, 0xb77cba9a, 0x6f63a77b,
+    0x869c8e9f, 0x8aad839d, 0xa88d8b57, 0x7e7f8476, 0x8f97af97, 0x9ccc886e, 0x72616b9d, 0xb293b26c,
+    0x60608d98, 0x92798891, 0x8e815f7b, 0x7f7fa77f, 0x57888a81, 0x827a8e95, 0xb08a6d79, 0xa2bec793,
+    0x99d27775, 0x6574bc71, 0x9758ae77, 0xa0cfa772, 0x90827c9c, 0x51ac777b, 0x7db3b8a6, 0xca7b465e,
+    0x8a6948b4, 0x9fb34c76, 0x765f7bad, 0xa5829589, 0xb1c87e78, 0x68b1a770, 0xbc4c7872, 0x8f738d98,
+    0x845e79b8, 0x7e717fbd, 0x84c08f7d, 0x798c9d65, 0x53cc9c81, 0x55c27a70, 0x8b6a7c5e, 0xbc998e89,
+    0x8c978455, 0xa98ea45a, 0xac5c71a0, 0x7eb19a8b, 0x7d698296, 0x887095a6, 0xcfa58f9e, 0x7a958e94,
+    0xacb6ae7e, 0xb463b1a7, 0x8a938d98, 0x85a8867e, 0x7983b37b, 0x4e8b6671, 0x60bb72c8, 0x6b805a99,
+    0xc2927daa, 0xbfa58b72, 0x9c637891, 0x74a69161, 0x7bbc806a, 0x94977a73, 0x73927ba2, 0xb197968b,
+    0x9073cc7e, 0x874d7e6d, 0x809ba385, 0xb071bda2, 0x6c6eaa88, 0x92adad8b, 0x557a7971, 0x9b80819d,
+    0x6275836a, 0x9b7bbb60, 0xaebb84ac, 0x5585b27e, 0x754d9f6e, 0x70638286, 0x99896482, 0x939a9a52,
+    0x96b2b261, 0x9296a777, 0x879e71d0, 0x6fbc8d80, 0x9a7d8d79, 0x6f586e5d, 0x6c8b6ea8, 0xa0ac535c,
+    0x77a1a195, 0x9a73a977, 0x7f8667cb, 0x526fa68c, 0x83b0816e, 0x6bb59a55, 0x809c9f47, 0x9e3f988a,
+    0xc37ca892, 0x6398af76, 0xa27eae81, 0x8171ca6d, 0x848c998a, 0x7cae828d, 0x6d9499a0, 0x9e9c8494,
+    0x728b9160, 0x9a888c47, 0xa09365ab, 0x7faaa780, 0x6a6b8d7e, 0x6d877dce, 0x6b6ea163, 0x77aa739d,
+    0xbaaf9e83, 0xb596d287, 0xaf7d98cf, 0x518f836d, 0x8877c46a, 0xa277c3a1, 0xb0acb6c4, 0xdc7067b3,
+    0x54747876, 0xc08c685d, 0x6d7d5291, 0x95668072, 0x7fab636d, 0x7bc58a3b, 0xafa2a087, 0xb7777c69,
+    0x9b80a4af, 0x445693c0, 0x906d9f9a, 0x839b837b, 0x706d8a9f, 0xa6ca6885, 0x788e8e83, 0x9c869372,
+    0x808e7fb4, 0xb48ac192, 0x5a56988c, 0x9394767c, 0x5992ca78, 0xc86072a8, 0xa563bfa9, 0x8fb3a681,
+    0xa3b2998e, 0xb784bcb2, 0xa78f4e92, 0x8ac36990, 0xb28da48d, 0xa0a7857b, 0xaba379aa, 0x9971a0b0,
+    0x77a48d71, 0xc9c58d79, 0x5d7f7183, 0xb09b89ab, 0x97b2618b, 0xb586a576, 0x818dc89f, 0x8ea18445,
+    0x8d977289, 0x5d7eaf9b, 0x929a5a9b, 0x7c669884, 0x615c8978, 0x77ac856b, 0xb89c7e59, 0xb3827e7f,
+    0xaa796e70, 0x736c8f7c, 0x7b97a48c, 0x5c8a8f89, 0x989cbdaf, 0xac9672ad, 0x9dd1d586, 0xabb88d4d,
+    0xb1b49caf, 0xc3c3a192, 0x867e7492, 0x79717190, 0x5fbe89a7, 0xcf92a093, 0xae9ca775, 0xc3599d83,
+    0x5575b19b, 0x7d8f69b1, 0x768cb95a, 0x7c8741ab, 0x55e2b87b, 0xaec38ea8, 0x889cd95f, 0x7d7f7c83,
+    0x8baa817c, 0x74888a88, 0xc261628d, 0x8e6b709c, 0xa9b9bf85, 0x97938e8e, 0x83c47b8b, 0x907d5192,
+    0x9babbf8a, 0x8981c15a, 0x97a776bf, 0x659ca070, 0x7e846f7e, 0x6e6c967f, 0x639ba461, 0x96b28fa5,
+    0x76abb5c9, 0xb0a69190, 0xa2707c87, 0xbac3c8ac, 0xae70947b, 0xad508ca7, 0x8394aac7, 0xa99777a1,
+    0x957aa89f, 0x8f9e86a0, 0x93b07a70, 0x6674a87b, 0x6bb55bab, 0xcfbd7da5, 0x7055bb94, 0x4f71769a,
+    0x877bd6ab, 0x7c88a68a, 0x56966685, 0x6c76a390, 0x8fbeab66, 0x767d7e7d, 0x9a6f9a87, 0xb5b56e8c,
+    0xb67074af, 0xd3949f5d, 0x6086a392, 0x95909661, 0xa1a09c9d, 0xb68c8f90, 0x929e9ea4, 0xa1b5a9ae,
+    0x7499c3a8, 0x8797b57d, 0x87c2697c, 0x7466b76c, 0xa56e8c6d, 0x9b917e61, 0x775e72cd, 0xa698838f,
+    0xa094baae, 0x5ea2749a, 0x86898695, 0x9096a0c5, 0x5c88648f, 0x53b880a9, 0x79a777a5, 0x98848774,
+    0x9384769b, 0xad806665, 0x9e916eb0, 0x83c29f9e, 0x74928f7f, 0xa7879799, 0x8d7195a1, 0xa49c9e96,
+    0xaf5fc4a5, 0xc38bb172, 0xa4ac94ad, 0x6b54806a, 0x7c828c7c, 0x7c6fad6c, 0xa56a7b90, 0x94999092,
+    0x94b9846c, 0x899b9f90, 0xa7867bb7, 0xaa70b7a3, 0x8cbaa4a4, 0xb098ada2, 0x6a91967b, 0xb878ae9c,
+    0x837d7d97, 0x8b7e65b0, 0x74c6719b, 0x98b78ca5, 0x7d6d8ab0, 0x9ab29aa2, 0xc48b77c2, 0x81826380,
+    0xbda98f8a, 0xd28f8790, 0xb85d848a, 0x96af8f9c, 0x817f6e9d, 0x7c8f716e, 0xb88fab55, 0x627d989b,
+    0x8ba6a472, 0x9a939c82, 0x8383a990, 0x688ca099, 0x9ea78288, 0x80748077, 0xc1af83a7, 0xa082d26e,
+    0x80b29b7e, 0xa97c5e78, 0x9a908083, 0x8d83637c, 0x799b7b84, 0xa6a1999e, 0xb5ad7978, 0x8a8dae78,
+    0x6c9f90b8, 0x72cab493, 0x9890b2b1, 0x7e88ab98, 0x94a880b3, 0xbd8e8dc8, 0xaa7e839f, 0x968ca791,
+    0xa2af9580, 0x8f925980, 0x9b6b975c, 0xa7865593, 0x8fc2b17e, 0x8b857fa1, 0x9eaf878a, 0x818c8f88,
+    0x8b8c8495, 0x898f6d7e, 0xbc6db5b4, 0x668a77bc, 0x908c7fa0, 0x9578909d, 0x53758891, 0xa07bc9af,
+    0x6badaf9f, 0x62bb7297, 0x7aa1be9a, 0x74989a8e, 0xa581738c, 0x7c767c88, 0xc978bc5d, 0xbb906898,
+    0x979566bd, 0x658854b6, 0x60d2c195, 0xb5ac9c71, 0x539b72b3, 0x997f888b, 0x796790a6, 0xbf769e6f,
+    0xa977cea3, 0xc38d535f, 0xa3a1d47a, 0x6a6d798b, 0x5daabc74, 0x83a2937e, 0x829c799e, 0xbe8d8e5c,
+    0xcbaf8b79, 0x6e7a806c, 0xa9957891, 0x7ea661b3, 0x94938eb8, 0xb8a29195, 0x918d7870, 0xaea6d9ca,
+    0x63989359, 0xdd4570d5, 0xc5818e73, 0x88af4da0, 0x7d847088, 0x9ba66d7c, 0xc2999885, 0xa39274ab,
+    0xa9ac5ba3, 0x9c6ca76f, 0x9ca8b1d9, 0xb5a1af63, 0x5da17fc9, 0xa8b37c99, 0x896f9583, 0x728ebfa8,
+    0x5e7ab880, 0x81b9886f, 0x7b6f8a9b, 0x5d998ea2, 0xb471a85b, 0xb48b80a6, 0x903e9e52, 0x87758f6d,
+    0x7bb1965d, 0x7b688373, 0xc68b6ea5, 0x819cb867, 0x8c76a6b9, 0x67827c95, 0x767b94be, 0xb7bb97b6,
+    0x5b69c178, 0x678b71a0, 0xa0a6ad80, 0x9a877891, 0x8b81a77d, 0x4e6d7e98, 0xd6906d8b, 0x90a94a93,
+    0xb58265b6, 0xb9aa7a9e, 0x90a0b1b2, 0xaa848a6d, 0x80bd8b84, 0x98b293c1, 0x767d86b5, 0x6290a6a6,
+    0x966c9d6c, 0x67c09ab0, 0x8b5a89b0, 0x87789984, 0x5aa3be62, 0x9e798ca8, 0x995fb35b, 0x9680c4c4,
+    0x645e6186, 0xb0838c7d, 0x7d7567a9, 0x88b18c97, 0x9bad8085, 0x9488a75f, 0x878e9db1, 0x99b99dc5,
+    0x899a8573, 0xc27ec3ae, 0x70b37eb5, 0x998cbf7b, 0xb27b8289, 0x5a71a871, 0xd1bc7f59, 0x8a9e819e,
+    0xa592768b, 0x646a8a76, 0x9869b6a2, 0x84b76caa, 0x989ba4ab, 0x919a8b9f, 0x8775a293, 0x9d9ba389,
+    0x8aa18147, 0xa39492ab, 0x899aa779, 0x9fa68c8e, 0xb1a9ab60, 0xb1b37da7, 0x826646b8, 0x66a2998d,
+    0x6662a870, 0x9d9d9375, 0x7b519d8a, 0x54779c61, 0xaf5d6484, 0x83597b8b, 0x666abf8d, 0x9e9ca09a,
+    0x9dc98fa4, 0x8e87a671, 0x878f90b8, 0x9ea988a1, 0xb1b28671, 0x89664ea1, 0x8e9374cb, 0x82c6ba76,
+    0x97ad8172, 0x7c9a9e87, 0x8caf69b9, 0x90b996a3, 0x528e76a7, 0x4d908c7a, 0xc3605f97, 0x89998394,
+    0x66beb699, 0xbe968ab1, 0xb55a9f82, 0x7f96986c, 0x795f8d97, 0x7488ab9e, 0x969664af, 0x8396746a,
+    0x82425987, 0x63ae6180, 0xbb9382d7, 0x84b19c8c, 0xaf76a9a9, 0x896a7286, 0x957fa85a, 0x5ea1a07d,
+    0x728c7784, 0x979d899f, 0xa0a6748a, 0x777f8964, 0x7493928f, 0x9969588b, 0x84815386, 0xc0a8b351,
+    0x726ca7a6, 0x6d828baf, 0xbfa5ce6c, 0x6e7aba81, 0x679083ab, 0x578a8947, 0xa294a985, 0x7ec9a3a0,
+    0x97909ea8, 0x8fb49583, 0x707e9265, 0x788e8e74, 0x7863768b, 0xc5957dab, 0x777677b1, 0x53797a65,
+    0x52548146, 0x90d24fc1, 0x6b818ac6, 0x5598787d, 0xa5628c9c, 0x6c937b86, 0x718c9549, 0xae66aa72,
+    0x96a5acb3, 0x809bb088, 0xb977978b, 0x8a8f90ac, 0x7b7fa573, 0x9c8378a1, 0x9c8a9574, 0x8ebaa09c,
+    0xad937b74, 0x8c9d7085, 0x87b595c2, 0x83ada58b, 0x9e7379af, 0x779aa489, 0x68658f78, 0x9a9a9e9f,
+    0xa1b0bcb6, 0x72649aa2, 0xa972858a, 0x8097a1b1, 0x8f8ea37e, 0x6a81a089, 0x8ba76371, 0x83a781c3,
+    0x6476989e, 0x86929074, 0x8c6384a1, 0xa9988793, 0x87727870, 0x896e8b9a, 0x884d97a7, 0x91c77e6b,
+    0x886dbfa4, 0xaaa4a388, 0x788a949b, 0xc7a8a77b, 0xa0aaad9f, 0x7f95a4a7, 0x7b8ca3a2, 0xa7a88b53,
+    0xac55a980, 0x767ba674, 0x8ea5848b, 0xa98c7f6f, 0x88c8b5a0, 0xa2949387, 0x71798972, 0xa28792a4,
+    0xb18d5a92, 0xc58a918d, 0xb19dbf8d, 0x8c8ca379, 0x8e8e93b2, 0x94c5746d, 0xa8ab8fb0, 0x7694ad66,
+    0x75736b8c, 0xa7a98c70, 0x857198c2, 0xafc99a99, 0x8e84a0a1, 0x659ec277, 0x777693a4, 0x7bbbb578,
+    0x93a7bf81, 0x93a6a577, 0x9e7d787c, 0x7998966a, 0x7aacacad, 0x61906570, 0x9892a797, 0xa16a7983,
+    0xc98068ae, 0x598c8f77, 0x84b375b8, 0xa9748cad, 0x6f8080b7, 0x78a8a275, 0x91949d8f, 0x5d839298,
+    0xa1c07a89, 0x7a9d8190, 0x9c6f73a3, 0xbd949472, 0x94a8889c, 0x55ba858a, 0x80969c8c, 0x9275829e,
+    0x9369a098, 0xa0c082ae, 0xc36ea7ae, 0x7fa6a296, 0x718763af, 0xa49ea17e, 0x987a977c, 0x8170859f,
+    0x9a95d875, 0x8995777b, 0xa558a168, 0x8b8a9c7a, 0xa4b3939b, 0x896f8c7c, 0x8074906a, 0xa1bcc279,
+    0xa0579294, 0xae898ab8, 0xbf989d9e, 0x7ebc9880, 0x8c6eaf8d, 0x89987077, 0xc57a8e77, 0x918378b0,
+    0x86b7c18c, 0x7c91837e, 0x5a9a927d, 0x77b17793, 0x6d967990, 0xa463769f, 0xa5a495a0, 0xa6b98e83,
+    0x858aaf9c, 0xa6837492, 0xb58a75a1, 0x54c9848b, 0x6a718799, 0x88887d9e, 0xb68bb080, 0x89527970,
+    0xba9494b7, 0xb4a6a54e, 0x7156b071, 0xb69cb275, 0x639cb8b5, 0x7e83ab86, 0x9098b1a3, 0xc97bb6b3,
+    0x848189b4, 0x91688280, 0x8d7dada9, 0x7e68a96f, 0x98928ea0, 0x76aaa8ab, 0x71d29a7f, 0x9351af7b,
+    0xa989c5b8, 0xc17594a1, 0x98a4b2a4, 0xd4998777, 0x468a729a, 0xa376ac71, 0x9f6f71ad, 0x7ec482a2,
+    0x9f82b293, 0x8a978999, 0x917e8987, 0x8dafa687, 0x93907673, 0x79748394, 0xba914f69, 0x7f8866ac,
+    0x75809190, 0xad8aad9d, 0x95bc6a90, 0xb58da7a5, 0x688190af, 0x947298aa, 0x8e8d8ba3, 0xd5a38363,
+    0xc1985b82, 0x4f9a8f71, 0xbeb385ad, 0x758db770, 0x74639788, 0x7ba2babd, 0x89927aad, 0x7385a2a5,
+    0xa867a47c, 0x7a729ea4, 0x69a77da1, 0xa9b5a8af, 0x46729279, 0x75777885, 0x906790ab, 0x9791bb86,
+    0x7fa07e98, 0x9f658996, 0x84ac9493, 0xa19da39a, 0x6292c26b, 0x488270c4, 0x6c825787, 0x566f7a91,
+    0x839dbc6f, 0x6397af54, 0xab6786d6, 0xa8999c96, 0x7ca49d6b, 0x8999607d, 0x996d6c95, 0xbd787c90,
+    0xb19c9a69, 0x5ac999ab, 0x7b5b6785, 0xa2b9a6cd, 0x9e6a9fa7, 0x99a9767d, 0xa3a6a7af, 0xb55586a7,
+    0x7db07251, 0x60a99e84, 0xa45c9c75, 0x77ae9f87, 0x71749197, 0xbe9aa08c, 0x8cbe9166, 0x7999aa88,
+    0x789dbe92, 0x9c8793a5, 0x9280669d, 0x9c6da8b2, 0x88bd52a4, 0x63887859, 0x8e956794, 0x8eb1a89c,
+    0xa08ab4a9, 0xad9f7d93, 0x79b876a0, 0x86a2bb64, 0xba6f929f, 0x5d82709c, 0x91938398, 0x7ab67597,
+    0x7996a183, 0x67928e85, 0xc271c270, 0x8cb580a3, 0xa4608d7c, 0x909ac388, 0xb2878bbf, 0xa4a375c2,
+    0x769f87b9, 0xa46f8a7a, 0x789990b9, 0x7cb0687b, 0xa16e8c72, 0x6b89947e, 0x99975d89, 0x8d988899,
+    0xb79bbe6b, 0x778b7f92, 0x8a77a18e, 0xb7a08967, 0xa58db861, 0x818e8d63, 0x9d9793ad, 0x7e5db781,
+    0xac73a78c, 0x7a88b18c, 0x82635f67, 0x99a9a167, 0x839d5aa0, 0x6f69847a, 0x767781a0, 0xb49a7487,
+    0xa18a674d, 0x8a868271, 0x76a8b4d4, 0x518665b1, 0xab93977e, 0x9898a46a, 0x5aa68d65, 0x75b3729a,
+    0x88748a9c, 0x729fc9ac, 0x7fcb9286, 0xa57e90ac, 0x8b476895, 0xaeae8570, 0x8ead8894, 0x7082a181,
+    0x5f5b956d, 0x9e70b285, 0x6c90778f, 0x8f867370, 0x75a39682, 0x6a808892, 0x9392a08f, 0x6d73a0a9,
+    0xb8a77b74, 0x666bb293, 0x839ba759, 0x9cb47588, 0x7f906f7d, 0x66619fc2, 0x857b6fa1, 0xa676b6a7,
+    0x6968b890, 0xa98f7c55, 0x847b8e8e, 0x7c9989a9, 0x92c19ca0, 0xa2ad8079, 0x7382a49f, 0xa37e8c75,
+    0xa1728e84, 0x977e8aaa, 0x417d719d, 0x95838f7e, 0x8a7478b1, 0x68a69b86, 0x60874978, 0x9b729781,
+    0x6665688b, 0x867c8381, 0xae58918e, 0x8686b0b3, 0x8aa189b3, 0x73858880, 0x7195ae81, 0x948d85c5,
+    0x8cb59f9a, 0xbf498f7f, 0x815e6c70, 0xad79c38e, 0x9c959b86, 0x96915388, 0x8dbd58a6, 0x9589958d,
+    0xbb786f8d, 0x73875b79, 0xb67aaf9a, 0x7d869b9a, 0xb3ae779f, 0x84d1896d, 0x58867997, 0x926f935d,
+    0x83678c76, 0x717ab078, 0x8f8b7ab0, 0xc37d7462, 0x597a8a9b, 0x8bd5a46a, 0x7a8aa25f, 0x978b8b78,
+    0x9d6eb387, 0x697c5781, 0x836f8d7c, 0x8c869594, 0x56b791a9, 0x58ad628a, 0x9b5e7d9d, 0x6180bda5,
+    0x9c78aa7e, 0xa45b7199, 0x85686e76, 0x70b5905a, 0x9e8d8582, 0x7b678d70, 0x97b086b1, 0x7b89607c,
+    0x7b7f7d62, 0x867f9070, 0x64636fbf, 0x8899877e, 0x698f7897, 0x90847f71, 0x83869897, 0x85918a76,
+    0x956ca1c0, 0x7b7aa4c3, 0x7ea964c1, 0x79b8bc94, 0x7c69a872, 0xb4ccc2be, 0x708c8785, 0x7da98a90,
+    0x9b677275, 0x9aa1b58b, 0x9b7f5884, 0xac79b398, 0x6291794e, 0x7fc0a9b3, 0x81b4d0af, 0x5fb5af92,
+    0xa7b87c79, 0x9c7cb5ad, 0x884ca1c2, 0x586a8a4d, 0x9c7b953b, 0x588b7a72, 0x6bc36a7a, 0xb1685f63,
+    0xa2864f9e, 0x6f899285, 0x9c6c7476, 0x768897a6, 0x949e457b, 0x8789a162, 0x94708ea4, 0x857b9959,
+    0xc09498ab, 0x7899938b, 0x86928b7a, 0x819e946e, 0x858fb973, 0x98c271c3, 0xa48a4c94, 0x7aa05589,
+    0x6758b978, 0x9a6b9b97, 0xa65e3971, 0x48979189, 0x5672cb68, 0x5d93889c, 0xc08f8161, 0x88be87c4,
+    0x979b8278, 0x88908694, 0x7e7f8896, 0x9297a7b4, 0xa169a361, 0x868670b4, 0xac97a4b9, 0xa9767796,
+    0x50498c57, 0x7c969093, 0x7161528f, 0x7682a894, 0x76b98e55, 0x91b2768a, 0xba80789f, 0xa18368b3,
+    0xb690aaa5, 0x718aabb1, 0x7c7e5566, 0x836f95a2, 0x45aeb08e, 0xb6a07590, 0x535c5d9e, 0xa191b360,
+    0x8b7ea858, 0x8391a160, 0x837a569f, 0x878085ab, 0x5b5a9797, 0xc6b1639d, 0x9b8f8c5b, 0x809e7293,
+    0x859c9369, 0x73c0c66b, 0x8b766784, 0x55829a74, 0x745aaa8c, 0x968088a4, 0xa4838ec2, 0xc7667086,
+    0x716e636d, 0x7393987c, 0x6a5c4f8b, 0xba9d4b73, 0x75b99661, 0x7e8388a3, 0x825a64a5, 0xb0889e95,
+    0x8ba170b3, 0x3a82b4c0, 0x9a5e7988, 0x9c98a962, 0x92b0b69c, 0x8d9a9eae, 0x91669280, 0x709c939f,
+    0x7b927d81, 0x726e957f, 0x857a9fbd, 0x5d7d9fbe, 0x7767ba93, 0x8d946c7e, 0xa7839c8a, 0x9889a177,
+    0xcbd09871, 0xc671666b, 0x6c768582, 0x4091b580, 0x63bb8e82, 0xb7a496a5, 0xacc470d6, 0x74b1949d,
+    0xa3be578e, 0xa8906f82, 0x48658898, 0x8585a86b, 0x627b8b73, 0x87a79274, 0xcb9c9093, 0x86986569,
+    0xbba9bd86, 0x96559eb0, 0x6f8e7dac, 0xa1a87365, 0x838fbe96, 0xa5b2b588, 0xbc669a66, 0xab6e967e,
+    0x519ba37d, 0x8c767c80, 0x61719793, 0x9e6f6fad, 0x81839565, 0x57757b9a, 0x85a798a1, 0x77a783ad,
+    0x93c7aa85, 0x8a72a1a7, 0x69946482, 0xac4fa971, 0x70829e6f, 0x86ca60ab, 0x9c8c86ad, 0x84697e61,
+    0x869d9990, 0x9b7d7363, 0x76933a93, 0x9349ae72, 0xbbb4b48c, 0xb7c56892, 0xa98ca65a, 0x748e4e70,
+    0x7f8170a3, 0xaa84afc8, 0x92867377, 0xafaabd7b, 0x6db26382, 0x81bc7acc, 0x74b278a6, 0xac6d5675,
+    0x69b09383, 0x8db2a665, 0x976a72ac, 0x9b6b7474, 0x8e7ba18a, 0xc389b5a8, 0x95a8c15f, 0xa8c98973,
+    0xa5a998a7, 0x66c4d389, 0x72a18988, 0x836dad96, 0x7f5877a6, 0x9583c383, 0xa9b163c6, 0x89a3ba7a,
+    0x7fad8b5c, 0xaa928a94, 0x79987893, 0x8f739b88, 0x98a8a27b, 0xa0a48c75, 0x7c7aa096, 0x97a1a38d,
+    0xb490c3be, 0x656ca75c, 0x8c669ba5, 0xb98794c5, 0xa1a9bc95, 0xaab67c88, 0xaa676784, 0x6796aab5,
+    0x53639f8c, 0x92788ca6, 0xa2a888ce, 0x98a68282, 0x887b976e, 0xb7aa8663, 0x6dc597a8, 0x7bbf8db2,
+    0x8b859a85, 0x54bb8abf, 0x9ca5a888, 0x8a857e90, 0xad769596, 0x6f7cb376, 0x9091687b, 0x77a7797e,
+    0x86cb7393, 0x7aa5ab69, 0x95a077ae, 0x7686ba69, 0x8f77997b, 0x8e7d7e64, 0x648f91bd, 0x708d6d7e,
+    0x92869a86, 0xcd998486, 0xa1926ca1, 0x92765d5d, 0x72729d73, 0x99c2688d, 0xb57f799f, 0x9cbaac79,
+    0x927e948f, 0x678a6086, 0x86a0c4a0, 0x7e986491, 0x946db689, 0x98aaa36f, 0x8f7da483, 0x9b9eab85,
+    0xbe4b8973, 0x919e7d7a, 0x86b96fae, 0x9891999d, 0x80c594c0, 0x838ea398, 0xbfce9f99, 0x747c9689,
+    0x6f689a99, 0x7985a289, 0xae69799b, 0x87979e86, 0xa758aa8a, 0xc087a18c, 0xa0b8a497, 0x705a896c,
+    0x86c1bb96, 0x95a4c078, 0x896f6dc0, 0xa3ad9580, 0x9cb28e8c, 0xa5c4ac90, 0xb38ab086, 0xa29a8373,
+    0x667eb95e, 0x9e96858a, 0x7e858ac8, 0x8f5f7997, 0x94856984, 0xae7da685, 0x8ecca5a0, 0x8f90c090,
+    0x8cb063c7, 0x9d917ea5, 0xa9a2a085, 0xa9a68aac, 0x7b98868d, 0xc6af96af, 0xabb591c5, 0xbe8c7692,
+    0x67b988a1, 0x7d8b7697, 0x8eac8399, 0x85a67faf, 0xb9819a9a, 0x7a7cab9b, 0x8999a3a5, 0xa26bb264,
+    0x965c84ba, 0xbe5b60b7, 0xa263b3b8, 0x968a69bf, 0xb99790a9, 0x7dc18e89, 0x9f9e8baf, 0x7bac7b8e,
+    0x8797b35e, 0xac85a5c1, 0x899d707b, 0x95a69387, 0xa4cc8db9, 0x87ab9a6d, 0x76a47492, 0x7cb7a8b1,
+    0x81ac837b, 0x92bb9bcf, 0x89897596, 0x6d569fa8, 0x91909194, 0x8c7bce9a, 0x6695838e, 0xb792666b,
+    0x63ba9598, 0xa068ad8f, 0x80795659, 0x9f62c493, 0x58bcc384, 0xc3b75b7e, 0xba8083b7, 0xc29fbb70,
+    0x9e9eb3b0, 0xb4aa9a7f, 0x998292a3, 0xb1a377b2, 0x869d8971, 0x7a9f65aa, 0x91aab2a0, 0x887661a1,
+    0x927b8779, 0x96a1955e, 0x9394958b, 0x6e988286, 0x94629986, 0x80a05f53, 0x9fa79b8f, 0x9f89a6bb,
+    0x8d625fa5, 0xa6996173, 0x9e6dad8a, 0xb5b1905d, 0xc3788973, 0x80a098ae, 0xa69e7c9a, 0x967e54a1,
+    0x9e8a87ca, 0x829c8876, 0xab8e8bc2, 0x84948687, 0x83a0acb4, 0x76a2ac8a, 0xa66da953, 0xad9b80ba,
+    0x86ac6b67, 0x839d836e, 0x60a8df9d, 0xbdad8855, 0xb98c7fab, 0x7c878060, 0xb77f7759, 0x72656689,
+    0x61729c67, 0x728c74a2, 0x82bc9d87, 0xa3b090a7, 0xa473b6af, 0x80b28094, 0x8f5cc650, 0x82c2917c,
+    0x7e8ccd9c, 0x69807cb5, 0xd189b497, 0x7ab2b054, 0x6daca18c, 0x7b759da3, 0x88cd7da2, 0xa68868a3,
+    0x755284a1, 0x6caab896, 0xbb8de287, 0xb1dab078, 0x538480ae, 0x9e7d6ab7, 0x6a7d7d7b, 0xb6869fb2,
+    0x529f8974, 0xaba7bfcb, 0x8957bdb2, 0x8c83a95d, 0x8f67a09c, 0xa0805bb0, 0xa49dbeaf, 0xa8ab92ac,
+    0xcb83b879, 0x646f5a97, 0xa48a82b5, 0x7bc57985, 0x9694a0cd, 0xa47b7b78, 0x7a7a7e85, 0x9ad7afab,
+    0xc69b87a4, 0x7464a1a7, 0xa1ccb496, 0x9474655d, 0x953c9a83, 0xa6ab7c84, 0x948b8587, 0xb5b56756,
+    0x8d7d8286, 0x988e8b65, 0xa2c88dc8, 0xcd918ba0, 0x5c859983, 0x95b3966f, 0x7d9fbcaa, 0xb484ba8e,
+    0x907e80ab, 0xbf83c29b, 0x94b8af5d, 0x6161bb81, 0xb3729c9b, 0x78769b5a, 0x7f728f98, 0x7ba48b6a,
+    0xa96c527d, 0x7ca75781, 0x7a6ca675, 0x5caa868d, 0xa574a0a7, 0x95835395, 0x5f658e68, 0x96beaca6,
+    0x9e628c94, 0x626e72a3, 0x9b8985b4, 0x9ba05c86, 0xa0549c7d, 0x6c989f69, 0x83518a83, 0x738c6d8f,
+    0xa9b0664c, 0xaf868f8e, 0x91bfb88c, 0x7a7c7d95, 0x62686bcf, 0x9949977a, 0x846f8d72, 0xa3a9da85,
+    0x9d9ba980, 0xa2a6888e, 0x9f877e6e, 0x7c6670a3, 0xb28d7c8b, 0x96729aa5, 0x85806d97, 0x7cac79a4,
+    0xb7697e8e, 0x7982824c, 0xa2afaf74, 0xa8b87e81, 0xb07e7bac, 0x6b685f7d, 0x74a4a77f, 0xa69bdc7e,
+    0x74857f86, 0x7c8290a8, 0x84808f9b, 0x95b6aa97, 0x807e8cae, 0x937f8371, 0x9f8c996a, 0x775a62a5,
+    0x73856587, 0x7f7a9a76, 0x66a47bb7, 0x83968b6d, 0x88bf7ecc, 0xb493977c, 0x64a38376, 0x85b89584,
+    0x996aa478, 0xb9c39a5a, 0x86c06e73, 0x6067697d, 0xc0918186, 0x8f888181, 0xaba38669, 0x8b617b61,
+    0x8d95a174, 0x8f93b169, 0x6185be5d, 0x82a3a98a, 0xb8d181d3, 0x9e827a81, 0x9b9d9539, 0x9da0af93,
+    0x9781bbaf, 0x8dc19fa0, 0x9c7d60a2, 0x839777b2, 0x8c78aa77, 0x5c908480, 0xae88654f, 0x8d877691,
+    0xc0709d7b, 0x6b9bc0af, 0x47c2b0af, 0x90b67d82, 0x577594bc, 0x63a57fb6, 0xb1a39070, 0x78ac889e,
+    0x75a2b166, 0xa182778d, 0x7699895b, 0x869bc786, 0xad95b97a, 0x9d6fae82, 0x4b966499, 0x84aaad59,
+    0x80aa8584, 0x8d967f73, 0x7764a89b, 0x779292b8, 0xa2908eac, 0x7f889696, 0x769e8257, 0x8fa18786,
+    0x7842be7d, 0xacabb483, 0x928cc06c, 0x8c596b97, 0xb8a668b4, 0x9e717fa6, 0x93a3aa93, 0x6d949172,
+    0x965d9b94, 0x5bc96d97, 0xb588849a, 0x6293879c, 0x6a83ae7c, 0x807da85c, 0x976fa995, 0x78c88f91,
+    0x9cc273b7, 0x959c678b, 0x98918987, 0xaa68a58d, 0x8c94b0a2, 0x7ca05972, 0x9996599d, 0x788ca17c,
+    0x96c0ae99, 0x98b08785, 0x676f57be, 0xa8a168ba, 0x9aba8789, 0x91817389, 0x7591af7a, 0x75b89ca0,
+    0xa4c3a667, 0x93a8959d, 0x8567848c, 0x9b8e6284, 0x86b08b8c, 0xbe9aa28f, 0xbb8c9d67, 0x9d81737e,
+    0x6f8b8d6b, 0xaa929180, 0x9eb6b8c3, 0x97a8b2c3, 0x98a48abf, 0x9cb57b88, 0x7faca37d, 0x7c849593,
+    0xa8a9bf80, 0xb2bd78a8, 0x6d8ead7c, 0x948fa379, 0x60a35994, 0x9f77a270, 0x72bb57ac, 0x72687596,
+    0x8d8bb384, 0x9b856ea4, 0x84699a79, 0x7587a97a, 0xb79f9179, 0x9060929e, 0x84817a83, 0xa1a07b77,
+    0x826f6d91, 0x89687ca9, 0x7d82957f, 0x9890ab80, 0x826c886e, 0x7c588872, 0x91aa9695, 0xb8ccb263,
+    0xb493c578, 0x51518255, 0x978a9fb1, 0x8a99a776, 0x6f749281, 0x7b9c7788, 0x8a9f7a8d, 0x74be9ea6,
+    0x92857db9, 0x95bdb5c5, 0x53a686a5, 0x9ec081b2, 0x7e577073, 0x696b675c, 0xa6997d8a, 0xabc26fc8,
+    0x84cb8a6d, 0xbbb48a80, 0xb08a9a8e, 0x82908e82, 0x72a16876, 0x844ea4b2, 0x8c63ad95, 0x5eb1969b,
+    0xb887ae9c, 0x97b97f84, 0x94909287, 0xa492a572, 0x83719cb5, 0xbf775f9f, 0x71a98085, 0x6f98bf7a,
+    0x999d7084, 0x6d8466ad, 0x92b77e74, 0x7c7e68a8, 0xc9b3b1a6, 0x657cb354, 0x94889893, 0x9b9ec9a6,
+    0xaf87a599, 0x7d6eb571, 0x8c74a354, 0xaa95c27c, 0x969e8c80, 0xad4ca38e, 0x9ec89b90, 0x9ec19499,
+    0x6f7eab86, 0x9782708e, 0x865c6fb7, 0x7d6fa7b6, 0xa4837c6e, 0x87569864, 0xa0816ec8, 0x99a0a5a0,
+    0xa192918a, 0x6271a2b8, 0x8c6eb894, 0x8192b267, 0x7fcb9484, 0x6b848b80, 0x929c97a0, 0xa76fc660,
+    0x9b8398be, 0x78a75151, 0x958486a9, 0xc09891b0, 0xa7629b94, 0x85968293, 0x80857486, 0xa496aa8d,
+    0x93be64a8, 0x7baa7fa3, 0x9267929b, 0x79c0a560, 0x8fab7aaa, 0x8bb37e4f, 0x7ab45d77, 0x86755c7b,
+    0x7b59b6b1, 0xa4714fbc, 0x87407fa0, 0xb58d8a94, 0x65c0b889, 0x46858d89, 0x908c6ea3, 0x7692b777,
+    0xb683a295, 0xada8749f, 0x86677274, 0x9dacb75a, 0x85c49f78, 0x896f806b, 0x84ae9bc1, 0x62b0cd8a,
+    0xa9625587, 0x9b6e6d52, 0xac8c88a4, 0x83a8a186, 0xa892a76a, 0x91a89f9c, 0x97a3b472, 0xbe8d8084,
+    0x69b1ad9d, 0x817e9eaa, 0x697195a7, 0x97a15b4c, 0x9d8f869d, 0x8f6e9059, 0x8d88ad90, 0x9e9d7aa8,
+    0x906c716c, 0xa18f8194, 0x9a929ebb, 0xb4c6abc6, 0x85c49699, 0x9c8a86b2, 0xb99881a0, 0x528389ab,
+    0xa0b8a772, 0xc264788b, 0xabbfa783, 0x89889550, 0xaa9083a8, 0x9093776a, 0x936c93c0, 0x7aa59575,
+    0xb78177b4, 0x509f657f, 0xa58d6880, 0x899b85ab, 0x9c7971b8, 0x45a0a6b8, 0xadb08f84, 0x93b3a5b0,
+    0xb2869280, 0xbb92a572, 0x8c8e7393, 0xadbf936f, 0x58763cb0, 0x8395913f, 0x8d92b39f, 0xa9a48093,
+    0x7d86b08c, 0x9e965da1, 0x858b64ab, 0x8791868b, 0x8b8d9d78, 0x6b94877e, 0x74bf8796, 0x7b97618a,
+    0xbf9ea96b, 0x65597e8f, 0x8e98a8cb, 0xad91976d, 0x8ca86384, 0x9a7b7ca2, 0x5b868189, 0x92698d4b,
+    0x7c9c987c, 0x495d5f89, 0xc082a98e, 0x9a9c9c97, 0xc05c88a1, 0x7474c0a1, 0x809f8d6f, 0x85b6667d,
+    0x9c88789b, 0x8fb281a9, 0x819db560, 0xb1aab16f, 0x6fb47fc8, 0xd2a7c35d, 0xa68ba7c1, 0xad959079,
+    0x8e43ab8c, 0xa8969ab8, 0xc643b6a9, 0x8f7f847d, 0x649288a4, 0x838c8a91, 0xd59f848d, 0x636a6592,
+    0xa8749e7f, 0x9b928a7a, 0x9dbf8794, 0x6b93d845, 0x93936291, 0x966f61ba, 0x7a958596, 0xbd8b9c79,
+    0xb2ad7979, 0x5db36898, 0x997d768c, 0xba76a9a8, 0x71578a71, 0x60b68690, 0xa68383c0, 0xc17bb795,
+    0x85b36e86, 0xaaa4778b, 0x565b9973, 0xcb7f7c84, 0xa8956d91, 0x8e64a67b, 0x9b817f6d, 0x7ac77fab,
+    0x6bb47f73, 0x537d9675, 0x8e688e9a, 0x8a7eb1ba, 0x908b5f95, 0x99968981, 0x9699928d, 0xa260b577,
+    0xb967b372, 0x8ca37ecb, 0x727f4fbc, 0xa167a85b, 0x956a838c, 0xa29c6c98, 0x9e8c6d71, 0x78af7556,
+    0x99758081, 0x417f828d, 0x97936879, 0x6c8d6b81, 0x9657848f, 0x9d8e55b7, 0xa277c29e, 0x949f67ab,
+    0x859b779e, 0xbc7c7774, 0x7c8ca4c7, 0x96b18571, 0xae935099, 0x98a49f7f, 0xac6c7891, 0x7ca1aa7b,
+    0x8c89be90, 0xafb6857c, 0xbe6a6278, 0xc080929d, 0x6c66b45d, 0x58c19165, 0x937c7f85, 0x7ba494a4,
+    0x8ab5a779, 0x8e9b96a4, 0x8d786d6d, 0x8997958f, 0x9d8ca3a0, 0x776981c0, 0x9459b4c1, 0x9e735b5f,
+    0x71828986, 0x77909188, 0xaeb387a2, 0x81a98e63, 0x7b86a7aa, 0x8671925a, 0x6ba5ca8a, 0x97a27c7f,
+    0x758b6cb5, 0x987094a2, 0x878884a5, 0x7d94c997, 0x6999a7b2, 0x9596c9a6, 0x6c797ca9, 0xc8b1c1a5,
+    0xa5be8e74, 0x9f909e99, 0x937d808b, 0x9c7bb395, 0xb1aa959c, 0x726d81a2, 0xa7b5aeb6, 0x8d6e846c,
+    0x7f747b7b, 0x9194c28e, 0x8c95a9a7, 0x8e799558, 0xac839f81, 0xaca18db8, 0xa785a383, 0x7f88488b,
+    0x958b7588, 0x67ad557b, 0x7ea4c46b, 0x5d897eb2, 0x91a69a98, 0x8d918c64, 0x7f9fce89, 0x8d7186ba,
+    0x465fa077, 0x80b77bc7, 0x7f9db289, 0x919c7c88, 0x839d5c68, 0x7e74b25b, 0x8b818091, 0xa787a66b,
+    0x96c57e67, 0x7a946d7c, 0xad7e916c, 0x6e9d8072, 0x667ca778, 0x97819977, 0x798ec474, 0x809ec27f,
+    0x9e71a48a, 0x7f7ac4b9, 0x6a887b9e, 0x6092b96f, 0x8b69796a, 0xb59a9966, 0x81ada0aa, 0x5d8a6cc6,
+    0x93963eaf, 0x8f866cb2, 0xa38b6ca0, 0x8b658690, 0xa8b6b16f, 0x79dd6766, 0x828dc7a7, 0x8d63686d,
+    0x8583828e, 0xa75f9866, 0x9d979182, 0xaf6d73a1, 0x5a737ba3, 0x81a89163, 0xa3509e6c, 0x8cada7b5,
+    0xa2a77ba6, 0x9096c7b2, 0x69836b38, 0xae7da186, 0x8fb79f8b, 0x73a39cac, 0x6a647fa6, 0x8a72af84,
+    0x9f99b65d, 0x90619276, 0xa3435d74, 0x4f726d81, 0x93557c86, 0x6d6fc15f, 0x79b5bcac, 0xac8650b1,
+    0x56897a85, 0xc18b838b, 0x877f7997, 0x8ba1935b, 0x9bac7280, 0x9fac9885, 0x68527c92, 0x6c4daf92,
+    0x7f8e68b3, 0x947d7194, 0xa89e7c77, 0x576aa590, 0xa09b6da0, 0x7bc4a387, 0x98408587, 0xab9a807c,
+    0x9f587c92, 0x55aba59c, 0x6f588092, 0x5c9cbc9d, 0x7a88849c, 0x9f9da896, 0xbdb6889d, 0xa491877a,
+    0xa6a27e9e, 0xaca7a18b, 0x8d786da7, 0x55929355, 0xba4f8971, 0x6b587a71, 0x8b758499, 0x9b8dae9b,
+    0x9c6b9595, 0x78907e8d, 0x867261b1, 0xa1a98a68, 0x9a95a25e, 0x7ea18c59, 0x6381c081, 0x847f8187,
+    0x718178aa, 0x7776a087, 0x9771a9a3, 0x83bc8e9e, 0xa1a1b4b0, 0xb29c9081, 0xa25e83a5, 0x8fc266ac,
+    0x7b957d9c, 0xb377737e, 0x50667187, 0x7b719b87, 0x6e48a371, 0x9a8878a5, 0xbfadc479, 0xb8a56b81,
+    0xa1af8dab, 0xbc74bebc, 0x7c7573a4, 0x52babd69, 0x9689a271, 0x84a78c9d, 0xc0d08364, 0xba746f79,
+    0x98969969, 0xa87ebab8, 0x9b677fb0, 0xb893808c, 0x5b8e7ca0, 0x847e7d6a, 0x6ca274b1, 0x5981ba9d,
+    0xaf6f99ae, 0x973f78b8, 0x98968d6d, 0x72967898, 0x78aa9e97, 0x7789a677, 0x90647177, 0x7b945991,
+    0xa57ac4c3, 0xa69fb491, 0x74be7fad, 0xb258a06c, 0x7e74b0b3, 0x8063959c, 0x718f7e80, 0x79cb756a,
+    0x92b4a59a, 0xbda086b5, 0x988d82a6, 0x79928eb6, 0xb37d937a, 0xaf98c38e, 0x759c72b2, 0x9173957b,
+    0x9773a489, 0x9e8fa18a, 0x6a75a263, 0xc779717d, 0x708a8481, 0x729f5a85, 0xb17b7093, 0x50ac64b8,
+    0x77b75f9e, 0xc4857d69, 0x9c8ca7b1, 0x6f61918a, 0x95af9989, 0xb1a97788, 0x9b9a5ea3, 0x8b7e9384,
+    0x93a27fa7, 0x6e87a2cf, 0x616c53a3, 0x62acb2a8, 0x9d99bbae, 0xacbf9d9c, 0x958f8b95, 0x92b29bbb,
+    0x7490897f, 0x549c7376, 0x67a09dc2, 0xa09aabac, 0x67a387b6, 0xa69e7aa4, 0x8e80848f, 0x7b877859,
+    0x8d9d9588, 0xaf7d5a76, 0x96a1bd64, 0x88a29674, 0x928cbf55, 0x8e8e79a2, 0xba7ea47b, 0x6ed39990,
+    0xaf7b846c, 0x5eb45d9c, 0x84707cc2, 0x7b677693, 0x9d6e94a5, 0x7fc7bd6c, 0xa56969b9, 0xb795aaa2,
+    0xabbdad76, 0x96786580, 0x8b95559e, 0x686b6c9b, 0xba86c6a9, 0xb16aa498, 0x979d6da3, 0xb26db081,
+    0x807b7c83, 0x698f6f73, 0x789d9cb5, 0x83b17374, 0x68b8b177, 0x81929999, 0x87be89a1, 0x69b082b5,
+    0x6ca4cb7b, 0xaa6db8c2, 0x7b949f58, 0x7f8a8185, 0x6fba90a7, 0xa670ba67, 0x99b57eba, 0x93837c91,
+    0x97999c70, 0xb395a7a8, 0xc669af86, 0xc4989b64, 0x9194797e, 0x8da4ad80, 0x78697892, 0xbea4c180,
+    0x6455908b, 0x8a938f65, 0x967ca150, 0x6c6a57a7, 0x8283997e, 0x847c9777, 0xafa8927f, 0x7f8daa90,
+    0xa6b85a83, 0x87887463, 0xbb987479, 0x95b76f59, 0x9ba19a8b, 0x9a72967c, 0x6daa92b7, 0xba7d8da2,
+    0x937d7ac0, 0xa97b9a8a, 0x8a93b58d, 0x6f966a91, 0x9790aeb8, 0xadac937e, 0xba99bb91, 0x87a58b5e,
+    0x659c916d, 0x6caac5af, 0xb1947e9f, 0x6d8f7cb9, 0x6e9c7f66, 0x8e9a87a1, 0x7683848e, 0xab867083,
+    0x939f7f67, 0x86708d90, 0xa595aa60, 0x919dbb7f, 0xa8bc9071, 0x93815da4, 0xb697a371, 0x7ea66abb,
+    0x7e84a3b4, 0x5b879b79, 0x9576ae71, 0x7e938598, 0xa0a47dad, 0x77a6a682, 0xa9bca7ca, 0x80679db7,
+    0xa6abb091, 0x77b78c9c, 0x836faa7d, 0xb17790a1, 0x7d9e85a7, 0x8a91ab94, 0xaaa6b285, 0xb39d888c,
+    0x98a76c95, 0x678893a3, 0x91a8938a, 0xb8776ab5, 0x978d7fc7, 0xa0ac63a0, 0x6cb37ba8, 0xcd9e88c1,
+    0x81bdac6e, 0xa57e868e, 0xb590b16a, 0x897da182, 0x93cf797a, 0x99578d71, 0x6e878173, 0x7a88ad90,
+    0x887c8e88, 0x7997c074, 0x7c8755ac, 0xc47bb1ae, 0x848d5ebd, 0x8996a092, 0x7c5d9d9e, 0xa6969472,
+    0xa79f919f, 0x8c9eac66, 0x6d707eac, 0x93a9778d, 0x81908fa0, 0xa871b3b4, 0x7470917f, 0x84927b65,
+    0xb98d84ab, 0xb0a96b7e, 0x7d6cc4ad, 0x906fa679, 0x5e99888d, 0x72c8987b, 0x9c7281a3, 0x888a8392,
+    0x988a83c2, 0x90676a8e, 0x9e69a976, 0x95708398, 0x8dbd6298, 0x8591966a, 0x6e8d95c3, 0x7669747e,
+    0x8fbf737d, 0xad767fa9, 0x88677ac4, 0x998ba886, 0x95786353, 0x7f7a7d71, 0x9f8a9bc3, 0xad89caa6,
+    0xa89f7c95, 0x7cc2856b, 0xba7eab9c, 0x946881b2, 0x7f918bc5, 0x58a2b289, 0xb46f91ae, 0xc36b9bb8,
+    0xa1b2759a, 0x8cb3a8c8, 0xa78b87aa, 0x7f898ea7, 0x7c8c8057, 0xacbc5b97, 0x72979da2, 0x83b1c0ac,
+    0xa1738ebc, 0x94738486, 0x9b72897c, 0x74a6b18b, 0x7c806281, 0xa382a554, 0xbb986cc1, 0x97839a70,
+    0xc7a06574, 0x7e7266a5, 0xa49bae52, 0xae74739b, 0x74818d5f, 0xa1ae8b7e, 0x848ca66e, 0x61a0889f,
+    0x9ca19a98, 0x89b38e86, 0x87859b89, 0xcfaca5c1, 0x89965aac, 0x9eaaa387, 0xa3529994, 0xae9d778a,
+    0x987f95aa, 0x8da58b6e, 0x8eb28982, 0x886fc5b5, 0x71697273, 0xa09f669c, 0xbc969e74, 0x996158a0,
+    0x79ba7f80, 0x8c848d8b, 0xa061b197, 0x88bdaabd, 0x8d6b6ed2, 0x8eac7a6f, 0x73959853, 0xa186ce78,
+    0xbc536c79, 0x51609296, 0xb89d9797, 0xa4b67981, 0x80599e8b, 0x5bbc8075, 0xa857aa55, 0x55c0577e,
+    0xaf82a770, 0xb187a0c4, 0xa8a3aed1, 0x9db5bda2, 0xab7676bc, 0x7b6ca86f, 0x9b5da1a6, 0x69839abf,
+    0x9b9381c3, 0xc3cbd18b, 0x8e76ae78, 0xbd5cc989, 0xafa4a467, 0xbb7e874b, 0xb5489090, 0xc26c81a9,
+    0x8e90897c, 0x73918f97, 0x87b19b82, 0x8aa8907c, 0x8cb1afcf, 0x9c9c8c7a, 0x9b707389, 0x86c0998c,
+    0x7a885fa1, 0x4c7966db, 0x778eafb1, 0x938457b8, 0xab4a757c, 0xa0898a82, 0x7368a274, 0x729b4c8c,
+    0x8394d978, 0x7a85ba82, 0x9aa6c8c2, 0xd3929395, 0x438b58b7, 0x735f90a7, 0xcf54826d, 0x697daaa7,
+    0xa8a66c50, 0xb2c4b46b, 0x8b7bb9a7, 0x9679a59d, 0xde737f7d, 0x94a46f50, 0x77b0838a, 0x6f5eb887,
+    0xb67d92a7, 0x71cdb855, 0xb3a09a4a, 0xb47eafa2, 0xd9ad68e9, 0x975d6b7b, 0x79ab8b46, 0xafa9aba2,
+    0x85748194, 0x8d9f7295, 0x959168a5, 0xaf916ccc, 0x9698b579, 0x9b96b45f, 0xae735361, 0x58b85eb7,
+    0xa294955e, 0xa1bd9a8e, 0x84bc9686, 0xcb948c81, 0x7661798f, 0x829da098, 0x9d7da870, 0x919ad07d,
+    0xa1956a85, 0x7c8c7764, 0x97a25469, 0x839b818d, 0xb0cf9e69, 0x71a57094, 0xa175ab83, 0x7da07a71,
+    0x5b686c7d, 0x4596668c, 0x9389ce6d, 0x97b45aaf, 0xb85e66a5, 0x62738544, 0x87918051, 0x8198bc7f,
+    0x9d5b8be3, 0x7c8469b7, 0xb098867b, 0x9f7566aa, 0xb9886fb4, 0x969aa0a4, 0xcc8a6f4b, 0x7a9baf96,
+    0xa08fb672, 0xa47794b3, 0xafb98694, 0xa3b7b67b, 0x8d3b56a1, 0x565fae78, 0x6e95a88e, 0xa864d489,
+    0xa5987b8d, 0xcacc9766, 0x81c39695, 0xaa849489, 0x80b58647, 0xa7577b74, 0x9586587b, 0x8f867ba7,
+    0x76a39d8d, 0x76aecba5, 0x7c999c87, 0xb8ab9b91, 0xba778c96, 0xa1bc903c, 0xa4706944, 0x9bbc9da5,
+    0x876a6ebe, 0x8cac65a4, 0xa076a393, 0x6fc07f80, 0x8262b7a5, 0x857aa381, 0x7389828b, 0x6f898488,
+    0x9f8b943f, 0x8e9f9586, 0x8cac8fae, 0x8b6abb89, 0x5579958b, 0x62557d8f, 0xa76c7790, 0x866bdd8b,
+    0x948ba68e, 0x8c908c74, 0x77829693, 0x98508281, 0xc1658ba1, 0x6749808c, 0xb5867d83, 0xbfaead89,
+    0x817ca7ab, 0x96ac949c, 0xc16bcc89, 0x657a8ba4, 0x98a88bc3, 0x77787a74, 0x7c6d7368, 0x9c87caae,
+    0x9870a57b, 0x646aa8b9, 0x9e7ca278, 0xaaae82cb, 0x7b8f72a6, 0x8e7b8e83, 0xac57b68a, 0xaf85a7ac,
+    0x8da2b79d, 0x95988690, 0xb78587b6, 0x878a8277, 0x8a81588f, 0x9969846e, 0xa998aa5f, 0x867da893,
+    0xa391729b, 0xa5aa9e7d, 0x76827f62, 0x97c0c07f, 0x8fa0867f, 0x8d58866b, 0x9ca57770, 0x7b94a2a4,
+    0x537e86b7, 0x82b4936d, 0xc4837b95, 0x5cb2a889, 0x765484b3, 0xa771849f, 0x89b4748b, 0x8671b07b,
+    0x85748f96, 0x98b7a689, 0x7e699876, 0x7dac70aa, 0x89889890, 0x91a7b9bf, 0xa5948e82, 0x8c6e9a73,
+    0xc097b19f, 0x585c8f8a, 0xb3c3b79b, 0x7e9dbeb2, 0x7b7597a9, 0x628a8bbb, 0x738e885d, 0x8e72acb0,
+    0x677aa578, 0x9fc68b85, 0x8470a47d, 0x969691a9, 0x9f9c8153, 0x7c8d4f4d, 0x9e836c95, 0x7e988ca8,
+    0x96697982, 0x79748ba7, 0x8f9bad89, 0xc4c88e9c, 0x9e928eb0, 0x979ebb7d, 0x9ab78d65, 0x786da9a2,
+    0x92a87fb5, 0x9b8079a4, 0x7ea5ad78, 0x99a39285, 0x7a83a371, 0xaeb9a29e, 0x826a91af, 0x819a7da4,
+    0xb3887d7f, 0x92739574, 0xa98f86a4, 0x779bb1a9, 0x97606883, 0x628ab1a3, 0x786e8b62, 0xa33ca186,
+    0x6b93ac97, 0x839caaa1, 0x7a8eb3ba, 0x7c99a38d, 0x78aa89c2, 0xaf887490, 0xa59f5abd, 0x9a7b8759,
+    0x857b98a9, 0xcea99076, 0x75749597, 0x86867da2, 0xa3a277b0, 0x67ba8fb4, 0x6fa47881, 0x5c9b73ba,
+    0x98927f63, 0xa79a8095, 0xbe4a95b7, 0x9469998e, 0x689ea582, 0x559c8998, 0xa4748aa0, 0xb79abb65,
+    0x898eaa92, 0x878e988b, 0xa48d85c1, 0x76aaa1a0, 0x9aa27084, 0x6e7b918e, 0xbca8a289, 0x7a64a6bc,
+    0x9588a68e, 0xb8a19ca7, 0x88828d58, 0xa98e958d, 0xa6997073, 0x89599059, 0x7b87b4b9, 0x9cb78ac1,
+    0x8872ce86, 0xad8dc171, 0xc183b285, 0x7a96898d, 0x9f8391b7, 0x9173628b, 0xb3797278, 0x6e9067a2,
+    0x85b7b38e, 0x9c877586, 0x84676551, 0x91a781af, 0x9c7e81ae, 0x9a70769a, 0x9c9c7e73, 0x8c74a088,
+    0xa258a0ad, 0xa58b767f, 0x829e9392, 0x7880ab87, 0x775c679f, 0x7b9d8099, 0x9e988563, 0xa07fa2ab,
+    0x8b9b7ab1, 0xabcca989, 0x7285b580, 0x9d8cb473, 0x9e7f7592, 0xa4586f41, 0xac8570b0, 0x9483587d,
+    0x928a8981, 0xbd697884, 0x7c517b76, 0x6e769f61, 0xa49075b0, 0x6074cf7a, 0x9fa06bb3, 0x6487a489,
+    0xc36fa7a7, 0x937ca5b7, 0xa962b284, 0x9780a7ae, 0x7883b0c0, 0x6aa7b19a, 0x8c889666, 0xba709a73,
+    0x6fb88a6e, 0x90947e55, 0xb8868fce, 0x72937772, 0x997d8da5, 0x9a90789c, 0x6ec081a7, 0xb16cc671,
+    0x9d86b08e, 0x53869390, 0x7d6f83a5, 0x9f7e8491, 0x84819f72, 0xa8918591, 0xc08d69c0, 0xa69e8d8a,
+    0x80959c8f, 0x9566718e, 0xa986b751, 0x98a5a7ca, 0x5fa6a75e, 0xa39c8f93, 0x9a8e3c85, 0x81a474a7,
+    0x81b5889a, 0x96cb977a, 0xb4677565, 0x7892a58c, 0x93776aa0, 0x829a6db3, 0xab7898ae, 0xc28ba796,
+    0xa56b8d97, 0x8f757bad, 0x74757a64, 0x8b87b799, 0xa1639c90, 0x70aba0ae, 0x8480be4c, 0xa789a18c,
+    0x86b27b86, 0xb57bac8d, 0x8b926d88, 0x79afbb9c, 0xc29b7393, 0x7b526d49, 0x6e7879a0, 0x8b8fa17f,
+    0xa06585af, 0x627e60b4, 0x7193c287, 0xa6a58ac3, 0x9eaca883, 0x7c7cb3b0, 0x5d828cbf, 0x67bcb16c,
+    0x81c05a7f, 0xbe9886a9, 0xb3aba6ad, 0x9483a37a, 0xa6915c9e, 0x8a689790, 0x9e5887a3, 0x9476b79a,
+    0xa2769a8d, 0xa780af92, 0xc38fae9e, 0x7b9eb37b, 0xc9538c87, 0x72808386, 0x74ae806d, 0xa598b964,
+    0x827d65aa, 0x91a899aa, 0xb1877da2, 0x9cb0af7a, 0x90828067, 0xa385aa87, 0x6e7f72c0, 0x7b7c747a,
+    0xa86dc977, 0x6a939f71, 0x5e8d7c56, 0xcb6aa8ae, 0xb5c46697, 0x59637d89, 0xa08c459f, 0x8ca383b9,
+    0xb19d88a5, 0xbd8d826c, 0x7a7d788f, 0x6e7b9fa0, 0xb1bf4488, 0x7eafa38a, 0x86797bbb, 0x9f517ca2,
+    0x9b58a987, 0xa7968d90, 0x5d69939d, 0xa28fad9a, 0x815ba564, 0xc09e847b, 0x7bcd687a, 0x63a065a0,
+    0x6f688d78, 0x88afa7a0, 0x926c8d84, 0x8aae947f, 0x6e6f5295, 0xa67370a0, 0x7fa25678, 0x977181ad,
+    0x9868b383, 0x8b5fb390, 0x8c937e86, 0xb18b717b, 0x855a93b4, 0x8d77a19d, 0x877f7dad, 0x528e97a4,
+    0x7a839363, 0x898a7fa1, 0x85b57490, 0x83aea397, 0x9cd14a75, 0xad809e85, 0x789d7f7d, 0x6d9a857f,
+    0x8a906e61, 0xb49c8093, 0x9aa17987, 0x95949061, 0x9283536d, 0x9c9087ae, 0x5876a094, 0xab86a884,
+    0x7b676592, 0xb2ab9a5d, 0x7ab28eca, 0xbdb18977, 0x7a4d6f76, 0x6eb4706d, 0x93688b83, 0x918095c9,
+    0x87a8649d, 0x5f91a2bc, 0x8770766b, 0xbc8aac96, 0xa2689058, 0x89c5a37d, 0xb2c9b49a, 0x78b8614a,
+    0xb2a47a6c, 0x85b5529e, 0x8a73b799, 0xa4729a5f, 0xa0a17a93, 0x568981a6, 0x547c80ce, 0x708276d2,
+    0x4c9f9b97, 0xa0a77da9, 0xa6b7a265, 0x6fba8895, 0x726da162, 0x94b9947d, 0x74b85592, 0x919d5a9c,
+    0xa2865da2, 0x80979db5, 0x6e857a9d, 0x6f73a196, 0x914b7384, 0x66b2847e, 0xc06682a1, 0x5eb19f96,
+    0x9ab5a78d, 0x627673a3, 0x9aa56da7, 0x60727f9f, 0xb0488c8d, 0xa78775a8, 0x91948595, 0x8d844b65,
+    0x76ab9898, 0xc1766ea5, 0x73c07196, 0x7180a2b9, 0x9e786e62, 0x69b0c6b8, 0x76c8609f, 0x8b93616e,
+    0x906a7f93, 0xdb8f957c, 0x7c97506b, 0xae93ac6a, 0x8778a570, 0x8cba7cbc, 0xa9987f78, 0x879d9478,
+    0x804768c6, 0x778789a6, 0x808779ca, 0x8695c397, 0x7b5789c4, 0x9fc98e8e, 0x7c46587b, 0x9e786d96,
+    0x88988889, 0x5c92a88b, 0x877d9486, 0x89ae8f93, 0xae5bae79, 0x9982a17a, 0x79876e94, 0x5e6f5445,
+    0x9b97ad8a, 0xc0947a59, 0x9aab648a, 0x677d9996, 0x6795588a, 0xc0ca6aa7, 0x837389b3, 0xb4559985,
+    0xa47d8288, 0xdaa38493, 0x6bb47bac, 0xb297a386, 0xaf8a9e8c, 0x617f6e93, 0x9e69af95, 0x8ca17c5f,
+    0x5e73a1b4, 0x85708671, 0x755e6973, 0x4fba73a8, 0xa69a7c9e, 0x5c966895, 0x7c9a676f, 0xb36b7876,
+    0x90d48d72, 0x6e82a4bf, 0x97828985, 0x947e9081, 0x6c7c916c, 0x9a847872, 0x8378929b, 0x60bba27e,
+    0x72619275, 0x708476b9, 0x6d898c9c, 0x99598097, 0xb1669179, 0xaa98d5a0, 0x5f80ac6f, 0x4c968267,
+    0x6f717098, 0x8c7fc7b0, 0xa27f668b, 0x9e82a393, 0x7d8d7950, 0xbdbf856f, 0x507dbf8c, 0xa3788a72,
+    0x6cb0998a, 0x755e94da, 0xb86964b4, 0x95ad7ac5, 0xb08e7e98, 0x6380918d, 0x8954c268, 0x88778688,
+    0x6886a071, 0xaa719a9f, 0x62616d97, 0x8fad7aad, 0x75a2a5a0, 0xd49c9c71, 0xa4a17766, 0xafb66677,
+    0x96907a94, 0x9d78888f, 0x8780aaa5, 0x748cc4a0, 0xb37c777d, 0xaca0ae99, 0x4888aac6, 0x95748c91,
+    0xbbbc5b6f, 0xc6899f78, 0x7f857c88, 0x91905f80, 0xa080ac68, 0x8c6c8c8c, 0x8b71acb0, 0x7e92659f,
+    0x9b857b99, 0x9686aaaf, 0x766f65b4, 0xa1867f87, 0x5c9574a6, 0x9e7a709f, 0xbe856d82, 0x9176b3c9,
+    0x8b955aa7, 0x717e7c96, 0x457e7b7b, 0x7d6b9eaf, 0x64985890, 0x7aa89a7f, 0xc9babc81, 0x6790ab7e,
+    0x98aa8993, 0xb49a9776, 0x70898097, 0x5453665d, 0x8e766678, 0x7354a085, 0x8b6d90b2, 0xb0759a87,
+    0x8ea48f6c, 0x96b5989a, 0x658d997a, 0xa99ba295, 0x8e8bbb80, 0x7fbc8c9b, 0x8c839985, 0xb2a96aac,
+    0xcaa5919b, 0x7984ada5, 0x74828098, 0x726cc09f, 0x8c6ea7a4, 0x91877c98, 0x8b74617d, 0x81878874,
+    0x99a2c685, 0xbeb4959e, 0x8186b683, 0x878ed172, 0xcfaa9f88, 0x8897696d, 0xb08f7c63, 0x568c7e69,
+    0x948e828a, 0xa993818e, 0x86c1928f, 0x6e686f97, 0x9090b48f, 0xa6a16276, 0xbe9c8c91, 0xa6ab8ad0,
+    0x557065ac, 0x8693788d, 0x8f9f9b9b, 0x73b265bf, 0xa8877fad, 0xb8bd8985, 0xc962ae90, 0x62ab9793,
+    0xb375a596, 0x837581c1, 0xac868b9f, 0x9b4f7a70, 0xb6bd9a99, 0xbbce98a8, 0x69a65fb7, 0x729e9163,
+    0x8bc18362, 0x8fbaa780, 0xa4a7bdb1, 0x6f7eac7a, 0x9d71a485, 0xa0bb849c, 0x7a7ad3ac, 0x7da1bfa4,
+    0x8776a374, 0x96bfbaa4, 0x888f715a, 0x7b959974, 0x9682cf89, 0xae87b9a4, 0x9eb7827f, 0x6b8a84ae,
+    0x8bb6919a, 0xc47faa93, 0x75a7a7c2, 0xb49e95b7, 0x8ca69fbd, 0x9ea1bd7c, 0x7f9979a0, 0x97b08587,
+    0x8e8e9791, 0xa881b27e, 0x909b6481, 0xb5a47c84, 0xa78a8582, 0x88ae639f, 0xadbb9bbd, 0x829da98b,
+    0x9c9fc2aa, 0x67a5b56f, 0xb67e96b5, 0xcc7a729e, 0x9db38faf, 0x938f8ba4, 0xba85a2c1, 0x96678da8,
+    0x9d6c795b, 0x6fa4a795, 0x53a56598, 0x8cbca490, 0x6fce8db4, 0x999bad7f, 0x7c817197, 0xb6769284,
+    0x87a1618e, 0x7da7ab9f, 0x9d92798a, 0x8687aa70, 0xc79b56c6, 0x92a2b188, 0x9a829ea3, 0x889e588e,
+    0x70ca9993, 0xa7b1b689, 0x84a78d80, 0xae59a784, 0x8f80a861, 0x907bacc6, 0xb0756ca7, 0xa4aca19a,
+    0x9e999883, 0x9b94af81, 0x88a67fae, 0x86658bad, 0xa28f6aa5, 0x959da499, 0x83829a87, 0xaa9cb7a5,
+    0x7f905b76, 0x878e9580, 0xb98aa1a1, 0x9576a978, 0xc2b56a8b, 0xa88eaa9f, 0x80997dae, 0xb86e7a70,
+    0x7aa298ae, 0x8c8a9793, 0xae8176a1, 0x77868f87, 0x8d8fae77, 0x708cb799, 0xc87f878b, 0x6c88a46d,
+    0x937f9c6f, 0x807ec0c0, 0x826277ba, 0x908894cf, 0xb479988f, 0x66956e81, 0x989c909b, 0xab887657,
+    0x7374a587, 0x7575a05d, 0x957180a1, 0xcdb99565, 0xaf966b8e, 0x838fbbb6, 0x697b947e, 0x845cabb7,
+    0xba95b2a9, 0x7386948d, 0x959279a3, 0x9c79b88e, 0x8b7db4a2, 0xacb0b95c, 0x7065c78d, 0xa69ac1b0,
+    0x9e8ea08f, 0x92ad74af, 0x78957f7f, 0xa3a89ea0, 0x8e748798, 0xa29599b9, 0x617f677a, 0x8493906b,
+    0x92a2917c, 0x7b9f7e96, 0xcbb1a099, 0xb998a26d, 0xa0c08c9c, 0x708575ac, 0x86a6ad91, 0x6a9da4bb,
+    0x7c5e819c, 0x83ae9899, 0xba93a468, 0xb47f5c93, 0xa568a5b4, 0x7e788b8b, 0x93a3805d, 0xb063a271,
+    0x86a29b93, 0x837098b2, 0xb9ba88ac, 0xadb28cbd, 0xaecb8d76, 0x57a77d9d, 0x83b27f7c, 0x828b8680,
+    0xad71a4c7, 0x667fa1aa, 0xcecca7be, 0x85939ba9, 0x6d9e50ad, 0xce828d97, 0x7bbaa6bb, 0xaa887190,
+    0xa0807076, 0x718977c8, 0x69a0d2a8, 0xb2937e89, 0x939d74b1, 0xa49965b8, 0x7982b076, 0x8a7e687b,
+    0x77917f9c, 0x99908f76, 0xa65a65bb, 0x91bfb0b5, 0x9b9e7d8f, 0x859495a0, 0xa88e936e, 0x8891b575,
+    0xa0a9b37b, 0x7ea973a1, 0x96918d5b, 0x93c99f89, 0x7f548780, 0xcdaea3b1, 0xb3a99052, 0x98a96e8c,
+    0x9aa7996a, 0x9c9fa778, 0x8e6ebfaa, 0x96816cb4, 0x71a576b4, 0xc4bfb8bd, 0x9e9895ce, 0xa55f8672,
+    0xa6a06184, 0x61857c72, 0x5590b5a1, 0x75bc6f79, 0x7a7d9c78, 0x6d7c9cac, 0x6ea18992, 0xab74b985,
+    0xc48286ac, 0x5ab2c8b2, 0x776d7ea1, 0xac7f5e84, 0x8172bb8d, 0x91a5a279, 0xa37f7ea0, 0xa34c8667,
+    0x8e4a85b2, 0x778b7cb5, 0x85679569, 0x959370a5, 0x4f63b88a, 0x93929e6b, 0xa484975b, 0x99a36d9b,
+    0xcb7a5c5b, 0xb6a8bdbe, 0x899f9db3, 0xac5d837d, 0x66af7895, 0x7f7a9762, 0x939cb675, 0x7d5c8da5,
+    0x839e8892, 0x80a889a0, 0x81947ca2, 0x929f7cb3, 0xa2799c72, 0x9d7d895c, 0xb6595777, 0x9974a19a,
+    0x9667a288, 0x8c979099, 0x9e8f8476, 0xa09a6e96, 0x9ba0a9ef, 0xa098b66d, 0xc2a3af9a, 0x6c8ca08d,
+    0x8182b2a4, 0x8773896f, 0x8355978e, 0x7396918f, 0xaf5ca390, 0x9885c74c, 0xc049804e, 0x867e508f,
+    0x9683bd70, 0x9746ae7b, 0x82b8c389, 0xb977a473, 0x819f987e, 0xad4e9ad1, 0x8a73b193, 0x6f61a552,
+    0x8179757a, 0x97c172a0, 0x4a8da07f, 0x9b95a5ae, 0xb7e639b8, 0x866c6ca8, 0x8aa3a5ab, 0x85738e8c,
+    0x6f9d879b, 0x36bd9999, 0x98a9bc91, 0x768a8c7f, 0xa9638c92, 0x63928a56, 0x9dab8650, 0x8c878393,
+    0xa16dacaa, 0x57bd3c9e, 0xa98b7150, 0x70a078a3, 0x949a5dc0, 0xb386a55c, 0xdcb16e76, 0x739661be,
+    0x7d917873, 0x7eb1b5a9, 0x58a39096, 0x74647a61, 0x4d80be65, 0x9257b2ce, 0x8fa79c8a, 0xa567aea3,
+    0xa287506f, 0x8f8a9e82, 0x66936ec4, 0x7d7bad8c, 0xb3907987, 0x9287728c, 0x56b9b1b9, 0x8a614270,
+    0xa48fb67d, 0x548aa9b8, 0x9989895f, 0x968dbf8b, 0x96647fa2, 0xb39e745d, 0x61b0814d, 0x8b70aaca,
+    0x7492618e, 0x9874689a, 0x8e7693ac, 0xc28890e1, 0x8e6895ce, 0xa473a774, 0x7791bd61, 0x636d49a3,
+    0x7e72caa2, 0x7076ad9e, 0x899695a8, 0xac558a6d, 0x6460ada8, 0x51547e9d, 0x94607c8d, 0x6b6884b2,
+    0x7091986b, 0xb99a957c, 0x7a9f9c5a, 0x8b5bb2a6, 0xb8b46075, 0x9e566f71, 0x6f987853, 0x70795db7,
+    0x6a8f7ab2, 0x49ab9490, 0x99a48786, 0xa6cb9e8b, 0x6a3a71c3, 0xb18c788d, 0x989c8588, 0x87738387,
+    0x927e7ba1, 0x7d9564ca, 0x6ca2c685, 0xaf98669b, 0x8c88ad94, 0x959dc37e, 0x8b80af9b, 0x72bd9072,
+    0xba75a268, 0x9a8b9d58, 0x9da5c3a2, 0xc263766d, 0x3e7a9fa1, 0x8979a7dc, 0x997fb88e, 0x8d77aa74,
+    0x96849380, 0x94bd7a9d, 0x8d9caaac, 0x789ca093, 0x9e90528a, 0xb05e627e, 0x8c8b6983, 0x6a8655cc,
+    0x898378a3, 0x9959858c, 0x8c888a4f, 0xba7da158, 0xc194aad6, 0xa2748898, 0x978a615a, 0x7a5483a0,
+    0x7f64b29d, 0x998d6d94, 0x877c8e7f, 0x8d7c84a1, 0x607b85a2, 0x81ab8366, 0xb754866d, 0x5aa07fa0,
+    0x6c94aba5, 0xa99c8c8d, 0x6ddca892, 0xa5afaaa6, 0x7e4f6db4, 0x8133828b, 0xa278823b, 0x9880a884,
+    0x9a5a8b88, 0x98ab96b1, 0x676fb963, 0xab729b90, 0xbb9d76a2, 0x8883499e, 0x88839192, 0x9a558ca7,
+    0x7767b3c4, 0x67916baf, 0xcbae9e6b, 0x66a0978d, 0x9090668d, 0x7d9391ad, 0xa9b865a3, 0x83a59d88,
+    0x896b4cb2, 0x917c4d95, 0xb373a368, 0x8c80a19c, 0x9b6f98a8, 0x72c0a98d, 0x91a278a8, 0x6a9e90b5,
+    0x8765906f, 0xada1a26b, 0x97be849f, 0x7a82a099, 0x92348586, 0x637e94b0, 0x76688d43, 0xa97d916e,
+    0x9f815e9d, 0xad96488b, 0x9371a582, 0x97c194a4, 0x83a98e94, 0x6d40484c, 0x626b8063, 0x6a7f7da7,
+    0x6f9d8f80, 0x9170699d, 0x699a7e8a, 0xa8a6be55, 0xa54794c3, 0x9ca5b176, 0xab7a6393, 0x8ec0a796,
+    0x7773588b, 0xab716882, 0xc464ab5f, 0x738f4bb1, 0x79798ec6, 0x8f91ce89, 0xd65f8e7e, 0x645d7eb3,
+    0x9daf9574, 0x8a76b386, 0xb08c8dad, 0x817f7f68, 0x93547883, 0x777d677b, 0xa078c65f, 0x9435c7b5,
+    0xa0508d6a, 0xc77d6a8d, 0x658f7ca2, 0xa692cfa7, 0x65965e6d, 0xad70596b, 0xcabc98a1, 0x647f3e9c,
+    0x829b9390, 0x879093b5, 0x6e8ac469, 0x76949f8e, 0xa05da096, 0x9a81719f, 0x9cbf7c89, 0x827caeba,
+    0x5d6d83bd, 0xab887fbb, 0xe18e9d7b, 0x748a85a8, 0xad819283, 0x7274c47f, 0xbe609da4, 0x555392a5,
+    0xa683a44d, 0x908da07b, 0xa3b3bba8, 0xc84f8983, 0x779198b2, 0x4f816997, 0x7679ac65, 0x8e89cca0,
+    0x91607b59, 0x6a726ca5, 0xbf99adaf, 0x6daabb6d, 0x97b8717d, 0x9373824b, 0xa784729b, 0x8d9a5e9e,
+    0x7cab8570, 0x8f9a8499, 0x6d86864a, 0x82a9948e, 0xb32fb08e, 0x817d659a, 0x968c5382, 0xa789a188,
+    0x9e774b7d, 0x6fad938f, 0xaa3b8f68, 0xb2aa7fb8, 0x796c9d9b, 0xaaaa8eb0, 0xc5649b7b, 0x9857b18e,
+    0x8186a582, 0x8e6ba657, 0x8e9383b2, 0x93618745, 0x63658b8a, 0x4a7a66ad, 0x8a8c9e67, 0x7f5e8868,
+    0xb9667996, 0x74b386b5, 0x687ad157, 0xca709e96, 0x9bb368b6, 0x7483577b, 0xabbca491, 0x8c665a93,
+    0x698a8d90, 0xacb08697, 0x6896a772, 0xa692a787, 0xad817171, 0x879c68a6, 0xbc7e526c, 0x90a3ccb0,
+    0x7c736ab7, 0xc0877688, 0x8caa8191, 0xa1a76d7f, 0x739d95a2, 0x9869979c, 0x98635d8b, 0x943ea19f,
+    0xa8a38d95, 0xb27bc282, 0xb1a369ba, 0x86778b7f, 0x8b5a7169, 0x8b91868d, 0xbb85c36e, 0x968180a5,
+    0x91868ba6, 0x5b9b856d, 0x9c87be91, 0x7b7ebb84, 0xa4754e8b, 0x93606254, 0x8879889e, 0x92995fbe,
+    0x598b7876, 0x5299846a, 0x82889967, 0x92a6a09a, 0x8c6699c8, 0x897c8287, 0x6cba89b1, 0x7d86b090,
+    0x60967eb4, 0xd6dd7369, 0xb86cc76e, 0x8f6c75a6, 0x56a85e8e, 0xc18d925f, 0xb683b6a5, 0x478c8fa5,
+    0x8c52a96a, 0x94778748, 0x91a76b89, 0x8639687c, 0x6ab57998, 0x499f39b4, 0xd2a68871, 0xa3689c91,
+    0xb476957b, 0x97877ea1, 0x579cba81, 0xaaade059, 0x93cba887, 0x8587929b, 0x7c849bac, 0x8a88608f,
+    0x69915490, 0x72a07baa, 0x5f7c6f79, 0x8969777e, 0x8e4d9ba4, 0x9a81cc9a, 0xce8b4584, 0x569979a9,
+    0xa87973b0, 0x889f3992, 0xab3eae96, 0x90c67bc3, 0x84a15b92, 0xa7a1bc7a, 0xbd97b589, 0x8d6c67a1,
+    0xb348a779, 0xcf658672, 0xaba77187, 0xa89bc48c, 0x677c7796, 0x428260b5, 0x64a5b08b, 0x9c7f8470,
+    0xb4544e8e, 0xb9858780, 0x957386a3, 0xb78dc78a, 0x99929d9d, 0x6d8b9250, 0x89b6ad96, 0x9b8b4dbe,
+    0x67b19482, 0x8773989b, 0x8c68c874, 0x87a9bdab, 0xa54c6881, 0x919d6da2, 0x82c369a9, 0xac71b576,
+    0x7d9d74aa, 0xa5aaa895, 0x7e809987, 0xca929772, 0x62a56e71, 0x9d93ae69, 0x926a7a98, 0x9a92878a,
+    0xb7699473, 0x7583d395, 0x93838062, 0x9f7fb19b, 0x8a74a08e, 0x83786287, 0x77e36d54, 0xaa8b63b2,
+    0x7f736b84, 0x7b5c8fa1, 0x925c8c6f, 0x97cbb076, 0x858c8898, 0x9f736cb3, 0x90c2a7cc, 0x6a6690c1,
+    0x958788ab, 0x807887a4, 0x7973c080, 0xd6b5c16c, 0xa4766bc8, 0x7877b5b2, 0xbac465b2, 0x9e8f7484,
+    0x81ab91c5, 0xcbbdaa87, 0xbaa7ac54, 0xacabaeb0, 0x99996f8d, 0xb9a3a4d4, 0x828488a9, 0x856c8660,
+    0x969c8a59, 0xd35dbd9c, 0x8e8872c9, 0xbe8b917e, 0x8457756e, 0x6fa760ab, 0x59ccbd67, 0x88789caa,
+    0x9f789a8a, 0xa27fb495, 0x8f549dbb, 0x9e86bbb0, 0x91bc9caa, 0xa88c8372, 0xd4a99f96, 0x8c974dac,
+    0x5b8e95bc, 0x707165b5, 0x5889a584, 0xc7959699, 0x89838ebb, 0x8a779db2, 0x9ad038a8, 0x8a7e659b,
+    0x854b4dac, 0x90c46777, 0x7fa8837c, 0x7091977e, 0x7b9b6868, 0xc678997e, 0x805dcb77, 0x7f9684ab,
+    0xc38a8d52, 0xa080ea5f, 0x97c290ae, 0xb88a8040, 0x7665989b, 0x9a8f6d90, 0x31a1909c, 0x96a9858f,
+    0x6277668b, 0xbaa49393, 0x9b83a3a9, 0xcc94829f, 0x99a754a3, 0x80ae8951, 0xc36081a0, 0x605fb2bc,
+    0x5bc69bb4, 0x586b90a6, 0x95aab46c, 0x9bb1a681, 0x965f77b8, 0xaa68c664, 0xa3a14abd, 0x56936a86,
+    0xbb529cbc, 0xc8c08cb2, 0x6ac262ae, 0x5aa7acaf, 0x4e784099, 0xd185d8a2, 0xb5736a5d, 0x698d8299,
+    0xba906b74, 0xd936bc80, 0x9da09977, 0x80709f3d, 0x5f4e7d96, 0xa69c798f, 0x439db043, 0xbc849aa4,
+    0x564e77cd, 0xc27978ac, 0x8a587496, 0x8cbca794, 0x7277b0b6, 0x717e7eb2, 0x90925fb5, 0x5d566f96,
+    0x5c9d92c4, 0x868282b7, 0x8e858889, 0xa5a092c0, 0x97887ba5, 0x9a857b60, 0xb6a977ab, 0x42b3949d,
+    0x9a6c85a2, 0x81705469, 0x757c8c53, 0x8d9c89a1, 0x91a2729d, 0xbfbeba91, 0x989893af, 0x73b0945d,
+    0x9a6b776f, 0x9547b888, 0xc589b3b1, 0xeda6979e, 0x79759668, 0x5a81885f, 0x689b8851, 0x9dc99b99,
+    0x94b47dbb, 0x9977d3ac, 0x7e998499, 0xa268c3ce, 0x7a73a285, 0x95ba9447, 0xa4b48091, 0x6970c1dc,
+    0xa195adcb, 0x5165b6cb, 0x77855e63, 0x678392bd, 0x7c5f6b9a, 0x958d5cc6, 0x809fc1ac, 0x657c6459,
+    0xa78a729d, 0x7eaca563, 0x88b46d8f, 0x99979686, 0x81907679, 0xae76d279, 0x7a9cae71, 0x7d908371,
+    0xc491a8a3, 0x959ec2a9, 0xa4ce776d, 0xb6898e4c, 0x9c5b8d76, 0x736d936c, 0x5c66ad75, 0x8ca687b9,
+    0x8476a17d, 0x8da7a3ba, 0xbf5dafa3, 0xb15aa775, 0x577b6d8f, 0x6b5d586a, 0x997a927a, 0x60896ab8,
+    0x78768b80, 0xbc91a592, 0x5b7abe69, 0xaeafd98a, 0xb2767b71, 0x9e6aa977, 0xc0719d68, 0x75496181,
+    0x938c80a1, 0xa97a629f, 0x4fc25f7b, 0x8e8d7f50, 0x86698c72, 0x99b5baa9, 0x7d87a28a, 0x6c8d7eb2,
+    0xa2a47ea1, 0xcba087bb, 0xc26cb57d, 0xc99d5d75, 0xa8887c71, 0x86aa816e, 0x81c27588, 0x7cbd7676,
+    0x807b6c98, 0x63b2ad8b, 0x67a49f6c, 0x94a18e90, 0x729a91b3, 0x9382ad85, 0x819258b7, 0xbea977cd,
+    0x6698d876, 0xab8e876f, 0x8bd19eae, 0x7e81b4ae, 0xa1b67f97, 0x5e89ae8f, 0xdd60878f, 0x764e9978,
+    0x808173a0, 0x546d7d86, 0x95a3a394, 0x9f69918f, 0x5d7e869a, 0xa5a1aa70, 0x5d9a958a, 0x9d8e9379,
+    0xb2baaa62, 0x8e7d8193, 0xa7819264, 0xae9f9e7e, 0xa8988c7b, 0x99918ebb, 0x846d627c, 0x8bb2bac0,
+    0x9a567286, 0x867a888c, 0xa4988cad, 0x7f6baa6e, 0x8aad7ca3, 0xa47b6f72, 0xd29f727c, 0xb8a5747f,
+    0x9068bf94, 0x8291a293, 0x8fa6b389, 0x807da971, 0xa372749a, 0x6f7d908a, 0xaf8c5e68, 0x7ebd9c8d,
+    0xa776877c, 0x9cc8d2a0, 0xbb9a928d, 0x68975ecf, 0x8b7ba981, 0xb86372a6, 0x96cd7d8d, 0xab719393,
+    0xaca56b6e, 0x8473aebc, 0x7e896e8a, 0x87ae94a9, 0x7bc595b8, 0x6589c988, 0x70666c7e, 0x539baf87,
+    0x8dba896c, 0x77999862, 0x75a49ec6, 0x8ca581a7, 0x9aafaa8c, 0x8d7e579e, 0x85a97b84, 0x8270628b,
+    0x9679a05f, 0x9c6ba979, 0xb56d8fb1, 0x8994736f, 0x837bb875, 0x6b95a0cc, 0x959bcbb6, 0xb87776a2,
+    0x9b7fc1a6, 0xaba27887, 0x6dc1878a, 0xb07a59a0, 0x8d9360b2, 0xb581ad9c, 0xab9e67a5, 0x92a16370,
+    0xa39a9f98, 0xa48c7b8e, 0xac977cb0, 0x86a2c86f, 0x9b6ec0c9, 0x6da78886, 0x8ebbb185, 0xbf5ea3b8,
+    0x64948879, 0x88a7a999, 0xa27ea176, 0xcb899264, 0x8ea47582, 0xb4b579a6, 0x74a2698f, 0x8ca19d77,
+    0x9a89976c, 0x9c868076, 0x9d70a1a3, 0x9b7aa89b, 0x7a64b396, 0xc2ac9999, 0x70799375, 0x92688997,
+    0x60c48588, 0x799bab8d, 0x9f8f9089, 0x868faa9c, 0xbe809cc9, 0xa1757267, 0x82b39ea1, 0xc7a0b88a,
+    0x9394617d, 0x889f8382, 0x8b6d8a88, 0xa794ac6f, 0x7182ba7f, 0x8f8eac9b, 0x79bf6dae, 0x6a64a28d,
+    0x92c0a3b2, 0xb57bac9f, 0x9d9dab9c, 0x86758e9e, 0xa778b377, 0x9c93bb90, 0x7956918b, 0x82a89ab3,
+    0xa3777aa8, 0x6a88909e, 0x699f979f, 0x959078b2, 0x94919c6c, 0x7f94876a, 0x636c9960, 0xafc2845b,
+    0xc3ae709e, 0x8f8895a4, 0x91819dab, 0x99806eba, 0x587c757a, 0xa575ae59, 0x9e839bc7, 0x7072a199,
+    0xb0a2b3ae, 0x9bb5968c, 0x6d6da09b, 0x9fbd9883, 0xaba18e9d, 0xa0868b73, 0x95a8bcc9, 0x68b89e6f,
+    0x9f74b8bf, 0x7bc390a5, 0x6d7e987d, 0x8c8e9c5d, 0xa5c87583, 0xc972949c, 0xbd7a6d77, 0x776e6ba2,
+    0x61a45c8d, 0x7bb47980, 0x79c08b59, 0x609eab93, 0xa5c2b56c, 0x67987b9c, 0xa283ad99, 0xa58781aa,
+    0x909d9874, 0x7992a380, 0xb9a59fcd, 0x7390a25e, 0xbc6498a8, 0x84798185, 0x8a95899f, 0x6a8a8fa2,
+    0xbc93647f, 0x618993a0, 0x7d7f8c61, 0x8887966e, 0x78758383, 0x9c849b87, 0x6e6b74b2, 0x7b7b9298,
+    0xbc7c96ae, 0x74b070a3, 0x748ab880, 0xb38a9399, 0xc0978c83, 0x91a69e72, 0x69a39b78, 0x99979380,
+    0x83796c80, 0x99747c7f, 0xbf70a5ad, 0x8293726c, 0x917c96aa, 0xc5a2a199, 0xc182879d, 0x6f5f7379,
+    0x91bd7189, 0xa6a1c3a1, 0x6aa7888b, 0xbac1aa6e, 0x8e639fb1, 0x7bab9e91, 0x8c9d8d94, 0xa8b08b62,
+    0x84916e74, 0xa4ae8f79, 0x7d9aa785, 0x9db99ca9, 0xbaaa7aaf, 0x918e8c5d, 0x8067828c, 0x98b4ae71,
+    0x6ebf9b8d, 0x81a4c154, 0x7b91718c, 0xb3c08883, 0x81a958b0, 0x95638d85, 0x7c939992, 0x96998c99,
+    0x8280a6a9, 0x95b88d74, 0xa688875c, 0x8298bb6f, 0x8f61b069, 0x9a6f9985, 0x5aaac08c, 0x5fa49596,
+    0x86aa95a2, 0xbbb4c58b, 0xb47885a0, 0x686170be, 0x9ca2a8b1, 0x84a1ab70, 0x919aab7f, 0x8c768378,
+    0xc5a16f90, 0x9295a67d, 0x9cad817c, 0xa060a290, 0xaf897263, 0x8170c36e, 0x86779ba8, 0xaf82a790,
+    0x6fbc838c, 0xa7b1a2b9, 0x78c484c5, 0xab91a95b, 0x8ea77174, 0x937ea755, 0xb17e6d9d, 0x89857a8a,
+    0x8d5b9074, 0x96ab6bb4, 0x6281b588, 0x9c925f80, 0x76baaf9e, 0x8a8dc68d, 0xc09f8898, 0x88a854cb,
+    0x829ab78f, 0x597f769f, 0xb1ae9ca6, 0x9abc6281, 0xbb659e7e, 0xbc91b289, 0x7bbe907a, 0x837ea3b4,
+    0x887d5892, 0xcd7aa08a, 0x92ad9a76, 0xb0719f7d, 0x587aa77b, 0xb77da79f, 0xaa9e5f65, 0x8c8ea2a2,
+    0xab939c93, 0x9997a89a, 0xa4539b6e, 0xacb89acb, 0xafb19fba, 0xa8ad76a5, 0x6f949da6, 0x7f74abbf,
+    0x76966498, 0x8f6b907a, 0x79819d8e, 0xd58a92aa, 0x9a868a7a, 0x9c658fba, 0x85648d86, 0xa6988d94,
+    0xab778db8, 0x9f88a983, 0xab8b877e, 0x84737b89, 0x5182b788, 0xc6b1865b, 0x73c0ad79, 0x768e65b0,
+    0x74a38c66, 0xbfaaa766, 0x56a6848f, 0xc991969a, 0x687a9694, 0x6da99a94, 0x9faf7a88, 0x8a8a82a8,
+    0x8265b588, 0xb1999e82, 0xc07675d5, 0x908a9f88, 0xc19fb098, 0x7d6e977f, 0x9356ab78, 0x867c81b8,
+    0x87af738e, 0x7c7f9fa3, 0x70b78e87, 0x97a59f8d, 0x835f77d7, 0xd46b7884, 0x8b92a07f, 0x8d677777,
+    0x8e927b8d, 0x599463a5, 0x86a78c62, 0x94c28b6c, 0x7e777f81, 0xa68e8276, 0x82b4be83, 0x6b80939a,
+    0x9eab7273, 0x9e9ca37a, 0x81d1638f, 0x9996b395, 0x7e96a5aa, 0xb8875ebe, 0x9a91c491, 0x55726281,
+    0x798c8759, 0x8598a45f, 0x9f7171a5, 0xa56982d2, 0x6f97ba8a, 0x6d847988, 0x5d8769a8, 0x7a8e7d92,
+    0x9f9f97e3, 0x908eb9b7, 0x846ccb85, 0x86a2c995, 0x85727a97, 0xac7e7f8a, 0x7ea28d6e, 0x8d8c9cb3,
+    0x8b7d8ac3, 0xa3b769ad, 0xc8707e80, 0x81a48ab0, 0x6a67ccd6, 0x8c7c99aa, 0x769d8a91, 0x88a74e75,
+    0x6d5ea18e, 0xb7989965, 0x8a94a293, 0xae88a6aa, 0x8e707f8a, 0x67789bcf, 0xae85b47d, 0x639285a1,
+    0x7152779e, 0xb274acb6, 0x986e868a, 0x88919494, 0xafb38884, 0xa4a280aa, 0x68ccb1b4, 0x9a7f968e,
+    0x717b40e5, 0x7e6d95d1, 0xa2bba6b5, 0xa286538b, 0x958b96c2, 0xab8b5c9b, 0x78ad70b3, 0xa2a28667,
+    0x9b649dad, 0x6aab88c6, 0xc29f6077, 0x7c8c77ab, 0x5390b288, 0xa2b69792, 0x7f798b9b, 0x7b8f6490,
+    0x9b86a26c, 0xc69ecf70, 0x8e99a4a2, 0xb68ea892, 0x58929173, 0x7d78b2a2, 0x7a8ea687, 0x956dab8c,
+    0x7e6c8f86, 0x869ead8f, 0x80b38c91, 0xba8697cc, 0xab9aa0af, 0xc48ba851, 0x71dc8e92, 0x947f768b,
+    0x645c80de, 0x8e83b1ab, 0x6b83a37d, 0x9467988e, 0xd0828bce, 0x945d697d, 0x909565b5, 0x9c787280,
+    0x845798ae, 0x657993c2, 0xc78f926d, 0x93a57fc5, 0x749b88c3, 0x8d97e07c, 0x8d84a687, 0x9d7e99a6,
+    0xa267c74f, 0x9fbe9d70, 0x83736291, 0xbb6f9175, 0x897d8a6f, 0x9e4e71a9, 0xb599c0b4, 0x7f8d97bd,
+    0xb5a18e77, 0xce898559, 0x7f549fa4, 0x9f9a9db7, 0xb5c0a0b5, 0x716672bc, 0x54999f9c, 0x47968597,
+    0x75d27fb6, 0xa66980df, 0x915ca36e, 0xb1a5914e, 0x8685b0be, 0xce889a91, 0x9ea17e8e, 0x5b597863,
+    0x5a8a63bd, 0x50a07b70, 0x876960a8, 0x8f6e5cce, 0x6c969c90, 0x7788aba7, 0xa4b1717f, 0xaa955594,
+    0x8d6cad80, 0xb778c67a, 0x64b58a60, 0xc862b590, 0x8eab8968, 0x4c747bab, 0xadb68259, 0x756aac76,
+    0x755d80aa, 0x667c8fbd, 0xb1aa7e87, 0x97928975, 0xa5ba8ec6, 0x8b78537e, 0x84c1a3b6, 0x818c6d89,
+    0x858c78d0, 0xb4c193aa, 0x56928651, 0xaa9089a1, 0x86aa9098, 0x755b948e, 0x83b56877, 0xad94a873,
+    0x8daa71e0, 0x86748698, 0xaf64b95b, 0xae6e74b0, 0x5a9fc3bc, 0xa29abe85, 0xa44b7573, 0x9998ad74,
+    0xa99da66a, 0xbc749a8d, 0x8c9f8b8c, 0xc19385b5, 0x5b90af8d, 0x858a92d2, 0x67c0a583, 0xa48780bf,
+    0xbd8a9a6f, 0x74a8b789, 0x71939e85, 0xb48378cd, 0xc399a48b, 0xd09a68b2, 0x8e9c6d7b, 0x807e51a9,
+    0xa185a896, 0x8e955e9f, 0x9ca9a198, 0xd47e5e49, 0xb85ea7e0, 0xb25d8b81, 0x88cc82c8, 0x95818491,
+    0x8866a088, 0x88929c5f, 0x9c608062, 0x90538ba6, 0x427bc9b9, 0xa99d82aa, 0xb06ca467, 0xbb84bf7f,
+    0x8f72cd5a, 0xb1648f8b, 0x95b15397, 0x8d5baf84, 0x9384ae72, 0x736e7aa0, 0xaea78778, 0x8f659d8f,
+    0x8aaf5fa0, 0x988c799d, 0x5e6291a3, 0xa5ab7695, 0x99b788b4, 0x987e5a89, 0x69cf875d, 0x5b627888,
+    0x5e779bd3, 0x6e74a1c1, 0x9bc59282, 0xb768b47b, 0x948ca0b6, 0x8b77b1b7, 0x69dc728f, 0x6b84748f,
+    0x90726e96, 0x79a7ac69, 0xca9eb495, 0x9e947daf, 0x2ab38bb8, 0x8dc0a993, 0x8fa7ad83, 0x5d72a0a2,
+    0xb278c175, 0xae50bc62, 0x92ce96bb, 0xa54aab65, 0x78ae9555, 0x8b377ed6, 0x778d993f, 0x8b878a78,
+    0x8183a4b6, 0x779a779d, 0xc2b6c984, 0xaf95ad8e, 0x8691a865, 0xa08c825a, 0xb2d17d9d, 0x756271bc,
+    0x80757699, 0x6d6c75bb, 0x7b8f7f9d, 0x967d6484, 0x9e88b0d6, 0x9e5f9685, 0x81c8988a, 0x78b03f7a,
+    0x7e8f8796, 0x45a7877f, 0x73967da0, 0xb07d4f90, 0x66899a9f, 0x905ef464, 0xc45cad76, 0xa48f62ab,
+    0x9437cf75, 0xb194af5e, 0x76904a8a, 0xc874817b, 0x705f979b, 0x8c6f6da8, 0x7cab7f83, 0x5d51637e,
+    0x966a8679, 0x8d77aa86, 0x6c85b6a3, 0xa9a78c9d, 0xc9e090d5, 0x8c977056, 0x58d27896, 0x5d827cc8,
+    0x5c8f72d8, 0x8d815ca5, 0x5d828f66, 0xcd5c915a, 0x838ea7c3, 0x9b78967f, 0x76c77a60, 0x63d06873,
+    0x619f82c7, 0x80c16494, 0xa792648b, 0xb67a6186, 0x468281b5, 0xa5a3ad88, 0xc3a5a1ab, 0x696a6375,
+    0xad6e9e7a, 0x8058be78, 0x767b51bf, 0xb1698d7d, 0x726a9361, 0x796e7b92, 0x7fbac098, 0x7c8f549b,
+    0xa3af8887, 0xadc77489, 0x806cac7a, 0xb9859674, 0x9aa680c0, 0xa15b8274, 0x787e6878, 0x6b9940b8,
+    0x8a7095a6, 0x827e66cd, 0xb777a061, 0xb999a23f, 0x9d68b5d6, 0xaf687c52, 0x86998577, 0x75b9777d,
+    0x978e9ad3, 0x75b95c95, 0xb7ab878f, 0xd17f757b, 0x518096a5, 0x9d8cd683, 0xaf5a9e9f, 0x816c8374,
+    0x8b869588, 0xa877c599, 0x9283848f, 0xcb47bb7e, 0x6f81788e, 0xa27084b9, 0x7474c862, 0x4f7c80b4,
+    0xa0aa9b5f, 0xa694805a, 0x7f7f7682, 0xb4a15685, 0xb2a48797, 0x8eac776c, 0x838f8469, 0x748d469f,
+    0x6690a1a8, 0x95b79793, 0x998c936c, 0xa45bbc82, 0xae5b8ea4, 0xad5abd66, 0xafc4747d, 0x5198984f,
+    0x71c1b0ab, 0x73cb7496, 0x7eb57b84, 0x8a85a0c9, 0x68b39a84, 0xad87ac8e, 0xbf839c8f, 0x768cb5a4,
+    0x74979f65, 0xde4abe5f, 0x7c8b8b97, 0x95798a80, 0x7071856e, 0x8d60a19b, 0x99a88881, 0x487ca095,
+    0xc4777d64, 0x75a09390, 0x958ca1bd, 0xacb09caa, 0x98ad9f9f, 0xbb957085, 0x7c7392bd, 0x8fae6cc7,
+    0x74908aba, 0x8aa657d4, 0xbc65a182, 0x9e4eaa76, 0x7a8f66aa, 0xac669787, 0x91d376a5, 0x619b7385,
+    0x7e9c76e7, 0xaaaf8b8c, 0x7b88c062, 0xc8716b87, 0x598e75c2, 0x7485d07c, 0xc09c96b9, 0x7370a970,
+    0x928f6272, 0xae66d274, 0xa5839776, 0xaf738ca0, 0x6379578e, 0x7faaa382, 0x9884b75b, 0x73989c7c,
+    0xc38a6dab, 0x8686947b, 0x7489af6a, 0xd86eada1, 0xce8397bb, 0x69ae5f61, 0x898064c1, 0x7a8964a1,
+    0x79757ca7, 0x6aa4a4e0, 0xa6a4a967, 0xb5a98089, 0xc97781ab, 0x9939c169, 0x779f7864, 0x3d5e955d,
+    0x9eb76a87, 0x9eab9773, 0x7b96a994, 0xd14e8866, 0x32b9ac94, 0xacc8ba7e, 0x9c84cf93, 0x9c739482,
+    0xa5b28d9c, 0xa59f9f97, 0x85b1669d, 0x9e678b88, 0x7f89a295, 0x9f9f9665, 0x59b87e44, 0x63a28469,
+    0x6e5f649d, 0x9baf9e9a, 0x7661a878, 0xc5a063ab, 0x77ac636e, 0x92523d79, 0x5f68ba9a, 0x82896296,
+    0x4cad5ca0, 0xbeb34cd1, 0x6093a482, 0xb88b9485, 0x8b8d82ca, 0x918f5e98, 0x7dab93ce, 0x94a863a3,
+    0x53888d8f, 0x95b579b4, 0x96956879, 0x87a69a73, 0x7f874779, 0xba87e5a8, 0x67998469, 0xa86c8497,
+    0x9177a668, 0xdc87877a, 0xa58c5d7d, 0x9d677f8f, 0x4a998969, 0x808895b7, 0xa9a47b5a, 0x8d98afad,
+    0x6e946e94, 0xc28887a1, 0x819aad8d, 0x778eb266, 0x807497d5, 0xb98664a1, 0x6aa48d76, 0x5e918c9e,
+    0x5cb18eca, 0x7960a27e, 0x65aaaf87, 0x81958292, 0x849a7c78, 0xa074d58c, 0x91c168bb, 0x706bb586,
+    0x6ab9a48a, 0x66cf5aad, 0x8e876379, 0x8bc18a81, 0x8a916b8a, 0xa58cbe9e, 0xb2b09e74, 0x7f84a871,
+    0xaaa06f4f, 0xa398aa69, 0xa88a8474, 0xb57eb2ac, 0x7861adb0, 0x71b584b1, 0x72ad7f84, 0xa69bb998,
+    0xa552b6c4, 0x7f818da1, 0xc1acb295, 0x8e7e94b7, 0x67696a89, 0x6e847684, 0x58b79d84, 0xb27d827a,
+    0x9f899a90, 0x7b9cb68e, 0xc26a7886, 0x8bb2b866, 0x96958587, 0x5a729795, 0x8aab4c99, 0x9da35a8c,
+    0x5db399ae, 0x817e855d, 0x9891a18b, 0x977691a3, 0x84867fb0, 0x9eb98677, 0x77726fbb, 0x8a67808a,
+    0xcf87a47e, 0x9c69889e, 0xac8a89c0, 0xa99b6f90, 0x6068ac8f, 0xb3ab75c4, 0x9971a589, 0x66b0b58e,
+    0xa08b93b3, 0xc7b48cb6, 0x76a2807c, 0xa0c8aa95, 0x98588273, 0x63707398, 0x8ba28abd, 0x8a699e8a,
+    0x67777190, 0xaa9f8692, 0x71b19eaa, 0xa6ac8c8c, 0xb7cebf79, 0x5c56c0a2, 0x6a91956a, 0x958a9b58,
+    0xab7278b3, 0xb68c9e86, 0x9e977b66, 0x8ab78d91, 0x9c94946b, 0x9a95bf54, 0xa473665b, 0x99a9a6b1,
+    0x99738e8d, 0xa3a3667d, 0xacb48682, 0xa5878c83, 0x8c8f575c, 0x958c585e, 0xba78787e, 0x6595767e,
+    0xa55f9997, 0x795e918c, 0x879e77b6, 0x6e835bb3, 0x865a9ebd, 0x56a8a065, 0x958489bb, 0x8578a3cc,
+    0x87aeb769, 0x9c938591, 0xaf86a473, 0xa8948c83, 0x8693ac72, 0x9f74a05b, 0xb19386a0, 0x818d7580,
+    0xad9c8d9c, 0xbd849494, 0x9b87987f, 0xaf6ba68c, 0xa37c5c96, 0x87aec16f, 0x998079a3, 0xa6bf8589,
+    0xa47d86b3, 0xa98986b0, 0x7a78b488, 0xa26e6f5e, 0x99a4b269, 0x7cc1879d, 0xa8857ea6, 0xa4996e9c,
+    0xb57bc773, 0xc5a09bae, 0x769a7d63, 0xad848f7b, 0xa3b05795, 0x8189626c, 0xc1939a69, 0x75bf9c9c,
+    0x6dcbc57a, 0xa8a49ccb, 0x7988ab97, 0xb8a3a0a9, 0x797da2b3, 0xacaf8fb6, 0x877cc37e, 0x927c9a9b,
+    0xaab4bf75, 0x5f82a862, 0x8cabb790, 0x83868699, 0x70bfbcc7, 0x75b58b92, 0x9366d192, 0x5c647d8c,
+    0xbf876c80, 0xa293c79e, 0xac867563, 0x8b5b7296, 0x9c8a8ea4, 0xb48d89cc, 0xb58a8ebd, 0x7c8291d0,
+    0x918a97ca, 0x8fa8a1cc, 0x8e957583, 0xc4a0997e, 0x9b7e7a75, 0xc3ac9da3, 0x7e6292a5, 0x8d7d9b58,
+    0xad9583b6, 0xa39b698c, 0x8771a982, 0xa681b699, 0xbd8f9b87, 0xa5af8ba9, 0x959f8b9c, 0xa49e8a93,
+    0x9a87a8bb, 0x637d8894, 0xc9baaa6f, 0x8a5c946d, 0xc9787b7b, 0x99b0a890, 0x61848e6f, 0xa591be91,
+    0xb265bd61, 0x90c1a456, 0x6a6092bc, 0x72a7cd6e, 0x647f87ae, 0x8179a198, 0x708e9ba7, 0x9994bca2,
+    0x8d967395, 0x6ea4b3a7, 0xb8739eca, 0xb77554c0, 0x819684a7, 0x95ad7586, 0x9983ca82, 0x58a581a4,
+    0x89ba5580, 0x7a7daea7, 0x6584aba8, 0x7c85aa70, 0x90857c95, 0xa49d6a96, 0x83849b96, 0xa69e9aa6,
+    0x586b6cbb, 0x99888474, 0x719992a3, 0xc59575bc, 0xa58ca19b, 0xa6a96589, 0x9fb3556e, 0xaa89879d,
+    0x8675a574, 0xa99594b6, 0x909f85c4, 0x7e6ac166, 0x6697b477, 0x83858d8a, 0x6d7d72a6, 0x809db1ab,
+    0x99ad6f60, 0x8dc4c7a2, 0x999186b2, 0x949da068, 0xa99a8797, 0x7b97a167, 0x8291c09e, 0x6268815f,
+    0x8a7584b7, 0x7ec0bb7d, 0xa09fadb6, 0x5680857e, 0x7bb69b93, 0x8187a77d, 0x7a8587b0, 0xa56a97a6,
+    0xa4a27d8f, 0x96738d9b, 0x8f537b95, 0x888c6685, 0xc1997a9e, 0x8da49e97, 0x91809891, 0x727a6478,
+    0xa8617279, 0x6878925d, 0xc0b57892, 0xafa1c184, 0x74aaa6bd, 0xb3bd7696, 0x8fa3b58a, 0xcaa87888,
+    0xa076b597, 0x878fa0b6, 0x9ea76fa4, 0x5398957c, 0xaaa17a8f, 0x878c8fbc, 0xbeb497b3, 0x7a8099ae,
+    0x9064968f, 0x8e6dac6e, 0x87955582, 0xac899da9, 0x9d54c37c, 0xafa7697d, 0x81958c7b, 0x8a9b6c91,
+    0x9e6783b1, 0xc1807f7b, 0x6669649b, 0xa8816591, 0x7179a0b0, 0xc09d7b60, 0xb08f9a6d, 0x859a7bb3,
+    0xa59e8389, 0xb2c58db7, 0x8dac7e8d, 0x9b688eb2, 0x9d789487, 0xa76e7385, 0xa5988f84, 0xa3987c98,
+    0x5b97b384, 0x6eab909a, 0x8f6f9c88, 0xac8db0b1, 0xc1978aa5, 0x839299a3, 0x7abaab7f, 0x748ba47a,
+    0x82c96a7b, 0x6b5db4ae, 0xa3809263, 0x7d668cae, 0xb766bb6d, 0x6ba5b38b, 0xada4bab3, 0x99a8a5ae,
+    0x929f889d, 0x83c0a08f, 0xa571a59b, 0x92769a98, 0xa582b582, 0xa07e7868, 0x9590b5a8, 0x839d6b97,
+    0x6568b178, 0x879ac662, 0x7aa871aa, 0x818d74a7, 0x8f7d7094, 0x99867da4, 0x7d72a0b0, 0x95a284a7,
+    0x8ab3cc8e, 0x9090869f, 0x726a9292, 0x8e72c17f, 0xa5a65e9e, 0x7a7a8e7c, 0xa79466cc, 0xc18db095,
+    0xafb99667, 0xa57c6a5f, 0xc4ab6d67, 0x899987c9, 0x91777d5d, 0xaa8c9d90, 0x72889c91, 0xa77175ae,
+    0x838d9c74, 0x83c69879, 0x9171c394, 0x94907f8c, 0x767ecb91, 0x6fbfa379, 0x9d82a0b8, 0x869f849b,
+    0x97817793, 0x9daa9678, 0xa2a79997, 0xc2869c8d, 0xb8cea276, 0xa5b26da0, 0x6293b591, 0xc062bc8e,
+    0xa8908096, 0xb99a8578, 0xa5a18cb6, 0x878481ab, 0xa99083ca, 0x8a8e84c3, 0xadacb093, 0xaaa4a093,
+    0xb5997ebc, 0xb492ad86, 0xad53587e, 0xb3c9a075, 0xac6a7d59, 0x8ba7b9a5, 0xbfa7717d, 0x5e9aaa63,
+    0x956ea17b, 0x816c6d81, 0xa5b6a35c, 0xaf669594, 0xb390a58f, 0x75a193b3, 0x947d949a, 0x6d9b769e,
+    0x7c81ae72, 0x8f86a69e, 0x79cb7f8f, 0xada87364, 0x8485cc6a, 0x8d9197a2, 0x85ca9275, 0xa885a459,
+    0x9baa93a1, 0x9a818a87, 0xa790947e, 0xaf7db4b4, 0xa2ca9c5d, 0xa7c37778, 0x83988797, 0x77959b87,
+    0xb28e5d83, 0x76bbab97, 0xc6a07287, 0xc465c392, 0xc6a378ab, 0x7da18f9a, 0xb1a481b6, 0xab71afa6,
+    0x588578b1, 0xb4829a9b, 0x87b259a6, 0xae896796, 0x73c46378, 0xca649088, 0x9d66c585, 0xc4ba7b8d,
+    0x8c8abcab, 0x849aa673, 0xb48f87a1, 0xb35a8c72, 0x94749871, 0x927db472, 0xcb8d605e, 0x906fa298,
+    0xbcb099b7, 0xc988c474, 0xc87e769c, 0x867b86a0, 0x91896888, 0x8eafa0b9, 0x778b8372, 0x82927c5a,
+    0xc962a9bb, 0x9da1a37a, 0x9f628a6d, 0xcd865e88, 0xa29483c9, 0x99a8ac57, 0xc1618d86, 0x8e9f747c,
+    0x669265a7, 0x70997275, 0x9cb19783, 0x918c6888, 0x89b2b26a, 0x828a66b5, 0x91a39d96, 0xa2808a9f,
+    0x72b1bd6f, 0x89a99d83, 0x8d999480, 0x8172a977, 0x959fa9ab, 0x679f8dac, 0xac8ab782, 0x8a7c5d81,
+    0xca958f73, 0x799b98ae, 0x5ccd9a9c, 0x9581be61, 0x93a36e9a, 0xbe686b7e, 0xbf8c6082, 0x959d9ba7,
+    0xbb97b996, 0x61668f75, 0x939e8cba, 0x7c95b485, 0xa581a16f, 0x6a8ea3b8, 0x7c8d85a0, 0x95918f5c,
+    0x8c75c382, 0x8a718660, 0x98b08959, 0xaf9f86bb, 0x76a86768, 0xb1c99a87, 0x8584a29a, 0x8567c0ac,
+    0x8f539999, 0x9485948b, 0xc0a0aeb0, 0x655d8592, 0x73648998, 0x52b6b7c9, 0xdb7eac59, 0xa9a66ca0,
+    0xa089b58e, 0x5ec29191, 0x9d7a6297, 0x96c779bd, 0x99c5a8cd, 0x8e7f8893, 0x648e5697, 0x867193c4,
+    0x7a7764bb, 0x8ec0a09c, 0x96798aa7, 0xb2aa7e6d, 0x6b8095b8, 0xc2967c84, 0x99ad8065, 0x628c627d,
+    0x6fa66dc3, 0x5d705d73, 0x889e9194, 0x87768fb5, 0x6f84829a, 0xba645d8c, 0x9b74ca85, 0x73649d96,
+    0xad8b72af, 0xc087719c, 0x64bf8aa1, 0xae808fb3, 0x9dabb8b1, 0x7f9a98ab, 0xa988d08b, 0xb953a76f,
+    0x91b29b72, 0xab749ba3, 0x8081b556, 0x7a8b8b79, 0xaeba73b9, 0xd88d9488, 0x968c679e, 0x77a58b55,
+    0xc28b9b84, 0x92b674ba, 0x96acc08a, 0x69698a81, 0xa08c948e, 0x8f527958, 0x967d8097, 0x9c8670a6,
+    0x875b957f, 0x9b98786d, 0x838c6b84, 0x95798ca5, 0xbe9da79a, 0x80859671, 0xc56db689, 0x8d8e7a7b,
+    0xb28283b8, 0x8789daaa, 0x8e6a5c7f, 0xa3549170, 0x94ae9174, 0x91798f98, 0xaf509f8b, 0x8497a69a,
+    0xb7ae6d7b, 0xaf8954a7, 0x6f698666, 0xb37f829b, 0xb28088ac, 0x8d7d7295, 0xc6828f85, 0x4c867084,
+    0x8c96546b, 0x6bbc86b1, 0x728cae5f, 0xb08a8f7a, 0x96b39379, 0xa2717173, 0x789faaa7, 0xb460ae84,
+    0x97928b96, 0xa175737f, 0x6f729e91, 0x988faaa0, 0x5b90abd5, 0x85938264, 0x7777cd8e, 0x8e5e969a,
+    0xa588a2ab, 0x87908ba4, 0xae78a29c, 0x758ea48d, 0x8d998978, 0xa8a5a597, 0x7864c179, 0x9fa98f75,
+    0xc274c871, 0x91c9766f, 0x85b49e7a, 0xd16b9990, 0x998e746c, 0xad7489a1, 0xb29a7092, 0x9f767a84,
+    0x8f89a68a, 0x746daa94, 0x9ca27ea3, 0x899fadb1, 0xd6959cd3, 0xbf78d363, 0x96d66555, 0xaabe9e69,
+    0xb388b681, 0x8397aea8, 0xa786a497, 0x7998a580, 0xb073b7b9, 0xa7b59186, 0xbc91b19e, 0x96c76a68,
+    0xb351a67f, 0xa392a665, 0x9b62637f, 0xb7935375, 0x5eaa6f98, 0x6c838e87, 0x8fa39894, 0xba9c916d,
+    0x9d9a6788, 0x888b9e79, 0x9191cf6c, 0x7d6f87d0, 0xb89caab3, 0xb8a98e73, 0x998996b3, 0x7fa47297,
+    0x88ae6aac, 0x8d7f76d5, 0x8c6baa97, 0xab5d7972, 0xaa58aa7e, 0x936d887f, 0x95c8ab6e, 0x788c78af,
+    0xae7a6eb7, 0x877f7195, 0xcda9888a, 0xa8a89b9b, 0xa0a77b82, 0x95b29baa, 0xa18f7a56, 0x948382a2,
+    0x925ea678, 0x988cad8f, 0x90adc0c4, 0xaf86a8af, 0x90a07e92, 0x9b6f8f95, 0xa1686c6d, 0xc08c9871,
+    0x848e70af, 0x879db787, 0x81a79677, 0x75849791, 0xb4939666, 0xa3a061cd, 0xa4b286b5, 0x8a76798b,
+    0x599bc6a8, 0x87ae6390, 0x6b85b9b7, 0x9855b762, 0x8890718f, 0x7a71759c, 0x7f7c5b86, 0x95976c85,
+    0x8c75929c, 0x5c58828e, 0xa58484b2, 0xb586a7bd, 0xaf4fbb88, 0x9ca0be8d, 0x7080b3a4, 0x8ea27b97,
+    0x8772b297, 0x4f8bd997, 0x9a766a84, 0x998077b7, 0x647d9884, 0xa39c5795, 0x7572be73, 0x9b9279a7,
+    0x9f947552, 0x959666aa, 0x64b7cb8c, 0x978876a1, 0x988b9762, 0x88616480, 0x8cad7f81, 0x8a8c9074,
+    0x6751adb4, 0x98ac99e0, 0x8792d2c3, 0xb99fbc77, 0xa2a9b6a7, 0x7ac089a2, 0x7eb1519b, 0x67826596,
+    0x98887aa3, 0xa5a3a38a, 0x8c957994, 0xd184cbac, 0x896d84bb, 0x8185c4b2, 0xc9709064, 0x91978e9b,
+    0x769fb86e, 0xaf9fc994, 0x79597482, 0xa59584bc, 0x78b0769a, 0x928f82cd, 0xb6a6c486, 0x4eb366b6,
+    0x8a719fb0, 0xa78f7587, 0x6b84c9aa, 0xa0a36fb6, 0xe6bcc28b, 0xae86798e, 0x79918094, 0x7cc577c7,
+    0xb0b0a19e, 0x62a67e95, 0xbf6be47d, 0xc4717f86, 0xbc67b1b9, 0x638e8984, 0x8be5a18b, 0x9774b756,
+    0x829d9ece, 0xaaa37c60, 0x72a6659c, 0x96be96b5, 0x899a8986, 0xba737479, 0x9a8a81a9, 0xa7a07a64,
+    0x896cc692, 0xb494cf9d, 0x818175a0, 0xb07778a4, 0xae85a878, 0x6c5d99af, 0x8a8cc46e, 0x8a849185,
+    0xbc77967b, 0x96b17582, 0x656e957d, 0xc6b396b5, 0x8b8e8784, 0x93879574, 0x81bc596c, 0x9b6dafa9,
+    0x66ae75cd, 0xb69d959e, 0xa27eb65d, 0xaaabbbb1, 0xc697c8ce, 0xba7a8969, 0x9d8b9369, 0x965a9966,
+    0x68a1a8b9, 0x796a7aa2, 0xa1afac8c, 0xa59a758b, 0xa684b7b3, 0x829cac76, 0xad41a84c, 0xab87a447,
+    0x9790b373, 0x8da6da81, 0x52988698, 0xaead92b9, 0x5779be50, 0x7d7b93b6, 0xa7a3c1bf, 0xac6d8686,
+    0xbfa4bd99, 0x90786d7a, 0x8ca17e8a, 0xab8e73b7, 0xb57b868c, 0x908490a3, 0xacc58187, 0x7d719669,
+    0x67896ea8, 0x869a7ab3, 0x83819aaa, 0xa893c56e, 0xb1a29eb5, 0xb86f78ae, 0xaea4918b, 0x6fb6a45d,
+    0x7964bed7, 0xa99d919b, 0xae8c8a75, 0xc478bbaf, 0x7b4b8daf, 0x84647d82, 0xc87390aa, 0x96818546,
+    0x7e9fa087, 0x5657d4b2, 0x7dc8519b, 0xa4765c83, 0x666ab589, 0x818cbbd7, 0xa4908479, 0x9c81a2b1,
+    0xc3c1968a, 0xa69c8354, 0xb2959046, 0xb298848e, 0x8dab66b1, 0xa1b3649e, 0xc0baa197, 0x737a8279,
+    0xaa87af8c, 0x52db5caa, 0x7c58c485, 0xde9f9b45, 0x897273b5, 0x9d96698d, 0x69b79885, 0x848f9581,
+    0x9f6f8bc3, 0x91b7a373, 0x998589a6, 0x9e75c36a, 0x5c5a8bdb, 0xb561aa93, 0xb058888b, 0x67978b71,
+    0x5881a8a1, 0xb87d7a97, 0x7bb98e6a, 0x9b9960b4, 0xa6b2bea8, 0x6d8a8ead, 0xd18ba297, 0x8d8b83a1,
+    0x8d96b194, 0x789d7a6b, 0x9ca492ad, 0xbc896e8c, 0xbd9ac98e, 0xc3887d9f, 0x838e877c, 0x538c8d91,
+    0x886f7bd7, 0x8390859c, 0x6983d479, 0xa89fb29b, 0x889398bb, 0x8f717f83, 0xa7de7e6d, 0x90b86388,
+    0x4eb6a7a4, 0xa6915a94, 0xa3a5b35f, 0xab897190, 0x8486658a, 0x92829670, 0x9d81b070, 0xa19d8d7b,
+    0x9899a984, 0x9a759d80, 0x89766474, 0x8e978e74, 0x9d8a94b2, 0x78a69b8c, 0x879bad89, 0x6a988689,
+    0xbb8b925f, 0x9e989481, 0x9899ac81, 0xaf96798c, 0x9693c2b3, 0x867caf7a, 0xa96ea3b6, 0x889bb1af,
+    0x90bc8cac, 0x8ea68470, 0x9abbc856, 0x838a5499, 0xbe9caca0, 0x969ea777, 0xa0677880, 0x70aac18d,
+    0x64717dd1, 0x8a746891, 0x98bd855e, 0xb18ec880, 0x83b2bfa6, 0xb4a476a5, 0x916f978c, 0xac959f8d,
+    0x8ebd7c91, 0x5d9c9994, 0xab9cb995, 0x9f85b973, 0xc0a89f98, 0x9979bb8c, 0x915bbf69, 0x67b2769e,
+    0xa79095cc, 0x8d74bd9c, 0x779d78b4, 0x6d6b5f73, 0xad9e7c9f, 0xb3b16f7e, 0xaf779599, 0x7a8c8c6e,
+    0x6c74b38f, 0x71b68697, 0x58a38096, 0x77519282, 0x9e629790, 0xb28ec67d, 0x87807378, 0xac779154,
+    0x80b49682, 0x9f7882bb, 0xc5828ab5, 0x937d919b, 0xb0c5b872, 0xa3888a8f, 0xae6ab586, 0x9a9f7085,
+    0x527f9e6f, 0xb59ab75c, 0xb2a6aea1, 0x9c759554, 0x8c52c49e, 0x9fa289ae, 0x8a6f6871, 0x7ea7af7d,
+    0x728aa9b7, 0x6a9cc0bc, 0x9b6873ae, 0x54b389b4, 0x7ec2b0ab, 0x8f6d7f84, 0x8280b7b1, 0x9fb88f5f,
+    0x7183afbb, 0x9ea27470, 0x8e9c786d, 0x67a370b8, 0x76867d76, 0xbd8e7884, 0xa18497a3, 0x9dac848b,
+    0x5aaba5c1, 0x6e998687, 0xb6aa8354, 0x6fba767d, 0x9d88a09d, 0x9eb0a377, 0x57a9a9ac, 0x8c748cba,
+    0xa0916e8a, 0x9a90b48f, 0x84b2985f, 0x8293836d, 0x81ba949b, 0xbc806792, 0x5b9da281, 0xaea5c8a7,
+    0xc69a628a, 0x6e7588ad, 0x9c568e94, 0x9f83a89a, 0x7f9167b3, 0x8987bd8e, 0x7b7964a8, 0x8ca88e63,
+    0x8a9cb3a7, 0x97b7b3b4, 0xa27593c2, 0x9f998787, 0xc6586668, 0x7fccab97, 0x6978948e, 0x7a9b69ad,
+    0x857db199, 0x59899474, 0xa094998d, 0x977c5a6f, 0xa95c8eca, 0xa17e97c9, 0x70a2b285, 0xa1a0978d,
+    0xac66a1b5, 0xa7cd9c69, 0x9fb65691, 0x8fbf819a, 0x8e548cae, 0xc18a96b7, 0x9c899b99, 0xa0628d8b,
+    0x88837774, 0xa26a79cf, 0x7484a0b4, 0x809ba48b, 0x887e9a85, 0x8e82817c, 0x83b371a0, 0x7d825d75,
+    0x7e9b7b61, 0x79897699, 0x6ca3949c, 0xb861cb98, 0x9895a4c4, 0xb56ba0a3, 0x8371b3ab, 0x9981967f,
+    0xab8081c2, 0x6a6aa58d, 0x688acf86, 0xa8916a86, 0x7896bfa9, 0xa1b88fbc, 0xaf77c490, 0x5e778994,
+    0x9a868e8d, 0x9a90988c, 0x6c6fa8a7, 0x8dca979f, 0x837e9e83, 0x6aa282b0, 0xa573b974, 0x9d546e9b,
+    0x68897791, 0xb48b9385, 0x8387a2b1, 0xb070b9bd, 0x93ba7fb2, 0x5d78a0b6, 0x56a972b5, 0x787c9090,
+    0xba8e705f, 0x91acb2a1, 0x87b7917c, 0x85aaa773, 0x7ab789b8, 0x6fa892bf, 0x7786acc3, 0x687094a3,
+    0x9e90ad95, 0x9883a684, 0x8a897ab1, 0x928e945b, 0xa192bcb7, 0x9f966591, 0xcf949968, 0x9e9579a5,
+    0x679c967a, 0x679d899c, 0x98b8588b, 0x75b2677c, 0x656f6988, 0xab728d6c, 0x7f86649b, 0x8ac3b8c1,
+    0x836c7084, 0x8b957b82, 0x5e99729c, 0xbb80a8ab, 0x8359af91, 0xa97d8087, 0xc99a7eb1, 0x8f946fb4,
+    0x667f939a, 0xb88f7e90, 0x7091b598, 0x6cab70c6, 0x8e9a96b6, 0x619f838f, 0x95868286, 0x956ba6a8,
+    0x9589bc8e, 0x81a476a2, 0x67b96388, 0x62cd9595, 0x80aa87a9, 0xaf678a97, 0x6f81b75b, 0x95a09f67,
+    0xa17cbd77, 0x857f9294, 0x8e808585, 0x8773bc7d, 0xa59c896a, 0x868fcfb9, 0x6ec0b490, 0x8aafa5a3,
+    0x8f876e89, 0x8c54af9d, 0xa282579c, 0x6a77ceb2, 0xa4a9b79a, 0x8573b676, 0x6fa57193, 0x828cb192,
+    0x93aaa25a, 0x885cb073, 0x71837b98, 0x959b76a4, 0xb1988ca6, 0x5d9e957e, 0xbd89a3ab, 0x9dcbceb1,
+    0x628da278, 0x8fbfbc9d, 0x7972976b, 0x9e9a9f88, 0xb07685b8, 0xce8473b5, 0xc2a3a684, 0x8f608a87,
+    0xb6b177c8, 0x8f9cb8b1, 0x90aa8194, 0xa8808783, 0x9c9ea8a7, 0x7f796d5f, 0xa077bb7f, 0x9ca4a990,
+    0x7d888780, 0x98b48f59, 0xc89f7db1, 0x74a3bab2, 0x97989087, 0x89a58867, 0x9375997c, 0x9ca26d84,
+    0x837890b4, 0xac9d908c, 0x68a16b9f, 0x89a99b8a, 0x949a83bf, 0xabb2898a, 0x95acb756, 0xa3a0829d,
+    0x93848e8d, 0x3db42cd9, 0x3e18dc5f, 0x3d10cede, 0xbd20872a, 0x3e0f3047, 0x3c637b2d, 0x3e31556b,
+    0x3d439745, 0x3e2d5725, 0xbbf83bc9, 0x3e02145d, 0x3e3fab28, 0x3dfa9faf, 0x3e050ac4, 0xbc668b6a,
+    0x3e387fd0, 0x3d9f8bc9, 0x3d9e53e4, 0x3dbd3cd5, 0x3e2c9c0e, 0xbd009021, 0x3e2f1e8f, 0x3db059d7,
+    0x3d4668c6, 0x3dc6f91f, 0x3d0ef4d6, 0x3e39388d, 0x3d553941, 0x3d281a9d, 0x3e59d168, 0x3e133a38,
+    0x3d9b4530, 0x3de49dc8, 0x3e0d293c, 0x3d9da738, 0x3d6fab32, 0x3e1eb941, 0x3d0adb7a, 0x3e1e1fc7,
+    0xbc970378, 0x3e0c5c29, 0x3d00eebb, 0xbbb3dfc3, 0x3dd04b52, 0x3d7f2b3a, 0x3da63a99, 0x3dc6f5eb,
+    0xb9d72763, 0x3de47850, 0x3d63f2ae, 0x3cb90e13, 0x3e0ee79d, 0x3dbc657d, 0x3e33637b, 0x3d69ccab,
+    0x3d961c7c, 0x3d50fc7e, 0x3dce6695, 0x3e12979e, 0x3d069d8b, 0x3dc89b37, 0x3dacd63d, 0x3d44f455,
+    0x3e15e254, 0x3debe8e4, 0x3decc08b, 0x3d9c375e, 0x3d9e3eec, 0x3cdddc92, 0x3dbefd95, 0x3e12fc8f,
+    0x3de7c12f, 0x3ddfee4f, 0x3dc66a87, 0x3e1c5283, 0x3e5b33ab, 0x3c8a912a, 0x3db8af6e, 0x3db65d40,
+    0x3e3c6157, 0x3e0f1705, 0x3da4bf0e, 0x3dc9e10c, 0x3cbb35d0, 0x3de4f484, 0x3da4ba73, 0x3abcd75a,
+    0x3e2c28c2, 0x3dfa1387, 0x3e18813e, 0xbb7511d2, 0x3dbc2ad3, 0x3e1d9226, 0x3e0444fb, 0x3e044907,
+    0x3e014b1a, 0xbcb1b144, 0x3de27e28, 0x3e1e3807, 0x3d289b41, 0x3d2e636a, 0x3e2563a7, 0x3dab3dda,
+    0x3e0b3245, 0x3d4918e0, 0x3e080194, 0x3db71636, 0x3e193ecc, 0x3e15e947, 0x3d8b5e93, 0x3d956c85,
+    0x3da48e95, 0x3cbf6117, 0x3e189133, 0x3e295c87, 0x3de8c259, 0xbbe1f4ba, 0x3e33aa3d, 0x3b963f7a,
+    0x3dbeb4a4, 0x3cff7025, 0x3dfcc0a0, 0x3dc5ebf8, 0x3e0458f2, 0x3e16c363, 0x3d7623fb, 0xbc991c1b,
+    0x3e2097fe, 0x547e7c84, 0x9279a3a9, 0x48399074, 0x4c779dc3, 0x8f9c035e, 0xa684a74b, 0x9598b4a5,
+    0x5e896e2a, 0x6da54554, 0x463432a2, 0x1d8a7489, 0xa03c7c23, 0xbe75875d, 0x67d542aa, 0x769e6781,
+    0x617d80a1, 0x4e8c724b, 0x7589c96f, 0xab854b75, 0x666c5b6d, 0x65445e8c, 0x497a5d4d, 0x693d7b6a,
+    0x4a577566, 0x71858e92, 0x6c787e5e, 0x71a774a5, 0x815e6c85, 0x91278988, 0x6d98765b, 0xb860455c,
+    0x8d396766, 0x81544196, 0x6d7e3782, 0x5b7a9192, 0x695f8d8b, 0x5bdb69c1, 0x76b48368, 0x83c05950,
+    0x937578bb, 0x9f6c8e5a, 0xbe92807f, 0x90555582, 0x6d95983c, 0x5e717da1, 0x6a368ac0, 0x3f6d978b,
+    0xaea89165, 0x3e5c768b, 0x9b5d8270, 0x6c6e5c35, 0x89887c98, 0x74885a4e, 0x5fa28328, 0x7b8d81a3,
+    0x89737875, 0x8db38c47, 0x7c513cc0, 0x57a75c48, 0x9c749d5e, 0x89918d7f, 0x7789647f, 0x90ab5c6d,
+    0x797c938a, 0x77996f5d, 0xc4baac9c, 0x663fce80, 0x769acc7c, 0x8f6c4f45, 0x68b56448, 0x766c5158,
+    0x5c4fc65e, 0x80575e54, 0x397a4537, 0x562fad96, 0xc838437a, 0xaf508973, 0xb3bc43a6, 0xe93133a8,
+    0x5a37462e, 0x766b5387, 0x8d4f6e68, 0x4aa67c8a, 0x728c7ba8, 0x87b87c73, 0x96787182, 0x9d5a6b80,
+    0x768b629c, 0x8d849551, 0xb285599c, 0x4db56e6a, 0x73527d92, 0x6e9c7e81, 0x4c566673, 0x3f6c9c7f,
+    0x938b8cb1, 0x629b6d44, 0x6ac07bb6, 0x827847a6, 0x54e46219, 0xaa3f9d21, 0x495b258c, 0xb0933a1f,
+    0x388b587d, 0xb85a79ba, 0x64817731, 0x5f71b7c9, 0x7e2b2f82, 0x776e5366, 0xff9a7399, 0xad1b57bf,
+    0x2c2aa748, 0xa5587ea1, 0x952d8d78, 0x65837d51, 0x728c7d6b, 0xa5776067, 0x896d887b, 0x85715c94,
+    0xa0946399, 0x8f878885, 0x8a9765a7, 0x32bd6b48, 0x884b718c, 0x8a8c9686, 0x42826c76, 0x6f7a8d6b,
+    0x608484ac, 0x75a78986, 0x7fa38791, 0x5a807271, 0xa2187a36, 0x23ad7a6c, 0x9f6f87aa, 0x3f79776d,
+    0x86749968, 0x4d285195, 0x597a8c4a, 0xa636736f, 0x67a0668a, 0xa1434483, 0x956d7082, 0x87537588,
+    0x59621c50, 0xd5b86d70, 0xa67b6d7c, 0x6772685c, 0x9d5f5a75, 0x96b64d6b, 0x6d80793f, 0x89817a6d,
+    0x4a3b9d89, 0x89769364, 0x8e796c93, 0x41916f83, 0x8a476c61, 0xba33ac9e, 0x92a07d88, 0x9c904658,
+    0x6e7f586c, 0x58989325, 0x33a19a3c, 0xae955891, 0x9dc4264a, 0x8149f93a, 0x4b4159be, 0x883d7143,
+    0x7f8b4a6c, 0x8e869444, 0x70a5c65a, 0x896f8987, 0x598a39ec, 0x90b51e88, 0xab678885, 0x6e34aa6b,
+    0x3042a95b, 0x6b694e6e, 0x63008a8f, 0x7b6b7e7e, 0x2e8c8782, 0x79323d4b, 0x7e417b87, 0x7b76ac8c,
+    0xb0b57268, 0x64a3779b, 0x387c7b84, 0x5f8eb57e, 0x31878a61, 0x4e8b5245, 0x4ec6796d, 0x98597c86,
+    0x69478e74, 0xbd63dbbb, 0x982261a9, 0x4f7a513a, 0x2f905e97, 0x484b3d39, 0x9a399b84, 0x5898a7d3,
+    0xb489af8a, 0x8176429a, 0x46665a86, 0x155b6338, 0x7b89a072, 0xa5675165, 0x5fc12e55, 0xa0a65a5e,
+    0x48526a9b, 0xb938b8b8, 0xb8b89093, 0x7c987561, 0x43749c62, 0x454e417d, 0x7f66a586, 0x4b659498,
+    0x855bc993, 0x4a6a7d65, 0x68ad7292, 0x5c5165a9, 0x3f464e64, 0x855b7f9c, 0x489f394f, 0x7895388c,
+    0x79575964, 0x5da15b65, 0x84676e5c, 0x8d42888a, 0x89507e68, 0x937d86bf, 0x57a6584e, 0x888a4962,
+    0x5b708174, 0x6e86956c, 0x81786871, 0x9a826d75, 0xb3978c85, 0x89677e9e, 0x88599793, 0x7186666d,
+    0x82848381, 0xb64b824c, 0x8abb6a6a, 0x358bbe80, 0x366bb741, 0x859b1d5b, 0x8b648d77, 0x8d4c8042,
+    0x4e41c47c, 0x9b261a5d, 0x498f863c, 0x74639abe, 0x7c2f4e35, 0x5e246099, 0x84a9456a, 0xa11136cc,
+    0x961f4994, 0x5a946f65, 0x7fa85583, 0x8a676a8a, 0xab856a5c, 0x76c87573, 0x7b954680, 0x73aa4545,
+    0x7a72798d, 0x7c5d6639, 0xa887643c, 0xa366658f, 0x8d576481, 0x835588e6, 0x844e887d, 0x52697774,
+    0x979d4371, 0x47696c8f, 0x88723fb2, 0x57655745, 0x4b968c88, 0x59849574, 0x4e766b85, 0x58b462a9,
+    0xc3c24c6d, 0x6471b282, 0x76854b7b, 0x78447f55, 0x689c987d, 0x5f955678, 0x3d530d87, 0x685993aa,
+    0x57ad5c5e, 0x8164ad40, 0x819e6371, 0xa78791ad, 0x4e7e6042, 0x315daa77, 0x92897dbf, 0x6c4a5851,
+    0x66856b8c, 0x3d526344, 0x6a878e5e, 0xa13d5363, 0x7d74548a, 0x687434ad, 0x9839528a, 0x2f18b7a6,
+    0x898b5f8a, 0x667b5183, 0x92806075, 0x76d0839a, 0x77b87d20, 0xa9acb067, 0x538f6a9a, 0x856b7337,
+    0x93a265ad, 0x9e6d8e9c, 0x8fc15722, 0x5b54739b, 0x79ac538f, 0x4693738e, 0x648e7878, 0x8d4c5a87,
+    0x918dad5a, 0x699c8999, 0x96859773, 0x895c876a, 0x9e7e5ea0, 0x8d52615b, 0x51655f66, 0x5d516777,
+    0x85568ca4, 0x76956d3e, 0x6f726cac, 0x55a57066, 0x953a847f, 0x6d698ec9, 0x88758b79, 0x447c5a5a,
+    0x909b94a0, 0x86407370, 0x6d663d7f, 0x3da67a8a, 0x414baa19, 0x3ebd7667, 0xac70ded1, 0x2e767485,
+    0x73998abe, 0x704f7488, 0x84b47a4f, 0xaf588385, 0x6c977f42, 0x47646291, 0x76875581, 0x736b7d9f,
+    0xa06b2b61, 0x8d5c8e76, 0x759b9f60, 0x8a5a9d72, 0x55578e7b, 0x50849fd7, 0x7089936d, 0x364e676a,
+    0x6e6c7a54, 0x3f8b7473, 0x717d8d73, 0xb8933480, 0x698e6f7c, 0x7233887a, 0x5f658087, 0x5c70546e,
+    0x98714f7b, 0x8847a6c7, 0x6c7b7e90, 0x523f8456, 0x6b6b8ba6, 0x78721e57, 0x8d8d9155, 0x836bc3ba,
+    0x78788c45, 0x7a991b72, 0x74593bc6, 0x4783664a, 0x2c5d963a, 0xaf71754d, 0x34c03a7d, 0x82cb8b81,
+    0x5a8d75bd, 0x817d884b, 0x6cc08767, 0x59646f65, 0xa6458455, 0x36639567, 0x8c6bbaaa, 0x346b5a7a,
+    0x70466b72, 0x4836595a, 0x5d776777, 0xb68b3e58, 0x63465765, 0x7a476a90, 0x5f3e926b, 0x2c34638f,
+    0x98692972, 0x69a44163, 0x752b8e31, 0x80ae4a50, 0xc07f5667, 0xa14d8287, 0x535f4f82, 0x6c8a936d,
+    0x5b575c6b, 0xb0c4b961, 0x76a4896b, 0x65946f70, 0x744da788, 0x6f537c88, 0xaa4cd145, 0x847c5835,
+    0x826d968f, 0x447a5823, 0x877b7f91, 0x726c83c6, 0x68896759, 0xa67d9055, 0x7d785776, 0xdb958574,
+    0x82bf6f74, 0xe1786a5f, 0x716e9169, 0x5a79d8b5, 0x6924478f, 0x8faa3aa0, 0x9e8d698b, 0x9f4b82cd,
+    0x4a78c399, 0x5d997a80, 0x5b70b454, 0xaa513774, 0x7b788482, 0x686f79a9, 0x5f807871, 0x6f5c6c83,
+    0x3f79695c, 0x69bd776f, 0x694f7e96, 0x80945f37, 0x4f678174, 0x75848b72, 0x6f738e6e, 0x4b8e7c5f,
+    0x716b8f72, 0x9d8d9c6b, 0x5f93862d, 0xa298628c, 0xaa825f74, 0x91a18562, 0x82737a82, 0x6a879875,
+    0x3d3da17b, 0xb37f5146, 0x9a666489, 0x618f8862, 0x6635669d, 0xac6e86cc, 0x9377822c, 0x4e6b8367,
+    0x81848884, 0x5c5c7670, 0xa4883eab, 0x559fada6, 0x4272d740, 0x86c35860, 0x9c6d7d87, 0xaac49a82,
+    0x8e93a77b, 0x63547fae, 0x57825e6a, 0x5142ad97, 0x97be6f51, 0x616d3757, 0xa4844877, 0xa07058ac,
+    0x605e5b45, 0x8ea24d4b, 0x5195bc71, 0x5dafa097, 0x6ac05239, 0xb0598971, 0x6b5c63aa, 0x904d6146,
+    0x206382a1, 0x886b5061, 0x6695a632, 0x7d6eb5d8, 0x5a463c77, 0x6b8a5188, 0xa5765a63, 0xa63a5ac9,
+    0x5c48b077, 0x5a67305e, 0x6b388f4d, 0xc890a87a, 0x519a7180, 0x89719992, 0x82848966, 0x8a85916e,
+    0xa2b34972, 0x8e787d6d, 0xc5778484, 0x9cb68854, 0x766c9488, 0x66bc6b7b, 0x776a8ab9, 0x3a667e9a,
+    0x7691d29a, 0x8a8ab05a, 0x3779aa48, 0xa968696e, 0x87377247, 0x306ba5a2, 0xaa448dc2, 0x3c40b35f,
+    0x4e509f62, 0x6c5c4d69, 0x73639d51, 0x9347836c, 0x4f7e4a99, 0x6980336e, 0xb855ab5b, 0x6d72bd74,
+    0x86444a86, 0x52576fa8, 0xe05644d7, 0x52a1623e, 0x1e409a49, 0x4d697774, 0x8d868a95, 0x5d917699,
+    0xc9c468a4, 0x604e7b85, 0x649d2c99, 0x6b2e896d, 0x8aa4a27a, 0x514b3e74, 0x6c874181, 0x7888956d,
+    0x5e992f23, 0xbca06929, 0x67ab7460, 0x3b8d9ba1, 0x9e417982, 0x68a3549e, 0x91729051, 0x73687750,
+    0x3852b483, 0x6f513548, 0x7e765f6e, 0x8e534cd1, 0x7e342c3b, 0x704892a8, 0xaa65a055, 0x93546597,
+    0x803f5da3, 0x485a7a89, 0x928481aa, 0x977b597a, 0x59548989, 0x1573a75e, 0x60a07c85, 0x5864486c,
+    0xaa8c636d, 0x593a934a, 0x7a57787d, 0x89404836, 0x98769ca0, 0x9171616a, 0x594b44a3, 0x4c58889a,
+    0x72955a21, 0x356b2961, 0x12359b7b, 0xcc7b5bc4, 0x46c26773, 0x8417a827, 0x8a48818c, 0xb6469c72,
+    0xb49f3a79, 0xc1a68657, 0x59a09b78, 0x5a77d56b, 0x5e2f49a1, 0x70ea1968, 0xb4775aa2, 0x593ab4a8,
+    0x4a4fd899, 0x647e763f, 0x454c6d63, 0x895e816b, 0x6c59a698, 0x707e709b, 0x66717d62, 0x7679a8a1,
+    0x567a3d43, 0x89896875, 0x734d9870, 0x8eb48150, 0x596c9d4c, 0x78914439, 0x3ab75792, 0x688e8f93,
+    0x789d8972, 0x6446a38f, 0x34957186, 0x938094b8, 0x6496bc62, 0x519b8d91, 0xb07baaac, 0x7b428589,
+    0x89957187, 0x6c606567, 0x849daf6d, 0x8563815f, 0x5a8d6aa0, 0x78b02a67, 0x6a5a607d, 0x4c658ad1,
+    0x7e769e82, 0x97ae6481, 0x6a6e6857, 0x697a8d7f, 0x9b6a6086, 0xb0a3a283, 0x66a05e67, 0xba625564,
+    0x6a8c64a8, 0x92839170, 0xab967d6b, 0x61aa5e80, 0x945d745c, 0x5db08170, 0x955f8b80, 0x65808482,
+    0x938487bf, 0x938aa75c, 0x41867c58, 0x807a637d, 0x66727e4d, 0x43324082, 0x98426588, 0x6d5f8c6f,
+    0x638c8877, 0x716d57b5, 0x3772b04e, 0xb85f9e66, 0x3c826b7f, 0x727f1d46, 0x92719042, 0x8a7a6d89,
+    0x822e8082, 0x706f3d7e, 0x7b7e6076, 0x7a907c94, 0x73826369, 0x9ba49b9c, 0x81885b75, 0xc3984a67,
+    0x99705986, 0xb0719759, 0x9d73734e, 0x6a8c7e78, 0x68448582, 0x677a899a, 0x7d4a797f, 0x527bb7af,
+    0x8492a1a2, 0x95925f97, 0x38615c3f, 0x526ba08a, 0x8d817f91, 0x9ec94a69, 0x79956b6f, 0x88646586,
+    0x6f6d7792, 0x985d8d4e, 0xa556807f, 0x506c6c88, 0x60519c47, 0x5c706c8d, 0x983b8079, 0x5d98bd62,
+    0x89a36f92, 0x66244ca8, 0xb38f3172, 0x76a27241, 0x7a69b840, 0x538f7c8d, 0x9971918f, 0x4fb98d71,
+    0x82aa66d0, 0x71608d96, 0x83a83c6f, 0x7d719064, 0x897b9882, 0x5d5d515f, 0x60643372, 0x726867a1,
+    0x82a52453, 0x9c442b44, 0x646a468f, 0x673dc2d9, 0x457ba68b, 0x59884d66, 0x87a28b57, 0xc1cd8392,
+    0x74786833, 0xb74e3767, 0x4862856f, 0x82659da7, 0xa1687234, 0x5f9b4e5d, 0x75854eb0, 0x6292c1e9,
+    0x55967aad, 0x88697c77, 0x7e5a5c83, 0x6b877d64, 0x6939973b, 0x53a57bb0, 0x84717f8b, 0x4d6e7c6c,
+    0x6f7773b1, 0x656a99a1, 0x96a18c4a, 0x9464708b, 0x6b8aa64e, 0x524b6c73, 0x62729164, 0x78914781,
+    0xb2615673, 0x716c8c90, 0xa3c4958f, 0x9a304573, 0x5a53a3a7, 0x44707074, 0x47a68b33, 0x6c52959b,
+    0x3448be25, 0x676e4b3e, 0x41285497, 0x417f6a73, 0x61603b5d, 0xdb7f8c98, 0x71963e7b, 0xbb796d53,
+    0x754b5071, 0xa297776f, 0x65855943, 0x4495888e, 0xa678676f, 0x7f8c5495, 0x72636e88, 0x68a28c57,
+    0x4d36d487, 0x96666656, 0x906e5c7e, 0x8d93667d, 0x6e486b58, 0x894966b2, 0x7155c02a, 0x5da65c60,
+    0x9e676bae, 0x9779a2c3, 0xd1253c98, 0x588e354c, 0x566a6285, 0x6598693b, 0xab45867b, 0x7c888f9c,
+    0xa6a68d6d, 0x505f64a3, 0x70905779, 0x5460704c, 0xb5a4ae54, 0x7b897e47, 0x3b934b5d, 0xa09f4f33,
+    0x3d845f7c, 0x41a2597b, 0x7a956f58, 0x8c3f8190, 0x894f7e37, 0x504c9684, 0x77353c96, 0x3a669a73,
+    0x488a775f, 0x5031888f, 0x3b3e9738, 0xd8598a73, 0x75aa8e4b, 0x79623d56, 0x6268ac73, 0x718a6559,
+    0x943e4e2b, 0x7e8e878f, 0x97a06987, 0x748d525b, 0x9f76557b, 0x88a37450, 0x34847945, 0x61845a5b,
+    0x57499a81, 0x74ab7853, 0x7e687893, 0x4c807a90, 0x93325868, 0xbc5cb5a5, 0x8e978e55, 0x8f6e5469,
+    0x5b696c83, 0x67ab7d65, 0x7eb8a58f, 0x80565675, 0xbb87567e, 0x83616e6b, 0x896ba689, 0x74637967,
+    0x2e45ab2f, 0x5d52197f, 0x4e4d9d4c, 0x6d4c8b90, 0xac5a428b, 0xc44691a6, 0x7d72947d, 0x756c5e7b,
+    0x43053144, 0x8a6ec858, 0x2183a429, 0x71629891, 0x6e298d60, 0x38796288, 0xb1458c7e, 0x7057b15a,
+    0x4e2b8a62, 0x387e2e52, 0x546ec041, 0xc8713fb9, 0x4d7f6f4e, 0x68379f64, 0x5f6fcb2f, 0x6d549f66,
+    0x8f4b4585, 0xc17cb596, 0xd3779bc8, 0x6870418a, 0x46765182, 0x924e3d23, 0x74496177, 0x84999f82,
+    0x5467bc6c, 0x607b805d, 0x2d6a4b8d, 0x17617467, 0xaa76427f, 0xb42ea87a, 0x8fb65160, 0xc57c4030,
+    0x2e3c4b57, 0x52aa448e, 0xac715d64, 0x986e9ea9, 0x998f7047, 0x9daaa160, 0x3e954992, 0x8d8f4a25,
+    0x5e546da1, 0xa16f768e, 0x9a816f49, 0xb1595f77, 0xa6967679, 0x626a7192, 0xb65b8f87, 0x68786e6b,
+    0x9f985749, 0x8758ad8a, 0xa7667984, 0x5f816b49, 0x8058c491, 0x8a982d69, 0x924ea16b, 0x7196adb3,
+    0x8699c963, 0x6a785895, 0x614b1ca6, 0x40839380, 0xa78a6a5a, 0x92817d5e, 0x5bcb1d49, 0x80a04a84,
+    0x39385c4f, 0x5c625689, 0x3c63a65e, 0xcf768873, 0x74a16894, 0x7f828e9b, 0x6f8f6e63, 0x9e5b7d7a,
+    0xbd6c5c76, 0x5dc7968e, 0x8d8f7671, 0x7ecc8c20, 0x51717c61, 0x85be7371, 0x7289688d, 0x60a3a178,
+    0x7ca19282, 0x575e6271, 0x505da771, 0x625795db, 0x39b08e83, 0x72436270, 0x8845ab69, 0xb7589d95,
+    0xd4cc5961, 0xa06f6c52, 0x6457ada7, 0x6896b25d, 0x45507c65, 0x73b06457, 0x436a5190, 0x5346aabe,
+    0x3c7a87a2, 0x5baa435b, 0xa7b26eaf, 0x437c96a5, 0x47b7722b, 0xb4aa6740, 0x62862766, 0x8ca4282e,
+    0x7b5b998e, 0xe35a658d, 0x5f807729, 0x6264b0b4, 0x9583516c, 0x4c67617f, 0x8b8e6db1, 0x93445a9f,
+    0x8a565758, 0x88ad7659, 0x6e527923, 0xa4998579, 0xb88c4f54, 0x7a86846a, 0x65495c9e, 0x546a6451,
+    0x56389490, 0xa4a08357, 0x9fa08977, 0xb0935c66, 0x8b467888, 0x816b7a92, 0xbb24d544, 0x517b785f,
+    0x797ba481, 0x844e5094, 0x6687757f, 0x50b38160, 0x66a86498, 0x9c8c626b, 0x6e877c95, 0x7c8c6f54,
+    0x777174e8, 0x93838262, 0xb6af5e5b, 0x8e716b81, 0x5f677f71, 0x3ec57e9f, 0x7f4b85a0, 0x654e5a9b,
+    0xa48f83a7, 0x2e808b91, 0x687db295, 0x782c278d, 0xa6478c7f, 0x744d769f, 0x6a856d6d, 0x7756bc70,
+    0x4b70981d, 0x596b5666, 0x3d06908a, 0xa0747264, 0x787b7c78, 0x99698264, 0x80b77f53, 0x9baf8543,
+    0x504b7869, 0x749d6375, 0x62467062, 0x7d5f4e57, 0x4833df42, 0x24383fc0, 0x6f4e5b48, 0x3378c28d,
+    0x4d745344, 0x2ca2c78e, 0x3b54c023, 0xc29c9343, 0x7fcbd95b, 0x3a547166, 0x526c943c, 0xd5874c4b,
+    0xcc409836, 0xac8b8775, 0x9379b07d, 0x708c444d, 0x756baf62, 0x58123b54, 0x7318828f, 0x7671ba9f,
+    0x628b7275, 0x5e9c9f71, 0x185e8c73, 0x6f5e9952, 0x6e90865c, 0x78587264, 0x56d6863b, 0xc59c4d29,
+    0x86106457, 0x6b346a68, 0x6667806d, 0x50e09997, 0x748c7e4d, 0x769a838f, 0x868188a7, 0x9773717a,
+    0x8f815f9e, 0x80778c78, 0x85cf7176, 0x847b9bb1, 0x726e6181, 0x30936396, 0x5e6a3989, 0x8a3f6cbb,
+    0x727c8bb2, 0x7d4b6f71, 0x81746d68, 0x47aa9882, 0x67856f85, 0x8b887d7c, 0x7691708b, 0x71965e86,
+    0x8a727ce1, 0x9b7d815b, 0xc3ac6a69, 0x6b7b8184, 0x815a718c, 0x5b9f4f8a, 0x8a6e9273, 0x626c67b6,
+    0x7b7faa96, 0x59655c7a, 0x7e5e6e9a, 0xac46aec0, 0x395b857c, 0xb49b6172, 0x8b865e72, 0x7a7f9487,
+    0xbfbe5078, 0x9e6a505b, 0x4d557c87, 0x6ab3a155, 0x676eae70, 0x8bd04645, 0x51af5eca, 0x688186b4,
+    0x4965b290, 0x2d7c407d, 0x8b3a3d88, 0x58717271, 0x727b8c7c, 0xb8988464, 0x91674f59, 0x9cd25689,
+    0xa07f864d, 0xb66f7977, 0x6441466c, 0x4b878989, 0x987ba45c, 0x7f715247, 0x819d6ea3, 0x67ab86ae,
+    0x5889a670, 0x84a24b73, 0x8a7c4c69, 0x7b519079, 0x7a3c7699, 0x8ac988b4, 0x72c25e82, 0x7d785443,
+    0x8a749d77, 0x7c407a62, 0x8b715f5a, 0xb263598b, 0xa8947a41, 0x716a9a9c, 0x786a7bb9, 0x897a6a91,
+    0xb09c424d, 0x6945857c, 0x5b289a6b, 0x6c9d5f80, 0x9e9a7887, 0xc94a7254, 0x89737f84, 0x96aead8b,
+    0xa7893197, 0x98aa738f, 0x857f6ca3, 0x0b979f68, 0x8e4f7b81, 0x86b3625a, 0x736a6a80, 0x44629278,
+    0x559e9da3, 0x916e5940, 0x4159658c, 0x88656883, 0x637a873d, 0x7a627897, 0x8545369a, 0x8c6b795d,
+    0x4b91516b, 0x754a918c, 0x6a559d19, 0xa044c066, 0x5aab867c, 0x5784165c, 0xa888ac7f, 0x895b836e,
+    0x6489b071, 0x2a747147, 0x6a6c848d, 0x56988cab, 0x62b6bc36, 0xa374b55a, 0x8055247d, 0xc8596a3e,
+    0x6b9d6e50, 0x9a585265, 0x3c96b261, 0x6d7eb782, 0x76596961, 0x97c57a82, 0x8b7c5077, 0x9b6a95a1,
+    0x3c5c878e, 0x5d78a382, 0x8aab767f, 0x888f90a4, 0x6b189a8a, 0x0b5f87a5, 0x888c9bbf, 0x4a687b90,
+    0x6a9c6981, 0x514b8c90, 0x727d8c67, 0x96696770, 0x4ba2774e, 0x7c4a4e7f, 0x6478885e, 0x6d567970,
+    0xa18e4563, 0x28788d48, 0x58907d77, 0xe04c2b80, 0x7899447a, 0xad3cc745, 0x60626da6, 0x88558f5f,
+    0xac766087, 0x84bc9d3b, 0x828e7b74, 0x676a660b, 0x6d4d77cf, 0x979e67bf, 0x636f8b68, 0x656cb467,
+    0x25528a8f, 0x688f5d6f, 0x6a1ec07c, 0x9b834563, 0x3597945d, 0x72556d5c, 0x6327757f, 0x5e499887,
+    0x7fcb3d5c, 0x91b59ac6, 0x7064b860, 0x7e6d9051, 0x58b28b87, 0x47a53952, 0x6d849c70, 0xc7757d86,
+    0x77488b74, 0x646b996b, 0x642d9584, 0x7b9b3026, 0x448f6250, 0x8e535d58, 0x7e1a64a5, 0x7d79c580,
+    0x769c9d99, 0x58a696c1, 0x4e758b9b, 0x418bc773, 0x2bc16c90, 0x3f7b5566, 0x92ac7e44, 0xa670826a,
+    0x7b368e6d, 0x7a936c5e, 0x8e625a9c, 0x557d8145, 0x56745257, 0x72a56f85, 0x5e98518b, 0x8c8c464c,
+    0x8a5a8d9e, 0x916aa079, 0xa67d6a74, 0x7f676491, 0x6d7f808d, 0x544399c3, 0x97687683, 0x6c846e64,
+    0xac9b8379, 0x437b8098, 0x8aa1ae58, 0xcc2b2b90, 0x84707ca3, 0x6f14846f, 0x957d917b, 0x691a8a99,
+    0x3c8b7c42, 0x47a34938, 0x262a708d, 0x73796738, 0x6a713691, 0x967b849c, 0x707c5362, 0x64685e41,
+    0x2b3a6254, 0x68378580, 0x88986e9b, 0x509e926a, 0x497ca256, 0x3ebb8e83, 0x86a1be76, 0x60754d51,
+    0x9c9f627b, 0x4c4e6e79, 0x8b7f4a65, 0x6f666c6b, 0x6b926652, 0x3b9b7667, 0x67683b9d, 0xa06d96c5,
+    0x65802645, 0x79815f64, 0xd87b67b5, 0x61887b96, 0x3a81ae66, 0x6f936055, 0x646c5b63, 0x92935763,
+    0x909f8a7e, 0x896481b9, 0x46857d4d, 0x173a7ab1, 0xa1867083, 0xbc742f5d, 0x93ae6087, 0xb3494694,
+    0x4b205933, 0x2f748d6f, 0x569ab96d, 0xc24b477b, 0xa289657d, 0xa22c6c27, 0x7b937e38, 0x80659a80,
+    0x325b605f, 0x6d8c716b, 0x7047a4a9, 0x5871997e, 0x713d4a72, 0xab7c69bb, 0x858b6498, 0x87638654,
+    0x584ca25a, 0xa467955f, 0x4e9e8459, 0x7468899b, 0xa7af7c8f, 0x856b4192, 0x8342777c, 0x7b556b66,
+    0x20549bb8, 0x949b3b48, 0x7ea6667e, 0x81926abd, 0x42334789, 0x7d458bc6, 0x96729831, 0x537c6a94,
+    0x8d6a908d, 0x597a7862, 0xa589b39b, 0x5c3f7d59, 0x627a6da8, 0x985e4f73, 0x41af7032, 0x7e64526d,
+    0x4a5d8a38, 0x88a8626a, 0x507c2a84, 0x4a6a757d, 0x8c544c57, 0xc94789bc, 0x5da46a80, 0x708a6281,
+    0x73394041, 0x88687785, 0xae605a9a, 0x68827d6d, 0x6a6e7f94, 0x84a14a74, 0x909b8a6d, 0x92b3739b,
+    0x80859a5a, 0x8a876f6d, 0x806f29b0, 0x3284836c, 0xaa659c5e, 0xae738364, 0x827b5c65, 0x7fad867c,
+    0x77897c96, 0x3b895b70, 0x742d6f75, 0x8791332c, 0x767e585c, 0x99337264, 0x5d394453, 0x817a8161,
+    0x8461577b, 0x8b94ceaf, 0x8c688055, 0x718d753c, 0x7da88e7f, 0x5c6e835a, 0x68669042, 0xac935a45,
+    0x79599a67, 0x578e9280, 0x92a07767, 0x6b3b3960, 0x8e5f646a, 0x2e43536b, 0x9c658873, 0x3b7699bb,
+    0x6b7a762e, 0x544f5a76, 0x5b6c8471, 0x8f592c2f, 0x8f6f8189, 0x75415a96, 0x49646b42, 0x3e3f792b,
+    0x6c855b7e, 0x558374b0, 0x92494e74, 0x85615b4e, 0x8265745b, 0x9198739b, 0x657f8058, 0x63869288,
+    0x7d66808b, 0x639aae7a, 0x7f836c9c, 0x788f6679, 0x8596cc2d, 0x8672856f, 0x636db36b, 0x87944862,
+    0xb18a7b7f, 0x535c4756, 0x563edd5e, 0xc5a04970, 0x4da83b69, 0xb851b947, 0x52563190, 0xa74f915f,
+    0xc881329d, 0xc388b8d3, 0xc6a69d50, 0x8886bc89, 0x494959d2, 0x569d50b8, 0x826f957a, 0x69698f60,
+    0x415af590, 0x0ea47557, 0x3169a99e, 0xb9894db5, 0x51944443, 0x7936c940, 0x645a6c79, 0x773e9661,
+    0xac9e4d6d, 0x7d7ab38b, 0x856a8a45, 0x84308043, 0x53bd94d8, 0x78874a83, 0x985b9d9e, 0x8038ac94,
+    0x657c784b, 0x89679044, 0x7ca45b64, 0x7f4b9fac, 0xb8758182, 0x77a0634e, 0x6974787c, 0x7fa3576c,
+    0x4f5cb383, 0x86571b28, 0x41508470, 0x805b8d97, 0x5a2b457b, 0xba8488a2, 0xb57b4c7a, 0x56517785,
+    0x48374d6f, 0x8b8d8c77, 0xbc766d8d, 0x42707b3e, 0xb5874fa3, 0x938f4c37, 0x4b78856e, 0x7a985b81,
+    0x684e906e, 0x879c6962, 0x8369347f, 0x59676381, 0xb954813c, 0xaa3fa686, 0x8b878860, 0x8fa5576b,
+    0x3a755898, 0xcc45bd37, 0x20a44c51, 0x53b5a7a3, 0x5438cc8d, 0x749b27ad, 0xc728a9aa, 0x4b528f65,
+    0x2651c281, 0xae623373, 0x7293657d, 0xa6a77ae3, 0x2b38253b, 0x5b4d7677, 0x766b9c21, 0x656f5eb2,
+    0x603471ca, 0x801e908f, 0x948848a3, 0x5fa88c96, 0x6034c36c, 0x3abb7962, 0x9685cc8b, 0x3c8e7b7f,
+    0xabba64d0, 0x505f7d99, 0x848a3b83, 0x8a456189, 0x65818d40, 0x656d4962, 0x4e7c3f84, 0x6b6062b3,
+    0x7d724464, 0x50656c1d, 0x2889d45b, 0xba6e26a2, 0x6d757959, 0x4c319f93, 0x52373986, 0x71359e52,
+    0x8762486b, 0x6f9398ae, 0x706fb959, 0x97848298, 0x20907390, 0x6d6d597a, 0x9d7f9d76, 0x90586e66,
+    0x6f04815f, 0x80248676, 0x6e9f666f, 0x52b1945c, 0x4e51c356, 0x38c06f93, 0x8887da86, 0x35677574,
+    0x72856e8c, 0x52538d61, 0x8bb9605e, 0x81755b8e, 0x57928767, 0x53726171, 0x6a73568f, 0x693e9591,
+    0x90735265, 0x9e73ca5b, 0x23acab32, 0x9d6c9090, 0x685d7474, 0x613b6570, 0xa94c8db0, 0x6b50c982,
+    0x5922a676, 0x1a603b7e, 0x54679a76, 0x7e6f646c, 0x2d6f4273, 0x82848383, 0xa36ba711, 0x6b649552,
+    0x6619877d, 0x6b7145b7, 0xab683d7e, 0x787a8d42, 0x7a5c7e7a, 0x767f8d99, 0x86766b70, 0x93a26d87,
+    0xb1956c7d, 0x7d699b76, 0x7e633f6c, 0x7c956935, 0xbd7ac772, 0x928a906d, 0x5c7d908f, 0x73a28266,
+    0x897d828d, 0x716b975a, 0x7e9b3983, 0x5d6d9c8f, 0x4b2a9671, 0x2f8466c7, 0x8774c7a8, 0x407a6356,
+    0x796e8caf, 0x615e6365, 0x6f7a8459, 0x9e87386c, 0x88775f87, 0x555662c3, 0x7a6e898a, 0x44567e6b,
+    0xaf8b5283, 0xac578b71, 0xa1a3338b, 0x51aa6fa4, 0x7a779726, 0x2e9e3377, 0xdb7b87ad, 0x5c949273,
+    0x5f7cb771, 0x782165a6, 0x4b8b6f57, 0x942787dd, 0x8c983e30, 0x73597a57, 0x928c7242, 0x96615cb4,
+    0x815a375f, 0x6cbc79a2, 0x6a9b8770, 0xad64234d, 0x9a68637f, 0x6b665b93, 0x478a7745, 0x5f658572,
+    0x6d5f7c6b, 0x65c6ae76, 0x8b6b8865, 0x9b86753f, 0x81819860, 0x764abd77, 0x759b8f41, 0x85b85819,
+    0x9c75826c, 0x809a778b, 0x6a97ae68, 0xc92c5f50, 0x7332a484, 0x287b6dbb, 0x55908155, 0x3e589e7e,
+    0x3a656145, 0x35a29694, 0x4360726d, 0xc6b35252, 0x798d7c3b, 0x631eab6c, 0x567b9c6b, 0xb39c403f,
+    0xcc77484f, 0x7549c3ca, 0xa85956c6, 0x2cb63353, 0x296d9662, 0x4757461b, 0xdb57828c, 0x80bc98be,
+    0x9a9eba91, 0x727e8da9, 0x2e7e59a1, 0x3b2e887e, 0x8c956e7f, 0x72246048, 0x609d744e, 0xab87556c,
+    0x48446847, 0x6386ba4c, 0x417a9967, 0xa66c4a94, 0xa77a486e, 0x6334c830, 0x955152b9, 0x6831657d,
+    0x78646177, 0x44542f4b, 0x5339aa5c, 0xa5499355, 0x45996cb1, 0xb1774c8c, 0x9b4cba5b, 0x55527629,
+    0x31657240, 0x6e72362d, 0x998972d3, 0x5861a6aa, 0x4c82ac7b, 0xc566852f, 0x868b6d61, 0xeda28f75,
+    0x67a29961, 0x9667515b, 0x54686980, 0x415db687, 0x71475b78, 0x8da44176, 0x8d9b4daf, 0x7c42849f,
+    0x418da099, 0x7b7e3e88, 0x542c7243, 0x986b715d, 0x7574647b, 0x9172827d, 0x5e5e563c, 0x816c7e56,
+    0x79694d74, 0x71c49795, 0x89876679, 0x7cbb923c, 0x647b8f77, 0x69ad7875, 0x7d6ca64c, 0x897c5c62,
+    0x9d8faf79, 0x46756e27, 0x5b6cbd55, 0xbe8934a0, 0x8ebe3249, 0x8313e015, 0x64283794, 0x9d627253,
+    0x9672608e, 0x998964a4, 0x6d729749, 0x7d609ea3, 0x6a8b36a9, 0x8e9a5fb9, 0xda637557, 0x4b1795b7,
+    0x222b9652, 0x37426151, 0x3529aa4c, 0x8d5874a3, 0x699e8f93, 0x823c996f, 0x7a3c775e, 0x9d858c97,
+    0xa6aa356c, 0xb77d6275, 0x8f90b2a3, 0x84a77264, 0x2d819a7e, 0x8fc6334f, 0x476379b0, 0x4d69a3b7,
+    0x5a96a779, 0x88576179, 0x584c776d, 0x6ad05e6e, 0x1e44963e, 0x445d526b, 0x8b896ac3, 0x5c8a8fa1,
+    0xaab76f80, 0x4e50b8b4, 0x65925b37, 0x9660717c, 0x37c37f39, 0x493b407b, 0x6886a268, 0x9b567249,
+    0x6b62596c, 0x3c30529f, 0x6e465ec1, 0x875d8f68, 0x5039b179, 0x457d8058, 0x8c6db0a3, 0x5c9a63b4,
+    0xaab0776b, 0x548a6e83, 0x7b764896, 0x826c8b1c, 0x878fae81, 0x6fa85443, 0x37972181, 0x79839e99,
+    0x53886876, 0x8840c8ae, 0x837f6ae1, 0x9a937a2c, 0x5552a9ad, 0x633f6768, 0x826c9c6b, 0x703883e1,
+    0x7a54965f, 0x52a4727b, 0x496533c2, 0x3c89723e, 0x7f8d8f62, 0xc16b7d7d, 0x57ce3f57, 0xa2bd6d61,
+    0x38475261, 0x49c65d63, 0x836c8967, 0x5e7d7f95, 0xc78d4f47, 0x8e6aa53f, 0x6369378c, 0x809f3f36,
+    0x4d3f9b61, 0xa160645a, 0x7e7e835f, 0x835d6eab, 0x937f768b, 0xaa5786c5, 0xe5548642, 0x876b6b69,
+    0x6d847c4b, 0x638a95a3, 0x7e7b7180, 0x6e3f1d7f, 0x92624a72, 0x42408420, 0x8a4ca39e, 0x8882b77a,
+    0x6f577a27, 0x5a456978, 0x5636849d, 0x8b437a36, 0xae585b98, 0xaa428278, 0x95949640, 0x8f76733e,
+    0x0d5d5954, 0x4c9094ab, 0x8c709593, 0x9a5b3f82, 0xc5656490, 0x59698e46, 0x7e7b9073, 0x3e469f77,
+    0x80727a63, 0x569c7467, 0x6e4e9d6d, 0x7f89611c, 0x987da08b, 0x8e6a928e, 0x70a5794a, 0x52ba7f44,
+    0x80766c67, 0x6b674681, 0x907c7e73, 0x86c25652, 0x6c975038, 0x8e9ea64b, 0x728945b4, 0x8c867e46,
+    0x858798cc, 0x94998079, 0x9abd7e25, 0x5259978b, 0x7a6f589e, 0x55735e9f, 0xb25d8651, 0x7a6c726e,
+    0x9b439784, 0xa92eb156, 0x355bac57, 0x30c59b8b, 0x4e829c79, 0x677d3b9d, 0x9c4dc963, 0x7923a7a3,
+    0x462b768e, 0x32674e9d, 0x48c3828b, 0x538e8194, 0x365a1c84, 0x63656a49, 0x90539123, 0xa33b3280,
+    0x930c5da1, 0x6160a39d, 0x7c988591, 0x8d7f8171, 0x4425a572, 0x2f8b7792, 0xa4a0b4c8, 0x26638177,
+    0x957d7983, 0x25639c5e, 0x7f928376, 0xb86e627e, 0x5f7e5f79, 0x693d567a, 0x686e5b8c, 0x70784862,
+    0x89753c78, 0x95724e8f, 0xaaa36e64, 0x86b39b4c, 0x69908693, 0xb2a58da5, 0x85b39f60, 0x5f926f3f,
+    0x7160547d, 0xb49a8878, 0xb4a4628a, 0x92b26181, 0x8587902c, 0x8b448598, 0x985e9671, 0x749c515b,
+    0xc39d6853, 0x3c8e8b68, 0x92c6b2ae, 0x8428417b, 0x5286a186, 0x583f6377, 0x4f6ba261, 0x5d527992,
+    0x3b56ae43, 0x48685460, 0x2a3f908c, 0x3b4f666a, 0x5a6a3d7f, 0xe43c9ca8, 0x77c3348a, 0xbb6f626e,
+    0x5334244c, 0x607475a3, 0x68595178, 0x837b893a, 0x8c84858c, 0x7b6b8b8b, 0x5885735a, 0x6da57e92,
+    0x8d805b79, 0x4fafa48a, 0x8f8f6e9f, 0x8c9c6f14, 0x6aa8c574, 0x72808480, 0x358e8f77, 0x8aa06e64,
+    0x55a1785a, 0x7b926053, 0x66779f2a, 0x8d866c8c, 0x979b4977, 0x9d84aa61, 0x51665aa2, 0xaf787855,
+    0x706d70af, 0xa9a88c84, 0x90b2a05b, 0x5e618c78, 0x643f60d3, 0x85777ce9, 0x9e2f8f59, 0x5a618456,
+    0x776a9294, 0x79495e76, 0x6459774e, 0x98659e3d, 0x75768aa8, 0x92795a81, 0x917aa276, 0x8c80b492,
+    0x82937d4f, 0x80854878, 0x5d667d8e, 0x519b783f, 0x877d9c65, 0xa69a7f58, 0x5f864266, 0x6b7faf89,
+    0x567789b5, 0x6f587a85, 0x7e987fa1, 0x5439c39c, 0x3c5fa3bb, 0x85973a56, 0x6fc67e38, 0x86968898,
+    0x69929820, 0x72741a67, 0x4f2453a4, 0x327e9290, 0xa23e6938, 0xc9826955, 0x5de32eb0, 0x7f6096a6,
+    0x2d8874a0, 0x485b787e, 0x7c75a1ba, 0x574c7d6e, 0x4c7395ba, 0x6f59175e, 0x7c8d9f43, 0x647ca5a3,
+    0x95688a2b, 0x686b4774, 0x242a28b5, 0x2472876f, 0x84535d6f, 0xcf778867, 0x5ecb2b90, 0xa87f83a7,
+    0x2b7d706c, 0x9e78e86c, 0x37cda446, 0xb16c6b8e, 0x7d686c7b, 0x35717770, 0xa07bb176, 0x461fad82,
+    0x4f2c8f47, 0x274b2b4a, 0x42708b71, 0x68874e4e, 0x5a584d75, 0x784a8cd4, 0x986c7e36, 0x4b61aa59,
+    0x6f384185, 0x63479092, 0xb26d4295, 0x7b947672, 0x5162843f, 0x5081845d, 0x8f67b797, 0x5fb477b0,
+    0xc9aa608a, 0x464b8c92, 0x67b73875, 0x5d268625, 0x81bf9b7f, 0x5c723274, 0x4d801b6f, 0x5e696c68,
+    0x45625c49, 0x54b37962, 0x70878f8c, 0xb65e4c30, 0x5152a19b, 0x4b5655b4, 0x60869c37, 0x2b2990bb,
+    0x66945d59, 0x1e819a99, 0x244ba078, 0x8b9f7e5a, 0x58a89348, 0x6c548b5f, 0x44c57161, 0x93815542,
+    0xb946434d, 0x8e7e7e9a, 0xa7aa9054, 0x9278975f, 0x7b7a7784, 0xa48192aa, 0x689c9a75, 0x6a7e706e,
+    0x62679389, 0x748a7e41, 0x736e579f, 0x7fa15d68, 0xad5e7279, 0x904799ba, 0x4b71776a, 0x64865063,
+    0xb1897e88, 0x788c4131, 0x4748c65b, 0x9264646c, 0x57847a1c, 0xa32e8268, 0x5336486e, 0x742cc620,
+    0x885b596d, 0x6b928792, 0x8d8dbb55, 0xa764c6af, 0x47668ea7, 0x53525569, 0x92528039, 0x8e747d7f,
+    0x8923bc6d, 0x3e14126c, 0x3d72b7fe, 0x3e42cd05, 0x3dfe13f1, 0x3e1e3fa4, 0x3dc391f3, 0x3daa713a,
+    0x3e4022cf, 0x3de3bbca, 0x3e2a6ea7, 0x3e25206d, 0x3e1bec2a, 0x3e053214, 0x3e1b59c6, 0x3e13a876,
+    0x3e27e01f, 0x3e21698c, 0x3de88688, 0x3e311e92, 0x3e37220c, 0x3df0548b, 0x3ddb1b85, 0x3e1acb63,
+    0x3e0ec4ec, 0x3dcc7c65, 0x3e2da469, 0x3e3dd7c3, 0x3e4d7033, 0x3e31cfa6, 0x3ded4950, 0x3e1d59a7,
+    0x3e2e9422, 0x3e0f1a56, 0x3e236962, 0x3e0bd0f5, 0x3e624f66, 0x3d986ff4, 0x3e18271b, 0x3dff6717,
+    0x3e1d2559, 0x3e0b3999, 0x3e114daa, 0x3e20fe6e, 0x3e334207, 0x3de94bb7, 0x3e3ee4e2, 0x3e31cf5f,
+    0x3e3208a0, 0x3ddbe2a6, 0x3e0afe8f, 0x3e1371b6, 0x3df6fa78, 0x3e19bc81, 0x3e5785a5, 0x3e06407a,
+    0x3e0513e7, 0x3e07de21, 0x3e1afa5e, 0x3e20d7d4, 0x3e232a77, 0x3e09ed7b, 0x3e640e50, 0x3e22d0d0,
+    0x3e3a7242, 0xbc2de0b9, 0xbe95c8e3, 0x3e07a7d7, 0x3d825eee, 0xbde61337, 0xbe9c3328, 0xbe476a18,
+    0x3e265176, 0x3da99eec, 0x3df088a3, 0xbcf9f30e, 0xbe49dbfb, 0x3e66ca6b, 0xbd4a0086, 0x3e33d4eb,
+    0xbd2eda89, 0x3e5b53af, 0x3e209831, 0xbe1a1f76, 0xbd051889, 0x3def709f, 0x3db1ed97, 0xbcffef92,
+    0xbeb388e4, 0xbe364d14, 0xbc80b6bf, 0x3e42d098, 0xbec44596, 0x3db36f14, 0xbea23ef8, 0xbdbf9b44,
+    0xbdf0ca23, 0x3d00e5fb, 0xbe610d3f, 0x3e3f3319, 0xbe1e60b8, 0xbe38a157, 0x3d81f88d, 0x3d93e65d,
+    0xbe91500a, 0xbe85e62e, 0x3e27bd7c, 0x3d83eadf, 0x3d205334, 0xbe8df883, 0xbe08e005, 0xbeaa1f81,
+    0x3e091494, 0xbe207679, 0x3da1c64a, 0x3ddc550d, 0xbc9e3961, 0x3dec76da, 0x3d0f6365, 0xbdbd04c0,
+    0x3dda4a0a, 0x3e04e6a7, 0xbea5248f, 0xbde0e7d9, 0xbeb67d16, 0xbde6d0d8, 0x3e08355a, 0x3e20e115,
+    0xbe55dbca, 0x3e038a2b, 0xbd8a0b50, 0x3e2c979f, 0xbe39f28f, 0xbd9d5356, 0x3cf25e2a, 0xbecd0051,
+    0x3dac3c13, 0x3d061368, 0xbdb566a2, 0xbe1d0c97, 0xbe8ad3c4, 0xbe803120, 0x3d7a4190, 0x3cdc11b2,
+    0x3c9b7ba3, 0xbe2363d2, 0x3e4318c5, 0xbd95f69e, 0x3e0b759c, 0x3e3d5fad, 0x3dec640e, 0x3e6e2e2c,
+    0xbe18c661, 0xbe06c3a4, 0x3d184923, 0xbe81f15f, 0x3d9e6fc1, 0xbe349409, 0x3da2734e, 0x3e4eb3aa,
+    0xbe29f902, 0xbe9b0d80, 0xbdef5b6b, 0xbd2ba967, 0x3e09fd38, 0xbd807b32, 0xbe00ab7d, 0xbdf272d9,
+    0xbe08a8ba, 0x3e3fe017, 0x3e31193f, 0xbe80e3b6, 0x3e3f648f, 0x3da003ee, 0x3e2d22c3, 0x3e2d93a9,
+    0xbe425087, 0x3dfb7f46, 0x3d50700e, 0xbdb7638d, 0x3e03552f, 0x3e4c6336, 0xbeb70a44, 0x3d0e93f8,
+    0x3baaa160, 0xbe201379, 0x3be8a807, 0x3e76336e, 0x3e52fa18, 0xbe8aeb33, 0xbe12afe4, 0xbe626112,
+    0xbcedb4a3, 0x3dcb2688, 0xbe4e8fdb, 0x3deeaf4f, 0x3d97a4cd, 0x3d9d067b, 0x3dcacaa7, 0x3df23a0d,
+    0xbe7a0030, 0xbe7b5eac, 0x3e086ffb, 0xbe9679b2, 0x3de35e8c, 0xbe630eff, 0x3d22f222, 0xbec504cf,
+    0x3da276d1, 0xbe6fcea1, 0x3e4e4920, 0xbc9898f7, 0xbe9432bc, 0x3cb4df98, 0xbe278114, 0xbd6f98e1,
+    0x3bebcf85, 0x3d29bb92, 0xbe02fe5c, 0xbd8637c3, 0x3bcaafa5, 0x3e2ea55f, 0xbe565cb8, 0x3e212f66,
+    0xbeb044c7, 0x3e40e746, 0xbebf2d1b, 0x3d561eff, 0xbda4870c, 0x3e269463, 0xbe56554d, 0xbd70bb2f,
+    0xbe850484, 0x3c70a1aa, 0x3dfd6c59, 0xbca7d3cb, 0xbe1edeff, 0xbe95a69b, 0xbc930dbd, 0xbdafc5fa,
+    0x3e47d341, 0x3e769ac6, 0xbe977c3c, 0x3d39f5e1, 0x3e583d41, 0xbe98155c, 0x3dbeb123, 0xbdbb2db1,
+    0x3c589aa6, 0x3de14b81, 0xbe0f8787, 0xbe4291dd, 0x3cc7d7fd, 0x3dad62ff, 0x3dca90e2, 0xbdebfe2d,
+    0x3e31d44f, 0xbc46a357, 0x3e07126e, 0xbdc17617, 0x3e2b6e61, 0xbd8fe7af, 0xbe204554, 0x3e300b0d,
+    0xbdf53a62, 0xbd964ed4, 0xbe947239, 0xbda63f15, 0xbe3391d8, 0x3dfedd7c, 0x3d17afd0, 0x3e08f682,
+    0x3e0161ad, 0xbe1703c2, 0x3ddb1d70, 0xbe219cba, 0xbe122aa3, 0x3e2fc638, 0x3d741702, 0x3e105ffd,
+    0xbe707d40, 0x3d47ab52, 0x3e0598d1, 0xbe6815ae, 0x3de4e55d, 0xbe5d925c, 0x3e262338, 0x3de18c24,
+    0x3d5b7c6a, 0x3d5effd7, 0xbeb02fda, 0xbe6b0a17, 0xbe443ee7, 0x3de7cf10, 0x3e240375, 0xbe669489,
+    0xbe00c74d, 0x3bc05391, 0x3d8cabaf, 0x3e160685, 0xbe3ce183, 0x3dcb5a5e, 0x3e1f7f09, 0xbe87454a,
+    0x3d8dc78e, 0x3c48ad1c, 0xbe738d64, 0x3e3d90ea, 0x3e227d2c, 0xbe036df4, 0xbe39cc08, 0xbe7fce2c,
+    0x3e3ad878, 0xbe1c1423, 0x3d25de09, 0x3dfffb72, 0xbe4560db, 0x3dbb8da6, 0x3d78b301, 0xbd9df3fe,
+    0x3bb492b2, 0x3d105bbe, 0x3dc9106f, 0xbe592dcb, 0xbe9f7f60, 0xbebef8dd, 0x3e0f9f61, 0xbe0b0543,
+    0x3d9b66db, 0xbd83f920, 0xbe2ecf93, 0xbe9af0b8, 0x3df8859d, 0x3dfaeab7, 0x3da1d39f, 0xbe7bbcb9,
+    0x3e71da89, 0xbe18781d, 0x3e4bd3c2, 0xbe1b209b, 0x3e44a6dd, 0xbe0b949d, 0xbcfd3903, 0x3e127e9e,
+    0xbcb13219, 0xbeab69d2, 0xbe79a804, 0xbe518bc5, 0xbe2a8178, 0x3dd27fa5, 0x3db14868, 0xbe3e178a,
+    0x3d534330, 0x3d8156e6, 0x3dbcae17, 0xbe895f8f, 0x3e205ef4, 0x3e0cf3dd, 0xbde2e77f, 0x3e1ab21d,
+    0xbe96026c, 0x3dc0d9cd, 0x3df9c345, 0x3d226197, 0xbe1c31e5, 0x3dc7bf2f, 0xbc8f18ce, 0xbdce9b03,
+    0x3e3dfc0b, 0xbdc6ec76, 0x3df82961, 0xbeabd730, 0x3e5df45c, 0xbe3980fb, 0x3e4fac01, 0xbdee3f10,
+    0xbea682a7, 0xbe16f824, 0x3dbea829, 0xbe221597, 0x3dbe4f31, 0xbec00816, 0x3e0c1e2a, 0xbd1aa35b,
+    0x3e11a676, 0x3e5a72e1, 0xbd8d90ec, 0xbe2f217f, 0xbdeec436, 0xbe21c6cc, 0x3dcc5ade, 0xbdb0469d,
+    0x3e590439, 0xbe16ea06, 0x3d659032, 0x3e0ae2a0, 0xbee87cbe, 0xbd676af7, 0xbdf8d691, 0xbe549046,
+    0x3db07008, 0xbe09927f, 0x3d6b8349, 0x3dbaae06, 0x3dd8d29e, 0x3e107589, 0xbe44acfa, 0x3e04fd5d,
+    0x3da73f1e, 0xbeab078c, 0x3e000761, 0xbb069821, 0xbd9c95eb, 0x3ddeeafd, 0xbe65009b, 0xbeab8170,
+    0x3e0e60c1, 0xbe97ce6f, 0x3db2770b, 0xbb5ceef1, 0x3dedd54a, 0xbdcf9f6a, 0xbe31fb65, 0x3dfd4f6d,
+    0xbd37bb1b, 0xbe658320, 0xbdc28f67, 0x3e4b0d9f, 0x3e3247e7, 0xbe63a226, 0xbc0aacea, 0xbe1e5c9d,
+    0x3de04bbe, 0x3dd1dcfa, 0xbe70802f, 0x3e818f2b, 0xbe0ca6a2, 0xbcd34007, 0x3d800aad, 0x3d9536e3,
+    0x3e1daa8f, 0x3e842194, 0xbe04b3b0, 0xbe6c135e, 0xbe2e811f, 0xbe4cc7e2, 0xbe8f1a45, 0xbe3d1675,
+    0xbe5dfd6f, 0x3ddec76d, 0x3df33117, 0xbe896b5a, 0x3d7d35ea, 0x3c0da9e7, 0x3dc85bf8, 0xbe227998,
+    0xbe561ade, 0xbe802abe, 0xbd019e62, 0x3d2e4197, 0x3da9fdf4, 0xbe5adee1, 0xbe7a35ec, 0x3dfd0a63,
+    0x3dbbf236, 0xbe0fe663, 0x3e862a87, 0xbe3aa849, 0xbe879664, 0x3e524ffd, 0x3dc62a30, 0xbe087983,
+    0xbcccc599, 0xbd4d93de, 0xbd85ed63, 0x3e2b0422, 0x3e7f5e11, 0xbe23125d, 0x3e482182, 0xbe39a3d3,
+    0x3e56ae40, 0x3bda542e, 0x3e01fb59, 0xbe1c552e, 0xbe2f9487, 0x3e0c465c, 0xbe869757, 0x3e068997,
+    0x3df22010, 0xbd31e41f, 0x3dd07722, 0xbe86d882, 0xbe7b6e25, 0x3e064e20, 0xbd8c05ae, 0x3e0f1569,
+    0xbeb686dd, 0xbdc4544b, 0xbe9418e1, 0x3db7a123, 0xbdb7b148, 0x3df576ed, 0xbde5c764, 0xbdcf4f8b,
+    0x3d9fecb3, 0xbe20c8af, 0xbe73eb40, 0xbda43d2e, 0xbce2045e, 0xbe73a0cf, 0x3e54ec6e, 0x3e600169,
+    0xbe4ff2e1, 0xbc539fbf, 0xbc65b696, 0x3e6fc822, 0xbeb4546f, 0x3d544892, 0x3e1c8381, 0xbe761eaa,
+    0x3d231031, 0xbde4ae42, 0x3e1c7509, 0x3e2b3407, 0x3e29e580, 0x3e43b7e8, 0xbe15ca3d, 0xbe0e9df9,
+    0xbe0893a6, 0xbe06a52c, 0xbd7cea31, 0xbbc8170a, 0x3e18984e, 0xbe057f5f, 0x3e031661, 0xbe430e18,
+    0x3e5a7b3d, 0x3de35a24, 0x3d33e9bb, 0xbe70b81c, 0xbe6e5a73, 0xbbab99ba, 0x3dd21745, 0x3e3439dd,
+    0x3cbe51b5, 0xbe88ffa6, 0x3daa6e92, 0x3dbe400b, 0xbdf33d4e, 0x3da94465, 0x3d979c54, 0x3df63f0c,
+    0xbe53769d, 0x3dbb11b7, 0x3d345f24, 0x3d72b522, 0x3dbf0860, 0x3e7c9bf1, 0xbd27e40a, 0xbdf7cc1d,
+    0xbe528ca4, 0xbd36eb1d, 0xbe0ee4e9, 0x3e54eafe, 0xbeba00f9, 0xbd62a23f, 0xbe50dbd3, 0xbe089891,
+    0x3e3867e2, 0xbe576952, 0x3e2b029c, 0xbe04bb47, 0xbe1382d0, 0xbd167e86, 0x3d9bbccf, 0xbe573ecc,
+    0x3df46017, 0x3e06e600, 0x3d836da5, 0xbe6fcebd, 0xbcc47d97, 0x3df4315c, 0x3d031e10, 0x3d47f7cb,
+    0xbee7bda6, 0xbeac4e6f, 0x3e38a91b, 0xbd9c33ff, 0x3e1a7779, 0xbdecca07, 0xbc2cfaa0, 0xbe9c1d75,
+    0xbe2d7928, 0xbd1843cb, 0x3e3f56e8, 0x3e4bd8ca, 0xbe8ad687, 0xbda46a99, 0xbe7aed78, 0x3d9d11a9,
+    0x3db8d761, 0x3e260aad, 0xbd8b2d4c, 0x3e0a8650, 0xbdb1aeeb, 0x3d2ca6ea, 0x3db27384, 0x3dbc7cd2,
+    0x3d00b7d2, 0xbeafd970, 0xbdb06c53, 0xbe27a422, 0x3d8a6a49, 0xbe1208c5, 0xbe8c9b3c, 0xbda6f570,
+    0x3e2ac7cd, 0xbde52a0b, 0xbe6ac574, 0x3db17a15, 0x3e07bb05, 0x3e569fd7, 0xbd1466cc, 0x3daf5a53,
+    0xbe2efe5b, 0xbebcc0c0, 0x3e3c9487, 0xbe4e9ee7, 0x3e1084cd, 0x3e210c24, 0x3d9492a6, 0xbe89ac5f,
+    0x3d0ff841, 0xbe439404, 0x3dfcd641, 0xbe8965e3, 0xbe882903, 0xbe15a6ce, 0x3e398673, 0xbd1839a9,
+    0x3de6cbd8, 0x3dd9e426, 0xbe0b5ece, 0xbd2cb531, 0x3da8bd59, 0x3e459a5f, 0xbdb18fcc, 0x3e3b8f24,
+    0x3e156fc2, 0xbe5a5bf0, 0xbe8fe6c7, 0xbe73a654, 0x3e1b2f05, 0x3e48de6a, 0xbe165b25, 0x3e59a192,
+    0x3e645995, 0x3dee4ac6, 0xbde6b487, 0xbeb0aac3, 0x3dab3cc5, 0xbdfb9866, 0x3e321f8e, 0xbd79c236,
+    0xbe51a797, 0xbe6c6d7a, 0xbe1f590f, 0x3ce666e7, 0x3e29eb38, 0x3de7aa1d, 0x3df31263, 0xbea3ddfa,
+    0xbe09c4e5, 0x3df8c900, 0xbdbeeee1, 0x3d821b9c, 0xbe3a98f8, 0xbe84323d, 0x3df2cb2a, 0xbe814f19,
+    0x3e0033cc, 0xbd9cf206, 0xbec255de, 0x3d3c61b6, 0xbded1760, 0xbe959bc3, 0xbe7695b2, 0xbe4cbdb5,
+    0x3e117151, 0xbd91f73b, 0xbdfc98ee, 0xbea18663, 0xbe42988a, 0x3e3b120e, 0x3e3e3ccf, 0x3e7092b5,
+    0xbddd4ad4, 0x3d545d9e, 0xbe6b17c8, 0x3e522de7, 0x3b400afb, 0xbd89b8e1, 0xbd84f8ac, 0x3e254181,
+    0x3e2069b0, 0x3e344b08, 0x3e542e10, 0x3c95a583, 0xbd0b346b, 0x3dd2c98f, 0x3d195cb7, 0x3e4768c0,
+    0x3d5eee1f, 0x3e133c95, 0x3e1bf647,
+};
+
+#endif // ___MODELS_DEEP_MLP_PLAN_H
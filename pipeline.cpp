@@ -0,0 +1,73 @@
+#include "pipeline.h"
+#include "stm32f413h_discovery_lcd.h"
+#include "models/deep_mlp.hpp"
+#include "memtrace.h"
+#include "view_tensor.h"
+#include "segment.h"
+
+void pipeline_draw(Image<float>& canvas, stroke_state_t& stroke,
+                   const touch_sample_t* batch, uint16_t n){
+    for(uint16_t i = 0; i < n; i++){
+        if(!batch[i].down){
+            stroke.in_stroke = false;
+            continue;
+        }
+
+        uint16_t x1 = batch[i].x;
+        uint16_t y1 = batch[i].y;
+
+        //Screen not in image x,y format. Must transpose
+        if(stroke.in_stroke){
+            // join to the previous sample so fast strokes stay connected
+            canvas.draw_capsule(stroke.prev_x, stroke.prev_y, x1, y1, 6);
+        } else {
+            canvas.draw_circle(x1, y1, 7);
+        }
+        stroke.in_stroke = true;
+        stroke.prev_x = x1;
+        stroke.prev_y = y1;
+
+        BSP_LCD_SetTextColor(LCD_COLOR_GREEN);
+        BSP_LCD_FillCircle(x1, y1, 5);
+    }
+}
+
+int pipeline_segment(const Image<float>& canvas, float* batch, int max_digits){
+    std::vector<digit_box_t> boxes;
+    int n = std::min(find_digits(canvas, boxes), max_digits);
+    for(int i = 0; i < n; i++){
+        Image<float> digit(batch + i * PIPELINE_DIGIT_SIZE, 28, 28);
+        normalise_digit(canvas, boxes[i], digit);
+    }
+    return n;
+}
+
+void pipeline_build(Context& ctx, float* batch, int n){
+    Tensor* input = new BufferTensor<float>(batch, {(uint32_t) n, PIPELINE_DIGIT_SIZE});
+    memtrace_reset();
+    get_deep_mlp_ctx(ctx, input);
+}
+
+void pipeline_read(Context& ctx, char* digits, int n){
+    memtrace_op(ctx, "y_pred", { "y_pred:0" });
+    S_TENSOR prediction = ctx.get({"y_pred:0"});
+    for(int i = 0; i < n; i++){
+        //ASCII numbers are 48 + the number, a neat trick
+        digits[i] = 48 + *(prediction->read<int>(i, 0));
+    }
+    digits[n] = '\0';
+}
+
+void pipeline_run_plan(const plan_t& plan, const float* batch, int n, float* arena, char* digits){
+    int classes[PIPELINE_MAX_DIGITS];
+    plan_run(plan, batch, n, arena, classes);
+    for(int i = 0; i < n; i++) digits[i] = '0' + classes[i];
+    digits[n] = '\0';
+}
+
+void pipeline_show(const char* digits){
+    BSP_LCD_Clear(LCD_COLOR_WHITE);
+    BSP_LCD_SetTextColor(LCD_COLOR_BLACK);
+    BSP_LCD_SetFont(&Font24);
+    BSP_LCD_DisplayStringAt(0, 120, (uint8_t*) digits, CENTER_MODE);
+}
@@ -0,0 +1,69 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <stdint.h>
+#include "uTensor/core/context.hpp"
+#include "image.h"
+#include "touch_ring.h"
+#include "plan.h"
+
+/*
+ * The stages of the demo, from touch samples to a guessed digit. main.cpp
+ * runs them on the board, host/replay.cpp runs the same code against
+ * stubbed BSP functions to time them.
+ */
+
+typedef struct {
+    bool in_stroke;
+    uint16_t prev_x;
+    uint16_t prev_y;
+} stroke_state_t;
+
+/**
+ * @brief Rasterize a batch of touch samples onto the canvas and the LCD
+ * @details Samples of one stroke are joined with capsules, a sample with
+ * down = 0 ends the stroke.
+ */
+void pipeline_draw(Image<float>& canvas, stroke_state_t& stroke,
+                   const touch_sample_t* batch, uint16_t n);
+
+#ifndef PIPELINE_MAX_DIGITS
+#define PIPELINE_MAX_DIGITS 8
+#endif
+
+#define PIPELINE_DIGIT_SIZE (28*28)
+
+/**
+ * @brief Split the canvas into digits and normalise each one to 28x28
+ * @details Digits are written left to right as consecutive rows of batch,
+ * which must hold max_digits * PIPELINE_DIGIT_SIZE floats.
+ *
+ * @return number of digits found, at most max_digits
+ */
+int pipeline_segment(const Image<float>& canvas, float* batch, int max_digits);
+
+/**
+ * @brief Build (and, as generated, run) the graph on n digits at once
+ * @details The graph reads batch in place, it must outlive ctx's use of it.
+ */
+void pipeline_build(Context& ctx, float* batch, int n);
+
+/**
+ * @brief Read the guessed digits after ctx.eval()
+ * @param digits receives n characters and a terminating '\0'
+ */
+void pipeline_read(Context& ctx, char* digits, int n);
+
+/**
+ * @brief Classify n digits with a precompiled plan instead of the graph
+ * @param arena plan_arena_floats(plan, n) floats
+ * @param digits receives n characters and a terminating '\0'
+ */
+void pipeline_run_plan(const plan_t& plan, const float* batch, int n, float* arena, char* digits);
+
+/**
+ * @brief Show the guessed digits on the LCD
+ */
+void pipeline_show(const char* digits);
+
+#endif
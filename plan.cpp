@@ -0,0 +1,107 @@
+#include "plan.h"
+#include "dense.h"
+#include <algorithm>
+
+static bool in_pool(const plan_header_t* h, uint32_t offset, uint64_t bytes){
+    return (offset & 3) == 0 && offset + bytes <= h->const_bytes;
+}
+
+bool plan_load(plan_t& plan, const void* blob, size_t size){
+    const uint8_t* p = (const uint8_t*) blob;
+    const plan_header_t* h = (const plan_header_t*) p;
+    if(((uintptr_t) p & 3) || size < sizeof(plan_header_t)) return false;
+    if(h->magic != PLAN_MAGIC || h->version != PLAN_VERSION) return false;
+
+    size_t tensors = sizeof(plan_header_t);
+    size_t ops = tensors + h->n_tensors * sizeof(plan_tensor_t);
+    size_t consts = ops + h->n_ops * sizeof(plan_op_t);
+    if(h->total_bytes != consts + h->const_bytes || h->total_bytes > size) return false;
+
+    plan.header = h;
+    plan.tensors = (const plan_tensor_t*) (p + tensors);
+    plan.ops = (const plan_op_t*) (p + ops);
+    plan.consts = p + consts;
+
+    if(h->input >= h->n_tensors || h->output >= h->n_tensors) return false;
+    for(uint16_t i = 0; i < h->n_tensors; i++){
+        const plan_tensor_t& t = plan.tensors[i];
+        // only the input lives outside the arena
+        if(t.offset == PLAN_EXTERNAL){
+            if(i != h->input) return false;
+        } else if((uint64_t) t.offset + t.size > h->arena_floats){
+            return false;
+        }
+    }
+    for(uint16_t i = 0; i < h->n_ops; i++){
+        const plan_op_t& op = plan.ops[i];
+        if(op.in >= h->n_tensors || op.out >= h->n_tensors) return false;
+        if(plan.tensors[op.out].offset == PLAN_EXTERNAL) return false;
+        const uint32_t in_size = plan.tensors[op.in].size;
+        const uint32_t out_size = plan.tensors[op.out].size;
+
+        switch(op.opcode){
+            case PLAN_OP_DENSE: {
+                if(op.k != in_size || op.n != out_size) return false;
+                uint64_t unit;
+                if(op.kernel == PLAN_KERNEL_DENSE_F32) unit = sizeof(float);
+                else if(op.kernel == PLAN_KERNEL_DENSE_U8) unit = sizeof(uint8_t);
+                else return false;
+                if(!in_pool(h, op.weights, (uint64_t) op.k * op.n * unit)) return false;
+                if(!in_pool(h, op.bias, (uint64_t) op.n * sizeof(float))) return false;
+                break;
+            }
+            case PLAN_OP_ARGMAX:
+                if(out_size != 1 || op.k != in_size || in_size == 0) return false;
+                break;
+            default:
+                return false;
+        }
+    }
+    return plan.tensors[h->output].size == 1;
+}
+
+size_t plan_arena_floats(const plan_t& plan, int batch){
+    return (size_t) plan.header->arena_floats * batch;
+}
+
+static void argmax(const float* x, int rows, uint32_t k, float* y){
+    for(int r = 0; r < rows; r++){
+        const float* xr = x + r * k;
+        y[r] = (float) (std::max_element(xr, xr + k) - xr);
+    }
+}
+
+void plan_run(const plan_t& plan, const float* input, int batch, float* arena, int* classes){
+    const plan_header_t* h = plan.header;
+    // Tensor t of the batch starts at offset * batch, so rows stay contiguous
+    auto data = [&](uint16_t t) -> float* {
+        if(t == h->input) return (float*) input;
+        return arena + (size_t) plan.tensors[t].offset * batch;
+    };
+
+    for(uint16_t i = 0; i < h->n_ops; i++){
+        const plan_op_t& op = plan.ops[i];
+        const float* x = data(op.in);
+        float* y = data(op.out);
+        switch(op.opcode){
+            case PLAN_OP_DENSE: {
+                const float* b = (const float*) (plan.consts + op.bias);
+                const bool relu = op.flags & PLAN_FLAG_RELU;
+                if(op.kernel == PLAN_KERNEL_DENSE_U8){
+                    dense_u8(x, batch, op.k, plan.consts + op.weights, op.w_min, op.w_scale,
+                             b, op.n, relu, y);
+                } else {
+                    dense_f32(x, batch, op.k, (const float*) (plan.consts + op.weights),
+                              b, op.n, relu, y);
+                }
+                break;
+            }
+            case PLAN_OP_ARGMAX:
+                argmax(x, batch, op.k, y);
+                break;
+        }
+    }
+
+    const float* out = data(h->output);
+    for(int r = 0; r < batch; r++) classes[r] = (int) out[r];
+}
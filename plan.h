@@ -0,0 +1,109 @@
+#ifndef PLAN_H
+#define PLAN_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Precompiled execution plan for the deep_mlp model.
+ *
+ * host/plan_compile.cpp does ahead of time what get_deep_mlp_ctx() does on
+ * every inference: it orders the ops, picks a kernel for each, folds the
+ * constants (weight ranges, the runtime quantization of float weights, the
+ * reshapes) and assigns every intermediate tensor an offset in a single
+ * arena. The result is one blob that plan_load() checks and plan_run()
+ * executes in place, so a plan in flash costs no heap beyond the arena the
+ * caller provides, and nothing is registered by name.
+ *
+ * Blob layout, little-endian, every section 4-byte aligned:
+ *
+ *   plan_header_t
+ *   plan_tensor_t[n_tensors]
+ *   plan_op_t[n_ops]
+ *   constant pool, const_bytes long
+ */
+
+#define PLAN_MAGIC   0x4C505455   // "UTPL"
+#define PLAN_VERSION 1
+
+// Tensor that is not in the arena, bound to the input of plan_run()
+#define PLAN_EXTERNAL 0xFFFFFFFF
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t n_tensors;
+    uint16_t n_ops;
+    uint16_t input;         // tensor index
+    uint16_t output;        // tensor index, one class per image
+    uint16_t reserved;
+    uint32_t arena_floats;  // arena per image
+    uint32_t const_bytes;
+    uint32_t total_bytes;   // whole blob, header included
+} plan_header_t;
+
+// Tensors are [batch x size] floats, at offset * batch in the arena
+typedef struct {
+    uint32_t offset;        // floats per image, or PLAN_EXTERNAL
+    uint32_t size;          // floats per image
+} plan_tensor_t;
+
+enum plan_opcode_t {
+    PLAN_OP_DENSE = 1,      // out = in * W + b, optionally ReLU
+    PLAN_OP_ARGMAX = 2      // out[0] = index of the largest of in
+};
+
+enum plan_kernel_t {
+    PLAN_KERNEL_NONE = 0,
+    PLAN_KERNEL_DENSE_F32 = 1,  // float weights
+    PLAN_KERNEL_DENSE_U8 = 2    // eight-bit weights, w = w_min + q * w_scale
+};
+
+#define PLAN_FLAG_RELU 0x01
+
+typedef struct {
+    uint8_t opcode;
+    uint8_t kernel;
+    uint8_t flags;
+    uint8_t reserved;
+    uint16_t in;            // tensor index
+    uint16_t out;           // tensor index
+    uint32_t k;             // in features
+    uint32_t n;             // out features
+    uint32_t weights;       // byte offset in the constant pool, k x n row-major
+    uint32_t bias;          // byte offset in the constant pool, n floats
+    float w_min;
+    float w_scale;
+} plan_op_t;
+
+typedef struct {
+    const plan_header_t* header;
+    const plan_tensor_t* tensors;
+    const plan_op_t* ops;
+    const uint8_t* consts;
+} plan_t;
+
+/**
+ * @brief Check a blob and point plan at its sections
+ * @details Nothing is copied: the blob, e.g. a const array in flash, must
+ * stay in place for as long as the plan is used. It must be 4-byte aligned.
+ *
+ * @return false if the blob is truncated, of another version, or refers to
+ * tensors, kernels or constants it does not contain
+ */
+bool plan_load(plan_t& plan, const void* blob, size_t size);
+
+/**
+ * @brief Number of floats plan_run() needs as arena for batch images
+ */
+size_t plan_arena_floats(const plan_t& plan, int batch);
+
+/**
+ * @brief Run the plan on batch images
+ * @param input batch rows of the input tensor
+ * @param arena plan_arena_floats(plan, batch) floats
+ * @param classes receives one class index per image
+ */
+void plan_run(const plan_t& plan, const float* input, int batch, float* arena, int* classes);
+
+#endif
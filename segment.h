@@ -0,0 +1,181 @@
+#ifndef SEGMENT_H
+#define SEGMENT_H
+
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+#include "image.h"
+
+typedef struct {
+	int xMin;
+	int yMin;
+	int xMax;      // inclusive
+	int yMax;      // inclusive
+	uint32_t pixels;
+} digit_box_t;
+
+// A horizontal run of set pixels, the unit of the union-find
+typedef struct {
+	int x0;
+	int x1;
+	uint32_t parent;
+	digit_box_t box;
+} ink_run_t;
+
+static inline uint32_t run_find(std::vector<ink_run_t>& runs, uint32_t i){
+	while(runs[i].parent != i){
+		runs[i].parent = runs[runs[i].parent].parent;
+		i = runs[i].parent;
+	}
+	return i;
+}
+
+static inline void box_merge(digit_box_t& a, const digit_box_t& b){
+	a.xMin = std::min(a.xMin, b.xMin);
+	a.yMin = std::min(a.yMin, b.yMin);
+	a.xMax = std::max(a.xMax, b.xMax);
+	a.yMax = std::max(a.yMax, b.yMax);
+	a.pixels += b.pixels;
+}
+
+static inline void run_union(std::vector<ink_run_t>& runs, uint32_t a, uint32_t b){
+	a = run_find(runs, a);
+	b = run_find(runs, b);
+	if(a == b) return;
+	if(b < a) std::swap(a, b);
+	runs[b].parent = a;
+	box_merge(runs[a].box, runs[b].box);
+}
+
+/**
+ * @brief Find the digits on a canvas
+ * @details Single raster pass: every row is split into runs of set pixels,
+ * each run is joined (8-connected) with the runs of the previous row it
+ * touches, and bounding boxes are merged as the sets are joined, so no
+ * label image is needed. Components narrower in x than they overlap with a
+ * neighbour are merged too, which keeps digits drawn with separate
+ * strokes (4, 5, 7) together.
+ *
+ * @param img canvas, pixels > 0 are ink
+ * @param boxes digits found, sorted left to right
+ * @param min_pixels components with fewer pixels are dropped as noise
+ * @return number of digits
+ */
+template<typename T>
+int find_digits(const Image<T>& img, std::vector<digit_box_t>& boxes, uint32_t min_pixels = 40){
+	std::vector<ink_run_t> runs;
+	uint32_t prev_begin = 0, prev_end = 0;
+
+	for(int y = 0; y < img.get_yDim(); y++){
+		uint32_t row_begin = runs.size();
+		uint32_t p = prev_begin;
+		int x = 0;
+		while(x < img.get_xDim()){
+			if(!(img(x, y) > 0)){
+				x++;
+				continue;
+			}
+			int x0 = x;
+			while(x < img.get_xDim() && img(x, y) > 0) x++;
+
+			uint32_t id = runs.size();
+			ink_run_t r = { x0, x - 1, id, { x0, y, x - 1, y, (uint32_t) (x - x0) } };
+			runs.push_back(r);
+
+			// previous row runs are sorted, skip the ones left of this run
+			while(p < prev_end && runs[p].x1 < x0 - 1) p++;
+			for(uint32_t q = p; q < prev_end && runs[q].x0 <= x; q++){
+				run_union(runs, q, id);
+			}
+		}
+		prev_begin = row_begin;
+		prev_end = runs.size();
+	}
+
+	boxes.clear();
+	for(uint32_t i = 0; i < runs.size(); i++){
+		if(runs[i].parent == i) boxes.push_back(runs[i].box);
+	}
+
+	// Merge strokes of one digit that overlap mostly in x
+	bool merged = true;
+	while(merged){
+		merged = false;
+		for(size_t i = 0; i < boxes.size() && !merged; i++){
+			for(size_t j = i + 1; j < boxes.size() && !merged; j++){
+				digit_box_t& a = boxes[i];
+				digit_box_t& b = boxes[j];
+				int overlap = std::min(a.xMax, b.xMax) - std::max(a.xMin, b.xMin) + 1;
+				int narrow = std::min(a.xMax - a.xMin, b.xMax - b.xMin) + 1;
+				if(overlap * 2 > narrow){
+					box_merge(a, b);
+					boxes.erase(boxes.begin() + j);
+					merged = true;
+				}
+			}
+		}
+	}
+
+	boxes.erase(std::remove_if(boxes.begin(), boxes.end(),
+		[min_pixels](const digit_box_t& b){ return b.pixels < min_pixels; }), boxes.end());
+	std::sort(boxes.begin(), boxes.end(),
+		[](const digit_box_t& a, const digit_box_t& b){ return a.xMin < b.xMin; });
+	return boxes.size();
+}
+
+/**
+ * @brief Normalise one digit the way MNIST is: the longer side of its box
+ * is scaled to 20 pixels and its centre of mass is put at the centre of a
+ * 28x28 image.
+ * @details Each output pixel takes the maximum of the canvas pixels it
+ * covers, so strokes keep their weight when a large digit is shrunk. Reads
+ * straight from the canvas, no scratch image.
+ *
+ * @param out 28x28 destination, e.g. an Image over one row of a batch
+ */
+template<typename T>
+void normalise_digit(const Image<T>& img, const digit_box_t& box, Image<T>& out){
+	const int w = box.xMax - box.xMin + 1;
+	const int h = box.yMax - box.yMin + 1;
+	const float side = std::max(w, h) * 28.0f / 20.0f;
+
+	// Centre of mass of the ink
+	float cx = 0, cy = 0, mass = 0;
+	for(int y = box.yMin; y <= box.yMax; y++){
+		for(int x = box.xMin; x <= box.xMax; x++){
+			float v = img(x, y);
+			cx += v * x;
+			cy += v * y;
+			mass += v;
+		}
+	}
+	if(mass > 0){
+		cx = cx / mass + 0.5f;
+		cy = cy / mass + 0.5f;
+	} else {
+		cx = (box.xMin + box.xMax + 1) * 0.5f;
+		cy = (box.yMin + box.yMax + 1) * 0.5f;
+	}
+
+	const float x0 = cx - side * 0.5f;
+	const float y0 = cy - side * 0.5f;
+	const float step = side / out.get_xDim();
+
+	for(int j = 0; j < out.get_yDim(); j++){
+		int sy0 = std::max((int) std::floor(y0 + j * step), box.yMin);
+		int sy1 = std::min((int) std::ceil(y0 + (j + 1) * step), box.yMax + 1);
+		for(int i = 0; i < out.get_xDim(); i++){
+			int sx0 = std::max((int) std::floor(x0 + i * step), box.xMin);
+			int sx1 = std::min((int) std::ceil(x0 + (i + 1) * step), box.xMax + 1);
+			T v = 0;
+			for(int sy = sy0; sy < sy1; sy++){
+				for(int sx = sx0; sx < sx1; sx++){
+					v = std::max(v, img(sx, sy));
+				}
+			}
+			out(i, j) = v;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef SPARSE_MATMUL_H
+#define SPARSE_MATMUL_H
+
+#include "uTensor/core/tensor.hpp"
+#include "uTensor/core/context.hpp"
+#include "uTensor/ops/MatrixOps.hpp"
+
+/**
+ * @brief Fraction of activations that are not at the zero point
+ *
+ * @param A quantized activations
+ * @param offset_a quantized value of 0.0f
+ */
+template<class T1>
+float activation_density(S_TENSOR A, int32_t offset_a){
+	const T1* a = A->read<T1>(0, 0);
+	uint32_t size = A->getSize();
+	uint32_t nz = 0;
+	for(uint32_t i = 0; i < size; i++){
+		if((int32_t) a[i] != offset_a) nz++;
+	}
+	return size ? (float) nz / size : 0.0f;
+}
+
+/**
+ * @brief Quantized matmul that skips zero activations
+ * @details Same contract as uTensor's QuantizedMatMul: C = (A - offset_a) x
+ * (B - offset_b), A is [m, k], B is [k, n]. Only the rows of B that match a
+ * non-zero activation are accumulated, so the cost scales with the number
+ * of non-zero activations instead of k. The B zero point is folded into
+ * one correction per output row. Nothing is allocated on the heap.
+ */
+template<class T1, class T2, class TOut>
+void QuantizedSparseMatMul(S_TENSOR A, S_TENSOR B, S_TENSOR C,
+                           S_TENSOR mina, S_TENSOR minb, S_TENSOR maxa,
+                           S_TENSOR maxb, S_TENSOR outmin, S_TENSOR outmax){
+	const float min_a = *(mina->read<float>(0, 0));
+	const float max_a = *(maxa->read<float>(0, 0));
+	const float min_b = *(minb->read<float>(0, 0));
+	const float max_b = *(maxb->read<float>(0, 0));
+
+	const uint32_t m = A->getShape()[0];
+	const uint32_t k = A->getShape()[1];
+	const uint32_t n = B->getShape()[1];
+	if(B->getShape()[0] != k){
+		ERR_EXIT("matmul shape mismatch: %lu vs %lu", (unsigned long) k, (unsigned long) B->getShape()[0]);
+	}
+
+	TensorShape c_shape({m, n});
+	if(C->getSize() == 0) C->resize(c_shape);
+
+	const int32_t offset_a = FloatToQuantizedUnclamped<T1>(0.0f, min_a, max_a);
+	const int32_t offset_b = FloatToQuantizedUnclamped<T2>(0.0f, min_b, max_b);
+
+	const T1* a = A->read<T1>(0, 0);
+	const T2* b = B->read<T2>(0, 0);
+	TOut* c = C->write<TOut>(0, 0);
+
+	for(uint32_t i = 0; i < m; i++){
+		const T1* a_row = a + i * k;
+		TOut* c_row = c + i * n;
+
+		for(uint32_t j = 0; j < n; j++) c_row[j] = 0;
+
+		int32_t a_sum = 0;
+		for(uint32_t kk = 0; kk < k; kk++){
+			const int32_t av = (int32_t) a_row[kk] - offset_a;
+			if(av == 0) continue;
+			const T2* b_row = b + kk * n;
+			a_sum += av;
+			for(uint32_t j = 0; j < n; j++){
+				c_row[j] += av * (int32_t) b_row[j];
+			}
+		}
+
+		const int32_t correction = a_sum * offset_b;
+		for(uint32_t j = 0; j < n; j++) c_row[j] -= correction;
+	}
+
+	float min_c_value;
+	float max_c_value;
+	QuantizationRangeForMultiplication<T1, T2, TOut>(
+		min_a, max_a, min_b, max_b, &min_c_value, &max_c_value);
+
+	*(outmin->write<float>(0, 0)) = min_c_value;
+	*(outmax->write<float>(0, 0)) = max_c_value;
+}
+
+/**
+ * @brief Drop-in replacement for QntMatMulOp
+ * @details Measures the density of the activation input first. Above
+ * dense_above the reference dense kernel is used, otherwise the zero
+ * skipping one.
+ *
+ * Inputs: A, min_a, max_a, B, min_b, max_b
+ * Outputs: C, min_c, max_c
+ */
+template<class T1, class T2, class TOut>
+class QntSparseMatMulOp : public Operator {
+	private:
+		float dense_above;
+
+	public:
+		QntSparseMatMulOp(float _dense_above = 0.6f) : dense_above(_dense_above) {
+			n_inputs = 6;
+			n_outputs = 3;
+		}
+		virtual void compute() override {
+			const float min_a = *(inputs[1]->read<float>(0, 0));
+			const float max_a = *(inputs[2]->read<float>(0, 0));
+			const int32_t offset_a = FloatToQuantizedUnclamped<T1>(0.0f, min_a, max_a);
+
+			if(activation_density<T1>(inputs[0], offset_a) > dense_above){
+				QuantizedMatMul<T1, T2, TOut>(inputs[0], inputs[3],
+					outputs[0], inputs[1], inputs[4], inputs[2], inputs[5],
+					outputs[1], outputs[2]);
+			} else {
+				QuantizedSparseMatMul<T1, T2, TOut>(inputs[0], inputs[3],
+					outputs[0], inputs[1], inputs[4], inputs[2], inputs[5],
+					outputs[1], outputs[2]);
+			}
+		}
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef TOUCH_RING_H
+#define TOUCH_RING_H
+
+#include <stdint.h>
+#include <atomic>
+
+typedef struct {
+    uint32_t t_us;     // sample time, microseconds
+    uint16_t x;
+    uint16_t y;
+    uint8_t down;      // 0 marks the end of a stroke
+} touch_sample_t;
+
+/**
+ * @brief Lock-free single producer / single consumer queue of touch samples
+ * @details The producer (a ticker interrupt) only writes head, the consumer
+ * (the main loop) only writes tail, so no locking is needed. Indices run
+ * freely and are masked on access, so N must be a power of two. When the
+ * queue is full new samples are dropped and counted in overflows().
+ *
+ * @tparam N capacity in samples
+ */
+template<uint16_t N>
+class TouchRing {
+    static_assert(N && (N & (N - 1)) == 0, "TouchRing size must be a power of two");
+
+	private:
+		touch_sample_t buf[N];
+		std::atomic<uint16_t> head;
+		std::atomic<uint16_t> tail;
+		std::atomic<uint32_t> dropped;
+
+	public:
+		TouchRing() : head(0), tail(0), dropped(0) {}
+
+		// Producer side
+		bool push(const touch_sample_t& s){
+			uint16_t h = head.load(std::memory_order_relaxed);
+			if((uint16_t)(h - tail.load(std::memory_order_acquire)) == N){
+				dropped.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			buf[h & (N - 1)] = s;
+			head.store(h + 1, std::memory_order_release);
+			return true;
+		}
+
+		// Consumer side, returns the number of samples copied into out
+		uint16_t pop(touch_sample_t* out, uint16_t max){
+			uint16_t t = tail.load(std::memory_order_relaxed);
+			uint16_t avail = head.load(std::memory_order_acquire) - t;
+			uint16_t n = avail < max ? avail : max;
+			for(uint16_t i = 0; i < n; i++){
+				out[i] = buf[(uint16_t)(t + i) & (N - 1)];
+			}
+			tail.store(t + n, std::memory_order_release);
+			return n;
+		}
+
+		uint16_t size(void) const {
+			return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+		}
+
+		uint32_t overflows(void) const { return dropped.load(std::memory_order_relaxed); }
+};
+
+#endif
@@ -0,0 +1,40 @@
+#include "touch_source.h"
+
+#ifdef __MBED__
+
+#include "mbed.h"
+#include "stm32f413h_discovery_ts.h"
+
+bool touch_source_read(touch_sample_t& s){
+    TS_StateTypeDef state = {0};
+    BSP_TS_GetState(&state);
+    if(!state.touchDetected) return false;
+    s.x = state.touchX[0];
+    s.y = state.touchY[0];
+    return true;
+}
+
+uint32_t touch_source_now_us(void){
+    return us_ticker_read();
+}
+
+#else
+
+#include <chrono>
+
+static touch_stub_fn stub = nullptr;
+
+void touch_source_set_stub(touch_stub_fn fn){
+    stub = fn;
+}
+
+bool touch_source_read(touch_sample_t& s){
+    return stub ? stub(s) : false;
+}
+
+uint32_t touch_source_now_us(void){
+    using namespace std::chrono;
+    return (uint32_t) duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef TOUCH_SOURCE_H
+#define TOUCH_SOURCE_H
+
+#include <stdint.h>
+#include "touch_ring.h"
+
+/*
+ * Where touch samples come from. On the board this is the BSP touch
+ * controller; on the host a stub callback supplies them instead.
+ */
+
+/**
+ * @brief Read the touch controller once
+ * @details Safe to call from interrupt context. Fills s and returns true
+ * when a finger is down.
+ */
+bool touch_source_read(touch_sample_t& s);
+
+/**
+ * @brief Microsecond timestamp used for touch samples
+ */
+uint32_t touch_source_now_us(void);
+
+#ifndef __MBED__
+typedef bool (*touch_stub_fn)(touch_sample_t& s);
+
+// Replace the host touch source, nullptr means "never touched"
+void touch_source_set_stub(touch_stub_fn fn);
+#endif
+
+/**
+ * @brief Poll the source and queue what changed
+ * @details Queues every sample while the finger is down and one sample with
+ * down = 0 when it is lifted. Intended to run from a Ticker.
+ */
+template<uint16_t N>
+void touch_sample_into(TouchRing<N>& ring){
+    static bool was_down = false;
+    touch_sample_t s;
+    s.t_us = touch_source_now_us();
+    bool down = touch_source_read(s);
+    if(down){
+        s.down = 1;
+        ring.push(s);
+    } else if(was_down){
+        s.x = 0;
+        s.y = 0;
+        s.down = 0;
+        ring.push(s);
+    }
+    was_down = down;
+}
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef VIEW_TENSOR_H
+#define VIEW_TENSOR_H
+
+#include "uTensor/core/tensor.hpp"
+#include "uTensor/core/context.hpp"
+
+/**
+ * @brief Tensor that aliases the storage of another tensor
+ * @details A view owns no data. It holds a reference to its source, so the
+ * source stays alive for as long as the view does, and forwards every
+ * read/write to it. Only the shape differs. The element count of the view
+ * must match the element count of its source.
+ *
+ * Writes through a view of a BinaryTensor return nullptr, the same way the
+ * BinaryTensor does.
+ *
+ * @tparam T element type, must match the source
+ */
+template<class T>
+class ViewTensor : public Tensor {
+	private:
+		S_TENSOR src;
+
+	public:
+		ViewTensor() : Tensor() {}
+		ViewTensor(S_TENSOR that, TensorShape shape) : Tensor() {
+			bind(that, shape);
+		}
+
+		void bind(S_TENSOR that, TensorShape& shape){
+			uint32_t total = 1;
+			for(auto d : shape) total *= d;
+			if(total != that->getSize()){
+				ERR_EXIT("view of %lu elements on a tensor of %lu", (unsigned long) total, (unsigned long) that->getSize());
+			}
+			src = that;
+			s->shape = shape;
+			s->total_size = total;
+		}
+
+		virtual void* read(size_t offset, size_t ele) override {
+			return (void*) src->read<T>(offset, ele);
+		}
+		virtual void* write(size_t offset, size_t ele) override {
+			return (void*) src->write<T>(offset, ele);
+		}
+		virtual uint16_t unit_size(void) override { return sizeof(T); }
+};
+
+/**
+ * @brief Tensor over caller owned memory
+ * @details Reads and writes go straight to buffer, which must hold as many
+ * elements as the shape and outlive the tensor. Nothing is allocated for
+ * the data and nothing is freed.
+ */
+template<class T>
+class BufferTensor : public Tensor {
+	private:
+		T* buf;
+
+	public:
+		BufferTensor(T* buffer, TensorShape shape) : Tensor(), buf(buffer) {
+			uint32_t total = 1;
+			for(auto d : shape) total *= d;
+			s->shape = shape;
+			s->total_size = total;
+		}
+
+		virtual void* read(size_t offset, size_t ele) override {
+			return (void*) (buf + offset);
+		}
+		virtual void* write(size_t offset, size_t ele) override {
+			return (void*) (buf + offset);
+		}
+		virtual uint16_t unit_size(void) override { return sizeof(T); }
+};
+
+/**
+ * @brief Drop-in replacement for ReshapeOp that binds its output, which must
+ * be a ViewTensor<T>, to the input instead of copying the data.
+ *
+ * Inputs: data, shape (int, one dimension may be -1)
+ */
+template<class T>
+class ReshapeViewOp : public Operator {
+	public:
+		ReshapeViewOp() {
+			n_inputs = 2;
+			n_outputs = 1;
+		}
+		virtual void compute() override {
+			S_TENSOR input = inputs[0];
+			S_TENSOR dims = inputs[1];
+			const int* d = dims->read<int>(0, 0);
+
+			TensorShape shape;
+			int infer = -1;
+			uint32_t known = 1;
+			for(uint32_t i = 0; i < dims->getSize(); i++){
+				if(d[i] < 0){
+					infer = i;
+					shape.push_back(1);
+				} else {
+					shape.push_back(d[i]);
+					known *= d[i];
+				}
+			}
+			if(infer >= 0) shape[infer] = input->getSize() / known;
+
+			static_cast<ViewTensor<T>*>(outputs[0].get())->bind(input, shape);
+		}
+};
+
+#endif